@@ -0,0 +1,20 @@
+-- add egl package
+option("egl")
+
+    -- show menu
+    set_showmenu(true)
+
+    -- set category
+    set_category("package")
+
+    -- set description
+    set_description("The egl package", "  the gl device can be benchmarked on the offscreen egl surface, e.g. the headless mesa")
+    
+    -- add defines to config.h if checking ok
+    add_defines_h_if_ok("$(prefix)_PACKAGE_HAVE_EGL")
+
+    -- add links for checking
+    add_links("EGL")
+
+    -- add c includes for checking
+    add_cincludes("EGL/egl.h")
@@ -0,0 +1,206 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the view size
+#define GB_DEMO_CORE_BITMAP_VIEW_SIZE       (256)
+
+// the padding bytes of the parent rows
+#define GB_DEMO_CORE_BITMAP_VIEW_PADDING    (64)
+
+// the padding byte
+#define GB_DEMO_CORE_BITMAP_VIEW_PADBYTE    (0xcd)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_demo_core_bitmap_view_draw(gb_bitmap_ref_t bitmap, gb_path_ref_t* paths, tb_size_t count, tb_size_t index)
+{
+    // init canvas
+    gb_canvas_ref_t canvas = gb_canvas_init_from_bitmap(bitmap);
+    tb_check_return(canvas);
+
+    // fit the tiger to the view
+    gb_canvas_scale(canvas, gb_idiv(GB_DEMO_CORE_BITMAP_VIEW_SIZE, 640), gb_idiv(GB_DEMO_CORE_BITMAP_VIEW_SIZE, 640));
+
+    // draw the tiger with the different color for each view
+    gb_canvas_mode_set(canvas, GB_PAINT_MODE_FILL);
+    gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+    tb_size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        gb_canvas_color_set(canvas, (i & 1)? GB_COLOR_BLACK : ((index & 1)? GB_COLOR_BLUE : GB_COLOR_RED));
+        if (paths[i]) gb_canvas_draw_path(canvas, paths[i]);
+    }
+
+    // exit canvas
+    gb_canvas_exit(canvas);
+}
+static tb_bool_t gb_demo_core_bitmap_view_same(gb_bitmap_ref_t bitmap, gb_bitmap_ref_t view)
+{
+    // the row bytes
+    tb_size_t row_bytes = gb_bitmap_width(bitmap) * 4;
+    tb_assert_and_check_return_val(gb_bitmap_width(bitmap) == gb_bitmap_width(view) && gb_bitmap_height(bitmap) == gb_bitmap_height(view), tb_false);
+
+    // compare all rows
+    tb_size_t           height = gb_bitmap_height(bitmap);
+    tb_byte_t const*    data = (tb_byte_t const*)gb_bitmap_data(bitmap);
+    tb_byte_t const*    view_data = (tb_byte_t const*)gb_bitmap_data(view);
+    while (height--)
+    {
+        if (tb_memcmp(data, view_data, row_bytes)) return tb_false;
+        data += gb_bitmap_row_bytes(bitmap);
+        view_data += gb_bitmap_row_bytes(view);
+    }
+
+    // ok
+    return tb_true;
+}
+static tb_bool_t gb_demo_core_bitmap_view_resize(tb_byte_t* data, tb_size_t size, tb_size_t row_bytes)
+{
+    // init the owned bitmap
+    gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, size, size, 0, tb_false);
+    tb_check_return_val(bitmap, tb_false);
+
+    // done
+    tb_bool_t ok = tb_false;
+    do
+    {
+        // set the new owned data, it will be freed by the bitmap
+        tb_byte_t* owned = tb_malloc0_bytes(size * size * 4);
+        tb_assert_and_check_break(owned);
+        if (!gb_bitmap_data_set(bitmap, owned, GB_PIXFMT_XRGB8888, size, size, 0, tb_false))
+        {
+            tb_free(owned);
+            break;
+        }
+
+        // attach the external data with the padded rows, it will be not freed by the bitmap
+        tb_check_break(gb_bitmap_data_attach(bitmap, data, GB_PIXFMT_XRGB8888, size, size, row_bytes, tb_false));
+
+        // resize it to be smaller and larger again within the external data
+        tb_check_break(gb_bitmap_resize(bitmap, size >> 1, size >> 2));
+        tb_check_break(gb_bitmap_size(bitmap) == (size >> 2) * row_bytes);
+        tb_check_break(gb_bitmap_resize(bitmap, size, size));
+        tb_check_break(gb_bitmap_size(bitmap) == size * row_bytes);
+
+        // cannot grow beyond the external data
+        tb_check_break(!gb_bitmap_resize(bitmap, size, size + 1));
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // exit bitmap
+    gb_bitmap_exit(bitmap);
+
+    // ok?
+    return ok;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * render the tiger into the four views of the padded parent bitmap without copying
+ *
+ * xmake r demo core_bitmap_view
+ */
+tb_int_t gb_demo_core_bitmap_view_main(tb_int_t argc, tb_char_t** argv)
+{
+    // init paths
+    tb_size_t       index = 0;
+    tb_size_t       count = tb_arrayn(g_demo_tiger) >> 1;
+    gb_path_ref_t   paths[tb_arrayn(g_demo_tiger) >> 1];
+    for (index = 0; index < count; index++)
+        paths[index] = gb_path_init_from_svg_data(g_demo_tiger[(index << 1) + 1]);
+
+    // init the external data with the padded rows, e.g. the buffer from the compositor
+    tb_size_t   size = GB_DEMO_CORE_BITMAP_VIEW_SIZE << 1;
+    tb_size_t   row_bytes = size * 4 + GB_DEMO_CORE_BITMAP_VIEW_PADDING;
+    tb_byte_t*  data = tb_malloc_bytes(row_bytes * size);
+    if (data)
+    {
+        // fill the padding bytes
+        tb_memset(data, GB_DEMO_CORE_BITMAP_VIEW_PADBYTE, row_bytes * size);
+
+        // init the parent bitmap and the standalone bitmaps for comparing
+        gb_bitmap_ref_t parent = gb_bitmap_init(data, GB_PIXFMT_XRGB8888, size, size, row_bytes, tb_false);
+        gb_bitmap_ref_t bitmaps[2];
+        for (index = 0; index < 2; index++)
+            bitmaps[index] = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_BITMAP_VIEW_SIZE, GB_DEMO_CORE_BITMAP_VIEW_SIZE, 0, tb_false);
+        if (parent && bitmaps[0] && bitmaps[1])
+        {
+            // draw the standalone bitmaps
+            for (index = 0; index < 2; index++)
+                gb_demo_core_bitmap_view_draw(bitmaps[index], paths, count, index);
+
+            // draw the views and compare them
+            tb_size_t failed = 0;
+            tb_size_t versions = 0;
+            tb_hong_t time = tb_mclock();
+            for (index = 0; index < 4; index++)
+            {
+                // init view
+                gb_bitmap_ref_t view = gb_bitmap_init_view(parent, (index & 1) * GB_DEMO_CORE_BITMAP_VIEW_SIZE, (index >> 1) * GB_DEMO_CORE_BITMAP_VIEW_SIZE, GB_DEMO_CORE_BITMAP_VIEW_SIZE, GB_DEMO_CORE_BITMAP_VIEW_SIZE);
+                if (view)
+                {
+                    // draw it, the parent version must be changed for the cached textures
+                    tb_size_t version = gb_bitmap_version(parent);
+                    gb_demo_core_bitmap_view_draw(view, paths, count, index);
+                    if (gb_bitmap_version(parent) == version) versions++;
+
+                    // the same as the standalone bitmap?
+                    if (!gb_demo_core_bitmap_view_same(bitmaps[index & 1], view)) failed++;
+
+                    // modify the parent, the view version must be changed too
+                    version = gb_bitmap_version(view);
+                    gb_bitmap_modified(parent);
+                    if (gb_bitmap_version(view) == version) versions++;
+
+                    // exit view
+                    gb_bitmap_exit(view);
+                }
+                else failed++;
+            }
+            time = tb_mclock() - time;
+
+            // the padding bytes are not modified?
+            tb_size_t padding = 0;
+            for (index = 0; index < size; index++)
+            {
+                tb_byte_t const*    p = data + index * row_bytes + size * 4;
+                tb_byte_t const*    e = p + GB_DEMO_CORE_BITMAP_VIEW_PADDING;
+                while (p < e) if (*p++ != GB_DEMO_CORE_BITMAP_VIEW_PADBYTE) padding++;
+            }
+
+            // trace
+            tb_trace_i("views: 4, size: %lux%lu, row_bytes: %lu, time: %lld ms", size, size, row_bytes, time);
+            tb_trace_i("views: %s, padding: %s, versions: %s", failed? "failed" : "ok", padding? "failed" : "ok", versions? "failed" : "ok");
+
+            // resize the bitmap with the attached data
+            tb_trace_i("resize: %s", gb_demo_core_bitmap_view_resize(data, size, row_bytes)? "ok" : "failed");
+        }
+
+        // exit bitmaps
+        for (index = 0; index < 2; index++)
+            if (bitmaps[index]) gb_bitmap_exit(bitmaps[index]);
+        if (parent) gb_bitmap_exit(parent);
+
+        // exit data
+        tb_free(data);
+    }
+
+    // exit paths
+    for (index = 0; index < count; index++)
+    {
+        if (paths[index]) gb_path_exit(paths[index]);
+    }
+    return 0;
+}
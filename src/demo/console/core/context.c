@@ -0,0 +1,239 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the canvas size
+#define GB_DEMO_CORE_CONTEXT_SIZE       (256)
+
+// the maximum threads count
+#define GB_DEMO_CORE_CONTEXT_MAXN       (16)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the context worker type
+typedef struct __gb_demo_core_context_worker_t
+{
+    // the thread
+    tb_thread_ref_t     thread;
+
+    // the frames count
+    tb_size_t           frames;
+
+    // the rendered frames count
+    tb_size_t           rendered;
+
+    // the hash of the last frame
+    tb_uint32_t         hash;
+
+}gb_demo_core_context_worker_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_uint32_t gb_demo_core_context_hash(gb_bitmap_ref_t bitmap)
+{
+    // the bitmap data
+    tb_byte_t const*    data = (tb_byte_t const*)gb_bitmap_data(bitmap);
+    tb_size_t           size = gb_bitmap_size(bitmap);
+
+    // compute the fnv-1a hash
+    tb_uint32_t hash = 2166136261u;
+    while (size--) hash = (hash ^ *data++) * 16777619u;
+
+    // ok
+    return hash;
+}
+static tb_pointer_t gb_demo_core_context_worker(tb_cpointer_t priv)
+{
+    // check
+    gb_demo_core_context_worker_t* worker = (gb_demo_core_context_worker_t*)priv;
+    tb_assert_and_check_return_val(worker, tb_null);
+
+    // init paths, the paths are not shared between threads
+    tb_size_t       index = 0;
+    tb_size_t       count = tb_arrayn(g_demo_tiger) >> 1;
+    gb_path_ref_t   paths[tb_arrayn(g_demo_tiger) >> 1];
+    for (index = 0; index < count; index++)
+        paths[index] = gb_path_init_from_svg_data(g_demo_tiger[(index << 1) + 1]);
+
+    // init context, bitmap and canvas for this thread
+    gb_context_ref_t    context = gb_context_init();
+    gb_bitmap_ref_t     bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_CONTEXT_SIZE, GB_DEMO_CORE_CONTEXT_SIZE, 0, tb_false);
+    gb_canvas_ref_t     canvas = (context && bitmap)? gb_canvas_init_from_bitmap_with_context(bitmap, context) : tb_null;
+    if (canvas)
+    {
+        // fit the tiger to the canvas
+        gb_canvas_scale(canvas, gb_idiv(GB_DEMO_CORE_CONTEXT_SIZE, 640), gb_idiv(GB_DEMO_CORE_CONTEXT_SIZE, 640));
+
+        // init paint
+        gb_canvas_mode_set(canvas, GB_PAINT_MODE_FILL_STROKE);
+        gb_canvas_stroke_width_set(canvas, GB_TWO);
+
+        // render frames
+        tb_size_t frame = 0;
+        for (frame = 0; frame < worker->frames; frame++)
+        {
+            gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+            for (index = 0; index < count; index++)
+            {
+                gb_canvas_color_set(canvas, (index & 1)? GB_COLOR_BLACK : GB_COLOR_RED);
+                if (paths[index]) gb_canvas_draw_path(canvas, paths[index]);
+            }
+            worker->rendered++;
+        }
+
+        // the hash of the last frame
+        worker->hash = gb_demo_core_context_hash(bitmap);
+    }
+
+    // exit canvas, bitmap and context
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+    if (context) gb_context_exit(context);
+
+    // exit paths
+    for (index = 0; index < count; index++)
+    {
+        if (paths[index]) gb_path_exit(paths[index]);
+    }
+
+    // end
+    return tb_null;
+}
+static tb_hong_t gb_demo_core_context_done(tb_size_t threads, tb_size_t frames, tb_uint32_t* hash)
+{
+    // init workers
+    gb_demo_core_context_worker_t workers[GB_DEMO_CORE_CONTEXT_MAXN];
+    tb_memset(workers, 0, sizeof(workers));
+
+    // start workers
+    tb_size_t i = 0;
+    tb_hong_t time = tb_mclock();
+    for (i = 0; i < threads; i++)
+    {
+        workers[i].frames = frames;
+        workers[i].thread = tb_thread_init(tb_null, gb_demo_core_context_worker, &workers[i], 0);
+        tb_assert(workers[i].thread);
+    }
+
+    // wait workers
+    for (i = 0; i < threads; i++)
+    {
+        if (workers[i].thread)
+        {
+            tb_thread_wait(workers[i].thread, -1);
+            tb_thread_exit(workers[i].thread);
+        }
+    }
+    time = tb_mclock() - time;
+
+    // check the rendered frames, all threads must render the same result
+    tb_size_t failed = 0;
+    for (i = 0; i < threads; i++)
+    {
+        if (workers[i].rendered != frames) failed++;
+        else if (!*hash) *hash = workers[i].hash;
+        else if (workers[i].hash != *hash) failed++;
+    }
+
+    // trace
+    tb_trace_i("threads: %lu, frames: %lu, time: %lld ms, %lld frames/s: %s"
+        ,   threads
+        ,   threads * frames
+        ,   time
+        ,   time? ((tb_hong_t)threads * frames * 1000) / time : 0
+        ,   failed? "failed" : "ok");
+
+    // ok?
+    return time;
+}
+static tb_uint32_t gb_demo_core_context_layer(tb_size_t quality)
+{
+    // init context, bitmap and canvas with the given quality
+    tb_uint32_t         hash = 0;
+    gb_context_ref_t    context = gb_context_init();
+    gb_bitmap_ref_t     bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, 16, 16, 0, tb_false);
+    gb_canvas_ref_t     canvas = (context && bitmap)? gb_canvas_init_from_bitmap_with_context(bitmap, context) : tb_null;
+    if (canvas)
+    {
+        // set the quality of this context only
+        gb_context_quality_set(context, quality);
+
+        // draw a nearly transparent layer, it is dropped only for the low quality
+        gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+        if (gb_canvas_save_layer(canvas, tb_null, 12))
+        {
+            gb_canvas_draw_clear(canvas, GB_COLOR_RED);
+            gb_canvas_load_layer(canvas);
+        }
+
+        // the hash of the result
+        hash = gb_demo_core_context_hash(bitmap);
+    }
+
+    // exit canvas, bitmap and context
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+    if (context) gb_context_exit(context);
+
+    // ok
+    return hash;
+}
+static tb_void_t gb_demo_core_context_quality(tb_noarg_t)
+{
+    // the paint flags of the different qualities
+    tb_bool_t       ok = tb_false;
+    gb_paint_ref_t  paint = gb_paint_init();
+    if (paint)
+    {
+        ok =    (gb_paint_flag_with_quality(paint, GB_QUALITY_LOW) & GB_PAINT_FLAG_ANTIALIASING) == 0
+            &&  (gb_paint_flag_with_quality(paint, GB_QUALITY_TOP) & GB_PAINT_FLAG_ANTIALIASING) != 0;
+        gb_paint_exit(paint);
+    }
+
+    // the layers of the two contexts with the different qualities must be composited differently
+    ok = ok && gb_demo_core_context_layer(GB_QUALITY_LOW) != gb_demo_core_context_layer(GB_QUALITY_TOP);
+
+    // trace
+    tb_trace_i("quality: %s", ok? "ok" : "failed");
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * render the tiger from the multiple threads, one context and canvas for each thread
+ *
+ * xmake r demo core_context [frames] [threads]
+ */
+tb_int_t gb_demo_core_context_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the frames count for each thread
+    tb_size_t frames = argv[1]? tb_atoi(argv[1]) : 20;
+    tb_check_return_val(frames, 0);
+
+    // the maximum threads count
+    tb_size_t maxn = (argv[1] && argv[2])? tb_atoi(argv[2]) : 8;
+    tb_check_return_val(maxn, 0);
+    if (maxn > GB_DEMO_CORE_CONTEXT_MAXN) maxn = GB_DEMO_CORE_CONTEXT_MAXN;
+
+    // check the quality of the different contexts
+    gb_demo_core_context_quality();
+
+    // done
+    tb_size_t   threads = 1;
+    tb_uint32_t hash = 0;
+    while (threads <= maxn)
+    {
+        gb_demo_core_context_done(threads, frames, &hash);
+        threads <<= 1;
+    }
+    return 0;
+}
@@ -0,0 +1,234 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the canvas size
+#define GB_DEMO_CORE_DENSITY_SIZE       (512)
+
+// the maximum threads count
+#define GB_DEMO_CORE_DENSITY_MAXN       (16)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the density worker type
+typedef struct __gb_demo_core_density_worker_t
+{
+    // the thread
+    tb_thread_ref_t     thread;
+
+    // the density of this thread
+    gb_density_ref_t    density;
+
+    // the points
+    gb_point_ref_t      points;
+
+    // the points count
+    tb_size_t           count;
+
+}gb_demo_core_density_worker_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_long_t gb_demo_core_density_random(tb_uint32_t* seed)
+{
+    // the xorshift generator, the period of the default random generator is too short for millions of points
+    tb_uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+
+    // the random value in [-64, 64)
+    return (tb_long_t)(x & 127) - 64;
+}
+static tb_void_t gb_demo_core_density_make(gb_point_ref_t points, tb_size_t count)
+{
+    // make the clusters, some points are out of the canvas
+    tb_size_t   i;
+    tb_uint32_t seed = 2463534242u;
+    for (i = 0; i < count; i++)
+    {
+        // the cluster center
+        tb_long_t cx = (i & 3) * (GB_DEMO_CORE_DENSITY_SIZE / 3);
+        tb_long_t cy = ((i >> 2) & 1)? GB_DEMO_CORE_DENSITY_SIZE / 3 : (GB_DEMO_CORE_DENSITY_SIZE * 2) / 3;
+
+        // the approximate normal distribution
+        tb_long_t dx = gb_demo_core_density_random(&seed) + gb_demo_core_density_random(&seed) + gb_demo_core_density_random(&seed);
+        tb_long_t dy = gb_demo_core_density_random(&seed) + gb_demo_core_density_random(&seed) + gb_demo_core_density_random(&seed);
+        gb_point_imake(points + i, cx + dx, cy + dy);
+    }
+}
+static tb_pointer_t gb_demo_core_density_worker(tb_cpointer_t priv)
+{
+    // check
+    gb_demo_core_density_worker_t* worker = (gb_demo_core_density_worker_t*)priv;
+    tb_assert_and_check_return_val(worker && worker->density, tb_null);
+
+    // bin the points of this part
+    gb_density_done(worker->density, tb_null, worker->points, worker->count);
+
+    // end
+    return tb_null;
+}
+static tb_bool_t gb_demo_core_density_done(gb_density_ref_t density, gb_point_ref_t points, tb_size_t count, tb_size_t threads)
+{
+    // init workers
+    gb_demo_core_density_worker_t workers[GB_DEMO_CORE_DENSITY_MAXN];
+    tb_memset(workers, 0, sizeof(workers));
+
+    // start workers, bin each part into the density of each thread
+    tb_size_t i = 0;
+    tb_size_t part = count / threads;
+    tb_bool_t ok = tb_true;
+    for (i = 0; i < threads; i++)
+    {
+        workers[i].density  = gb_density_init(gb_density_width(density), gb_density_height(density));
+        workers[i].points   = points + i * part;
+        workers[i].count    = (i + 1 == threads)? count - i * part : part;
+        workers[i].thread   = workers[i].density? tb_thread_init(tb_null, gb_demo_core_density_worker, &workers[i], 0) : tb_null;
+        if (!workers[i].thread) ok = tb_false;
+    }
+
+    // wait workers and merge the densities
+    for (i = 0; i < threads; i++)
+    {
+        if (workers[i].thread)
+        {
+            tb_thread_wait(workers[i].thread, -1);
+            tb_thread_exit(workers[i].thread);
+            if (!gb_density_merge(density, workers[i].density)) ok = tb_false;
+        }
+        if (workers[i].density) gb_density_exit(workers[i].density);
+    }
+
+    // ok?
+    return ok;
+}
+static tb_uint32_t gb_demo_core_density_overlap(tb_size_t repeat, tb_byte_t alpha, tb_bool_t layer)
+{
+    // init bitmap and canvas
+    tb_uint32_t     pixel = 0;
+    gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, 16, 16, 0, tb_false);
+    gb_canvas_ref_t canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+    if (canvas)
+    {
+        // the same point for several times
+        tb_size_t   i = 0;
+        gb_point_t  points[4];
+        for (i = 0; i < repeat && i < tb_arrayn(points); i++) gb_point_imake(points + i, 8, 8);
+
+        // draw the wide points with the given alpha
+        gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+        if (!layer || gb_canvas_save_layer(canvas, tb_null, 0x80))
+        {
+            gb_canvas_mode_set(canvas, GB_PAINT_MODE_STROKE);
+            gb_canvas_color_set(canvas, GB_COLOR_RED);
+            gb_canvas_alpha_set(canvas, alpha);
+            gb_canvas_stroke_width_set(canvas, gb_long_to_float(5));
+            gb_canvas_stroke_cap_set(canvas, GB_PAINT_STROKE_CAP_ROUND);
+            gb_canvas_draw_points(canvas, points, i);
+            if (layer) gb_canvas_load_layer(canvas);
+        }
+
+        // the center pixel
+        pixel = *((tb_uint32_t const*)((tb_byte_t const*)gb_bitmap_data(bitmap) + 8 * gb_bitmap_row_bytes(bitmap)) + 8);
+    }
+
+    // exit canvas and bitmap
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+
+    // ok
+    return pixel;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * draw the scatter points with the pixel points, the point sprites and the density,
+ * and bin the points from the multiple threads
+ *
+ * xmake r demo core_density [points] [threads]
+ */
+tb_int_t gb_demo_core_density_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the points count and the threads count
+    tb_size_t count     = argv[1]? tb_atoi(argv[1]) : 1000000;
+    tb_size_t threads   = (argv[1] && argv[2])? tb_atoi(argv[2]) : 4;
+    tb_check_return_val(count && threads, 0);
+    if (threads > GB_DEMO_CORE_DENSITY_MAXN) threads = GB_DEMO_CORE_DENSITY_MAXN;
+
+    // init points, bitmap, canvas and densities
+    gb_point_ref_t      points = tb_nalloc_type(count, gb_point_t);
+    gb_bitmap_ref_t     bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_DENSITY_SIZE, GB_DEMO_CORE_DENSITY_SIZE, 0, tb_false);
+    gb_canvas_ref_t     canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+    gb_density_ref_t    density = gb_density_init(GB_DEMO_CORE_DENSITY_SIZE, GB_DEMO_CORE_DENSITY_SIZE);
+    gb_density_ref_t    density_mt = gb_density_init(GB_DEMO_CORE_DENSITY_SIZE, GB_DEMO_CORE_DENSITY_SIZE);
+    if (points && canvas && density && density_mt)
+    {
+        // make the colors from the lowest density to the highest density
+        gb_color_t colors[4];
+        colors[0] = gb_color_make(0xff, 0x60, 0x00, 0x00);
+        colors[1] = gb_color_make(0xff, 0xc0, 0x40, 0x00);
+        colors[2] = gb_color_make(0xff, 0xff, 0xa0, 0x00);
+        colors[3] = gb_color_make(0xff, 0xff, 0xff, 0xc0);
+
+        // make points
+        gb_demo_core_density_make(points, count);
+
+        // draw the pixel points
+        gb_canvas_draw_clear(canvas, GB_COLOR_BLACK);
+        gb_canvas_mode_set(canvas, GB_PAINT_MODE_STROKE);
+        gb_canvas_color_set(canvas, GB_COLOR_WHITE);
+        tb_hong_t time = tb_uclock();
+        gb_canvas_draw_points(canvas, points, count);
+        time = tb_uclock() - time;
+        tb_trace_i("points: %lu, %lld us", count, time);
+
+        // draw the point sprites
+        tb_size_t sprites = tb_min(count, 100000);
+        gb_canvas_stroke_width_set(canvas, gb_long_to_float(5));
+        gb_canvas_stroke_cap_set(canvas, GB_PAINT_STROKE_CAP_ROUND);
+        time = tb_uclock();
+        gb_canvas_draw_points(canvas, points, sprites);
+        time = tb_uclock() - time;
+        tb_trace_i("sprites: %lu, %lld us", sprites, time);
+
+        // bin points and draw the density
+        gb_canvas_draw_clear(canvas, GB_COLOR_BLACK);
+        time = tb_uclock();
+        gb_density_done(density, gb_canvas_matrix(canvas), points, count);
+        gb_canvas_draw_density(canvas, density, colors, tb_arrayn(colors));
+        time = tb_uclock() - time;
+        tb_trace_i("density: %lu, maxn: %lu, %lld us", count, gb_density_maxn(density), time);
+
+        // bin points from the multiple threads
+        time = tb_uclock();
+        tb_bool_t ok = gb_demo_core_density_done(density_mt, points, count, threads);
+        time = tb_uclock() - time;
+        ok = ok && !tb_memcmp(gb_density_counts(density), gb_density_counts(density_mt), GB_DEMO_CORE_DENSITY_SIZE * GB_DEMO_CORE_DENSITY_SIZE * sizeof(tb_uint32_t));
+        tb_trace_i("density: %lu threads, %lld us: %s", threads, time, ok? "ok" : "failed");
+
+        // the overlapped translucent points must not be blended twice
+        ok =    gb_demo_core_density_overlap(1, 0x80, tb_false) == gb_demo_core_density_overlap(3, 0x80, tb_false)
+            &&  gb_demo_core_density_overlap(1, 0xff, tb_true) == gb_demo_core_density_overlap(3, 0xff, tb_true)
+            &&  gb_demo_core_density_overlap(1, 0xff, tb_false) == gb_demo_core_density_overlap(3, 0xff, tb_false);
+        tb_trace_i("overlap: %s", ok? "ok" : "failed");
+    }
+
+    // exit densities, canvas, bitmap and points
+    if (density_mt) gb_density_exit(density_mt);
+    if (density) gb_density_exit(density);
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+    if (points) tb_free(points);
+    return 0;
+}
@@ -0,0 +1,272 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the canvas size
+#define GB_DEMO_CORE_FLOAT_SIZE         (512)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the float benchmark type
+typedef struct __gb_demo_core_float_t
+{
+    // the tiger paths
+    gb_path_ref_t       paths[tb_arrayn(g_demo_tiger) >> 1];
+
+    // the tiger paths count
+    tb_size_t           count;
+
+    // the flattened points count
+    tb_size_t           points;
+
+    // the tessellated polygons count
+    tb_size_t           polygons;
+
+    // the bitmap
+    gb_bitmap_ref_t     bitmap;
+
+    // the canvas
+    gb_canvas_ref_t     canvas;
+
+}gb_demo_core_float_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_demo_core_float_tessellator_func(gb_point_ref_t points, tb_uint16_t count, tb_cpointer_t priv)
+{
+    // count polygons
+    (*((tb_size_t*)priv))++;
+}
+static tb_bool_t gb_demo_core_float_closed(gb_polygon_ref_t polygon)
+{
+    // check
+    tb_check_return_val(polygon && polygon->points && polygon->counts, tb_false);
+
+    // all contours are closed? the tessellator only accepts the closed contours
+    gb_point_ref_t      points = polygon->points;
+    tb_uint16_t const*  counts = polygon->counts;
+    while (*counts)
+    {
+        if (!gb_point_eq(points, points + *counts - 1)) return tb_false;
+        points += *counts++;
+    }
+
+    // ok
+    return tb_true;
+}
+static tb_bool_t gb_demo_core_float_scan()
+{
+    // the parsed svg data and the expected x-coordinate of the line end
+    static struct
+    {
+        tb_char_t const*    data;
+        tb_float_t          x;
+
+    } s_cases[] = 
+    {
+        {   "M0 0L12345.5 1",           12345.5f        }
+    ,   {   "M0 0L-0.25e2 1",           -25.0f          }
+    ,   {   "M0 0L0.000125 1",          0.000125f       }
+#ifndef GB_CONFIG_FLOAT_FIXED
+    ,   {   "M0 0L1234567890 1",        1234567890.0f   }
+    ,   {   "M0 0L12345678901234 1",    12345678901234.0f}
+    ,   {   "M0 0L123456789012e-3 1",   123456789.012f  }
+    ,   {   "M0 0L1234567890.75 1",     1234567890.0f   }
+#endif
+    };
+
+    // check all cases
+    tb_bool_t   ok = tb_true;
+    tb_size_t   i = 0;
+    for (i = 0; i < tb_arrayn(s_cases); i++)
+    {
+        // make path
+        gb_path_ref_t path = gb_path_init_from_svg_data(s_cases[i].data);
+        tb_check_continue(path);
+
+        // the parsed x-coordinate
+        gb_point_t point;
+        tb_float_t x = gb_path_last(path, &point)? gb_float_to_tb(point.x) : 0;
+
+        // check it, the float only keeps 24-bits and the fixed only keeps 16-bits fraction
+        tb_float_t e = x > s_cases[i].x? x - s_cases[i].x : s_cases[i].x - x;
+        tb_float_t a = s_cases[i].x > 0? s_cases[i].x : -s_cases[i].x;
+        if (e > a * 1e-6f && e > 1e-4f)
+        {
+            tb_trace_e("scan: %s => %f, expected: %f", s_cases[i].data, x, s_cases[i].x);
+            ok = tb_false;
+        }
+
+        // exit path
+        gb_path_exit(path);
+    }
+
+    // ok?
+    return ok;
+}
+static tb_hong_t gb_demo_core_float_path(gb_demo_core_float_t* bench)
+{
+    // exit the previous paths
+    tb_size_t index = 0;
+    for (index = 0; index < bench->count; index++)
+    {
+        if (bench->paths[index]) gb_path_exit(bench->paths[index]);
+        bench->paths[index] = tb_null;
+    }
+
+    // build paths and flatten curves
+    tb_hong_t time = tb_uclock();
+    bench->count    = tb_arrayn(g_demo_tiger) >> 1;
+    bench->points   = 0;
+    for (index = 0; index < bench->count; index++)
+    {
+        // make path
+        gb_path_ref_t path = gb_path_init_from_svg_data(g_demo_tiger[(index << 1) + 1]);
+        tb_check_continue(path);
+
+        // make polygon
+        gb_polygon_ref_t polygon = gb_path_polygon(path);
+        if (polygon)
+        {
+            tb_uint16_t const* counts = polygon->counts;
+            while (*counts) bench->points += *counts++;
+        }
+
+        // save path
+        bench->paths[index] = path;
+    }
+
+    // ok
+    return tb_uclock() - time;
+}
+static tb_hong_t gb_demo_core_float_tessellate(gb_demo_core_float_t* bench)
+{
+    // init tessellator
+    gb_tessellator_ref_t tessellator = gb_tessellator_init();
+    tb_check_return_val(tessellator, 0);
+
+    // init tessellator
+    bench->polygons = 0;
+    gb_tessellator_mode_set(tessellator, GB_TESSELLATOR_MODE_CONVEX);
+    gb_tessellator_rule_set(tessellator, GB_TESSELLATOR_RULE_NONZERO);
+    gb_tessellator_func_set(tessellator, gb_demo_core_float_tessellator_func, &bench->polygons);
+
+    // tessellate all polygons
+    tb_size_t index = 0;
+    tb_hong_t time = tb_uclock();
+    for (index = 0; index < bench->count; index++)
+    {
+        gb_path_ref_t path = bench->paths[index];
+        if (path && gb_demo_core_float_closed(gb_path_polygon(path))) 
+            gb_tessellator_done(tessellator, gb_path_polygon(path), gb_path_bounds(path));
+    }
+    time = tb_uclock() - time;
+
+    // exit tessellator
+    gb_tessellator_exit(tessellator);
+
+    // ok
+    return time;
+}
+static tb_hong_t gb_demo_core_float_draw(gb_demo_core_float_t* bench, tb_size_t mode)
+{
+    // init paint
+    gb_canvas_save_paint(bench->canvas);
+    gb_canvas_mode_set(bench->canvas, mode);
+    gb_canvas_color_set(bench->canvas, GB_COLOR_BLACK);
+    gb_canvas_stroke_width_set(bench->canvas, GB_TWO);
+
+    // draw all paths
+    tb_size_t index = 0;
+    tb_hong_t time = tb_uclock();
+    gb_canvas_draw_clear(bench->canvas, GB_COLOR_WHITE);
+    for (index = 0; index < bench->count; index++)
+    {
+        gb_path_ref_t path = bench->paths[index];
+        if (path) gb_canvas_draw_path(bench->canvas, path);
+    }
+    time = tb_uclock() - time;
+
+    // load paint
+    gb_canvas_load_paint(bench->canvas);
+
+    // ok
+    return time;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * compare the numeric backends by running it on both builds, e.g.
+ *
+ * xmake f --fixed=y && xmake && xmake r demo core_float
+ * xmake f --fixed=n && xmake && xmake r demo core_float
+ *
+ * the polygon raster always steps the edges in fixed-point,
+ * so the fixed option only switches the geometry, stroker and tessellator.
+ */
+tb_int_t gb_demo_core_float_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the frames count
+    tb_size_t frames = argv[1]? tb_atoi(argv[1]) : 20;
+    tb_check_return_val(frames, 0);
+
+    // check the number parser first
+    tb_trace_i("scan: %s", gb_demo_core_float_scan()? "ok" : "failed");
+
+    // init bench
+    gb_demo_core_float_t bench;
+    tb_memset(&bench, 0, sizeof(gb_demo_core_float_t));
+
+    // init bitmap and canvas
+    bench.bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_FLOAT_SIZE, GB_DEMO_CORE_FLOAT_SIZE, 0, tb_false);
+    bench.canvas = bench.bitmap? gb_canvas_init_from_bitmap(bench.bitmap) : tb_null;
+    if (bench.canvas)
+    {
+        // done
+        tb_size_t i = 0;
+        tb_hong_t path = 0;
+        tb_hong_t tessellate = 0;
+        tb_hong_t fill = 0;
+        tb_hong_t stroke = 0;
+        for (i = 0; i < frames; i++)
+        {
+            path        += gb_demo_core_float_path(&bench);
+            tessellate  += gb_demo_core_float_tessellate(&bench);
+            fill        += gb_demo_core_float_draw(&bench, GB_PAINT_MODE_FILL);
+            stroke      += gb_demo_core_float_draw(&bench, GB_PAINT_MODE_STROKE);
+        }
+
+        // trace
+#ifdef GB_CONFIG_FLOAT_FIXED
+        tb_trace_i("float: fixed, frames: %lu", frames);
+#else
+        tb_trace_i("float: float, frames: %lu", frames);
+#endif
+        tb_trace_i("path: %lld us/frame, paths: %lu, points: %lu", path / frames, bench.count, bench.points);
+        tb_trace_i("tessellate: %lld us/frame, polygons: %lu", tessellate / frames, bench.polygons);
+        tb_trace_i("fill: %lld us/frame", fill / frames);
+        tb_trace_i("stroke: %lld us/frame", stroke / frames);
+    }
+
+    // exit paths
+    tb_size_t index = 0;
+    for (index = 0; index < bench.count; index++)
+    {
+        if (bench.paths[index]) gb_path_exit(bench.paths[index]);
+    }
+
+    // exit canvas and bitmap
+    if (bench.canvas) gb_canvas_exit(bench.canvas);
+    if (bench.bitmap) gb_bitmap_exit(bench.bitmap);
+    return 0;
+}
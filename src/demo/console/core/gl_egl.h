@@ -0,0 +1,87 @@
+#ifndef GB_DEMO_CORE_GL_EGL_H
+#define GB_DEMO_CORE_GL_EGL_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#if defined(GB_CONFIG_PACKAGE_HAVE_OPENGL) && defined(GB_CONFIG_PACKAGE_HAVE_EGL)
+#   include <EGL/egl.h>
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the glReadPixels type, it is loaded from egl and we need not the gl headers
+typedef tb_void_t (*gb_demo_core_gl_egl_read_t)(tb_int_t x, tb_int_t y, tb_int_t width, tb_int_t height, tb_uint_t format, tb_uint_t type, tb_pointer_t pixels);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static __tb_inline__ tb_bool_t gb_demo_core_gl_egl_init_with_stencil(tb_size_t width, tb_size_t height, tb_size_t stencil)
+{
+    // init display, uses the surfaceless platform of mesa if EGL_PLATFORM=surfaceless
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    tb_check_return_val(display != EGL_NO_DISPLAY && eglInitialize(display, tb_null, tb_null), tb_false);
+
+    // choose the config with the stencil buffer for the stencil fill mode, no stencil buffer if be zero
+    EGLint      count = 0;
+    EGLConfig   config;
+    EGLint      attributes[] =
+    {
+        EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT
+    ,   EGL_RED_SIZE,           8
+    ,   EGL_GREEN_SIZE,         8
+    ,   EGL_BLUE_SIZE,          8
+    ,   EGL_ALPHA_SIZE,         8
+    ,   EGL_STENCIL_SIZE,       (EGLint)stencil
+    ,   EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT
+    ,   EGL_NONE
+    };
+    tb_check_return_val(eglChooseConfig(display, attributes, &config, 1, &count) && count, tb_false);
+
+    // init the offscreen surface
+    EGLint      sizes[] = {EGL_WIDTH, (EGLint)width, EGL_HEIGHT, (EGLint)height, EGL_NONE};
+    EGLSurface  surface = eglCreatePbufferSurface(display, config, sizes);
+    tb_check_return_val(surface != EGL_NO_SURFACE, tb_false);
+
+    // init the gl context
+    tb_check_return_val(eglBindAPI(EGL_OPENGL_API), tb_false);
+    EGLContext  context = eglCreateContext(display, config, EGL_NO_CONTEXT, tb_null);
+    tb_check_return_val(context != EGL_NO_CONTEXT, tb_false);
+
+    // make it current
+    return eglMakeCurrent(display, surface, surface, context);
+}
+static __tb_inline__ tb_bool_t gb_demo_core_gl_egl_init(tb_size_t width, tb_size_t height)
+{
+    // init it with the 8-bits stencil buffer
+    return gb_demo_core_gl_egl_init_with_stencil(width, height, 8);
+}
+static __tb_inline__ tb_void_t gb_demo_core_gl_egl_exit(tb_noarg_t)
+{
+    // exit the current context and surface
+    EGLDisplay display = eglGetCurrentDisplay();
+    EGLContext context = eglGetCurrentContext();
+    EGLSurface surface = eglGetCurrentSurface(EGL_DRAW);
+    if (display == EGL_NO_DISPLAY) return ;
+
+    // exit it
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (context != EGL_NO_CONTEXT) eglDestroyContext(display, context);
+    if (surface != EGL_NO_SURFACE) eglDestroySurface(display, surface);
+    eglTerminate(display);
+}
+static __tb_inline__ tb_bool_t gb_demo_core_gl_egl_read(tb_size_t x, tb_size_t y, tb_size_t width, tb_size_t height, tb_byte_t* data)
+{
+    // load glReadPixels
+    gb_demo_core_gl_egl_read_t read = (gb_demo_core_gl_egl_read_t)eglGetProcAddress("glReadPixels");
+    tb_check_return_val(read, tb_false);
+
+    // read the rgba pixels from the bottom row: GL_RGBA and GL_UNSIGNED_BYTE
+    read((tb_int_t)x, (tb_int_t)y, (tb_int_t)width, (tb_int_t)height, 0x1908, 0x1401, data);
+    return tb_true;
+}
+
+#endif
+#endif
@@ -0,0 +1,200 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "gl_egl.h"
+#if defined(GB_CONFIG_PACKAGE_HAVE_OPENGL) && defined(GB_CONFIG_PACKAGE_HAVE_EGL)
+#   include "../../core/tiger.g"
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the surface size
+#define GB_DEMO_CORE_GL_FILL_SIZE       (512)
+
+#if defined(GB_CONFIG_PACKAGE_HAVE_OPENGL) && defined(GB_CONFIG_PACKAGE_HAVE_EGL)
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_uint32_t gb_demo_core_gl_fill_hash(tb_size_t width, tb_size_t height)
+{
+    // read the pixels
+    tb_byte_t* data = tb_malloc_bytes(width * height * 4);
+    tb_check_return_val(data, 0);
+    if (!gb_demo_core_gl_egl_read(0, 0, width, height, data))
+    {
+        tb_free(data);
+        return 0;
+    }
+
+    // compute the fnv-1a hash
+    tb_size_t           size = width * height * 4;
+    tb_byte_t const*    p = data;
+    tb_uint32_t         hash = 2166136261u;
+    while (size--) hash = (hash ^ *p++) * 16777619u;
+
+    // exit data
+    tb_free(data);
+
+    // ok
+    return hash;
+}
+static tb_void_t gb_demo_core_gl_fill_draw(gb_canvas_ref_t canvas, gb_path_ref_t* paths, tb_size_t count)
+{
+    // clear it
+    gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+
+    // draw paths
+    tb_size_t index = 0;
+    for (index = 0; index < count; index++)
+    {
+        gb_canvas_fill_rule_set(canvas, (index & 1)? GB_PAINT_FILL_RULE_NONZERO : GB_PAINT_FILL_RULE_ODD);
+        gb_canvas_color_set(canvas, (index & 1)? GB_COLOR_BLACK : GB_COLOR_RED);
+        if (paths[index]) gb_canvas_draw_path(canvas, paths[index]);
+    }
+}
+static tb_void_t gb_demo_core_gl_fill_done(gb_canvas_ref_t canvas, tb_char_t const* name, gb_path_ref_t* paths, tb_size_t count, tb_size_t frames)
+{
+    // done the fill modes
+    tb_size_t   mode = 0;
+    tb_hong_t   times[2] = {0};
+    tb_uint32_t hashes[2] = {0};
+    for (mode = GB_DEVICE_FILL_MODE_TESSELLATOR; mode <= GB_DEVICE_FILL_MODE_STENCIL; mode++)
+    {
+        // set the fill mode
+        gb_device_fill_mode_set(gb_canvas_device(canvas), mode);
+
+        // draw the first frame for caching the programs and textures
+        gb_demo_core_gl_fill_draw(canvas, paths, count);
+        eglWaitClient();
+
+        // draw frames and wait for the gpu
+        tb_size_t frame = 0;
+        tb_hong_t time = tb_uclock();
+        for (frame = 0; frame < frames; frame++) gb_demo_core_gl_fill_draw(canvas, paths, count);
+        eglWaitClient();
+        times[mode] = tb_uclock() - time;
+
+        // the hash of the last frame
+        hashes[mode] = gb_demo_core_gl_fill_hash(GB_DEMO_CORE_GL_FILL_SIZE, GB_DEMO_CORE_GL_FILL_SIZE);
+    }
+
+    // trace, the antialiasing edges of the two modes may be different
+    tb_trace_i("%s: tessellator: %lld us/frame, stencil: %lld us/frame, hash: %08x %08x"
+        ,   name
+        ,   times[GB_DEVICE_FILL_MODE_TESSELLATOR] / frames
+        ,   times[GB_DEVICE_FILL_MODE_STENCIL] / frames
+        ,   hashes[GB_DEVICE_FILL_MODE_TESSELLATOR]
+        ,   hashes[GB_DEVICE_FILL_MODE_STENCIL]);
+}
+static tb_void_t gb_demo_core_gl_fill_shapes(gb_canvas_ref_t canvas, tb_size_t frames)
+{
+    // make the circles and round rects, many contours for each path
+    tb_size_t       i = 0;
+    tb_size_t       j = 0;
+    gb_path_ref_t   paths[8];
+    for (i = 0; i < tb_arrayn(paths); i++)
+    {
+        paths[i] = gb_path_init();
+        if (!paths[i]) continue;
+        for (j = 0; j < 64; j++)
+        {
+            tb_long_t x = (tb_long_t)((j & 7) * 64 + 32 + i);
+            tb_long_t y = (tb_long_t)((j >> 3) * 64 + 32 + i);
+            if (j & 1) gb_path_add_circle2i(paths[i], x, y, 30, GB_ROTATE_DIRECTION_CW);
+            else
+            {
+                gb_rect_t bounds;
+                gb_rect_imake(&bounds, x - 28, y - 28, 56, 56);
+                gb_path_add_round_rect2i(paths[i], &bounds, 12, 12, (i & 1)? GB_ROTATE_DIRECTION_CCW : GB_ROTATE_DIRECTION_CW);
+            }
+        }
+    }
+
+    // done
+    gb_demo_core_gl_fill_done(canvas, "shapes", paths, tb_arrayn(paths), frames);
+
+    // exit paths
+    for (i = 0; i < tb_arrayn(paths); i++)
+    {
+        if (paths[i]) gb_path_exit(paths[i]);
+    }
+}
+static tb_void_t gb_demo_core_gl_fill_tiger(gb_canvas_ref_t canvas, tb_size_t frames)
+{
+    // make the tiger paths
+    tb_size_t       index = 0;
+    tb_size_t       count = tb_arrayn(g_demo_tiger) >> 1;
+    gb_path_ref_t   paths[tb_arrayn(g_demo_tiger) >> 1];
+    for (index = 0; index < count; index++)
+        paths[index] = gb_path_init_from_svg_data(g_demo_tiger[(index << 1) + 1]);
+
+    // fit the tiger to the surface
+    gb_canvas_save_matrix(canvas);
+    gb_canvas_scale(canvas, gb_idiv(GB_DEMO_CORE_GL_FILL_SIZE, 640), gb_idiv(GB_DEMO_CORE_GL_FILL_SIZE, 640));
+
+    // done
+    gb_demo_core_gl_fill_done(canvas, "tiger", paths, count, frames);
+
+    // restore matrix
+    gb_canvas_load_matrix(canvas);
+
+    // exit paths
+    for (index = 0; index < count; index++)
+    {
+        if (paths[index]) gb_path_exit(paths[index]);
+    }
+}
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * benchmark the fill modes of the gl device on the offscreen egl surface,
+ * e.g. the headless mesa: EGL_PLATFORM=surfaceless xmake r demo core_gl_fill [frames] [stencil bits]
+ *
+ * the stencil fill mode will fall back to the tessellator without the stencil buffer,
+ * so the hashes of the two modes are same for zero stencil bits
+ */
+tb_int_t gb_demo_core_gl_fill_main(tb_int_t argc, tb_char_t** argv)
+{
+#if defined(GB_CONFIG_PACKAGE_HAVE_OPENGL) && defined(GB_CONFIG_PACKAGE_HAVE_EGL)
+    // the frames count and the stencil bits
+    tb_size_t frames = argv[1]? tb_atoi(argv[1]) : 100;
+    tb_size_t stencil = (argv[1] && argv[2])? tb_atoi(argv[2]) : 8;
+    tb_check_return_val(frames, 0);
+
+    // init egl
+    if (!gb_demo_core_gl_egl_init_with_stencil(GB_DEMO_CORE_GL_FILL_SIZE, GB_DEMO_CORE_GL_FILL_SIZE, stencil))
+    {
+        // trace
+        tb_trace_e("init egl failed!");
+        return 0;
+    }
+
+    // init device and canvas
+    gb_device_ref_t device = gb_device_init_gl_with_size(GB_PIXFMT_RGBA8888 | GB_PIXFMT_BENDIAN, GB_DEMO_CORE_GL_FILL_SIZE, GB_DEMO_CORE_GL_FILL_SIZE, tb_null);
+    gb_canvas_ref_t canvas = device? gb_canvas_init(device) : tb_null;
+    if (canvas)
+    {
+        // init paint
+        gb_canvas_mode_set(canvas, GB_PAINT_MODE_FILL);
+
+        // benchmark the shapes with many contours and the tiger
+        gb_demo_core_gl_fill_shapes(canvas, frames);
+        gb_demo_core_gl_fill_tiger(canvas, frames);
+
+        // exit canvas, the device is exited with it
+        gb_canvas_exit(canvas);
+    }
+    else if (device) gb_device_exit(device);
+
+    // exit egl
+    gb_demo_core_gl_egl_exit();
+#else
+    // trace
+    tb_trace_e("the opengl and egl packages are not found!");
+#endif
+    return 0;
+}
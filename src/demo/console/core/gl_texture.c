@@ -0,0 +1,175 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "gl_egl.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the surface size
+#define GB_DEMO_CORE_GL_TEXTURE_SIZE        (64)
+
+// the small bitmap size, it is packed into the atlas
+#define GB_DEMO_CORE_GL_TEXTURE_ITEM        (48)
+
+#if defined(GB_CONFIG_PACKAGE_HAVE_OPENGL) && defined(GB_CONFIG_PACKAGE_HAVE_EGL)
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static gb_color_t gb_demo_core_gl_texture_draw(gb_canvas_ref_t canvas, gb_bitmap_ref_t bitmap)
+{
+    // draw the bitmap
+    gb_color_t      color = {0};
+    gb_shader_ref_t shader = gb_shader_init_bitmap(canvas, GB_SHADER_MODE_CLAMP, bitmap);
+    if (shader)
+    {
+        gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+        gb_canvas_shader_set(canvas, shader);
+        gb_canvas_draw_rect2i(canvas, 0, 0, gb_bitmap_width(bitmap), gb_bitmap_height(bitmap));
+        gb_canvas_shader_set(canvas, tb_null);
+        gb_shader_exit(shader);
+    }
+
+    // read the center pixel, the rows are flipped
+    tb_byte_t data[4] = {0};
+    if (gb_demo_core_gl_egl_read(gb_bitmap_width(bitmap) >> 1, GB_DEMO_CORE_GL_TEXTURE_SIZE - 1 - (gb_bitmap_height(bitmap) >> 1), 1, 1, data))
+    {
+        color.r = data[0];
+        color.g = data[1];
+        color.b = data[2];
+        color.a = data[3];
+    }
+
+    // the color
+    return color;
+}
+static tb_bool_t gb_demo_core_gl_texture_same(gb_color_t a, gb_color_t b)
+{
+    // the texture sampling may be a little different
+    return  tb_abs((tb_long_t)a.r - (tb_long_t)b.r) <= 4
+        &&  tb_abs((tb_long_t)a.g - (tb_long_t)b.g) <= 4
+        &&  tb_abs((tb_long_t)a.b - (tb_long_t)b.b) <= 4;
+}
+static tb_bool_t gb_demo_core_gl_texture_view(gb_canvas_ref_t canvas)
+{
+    // init the parent bitmap and its view
+    gb_bitmap_ref_t parent = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_GL_TEXTURE_SIZE, GB_DEMO_CORE_GL_TEXTURE_SIZE, 0, tb_false);
+    gb_bitmap_ref_t view = parent? gb_bitmap_init_view(parent, 0, 0, GB_DEMO_CORE_GL_TEXTURE_SIZE >> 1, GB_DEMO_CORE_GL_TEXTURE_SIZE >> 1) : tb_null;
+    gb_canvas_ref_t bitmap_canvas = parent? gb_canvas_init_from_bitmap(parent) : tb_null;
+
+    // draw the view after modifying the parent, the texture of the view must be uploaded again
+    tb_bool_t ok = tb_false;
+    if (view && bitmap_canvas)
+    {
+        gb_canvas_draw_clear(bitmap_canvas, GB_COLOR_RED);
+        ok = gb_demo_core_gl_texture_same(gb_demo_core_gl_texture_draw(canvas, view), GB_COLOR_RED);
+        gb_canvas_draw_clear(bitmap_canvas, GB_COLOR_BLUE);
+        ok = ok && gb_demo_core_gl_texture_same(gb_demo_core_gl_texture_draw(canvas, view), GB_COLOR_BLUE);
+    }
+
+    // exit bitmaps
+    if (bitmap_canvas) gb_canvas_exit(bitmap_canvas);
+    if (view) gb_bitmap_exit(view);
+    if (parent) gb_bitmap_exit(parent);
+
+    // ok?
+    return ok;
+}
+static tb_size_t gb_demo_core_gl_texture_atlas(gb_canvas_ref_t canvas, tb_size_t count)
+{
+    // init the kept bitmap, it is drawn again after the atlas is reset
+    tb_size_t       failed = 0;
+    gb_bitmap_ref_t kept = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_GL_TEXTURE_ITEM, GB_DEMO_CORE_GL_TEXTURE_ITEM, 0, tb_false);
+    gb_canvas_ref_t kept_canvas = kept? gb_canvas_init_from_bitmap(kept) : tb_null;
+    if (kept_canvas)
+    {
+        gb_canvas_draw_clear(kept_canvas, GB_COLOR_GREEN);
+        gb_canvas_exit(kept_canvas);
+        if (!gb_demo_core_gl_texture_same(gb_demo_core_gl_texture_draw(canvas, kept), GB_COLOR_GREEN)) failed++;
+    }
+    else failed++;
+
+    // draw the many small bitmaps with the different colors, the atlas will be reset for several times
+    tb_size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        // init bitmap
+        gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_GL_TEXTURE_ITEM, GB_DEMO_CORE_GL_TEXTURE_ITEM, 0, tb_false);
+        gb_canvas_ref_t bitmap_canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+        if (bitmap_canvas)
+        {
+            // fill the unique color, the components are spaced for the filtering errors
+            gb_color_t color = gb_color_make(0xff, (tb_byte_t)((i & 0xf) << 4), (tb_byte_t)(((i >> 4) & 0xf) << 4), (tb_byte_t)(((i >> 8) & 0xf) << 4));
+            gb_canvas_draw_clear(bitmap_canvas, color);
+
+            // the drawn texture must be the current bitmap
+            if (!gb_demo_core_gl_texture_same(gb_demo_core_gl_texture_draw(canvas, bitmap), color)) failed++;
+        }
+        else failed++;
+
+        // exit bitmap, the address may be reused by the next bitmap
+        if (bitmap_canvas) gb_canvas_exit(bitmap_canvas);
+        if (bitmap) gb_bitmap_exit(bitmap);
+    }
+
+    // the kept bitmap must be uploaded again
+    if (kept)
+    {
+        if (!gb_demo_core_gl_texture_same(gb_demo_core_gl_texture_draw(canvas, kept), GB_COLOR_GREEN)) failed++;
+        gb_bitmap_exit(kept);
+    }
+
+    // the failed count
+    return failed;
+}
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * check the bitmap textures of the gl device on the offscreen egl surface,
+ * e.g. the headless mesa: EGL_PLATFORM=surfaceless xmake r demo core_gl_texture [count]
+ */
+tb_int_t gb_demo_core_gl_texture_main(tb_int_t argc, tb_char_t** argv)
+{
+#if defined(GB_CONFIG_PACKAGE_HAVE_OPENGL) && defined(GB_CONFIG_PACKAGE_HAVE_EGL)
+    // the small bitmaps count
+    tb_size_t count = argv[1]? tb_atoi(argv[1]) : 2000;
+
+    // init egl
+    if (!gb_demo_core_gl_egl_init(GB_DEMO_CORE_GL_TEXTURE_SIZE, GB_DEMO_CORE_GL_TEXTURE_SIZE))
+    {
+        // trace
+        tb_trace_e("init egl failed!");
+        return 0;
+    }
+
+    // init device and canvas
+    gb_device_ref_t device = gb_device_init_gl_with_size(GB_PIXFMT_RGBA8888 | GB_PIXFMT_BENDIAN, GB_DEMO_CORE_GL_TEXTURE_SIZE, GB_DEMO_CORE_GL_TEXTURE_SIZE, tb_null);
+    gb_canvas_ref_t canvas = device? gb_canvas_init(device) : tb_null;
+    if (canvas)
+    {
+        // init paint
+        gb_canvas_mode_set(canvas, GB_PAINT_MODE_FILL);
+
+        // check the view and atlas
+        tb_bool_t view = gb_demo_core_gl_texture_view(canvas);
+        tb_size_t failed = gb_demo_core_gl_texture_atlas(canvas, count);
+
+        // trace
+        tb_trace_i("view: %s, atlas: %lu bitmaps, %lu failed", view? "ok" : "failed", count, failed);
+
+        // exit canvas, the device is exited with it
+        gb_canvas_exit(canvas);
+    }
+    else if (device) gb_device_exit(device);
+
+    // exit egl
+    gb_demo_core_gl_egl_exit();
+#else
+    // trace
+    tb_trace_e("the opengl and egl packages are not found!");
+#endif
+    return 0;
+}
@@ -0,0 +1,238 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_size_t gb_demo_core_path_data_walk(gb_path_ref_t path, tb_size_t* points)
+{
+    // walk items
+    tb_size_t codes = 0;
+    tb_for_all_if (gb_path_item_ref_t, item, path, item)
+    {
+        codes++;
+        if (item->code != GB_PATH_CODE_CLOS) *points += item->code > GB_PATH_CODE_CLOS? item->code - 1 : 1;
+    }
+
+    // the codes count
+    return codes;
+}
+
+static tb_bool_t gb_demo_core_path_data_pack(tb_char_t const* file, tb_size_t total, tb_size_t codes, tb_size_t points)
+{
+    // init pack
+    gb_path_pack_ref_t pack = gb_path_pack_init(file);
+    tb_check_return_val(pack, tb_false);
+
+    // init all paths
+    tb_size_t       index = 0;
+    tb_size_t       count = gb_path_pack_size(pack);
+    gb_path_ref_t*  paths = count == total? tb_nalloc0_type(count, gb_path_ref_t) : tb_null;
+    if (paths)
+    {
+        for (index = 0; index < count; index++) paths[index] = gb_path_pack_path(pack, index);
+    }
+
+    // exit pack, the paths will keep the mapped file
+    gb_path_pack_exit(pack);
+    tb_check_return_val(paths, tb_false);
+
+    // walk and exit all paths
+    tb_size_t pack_codes = 0;
+    tb_size_t pack_points = 0;
+    for (index = 0; index < count; index++)
+    {
+        if (paths[index])
+        {
+            pack_codes += gb_demo_core_path_data_walk(paths[index], &pack_points);
+            gb_path_exit(paths[index]);
+        }
+    }
+    tb_free(paths);
+
+    // ok?
+    return pack_codes == codes && pack_points == points;
+}
+static tb_size_t gb_demo_core_path_data_corrupt(tb_byte_t const* data, tb_size_t size, tb_size_t* total)
+{
+    // make the corrupted data buffer
+    tb_byte_t* corrupt = tb_malloc_bytes(size);
+    tb_check_return_val(corrupt, 0);
+
+    /* corrupt every byte of the path data, 
+     * it must be rejected or be safe to walk and flatten, e.g. checking it with the address sanitizer
+     */
+    tb_size_t       i = 0;
+    tb_size_t       j = 0;
+    tb_size_t       rejected = 0;
+    tb_byte_t const values[] = {0x00, 0x01, 0x05, 0x7f, 0xff};
+    for (i = 0; i < size; i++)
+    {
+        for (j = 0; j < tb_arrayn(values); j++)
+        {
+            // corrupt it
+            tb_memcpy(corrupt, data, size);
+            tb_check_continue(corrupt[i] != values[j]);
+            corrupt[i] = values[j];
+            (*total)++;
+
+            // load path
+            gb_path_ref_t path = gb_path_init_from_data(corrupt, size);
+            if (path)
+            {
+                // walk and flatten it
+                tb_size_t points = 0;
+                gb_demo_core_path_data_walk(path, &points);
+                gb_path_polygon(path);
+                gb_path_exit(path);
+            }
+            else rejected++;
+        }
+    }
+
+    // exit the corrupted data
+    tb_free(corrupt);
+
+    // the rejected count
+    return rejected;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ */
+tb_int_t gb_demo_core_path_data_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the loading count
+    tb_size_t count = argv[1]? tb_atoi(argv[1]) : 100;
+    tb_check_return_val(count, 0);
+
+    // the data file
+    tb_char_t file[TB_PATH_MAXN] = {0};
+    tb_size_t size = tb_directory_temporary(file, sizeof(file));
+    tb_check_return_val(size && size + 16 < sizeof(file), 0);
+    tb_strcat(file, "/tiger.path");
+
+    // the path data count
+    tb_size_t index = 0;
+    tb_size_t total = tb_arrayn(g_demo_tiger) >> 1;
+
+    // save the tiger paths
+    tb_size_t codes = 0;
+    tb_size_t points = 0;
+    tb_stream_ref_t stream = tb_stream_init_from_file(file, TB_FILE_MODE_RW | TB_FILE_MODE_CREAT | TB_FILE_MODE_BINARY | TB_FILE_MODE_TRUNC);
+    if (stream && tb_stream_open(stream))
+    {
+        for (index = 0; index < total; index++)
+        {
+            // make path
+            gb_path_ref_t path = gb_path_init_from_svg_data(g_demo_tiger[(index << 1) + 1]);
+            if (path)
+            {
+                // walk items
+                codes += gb_demo_core_path_data_walk(path, &points);
+
+                // save path with the flattened polygon
+                gb_path_save(path, stream, GB_PATH_SAVE_FLAG_POLYGON);
+
+                // exit path
+                gb_path_exit(path);
+            }
+        }
+    }
+    if (stream) tb_stream_exit(stream);
+    stream = tb_null;
+
+    // load the whole data
+    tb_byte_t*  data = tb_null;
+    tb_file_ref_t reader = tb_file_init(file, TB_FILE_MODE_RO | TB_FILE_MODE_BINARY);
+    if (reader)
+    {
+        size = (tb_size_t)tb_file_size(reader);
+        data = size? tb_malloc_bytes(size) : tb_null;
+        if (data && !tb_file_read(reader, data, size))
+        {
+            tb_free(data);
+            data = tb_null;
+        }
+        tb_file_exit(reader);
+    }
+    tb_check_return_val(data, 0);
+
+    // check the loaded paths
+    tb_size_t read = 0;
+    tb_size_t loaded = 0;
+    tb_size_t loaded_codes = 0;
+    tb_size_t loaded_points = 0;
+    while (read < size)
+    {
+        // the path data size
+        tb_size_t need = gb_path_data_size(data + read, size - read);
+        tb_check_break(need);
+
+        // load path
+        gb_path_ref_t path = gb_path_init_from_data(data + read, need);
+        if (path)
+        {
+            // walk items
+            loaded_codes += gb_demo_core_path_data_walk(path, &loaded_points);
+            loaded++;
+
+            // exit path
+            gb_path_exit(path);
+        }
+        read += need;
+    }
+
+    // done
+    tb_size_t i = 0;
+    tb_hong_t time = tb_uclock();
+    for (i = 0; i < count; i++)
+    {
+        for (read = 0; read < size; read += index)
+        {
+            // the path data size
+            index = gb_path_data_size(data + read, size - read);
+            tb_assert_and_check_break(index);
+
+            // load path and make polygon
+            gb_path_ref_t path = gb_path_init_from_data(data + read, index);
+            tb_assert_and_check_break(path && gb_path_polygon(path));
+
+            // exit path
+            gb_path_exit(path);
+        }
+    }
+    time = tb_uclock() - time;
+
+    // corrupt the first path
+    tb_size_t corrupted = 0;
+    tb_size_t rejected = gb_demo_core_path_data_corrupt(data, gb_path_data_size(data, size), &corrupted);
+
+    // map the first path from file
+    gb_path_ref_t path = gb_path_init_from_file(file);
+    if (path)
+    {
+        // trace
+        tb_trace_i("file: %s, %lu bytes, first path: %{rect}", file, size, gb_path_bounds(path));
+
+        // exit path
+        gb_path_exit(path);
+    }
+
+    // load all paths from the pack file
+    tb_bool_t pack = gb_demo_core_path_data_pack(file, total, codes, points);
+
+    // trace
+    tb_trace_i("tiger: %lu paths, %lu codes, %lu points", total, codes, points);
+    tb_trace_i("load: %lu paths, %lu codes, %lu points: %s", loaded, loaded_codes, loaded_points, (codes == loaded_codes && points == loaded_points)? "ok" : "no");
+    tb_trace_i("load: %lu times, %lld us, %lld us/tiger", count, time, time / count);
+    tb_trace_i("corrupt: %lu/%lu rejected", rejected, corrupted);
+    tb_trace_i("pack: %s", pack? "ok" : "no");
+
+    // exit data
+    tb_free(data);
+    return 0;
+}
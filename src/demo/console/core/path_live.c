@@ -0,0 +1,201 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_demo_core_path_live_append(gb_path_ref_t path, tb_size_t index)
+{
+    // append the next sample of the telemetry
+    if (index) gb_path_line2i_to(path, (tb_long_t)index, (tb_long_t)((index * 7919) % 601));
+    else gb_path_move2i_to(path, 0, 0);
+}
+static tb_bool_t gb_demo_core_path_live_check(gb_path_ref_t path)
+{
+    // the polygon and bounds
+    gb_polygon_ref_t    polygon = gb_path_polygon(path);
+    gb_rect_ref_t       bounds = gb_path_bounds(path);
+    tb_check_return_val(polygon && bounds, tb_false);
+
+    // the points count of the polygon
+    tb_size_t           count = 0;
+    tb_uint16_t const*  counts = polygon->counts;
+    while (*counts) count += *counts++;
+
+    // the points count of the path
+    tb_size_t size = 0;
+    tb_for_all_if (gb_path_item_ref_t, item, path, item) size++;
+    tb_check_return_val(count == size, tb_false);
+
+    // make the bounds from the polygon points
+    gb_float_t      x0 = polygon->points[0].x;
+    gb_float_t      y0 = polygon->points[0].y;
+    gb_float_t      x1 = x0;
+    gb_float_t      y1 = y0;
+    gb_point_ref_t  point = polygon->points;
+    while (count--)
+    {
+        if (point->x < x0) x0 = point->x;
+        if (point->y < y0) y0 = point->y;
+        if (point->x > x1) x1 = point->x;
+        if (point->y > y1) y1 = point->y;
+        point++;
+    }
+
+    // the same bounds and the polyline is not convex?
+    return (    x0 == bounds->x && y0 == bounds->y
+            &&  x1 - x0 == bounds->w && y1 - y0 == bounds->h
+            &&  !polygon->convex)? tb_true : tb_false;
+}
+static tb_bool_t gb_demo_core_path_live_close(tb_size_t ring, tb_size_t count)
+{
+    // make the ring path
+    gb_path_ref_t path = gb_path_init();
+    tb_check_return_val(path, tb_false);
+    gb_path_ring_set(path, ring);
+    tb_size_t index = 0;
+    for (index = 0; index < count; index++) gb_demo_core_path_live_append(path, index);
+
+    // close it, the line to the head of the live points is patched if be closed
+    gb_path_clos(path);
+
+    // all points must be the live points and the last code
+    tb_bool_t   ok = tb_true;
+    tb_size_t   size = 0;
+    tb_size_t   code = GB_PATH_CODE_MAXN;
+    tb_for_all_if (gb_path_item_ref_t, item, path, item)
+    {
+        gb_point_ref_t point = &item->points[item->code > GB_PATH_CODE_CLOS? item->code - 1 : 0];
+        if (item->code != GB_PATH_CODE_CLOS && point->x < gb_long_to_float(count - ring)) ok = tb_false;
+        code = item->code;
+        size++;
+    }
+
+    // exit path
+    gb_path_exit(path);
+
+    // only closed if there are more than two live points
+    return ok && ((ring > 2)? (code == GB_PATH_CODE_CLOS && size == ring + 1) : (code != GB_PATH_CODE_CLOS && size == ring));
+}
+static tb_hong_t gb_demo_core_path_live_scale(tb_size_t ring, tb_size_t count, tb_bool_t* ok)
+{
+    // make the full ring path
+    gb_path_ref_t path = gb_path_init();
+    tb_check_return_val(path, 0);
+    gb_path_ring_set(path, ring);
+    tb_size_t index = 0;
+    for (index = 0; index < ring; index++) gb_demo_core_path_live_append(path, index);
+    gb_path_polygon(path);
+    gb_path_bounds(path);
+
+    // append points to the full ring path and draw it after each appending
+    tb_hong_t time = tb_uclock();
+    for (index = 0; index < count; index++)
+    {
+        gb_demo_core_path_live_append(path, ring + index);
+        gb_path_polygon(path);
+        gb_path_bounds(path);
+    }
+    time = tb_uclock() - time;
+
+    // check it
+    if (!gb_demo_core_path_live_check(path)) *ok = tb_false;
+
+    // exit path
+    gb_path_exit(path);
+
+    // the time per point, ns
+    return count? (time * 1000) / count : 0;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * append the points to the live polyline and draw it after each appending,
+ * the bounds and polygon are updated incrementally
+ *
+ * xmake r demo core_path_live [points] [appends] [ring]
+ */
+tb_int_t gb_demo_core_path_live_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the points count, appends count and the maximum points count of the ring path
+    tb_size_t points    = argv[1]? tb_atoi(argv[1]) : 50000;
+    tb_size_t appends   = (argv[1] && argv[2])? tb_atoi(argv[2]) : 10000;
+    tb_size_t ring      = (argv[1] && argv[2] && argv[3])? tb_atoi(argv[3]) : 1000;
+    tb_check_return_val(points && points <= TB_MAXU16 && ring <= TB_MAXU16, 0);
+
+    // init path
+    gb_path_ref_t path = gb_path_init();
+    gb_path_ref_t copy = gb_path_init();
+    if (path && copy)
+    {
+        // make the live polyline
+        tb_size_t index = 0;
+        for (index = 0; index < points; index++) gb_demo_core_path_live_append(path, index);
+
+        // make the polygon and bounds
+        gb_path_polygon(path);
+        gb_path_bounds(path);
+
+        // the time of remaking the whole polygon and bounds for each appending before
+        tb_hong_t time = tb_uclock();
+        gb_path_copy(copy, path);
+        gb_path_polygon(copy);
+        gb_path_convex(copy);
+        time = tb_uclock() - time;
+        tb_trace_i("rebuild: %lu points, %lld us", points, time);
+
+        // append points and draw it after each appending
+        tb_size_t count = tb_min(appends, TB_MAXU16 - points);
+        time = tb_uclock();
+        for (index = 0; index < count; index++)
+        {
+            gb_demo_core_path_live_append(path, points + index);
+            gb_path_polygon(path);
+            gb_path_bounds(path);
+        }
+        time = tb_uclock() - time;
+        tb_trace_i("append: %lu points, %lld us, %lld ns/point: %s", count, time, count? (time * 1000) / count : 0, gb_demo_core_path_live_check(path)? "ok" : "failed");
+
+        // make the scrolling ring path
+        gb_path_clear(path);
+        gb_path_ring_set(path, ring);
+        time = tb_uclock();
+        for (index = 0; index < points; index++)
+        {
+            gb_demo_core_path_live_append(path, index);
+            gb_path_polygon(path);
+            gb_path_bounds(path);
+        }
+        time = tb_uclock() - time;
+        tb_trace_i("ring: %lu points, %lu live points, %lld us, %lld ns/point: %s"
+            ,   points
+            ,   gb_path_polygon(path)->counts[0]
+            ,   time
+            ,   (time * 1000) / points
+            ,   gb_demo_core_path_live_check(path)? "ok" : "failed");
+
+        // the appending cost of the ring path must be flat for the different window sizes
+        tb_bool_t   ok = tb_true;
+        tb_hong_t   scale_1k = gb_demo_core_path_live_scale(1000, 20000, &ok);
+        tb_hong_t   scale_10k = gb_demo_core_path_live_scale(10000, 20000, &ok);
+        tb_hong_t   scale_40k = gb_demo_core_path_live_scale(40000, 20000, &ok);
+        tb_hong_t   scale_min = tb_min(scale_1k, tb_min(scale_10k, scale_40k));
+        tb_hong_t   scale_max = tb_max(scale_1k, tb_max(scale_10k, scale_40k));
+        tb_trace_i("scale: 1k: %lld ns/point, 10k: %lld ns/point, 40k: %lld ns/point: %s"
+            ,   scale_1k
+            ,   scale_10k
+            ,   scale_40k
+            ,   (ok && scale_max <= 4 * tb_max(scale_min, 100))? "ok" : "failed");
+
+        // close the ring paths
+        tb_trace_i("close: %s", (gb_demo_core_path_live_close(4, 10) && gb_demo_core_path_live_close(2, 6))? "ok" : "failed");
+    }
+
+    // exit path
+    if (copy) gb_path_exit(copy);
+    if (path) gb_path_exit(path);
+    return 0;
+}
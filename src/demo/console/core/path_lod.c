@@ -0,0 +1,116 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the tiny triangles count
+#define GB_DEMO_CORE_PATH_LOD_TINY          (200)
+
+// the points count of each side of the large square
+#define GB_DEMO_CORE_PATH_LOD_SIDE          (150)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_demo_core_path_lod_func(gb_point_ref_t points, tb_uint16_t count, tb_cpointer_t priv)
+{
+    // check
+    tb_size_t* triangles = (tb_size_t*)priv;
+    tb_assert_and_check_return(triangles && points && count);
+
+    // count the triangles
+    (*triangles)++;
+}
+static tb_bool_t gb_demo_core_path_lod_check(gb_polygon_ref_t polygon, tb_size_t* contours, tb_size_t* points)
+{
+    // check
+    tb_assert_and_check_return_val(polygon && polygon->points && polygon->counts, tb_false);
+
+    // the contours must not be degenerate, the closed contour has the duplicate tail point
+    tb_uint16_t const*  counts = polygon->counts;
+    gb_point_ref_t      head = polygon->points;
+    tb_uint16_t         count = 0;
+    while ((count = *counts++))
+    {
+        tb_bool_t closed = count > 1 && gb_point_eq(head, head + count - 1);
+        if (count < (closed? 4 : 3)) return tb_false;
+        *points += count;
+        head += count;
+        (*contours)++;
+    }
+
+    // ok
+    return tb_true;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * simplify the path with the many tiny contours and the large contour,
+ * and tessellate the simplified polygon like the concave fill of the gl device
+ *
+ * xmake r demo core_path_lod
+ */
+tb_int_t gb_demo_core_path_lod_main(tb_int_t argc, tb_char_t** argv)
+{
+    // init path and tessellator
+    gb_path_ref_t           path = gb_path_init();
+    gb_tessellator_ref_t    tessellator = gb_tessellator_init();
+    if (path && tessellator)
+    {
+        // make the tiny triangles, the inner points are removed by the large tolerance
+        tb_size_t i = 0;
+        for (i = 0; i < GB_DEMO_CORE_PATH_LOD_TINY; i++)
+        {
+            gb_float_t x = gb_long_to_float((tb_long_t)(i % 20) * 3);
+            gb_float_t y = gb_long_to_float((tb_long_t)(i / 20) * 3);
+            gb_path_move2_to(path, x, y);
+            gb_path_line2_to(path, x + GB_HALF, y);
+            gb_path_line2_to(path, x, y + GB_HALF);
+            gb_path_clos(path);
+        }
+
+        // make the large square with the many points on its sides
+        tb_long_t side = GB_DEMO_CORE_PATH_LOD_SIDE;
+        gb_path_move2i_to(path, 100, 0);
+        for (i = 1; i < (tb_size_t)side; i++) gb_path_line2i_to(path, 100 + i, 0);
+        for (i = 0; i < (tb_size_t)side; i++) gb_path_line2i_to(path, 100 + side, i);
+        for (i = 0; i < (tb_size_t)side; i++) gb_path_line2i_to(path, 100 + side - i, side);
+        for (i = 0; i < (tb_size_t)side; i++) gb_path_line2i_to(path, 100, side - i);
+        gb_path_clos(path);
+
+        // init tessellator like the gl device
+        tb_size_t triangles = 0;
+        gb_tessellator_mode_set(tessellator, GB_TESSELLATOR_MODE_TRIANGULATION);
+        gb_tessellator_rule_set(tessellator, GB_TESSELLATOR_RULE_NONZERO);
+        gb_tessellator_func_set(tessellator, gb_demo_core_path_lod_func, &triangles);
+
+        // simplify and tessellate it with the different tolerances
+        gb_float_t tolerance = GB_ONE / 4;
+        for (i = 0; i < 4; i++, tolerance += tolerance)
+        {
+            tb_size_t           contours = 0;
+            tb_size_t           points = 0;
+            gb_polygon_ref_t    polygon = gb_path_polygon_lod(path, tolerance);
+            tb_bool_t           ok = gb_demo_core_path_lod_check(polygon, &contours, &points);
+            if (ok)
+            {
+                triangles = 0;
+                gb_tessellator_done(tessellator, polygon, gb_path_bounds(path));
+                ok = triangles > GB_DEMO_CORE_PATH_LOD_TINY;
+            }
+
+            // trace
+            tb_trace_i("tolerance: %{float}, contours: %lu, points: %lu, triangles: %lu: %s", &tolerance, contours, points, triangles, ok? "ok" : "failed");
+        }
+    }
+
+    // exit tessellator and path
+    if (tessellator) gb_tessellator_exit(tessellator);
+    if (path) gb_path_exit(path);
+    return 0;
+}
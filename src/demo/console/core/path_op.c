@@ -0,0 +1,186 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the sampling step of the points
+#define GB_DEMO_CORE_PATH_OP_STEP       (3)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the operands type
+typedef struct __gb_demo_core_path_op_operands_t
+{
+    // the name
+    tb_char_t const*    name;
+
+    // the path
+    gb_path_ref_t       path;
+
+    // the other path
+    gb_path_ref_t       other;
+
+}gb_demo_core_path_op_operands_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+// the operation names
+static tb_char_t const* g_demo_core_path_op_names[] = {"union", "intersect", "difference", "xor"};
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_bool_t gb_demo_core_path_op_expected(tb_size_t op, tb_bool_t a, tb_bool_t b)
+{
+    // the expected result of the operation for the point
+    switch (op)
+    {
+    case GB_PATH_OP_UNION:      return a || b;
+    case GB_PATH_OP_INTERSECT:  return a && b;
+    case GB_PATH_OP_DIFFERENCE: return a && !b;
+    case GB_PATH_OP_XOR:        return a != b;
+    default:                    break;
+    }
+    return tb_false;
+}
+static tb_size_t gb_demo_core_path_op_check(gb_demo_core_path_op_operands_t* operands, tb_size_t op, tb_size_t rule, tb_size_t* samples)
+{
+    // make the result path = path op other
+    gb_path_ref_t result = gb_path_init();
+    tb_check_return_val(result, 1);
+    gb_path_copy(result, operands->path);
+    if (!gb_path_op(result, operands->other, op, rule))
+    {
+        gb_path_exit(result);
+        return 1;
+    }
+
+    // sample the points around the bounds of two operands, the points are not on the integer edges
+    tb_size_t       failed = 0;
+    gb_rect_ref_t   a = gb_path_bounds(operands->path);
+    gb_rect_ref_t   b = gb_path_bounds(operands->other);
+    tb_long_t       x0 = gb_float_to_long(tb_min(a->x, b->x)) - 10;
+    tb_long_t       y0 = gb_float_to_long(tb_min(a->y, b->y)) - 10;
+    tb_long_t       x1 = gb_float_to_long(tb_max(a->x + a->w, b->x + b->w)) + 10;
+    tb_long_t       y1 = gb_float_to_long(tb_max(a->y + a->h, b->y + b->h)) + 10;
+    tb_long_t       x;
+    tb_long_t       y;
+    for (y = y0; y < y1; y += GB_DEMO_CORE_PATH_OP_STEP)
+    {
+        for (x = x0; x < x1; x += GB_DEMO_CORE_PATH_OP_STEP)
+        {
+            // the point
+            gb_point_t point;
+            gb_point_make(&point, gb_long_to_float(x) + GB_ONE / 3, gb_long_to_float(y) + GB_ONE / 5);
+
+            // the expected result by the operands
+            tb_bool_t expected = gb_demo_core_path_op_expected(op, gb_path_contains_point(operands->path, &point, rule), gb_path_contains_point(operands->other, &point, rule));
+
+            // the result path has no overlapped contours, so it is same for all fill rules
+            if (    gb_path_contains_point(result, &point, GB_PAINT_FILL_RULE_ODD) != expected
+                ||  gb_path_contains_point(result, &point, GB_PAINT_FILL_RULE_NONZERO) != expected)
+            {
+                failed++;
+            }
+            (*samples)++;
+        }
+    }
+
+    // exit the result path
+    gb_path_exit(result);
+
+    // the failed samples
+    return failed;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * do all boolean operations on the overlapped, nested, disjoint and self-overlapped shapes for the two fill rules,
+ * and check the result path by sampling the points with the operands
+ *
+ * xmake r demo core_path_op
+ */
+tb_int_t gb_demo_core_path_op_main(tb_int_t argc, tb_char_t** argv)
+{
+    // init operands
+    gb_demo_core_path_op_operands_t operands[] =
+    {
+        {"overlapped",      gb_path_init(), gb_path_init()}
+    ,   {"nested",          gb_path_init(), gb_path_init()}
+    ,   {"disjoint",        gb_path_init(), gb_path_init()}
+    ,   {"self-overlapped", gb_path_init(), gb_path_init()}
+    };
+
+    // done
+    tb_size_t i = 0;
+    do
+    {
+        // check
+        for (i = 0; i < tb_arrayn(operands); i++)
+        {
+            tb_assert_and_check_break(operands[i].path && operands[i].other);
+        }
+        tb_check_break(i == tb_arrayn(operands));
+
+        // the rect and the circle across its right edge
+        gb_path_add_rect2i(operands[0].path, 0, 0, 100, 100, GB_ROTATE_DIRECTION_CW);
+        gb_path_add_circle2i(operands[0].other, 100, 50, 40, GB_ROTATE_DIRECTION_CW);
+
+        // the rect and the inner rect with the reverse direction
+        gb_path_add_rect2i(operands[1].path, 0, 0, 100, 100, GB_ROTATE_DIRECTION_CW);
+        gb_path_add_rect2i(operands[1].other, 25, 25, 50, 50, GB_ROTATE_DIRECTION_CCW);
+
+        // the rect and the far circle
+        gb_path_add_rect2i(operands[2].path, 0, 0, 50, 50, GB_ROTATE_DIRECTION_CW);
+        gb_path_add_circle2i(operands[2].other, 150, 150, 30, GB_ROTATE_DIRECTION_CW);
+
+        // the rect with the inner rect of the same direction, it is a ring for the odd rule, and the strip across them
+        gb_path_add_rect2i(operands[3].path, 0, 0, 100, 100, GB_ROTATE_DIRECTION_CW);
+        gb_path_add_rect2i(operands[3].path, 25, 25, 50, 50, GB_ROTATE_DIRECTION_CW);
+        gb_path_add_rect2i(operands[3].other, 40, -20, 20, 140, GB_ROTATE_DIRECTION_CCW);
+
+        // do all operations for the two fill rules
+        tb_size_t rules[] = {GB_PAINT_FILL_RULE_ODD, GB_PAINT_FILL_RULE_NONZERO};
+        tb_size_t j = 0;
+        tb_size_t op = 0;
+        for (i = 0; i < tb_arrayn(operands); i++)
+        {
+            for (j = 0; j < tb_arrayn(rules); j++)
+            {
+                for (op = GB_PATH_OP_UNION; op <= GB_PATH_OP_XOR; op++)
+                {
+                    // check it
+                    tb_size_t samples = 0;
+                    tb_size_t failed = gb_demo_core_path_op_check(&operands[i], op, rules[j], &samples);
+
+                    // trace
+                    tb_trace_i("%s: %s: %s: %lu samples, %lu failed: %s"
+                        ,   operands[i].name
+                        ,   rules[j] == GB_PAINT_FILL_RULE_ODD? "odd" : "nonzero"
+                        ,   g_demo_core_path_op_names[op]
+                        ,   samples
+                        ,   failed
+                        ,   failed? "failed" : "ok");
+                }
+            }
+        }
+
+    } while (0);
+
+    // exit operands
+    for (i = 0; i < tb_arrayn(operands); i++)
+    {
+        if (operands[i].path) gb_path_exit(operands[i].path);
+        if (operands[i].other) gb_path_exit(operands[i].other);
+    }
+    return 0;
+}
@@ -0,0 +1,492 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the path data parser type
+typedef gb_path_ref_t (*gb_demo_core_path_svg_parser_t)(tb_char_t const* data);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+
+/* the old path data parser of the tiger demo, it is kept only for comparing with gb_path_init_from_svg_data()
+ *
+ * it treats T as L and S as Q and does not support the arcs
+ */
+static __tb_inline__ tb_char_t const* gb_demo_core_path_svg_old_skip_separator(tb_char_t const* p)
+{
+    while (*p && (tb_isspace(*p) || *p == ',')) p++;
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_float(tb_char_t const* p, gb_float_t* value)
+{
+    // skip space
+    while (*p && tb_isspace(*p)) p++;
+
+    // has sign?
+    tb_long_t sign = 0;
+    if (*p == '-') 
+    {
+        sign = 1;
+        p++;
+    }
+
+    // skip '0'
+    while (*p == '0') p++;
+
+    // compute double: lhs.rhs
+    tb_long_t   dec = 0;
+    tb_uint32_t lhs = 0;
+    gb_float_t  rhs = 0;
+    tb_long_t   zeros = 0;
+    tb_int8_t   decimals[256];
+    tb_int8_t*  d = decimals;
+    tb_int8_t*  e = decimals + 256;
+    while (*p)
+    {
+        tb_char_t ch = *p;
+
+        // is the part of decimal?
+        if (ch == '.')
+        {
+            if (!dec) 
+            {
+                dec = 1;
+                p++;
+                continue ;
+            }
+            else break;
+        }
+
+        // parse integer and decimal
+        if (tb_isdigit10(ch))
+        {
+            // save decimals
+            if (dec) 
+            {
+                if (d < e)
+                {
+                    if (ch != '0')
+                    {
+                        // fill '0'
+                        while (zeros--) *d++ = 0;
+                        zeros = 0;
+
+                        // save decimal
+                        *d++ = ch - '0';
+                    }
+                    else zeros++;
+                }
+            }
+            else lhs = lhs * 10 + (ch - '0');
+        }
+        else break;
+    
+        // next
+        p++;
+    }
+
+    // check
+    tb_assert(d <= decimals + 256);
+
+    // compute decimal
+    while (d-- > decimals) rhs = gb_idiv(rhs + gb_long_to_float(*d), 10);
+
+    // done 
+    *value = (sign? -(gb_long_to_float(lhs) + rhs) : (gb_long_to_float(lhs) + rhs));
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_d_xoy(gb_path_ref_t* path, tb_char_t const* p, tb_char_t mode)
+{
+    // xoy
+    gb_float_t xoy = 0; p = gb_demo_core_path_svg_old_float(p, &xoy); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // trace
+    tb_trace_d("path: d: %c: %{float}", mode, &(xoy));
+
+    // done path
+    if ((*path))
+    {
+        // last point
+        gb_point_t pt = {0};
+        gb_path_last((*path), &pt);
+
+        // done
+        switch (mode)
+        {
+            case 'H':
+                gb_path_line2_to((*path), xoy, pt.y);
+                break;
+            case 'h':
+                gb_path_line2_to((*path), pt.x + xoy, pt.y);
+                break;
+            case 'V':
+                gb_path_line2_to((*path), pt.x, xoy);
+                break;
+            case 'v':
+                gb_path_line2_to((*path), pt.x, pt.y + xoy);
+                break;
+            default:
+                tb_trace_noimpl();
+                break;
+        }
+    }
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_d_xy1(gb_path_ref_t* path, tb_char_t const* p, tb_char_t mode)
+{
+    // x1
+    gb_float_t x1 = 0; p = gb_demo_core_path_svg_old_float(p, &x1); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y1
+    gb_float_t y1 = 0; p = gb_demo_core_path_svg_old_float(p, &y1); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // trace
+    tb_trace_d("path: d: %c: %{float}, %{float}", mode, &(x1), &(y1));
+
+    // init path
+    if (!(*path)) (*path) = gb_path_init();
+
+    // done path
+    if ((*path))
+    {
+        // last point
+        gb_point_t pt = {0};
+        gb_path_last((*path), &pt);
+
+        // done
+        switch (mode)
+        {
+            case 'M':
+                gb_path_move2_to((*path), x1, y1);
+                break;
+            case 'm':
+                gb_path_move2_to((*path), pt.x + x1, pt.y + y1);
+                break;
+            case 'L':
+                gb_path_line2_to((*path), x1, y1);
+                break;
+            case 'l':
+                gb_path_line2_to((*path), pt.x + x1, pt.y + y1);
+                break;
+            default:
+                tb_trace_noimpl();
+                break;
+        }
+    }
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_d_xy2(gb_path_ref_t* path, tb_char_t const* p, tb_char_t mode)
+{
+    // x1
+    gb_float_t x1 = 0; p = gb_demo_core_path_svg_old_float(p, &x1); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y1
+    gb_float_t y1 = 0; p = gb_demo_core_path_svg_old_float(p, &y1); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // x2
+    gb_float_t x2 = 0; p = gb_demo_core_path_svg_old_float(p, &x2); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y2
+    gb_float_t y2 = 0; p = gb_demo_core_path_svg_old_float(p, &y2); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // trace
+    tb_trace_d("path: d: %c: %{float}, %{float}, %{float}, %{float}", mode, &(x1), &(y1), &(x2), &(y2));
+
+    // init path
+    if (!(*path)) (*path) = gb_path_init();
+
+    // done path
+    if ((*path))
+    {
+        // done
+        switch (mode)
+        {
+            case 'Q':
+                gb_path_quad2_to((*path), x1, y1, x2, y2);
+                break;
+            case 'q':
+                {
+                    gb_point_t pt = {0};
+                    gb_path_last((*path), &pt);
+                    gb_path_quad2_to((*path), pt.x + x1, pt.y + y1, pt.x + x2, pt.y + y2);
+                }
+                break;
+            default:
+                tb_trace_noimpl();
+                break;
+        }
+    }
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_d_xy3(gb_path_ref_t* path, tb_char_t const* p, tb_char_t mode)
+{
+    // x1
+    gb_float_t x1 = 0; p = gb_demo_core_path_svg_old_float(p, &x1); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y1
+    gb_float_t y1 = 0; p = gb_demo_core_path_svg_old_float(p, &y1); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // x2
+    gb_float_t x2 = 0; p = gb_demo_core_path_svg_old_float(p, &x2); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y2
+    gb_float_t y2 = 0; p = gb_demo_core_path_svg_old_float(p, &y2); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // x3
+    gb_float_t x3 = 0; p = gb_demo_core_path_svg_old_float(p, &x3); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y3
+    gb_float_t y3 = 0; p = gb_demo_core_path_svg_old_float(p, &y3); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // trace
+    tb_trace_d("path: d: %c: %{float}, %{float}, %{float}, %{float}, %{float}, %{float}", mode, &(x1), &(y1), &(x2), &(y2), &(x3), &(y3));
+
+    // init path
+    if (!(*path)) (*path) = gb_path_init();
+
+    // done path
+    if ((*path))
+    {
+        // done
+        switch (mode)
+        {
+            case 'C':
+                gb_path_cubic2_to((*path), x1, y1, x2, y2, x3, y3);
+                break;
+            case 'c':
+                {
+                    gb_point_t pt = {0};
+                    gb_path_last((*path), &pt);
+                    gb_path_cubic2_to((*path), pt.x + x1, pt.y + y1, pt.x + x2, pt.y + y2, pt.x + x3, pt.y + y3);
+                }
+                break;
+            default:
+                tb_trace_noimpl();
+                break;
+        }
+    }
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_d_a(gb_path_ref_t* path, tb_char_t const* p, tb_char_t mode)
+{
+    // rx
+    gb_float_t rx = 0; p = gb_demo_core_path_svg_old_float(p, &rx); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // ry
+    gb_float_t ry = 0; p = gb_demo_core_path_svg_old_float(p, &ry); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // x-axis-rotation
+    gb_float_t xr = 0; p = gb_demo_core_path_svg_old_float(p, &xr); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // large-arc-flag
+    gb_float_t af = 0; p = gb_demo_core_path_svg_old_float(p, &af); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // sweep-flag
+    gb_float_t sf = 0; p = gb_demo_core_path_svg_old_float(p, &sf); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // x
+    gb_float_t x = 0; p = gb_demo_core_path_svg_old_float(p, &x); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // y
+    gb_float_t y = 0; p = gb_demo_core_path_svg_old_float(p, &y); p = gb_demo_core_path_svg_old_skip_separator(p);
+
+    // trace
+    tb_trace_d("path: a: %c: %{float}, %{float}, %{float}, %{float}, %{float}, %{float}, %{float}", mode, &(rx), &(ry), &(xr), &(af), &(sf), &(x), &(y));
+
+    // init path
+    if (!(*path)) (*path) = gb_path_init();
+
+    // done path
+    if ((*path))
+    {
+        // last point
+        gb_point_t pt = {0};
+        gb_path_last((*path), &pt);
+
+        // absolute x & y
+        if (mode == 'a') 
+        {
+            x += pt.x;
+            y += pt.y;
+        }
+
+        // arc-to
+//        gb_path_arc2_to((*path), x0, y0, rx, ry, ab, an);
+
+        // noimpl
+        tb_trace_noimpl();
+    }
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_demo_core_path_svg_old_d_z(gb_path_ref_t* path, tb_char_t const* data, tb_char_t mode)
+{
+    // trace
+    tb_trace_d("path: d: z");
+
+    // close path
+    if ((*path)) gb_path_clos((*path));
+
+    // ok
+    return data;
+}
+static tb_void_t gb_demo_core_path_svg_old_init(gb_path_ref_t* path, tb_char_t const* data)
+{
+    // check
+    tb_assert(path && data);
+
+    // trace
+    tb_trace_d("path: d");
+
+    // done
+    tb_char_t const*    p = data;
+    tb_char_t           l = '\0';
+    tb_char_t           m = *p++;
+    while (m)
+    {
+        tb_size_t d = 0;
+        switch (m)
+        {
+        case 'M':
+        case 'm':
+        case 'L':
+        case 'l':
+        case 'T':
+        case 't':
+            p = gb_demo_core_path_svg_old_d_xy1(path, p, m); l = m;
+            break;
+        case 'H':
+        case 'h':
+        case 'V':
+        case 'v':
+            p = gb_demo_core_path_svg_old_d_xoy(path, p, m); l = m;
+            break;
+        case 'S':
+        case 's':
+        case 'Q':
+        case 'q':
+            p = gb_demo_core_path_svg_old_d_xy2(path, p, m); l = m;
+            break;
+        case 'C':
+        case 'c':
+            p = gb_demo_core_path_svg_old_d_xy3(path, p, m); l = m;
+            break;
+        case 'A':
+        case 'a':
+            p = gb_demo_core_path_svg_old_d_a(path, p, m); l = m;
+            break;
+        case 'Z':
+        case 'z':
+            p = gb_demo_core_path_svg_old_d_z(path, p, m); l = m;
+            break;
+        default:
+            d = 1;
+            break;
+        }
+
+        // no mode? use the last mode
+        if (d && (tb_isdigit(m) || m == '.' || m == '-')) 
+        {
+            m = l;
+            p--;
+        }
+        else m = *p++;
+    }
+}
+static gb_path_ref_t gb_demo_core_path_svg_old_parse(tb_char_t const* data)
+{
+    // parse it with the old parser
+    gb_path_ref_t path = tb_null;
+    gb_demo_core_path_svg_old_init(&path, data);
+    return path;
+}
+static tb_hong_t gb_demo_core_path_svg_bench(gb_demo_core_path_svg_parser_t parser, tb_size_t count, tb_size_t* codes, tb_size_t* points)
+{
+    // the path data count
+    tb_size_t index = 0;
+    tb_size_t total = tb_arrayn(g_demo_tiger) >> 1;
+
+    // the codes and points count
+    for (index = 0; index < total; index++)
+    {
+        // make path
+        gb_path_ref_t path = parser(g_demo_tiger[(index << 1) + 1]);
+        if (path)
+        {
+            // walk items
+            tb_for_all_if (gb_path_item_ref_t, item, path, item)
+            {
+                (*codes)++;
+                if (item->code != GB_PATH_CODE_CLOS) *points += item->code > GB_PATH_CODE_CLOS? item->code - 1 : 1;
+            }
+
+            // exit path
+            gb_path_exit(path);
+        }
+    }
+
+    // done
+    tb_size_t i = 0;
+    tb_hong_t time = tb_uclock();
+    for (i = 0; i < count; i++)
+    {
+        for (index = 0; index < total; index++)
+        {
+            // make path
+            gb_path_ref_t path = parser(g_demo_tiger[(index << 1) + 1]);
+            tb_assert_and_check_break(path);
+
+            // exit path
+            gb_path_exit(path);
+        }
+    }
+
+    // the parsing time
+    return tb_uclock() - time;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * parse the tiger path data with gb_path_init_from_svg_data() and the old parser of the tiger demo
+ *
+ * xmake r demo core_path_svg [count]
+ */
+tb_int_t gb_demo_core_path_svg_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the parsing count
+    tb_size_t count = argv[1]? tb_atoi(argv[1]) : 100;
+    tb_check_return_val(count, 0);
+
+    // parse the same tiger data with the two parsers
+    tb_size_t codes = 0;
+    tb_size_t points = 0;
+    tb_size_t old_codes = 0;
+    tb_size_t old_points = 0;
+    tb_hong_t time = gb_demo_core_path_svg_bench(gb_path_init_from_svg_data, count, &codes, &points);
+    tb_hong_t old_time = gb_demo_core_path_svg_bench(gb_demo_core_path_svg_old_parse, count, &old_codes, &old_points);
+
+    // trace
+    tb_trace_i("tiger: %lu paths", tb_arrayn(g_demo_tiger) >> 1);
+    tb_trace_i("parse: %lu times, %lu codes, %lu points, %lld us, %lld us/tiger", count, codes, points, time, time / count);
+    tb_trace_i("parse: %lu times, %lu codes, %lu points, %lld us, %lld us/tiger: old", count, old_codes, old_points, old_time, old_time / count);
+    return 0;
+}
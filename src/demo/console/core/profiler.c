@@ -0,0 +1,134 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the canvas size
+#define GB_DEMO_CORE_PROFILER_SIZE      (512)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+// the stage names
+static tb_char_t const* g_stage_names[] =
+{
+    "flatten"
+,   "stroke"
+,   "tessellate"
+,   "raster"
+,   "blit"
+};
+
+// the count names
+static tb_char_t const* g_count_names[] =
+{
+    "paths"
+,   "spans"
+,   "pixels"
+,   "draws"
+};
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * profile the tiger frames and dump the chrome trace events to the temporary directory,
+ * the stage times and counts are only recorded in the profile mode, e.g.
+ *
+ * xmake f -m profile && xmake && xmake r demo core_profiler [frames]
+ */
+tb_int_t gb_demo_core_profiler_main(tb_int_t argc, tb_char_t** argv)
+{
+    // the frames count
+    tb_size_t frames = argv[1]? tb_atoi(argv[1]) : 20;
+    tb_check_return_val(frames, 0);
+
+    // init paths
+    tb_size_t       index = 0;
+    tb_size_t       count = tb_arrayn(g_demo_tiger) >> 1;
+    gb_path_ref_t   paths[tb_arrayn(g_demo_tiger) >> 1];
+    for (index = 0; index < count; index++)
+        paths[index] = gb_path_init_from_svg_data(g_demo_tiger[(index << 1) + 1]);
+
+    // init profiler, bitmap and canvas
+    gb_profiler_ref_t   profiler = gb_profiler_init(frames);
+    gb_bitmap_ref_t     bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_PROFILER_SIZE, GB_DEMO_CORE_PROFILER_SIZE, 0, tb_false);
+    gb_canvas_ref_t     canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+    if (profiler && canvas)
+    {
+        // attach the profiler to the canvas context
+        gb_context_profiler_set(gb_device_context(gb_canvas_device(canvas)), profiler);
+
+        // fit the tiger to the canvas
+        gb_canvas_scale(canvas, gb_idiv(GB_DEMO_CORE_PROFILER_SIZE, 640), gb_idiv(GB_DEMO_CORE_PROFILER_SIZE, 640));
+        gb_canvas_mode_set(canvas, GB_PAINT_MODE_FILL_STROKE);
+        gb_canvas_stroke_width_set(canvas, GB_TWO);
+
+        // render frames
+        tb_size_t frame = 0;
+        for (frame = 0; frame < frames; frame++)
+        {
+            gb_profiler_frame_begin(profiler);
+            gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+            for (index = 0; index < count; index++)
+            {
+                gb_canvas_color_set(canvas, (index & 1)? GB_COLOR_BLACK : GB_COLOR_RED);
+                if (paths[index]) gb_canvas_draw_path(canvas, paths[index]);
+            }
+            gb_profiler_frame_end(profiler);
+        }
+
+        // sum all frames
+        tb_size_t   i = 0;
+        tb_size_t   size = gb_profiler_size(profiler);
+        tb_hong_t   duration = 0;
+        tb_hong_t   stages[GB_PROFILER_STAGE_MAXN] = {0};
+        tb_hong_t   counts[GB_PROFILER_COUNT_MAXN] = {0};
+        for (frame = 0; frame < size; frame++)
+        {
+            gb_profiler_frame_ref_t record = gb_profiler_frame(profiler, frame);
+            tb_check_continue(record);
+
+            duration += record->duration;
+            for (i = 0; i < GB_PROFILER_STAGE_MAXN; i++) stages[i] += record->stages[i];
+            for (i = 0; i < GB_PROFILER_COUNT_MAXN; i++) counts[i] += record->counts[i];
+        }
+
+        // trace
+        if (size)
+        {
+            tb_trace_i("frames: %lu, %lld us/frame", size, duration / size);
+            for (i = 0; i < GB_PROFILER_STAGE_MAXN; i++) tb_trace_i("%s: %lld us/frame", g_stage_names[i], stages[i] / size);
+            for (i = 0; i < GB_PROFILER_COUNT_MAXN; i++) tb_trace_i("%s: %lld/frame", g_count_names[i], counts[i] / size);
+        }
+
+        // the trace file
+        tb_char_t file[TB_PATH_MAXN] = {0};
+        if (tb_directory_temporary(file, sizeof(file) - 16))
+        {
+            // dump the chrome trace events
+            tb_strcat(file, "/profiler.json");
+            tb_stream_ref_t stream = tb_stream_init_from_file(file, TB_FILE_MODE_RW | TB_FILE_MODE_CREAT | TB_FILE_MODE_BINARY | TB_FILE_MODE_TRUNC);
+            if (stream && tb_stream_open(stream) && gb_profiler_dump(profiler, stream))
+                tb_trace_i("trace: %s", file);
+            if (stream) tb_stream_exit(stream);
+        }
+    }
+
+    // exit canvas, bitmap and profiler
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+    if (profiler) gb_profiler_exit(profiler);
+
+    // exit paths
+    for (index = 0; index < count; index++)
+    {
+        if (paths[index]) gb_path_exit(paths[index]);
+    }
+    return 0;
+}
@@ -0,0 +1,207 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the canvas size
+#define GB_DEMO_CORE_RASTER_CACHE_SIZE      (512)
+
+// the grid spacing of the items
+#define GB_DEMO_CORE_RASTER_CACHE_SPACING   (8)
+
+// the grid size of the map
+#define GB_DEMO_CORE_RASTER_CACHE_GRID      (96)
+
+// the panned frames count
+#define GB_DEMO_CORE_RASTER_CACHE_FRAMES    (100)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_uint32_t gb_demo_core_raster_cache_random(tb_uint32_t* seed, tb_uint32_t range)
+{
+    // the xorshift generator
+    tb_uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+
+    // the random value in [0, range)
+    return x % range;
+}
+static tb_void_t gb_demo_core_raster_cache_draw(gb_canvas_ref_t canvas, tb_cpointer_t priv)
+{
+    // draw the visible items of the map
+    gb_scene_draw((gb_scene_ref_t)priv, canvas);
+}
+static tb_long_t gb_demo_core_raster_cache_wave(tb_size_t frame, tb_long_t period)
+{
+    // the triangle wave in [-period / 2, period / 2], the viewport is moved forwards and backwards
+    return tb_abs((tb_long_t)(frame % (period << 1)) - period) - (period >> 1);
+}
+static tb_void_t gb_demo_core_raster_cache_pan(gb_canvas_ref_t canvas, tb_size_t frame)
+{
+    /* the viewport is moved by the integer offset for each frame,
+     * it is panned to the left, right, top and bottom and the items will cross all edges of the canvas
+     */
+    gb_canvas_clear_matrix(canvas);
+    gb_canvas_translate(canvas, gb_long_to_float(gb_demo_core_raster_cache_wave(frame, 20) * 3), gb_long_to_float(gb_demo_core_raster_cache_wave(frame + 7, 16) * 2));
+}
+static tb_size_t gb_demo_core_raster_cache_diff(gb_bitmap_ref_t bitmap, gb_bitmap_ref_t other)
+{
+    // the pixmap
+    gb_pixmap_ref_t pixmap = gb_pixmap(gb_bitmap_pixfmt(bitmap), 0xff);
+    tb_assert_and_check_return_val(pixmap && pixmap->color_get, 0xff);
+
+    // the maximum difference of all channels
+    tb_size_t           i;
+    tb_size_t           diff = 0;
+    tb_size_t           n = gb_bitmap_width(bitmap) * gb_bitmap_height(bitmap);
+    tb_byte_t const*    p = (tb_byte_t const*)gb_bitmap_data(bitmap);
+    tb_byte_t const*    q = (tb_byte_t const*)gb_bitmap_data(other);
+    for (i = 0; i < n; i++, p += pixmap->btp, q += pixmap->btp)
+    {
+        gb_color_t a = pixmap->color_get(p);
+        gb_color_t b = pixmap->color_get(q);
+        diff = tb_max(diff, (tb_size_t)tb_abs((tb_long_t)a.r - b.r));
+        diff = tb_max(diff, (tb_size_t)tb_abs((tb_long_t)a.g - b.g));
+        diff = tb_max(diff, (tb_size_t)tb_abs((tb_long_t)a.b - b.b));
+    }
+    return diff;
+}
+static tb_void_t gb_demo_core_raster_cache_done(gb_bitmap_ref_t bitmap, gb_bitmap_ref_t other, gb_canvas_ref_t canvas, gb_canvas_ref_t direct, gb_paint_ref_t* paints, tb_size_t paints_count)
+{
+    // init paths, scene and cache
+    tb_size_t               count = GB_DEMO_CORE_RASTER_CACHE_GRID * GB_DEMO_CORE_RASTER_CACHE_GRID;
+    gb_path_ref_t*          paths = tb_nalloc0_type(count, gb_path_ref_t);
+    gb_scene_ref_t          scene = gb_scene_init();
+    gb_raster_cache_ref_t   cache = gb_raster_cache_init(0);
+    tb_size_t               made = 0;
+    do
+    {
+        // check
+        tb_assert_and_check_break(paths && scene && cache);
+
+        // make the rects and circles on the grid of the map
+        tb_uint32_t seed = 2463534242u;
+        for (made = 0; made < count; made++)
+        {
+            paths[made] = gb_path_init();
+            tb_assert_and_check_break(paths[made]);
+
+            // the position and size
+            tb_long_t x = (made % GB_DEMO_CORE_RASTER_CACHE_GRID) * GB_DEMO_CORE_RASTER_CACHE_SPACING + gb_demo_core_raster_cache_random(&seed, 8);
+            tb_long_t y = (made / GB_DEMO_CORE_RASTER_CACHE_GRID) * GB_DEMO_CORE_RASTER_CACHE_SPACING + gb_demo_core_raster_cache_random(&seed, 8);
+            tb_size_t r = gb_demo_core_raster_cache_random(&seed, 8) + 2;
+            if (made & 1) gb_path_add_circle2i(paths[made], x, y, r, GB_ROTATE_DIRECTION_CW);
+            else 
+            {
+                // the rect is not aligned to the pixels for checking the rounded edges
+                gb_float_t offset = gb_long_to_float(gb_demo_core_raster_cache_random(&seed, 8)) / 8;
+                gb_path_add_rect2(paths[made], gb_long_to_float(x) + offset, gb_long_to_float(y) - offset, gb_long_to_float(r << 1) + offset, gb_long_to_float(r) + offset + offset, GB_ROTATE_DIRECTION_CW);
+            }
+
+            // add it
+            if (!gb_scene_add(scene, paths[made], paints[made % paints_count])) break;
+        }
+        tb_check_break(made == count);
+
+        // the bounds of the map
+        gb_rect_ref_t bounds = gb_scene_bounds(scene);
+        tb_assert_and_check_break(bounds);
+
+        // pan the map and draw it from the cache and directly
+        tb_size_t   frame;
+        tb_size_t   diff = 0;
+        tb_hong_t   cached_time = 0;
+        tb_hong_t   direct_time = 0;
+        for (frame = 0; frame < GB_DEMO_CORE_RASTER_CACHE_FRAMES; frame++)
+        {
+            // draw it from the cache
+            gb_demo_core_raster_cache_pan(canvas, frame);
+            gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+            tb_hong_t time = tb_uclock();
+            gb_raster_cache_draw(cache, canvas, scene, 0, bounds, gb_demo_core_raster_cache_draw, scene);
+            cached_time += tb_uclock() - time;
+
+            // draw it directly
+            gb_demo_core_raster_cache_pan(direct, frame);
+            gb_canvas_draw_clear(direct, GB_COLOR_WHITE);
+            time = tb_uclock();
+            gb_scene_draw(scene, direct);
+            direct_time += tb_uclock() - time;
+
+            // compare them
+            diff = tb_max(diff, gb_demo_core_raster_cache_diff(bitmap, other));
+        }
+
+        // trace
+        gb_raster_cache_stats_ref_t stats = gb_raster_cache_stats(cache);
+        tb_trace_i("%lu items: pan %lu frames: cached: %lld us, direct: %lld us", count, (tb_size_t)GB_DEMO_CORE_RASTER_CACHE_FRAMES, cached_time, direct_time);
+        tb_trace_i("hits: %lu, misses: %lu, renders: %lu, evictions: %lu, size: %lu / %lu", stats->hits, stats->misses, stats->renders, stats->evictions, stats->size, stats->maxn);
+        tb_trace_i("maximum difference: %lu: %s", diff, diff <= 1? "ok" : "failed");
+
+    } while (0);
+
+    // exit cache, scene and paths
+    if (cache) gb_raster_cache_exit(cache);
+    if (scene) gb_scene_exit(scene);
+    if (paths)
+    {
+        tb_size_t i;
+        for (i = 0; i < made; i++) gb_path_exit(paths[i]);
+        tb_free(paths);
+    }
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * pan the map by the integer offsets in all directions and draw it from the raster cache,
+ * and compare it with drawing all items directly
+ *
+ * xmake r demo core_raster_cache
+ */
+tb_int_t gb_demo_core_raster_cache_main(tb_int_t argc, tb_char_t** argv)
+{
+    // init bitmaps and canvas
+    gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_RASTER_CACHE_SIZE, GB_DEMO_CORE_RASTER_CACHE_SIZE, 0, tb_false);
+    gb_bitmap_ref_t other = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_RASTER_CACHE_SIZE, GB_DEMO_CORE_RASTER_CACHE_SIZE, 0, tb_false);
+    gb_canvas_ref_t canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+    gb_canvas_ref_t direct = other? gb_canvas_init_from_bitmap(other) : tb_null;
+
+    // init paints
+    tb_size_t       i;
+    gb_paint_ref_t  paints[3];
+    for (i = 0; i < tb_arrayn(paints); i++) paints[i] = gb_paint_init();
+    if (canvas && direct && paints[0] && paints[1] && paints[2])
+    {
+        // init the translucent fill paints
+        gb_paint_mode_set(paints[0], GB_PAINT_MODE_FILL);
+        gb_paint_color_set(paints[0], GB_COLOR_RED);
+        gb_paint_alpha_set(paints[0], 0x80);
+        gb_paint_mode_set(paints[1], GB_PAINT_MODE_FILL);
+        gb_paint_color_set(paints[1], GB_COLOR_BLUE);
+
+        // init the stroke paint
+        gb_paint_mode_set(paints[2], GB_PAINT_MODE_STROKE);
+        gb_paint_color_set(paints[2], GB_COLOR_BLACK);
+        gb_paint_stroke_width_set(paints[2], GB_TWO);
+
+        // done
+        gb_demo_core_raster_cache_done(bitmap, other, canvas, direct, paints, tb_arrayn(paints));
+    }
+
+    // exit paints, canvas and bitmaps
+    for (i = 0; i < tb_arrayn(paints); i++) if (paints[i]) gb_paint_exit(paints[i]);
+    if (canvas) gb_canvas_exit(canvas);
+    if (direct) gb_canvas_exit(direct);
+    if (bitmap) gb_bitmap_exit(bitmap);
+    if (other) gb_bitmap_exit(other);
+    return 0;
+}
@@ -0,0 +1,214 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the canvas size
+#define GB_DEMO_CORE_SCENE_SIZE         (512)
+
+// the grid spacing of the items
+#define GB_DEMO_CORE_SCENE_SPACING      (16)
+
+// the hit points count
+#define GB_DEMO_CORE_SCENE_HITS         (10000)
+
+// the hit points count for testing all paths
+#define GB_DEMO_CORE_SCENE_HITS_ALL     (1000)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_uint32_t gb_demo_core_scene_random(tb_uint32_t* seed, tb_uint32_t range)
+{
+    // the xorshift generator
+    tb_uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+
+    // the random value in [0, range)
+    return x % range;
+}
+static tb_long_t gb_demo_core_scene_hit(gb_path_ref_t* paths, gb_paint_ref_t* paints, tb_size_t paints_count, tb_size_t count, gb_point_ref_t point)
+{
+    // test all paths from the topmost path, like the application without the scene
+    tb_size_t i = count;
+    while (i--)
+    {
+        // hit the filled shape?
+        gb_paint_ref_t paint = paints[i % paints_count];
+        if ((gb_paint_mode(paint) & GB_PAINT_MODE_FILL) && gb_path_contains_point(paths[i], point, gb_paint_fill_rule(paint)))
+            return (tb_long_t)i;
+
+        // hit the outline?
+        if ((gb_paint_mode(paint) & GB_PAINT_MODE_STROKE) && gb_path_contains_stroke_point(paths[i], point, gb_paint_stroke_width(paint), 0))
+            return (tb_long_t)i;
+    }
+    return -1;
+}
+static tb_void_t gb_demo_core_scene_done(gb_canvas_ref_t canvas, gb_paint_ref_t* paints, tb_size_t paints_count, tb_size_t count)
+{
+    // init paths and scene
+    gb_path_ref_t*  paths = tb_nalloc0_type(count, gb_path_ref_t);
+    gb_scene_ref_t  scene = gb_scene_init();
+    tb_size_t       made = 0;
+    do
+    {
+        // check
+        tb_assert_and_check_break(paths && scene);
+
+        // make the rects and circles on the grid of the map
+        tb_size_t   grid = tb_isqrti((tb_uint32_t)count) + 1;
+        tb_uint32_t seed = 2463534242u;
+        for (made = 0; made < count; made++)
+        {
+            paths[made] = gb_path_init();
+            tb_assert_and_check_break(paths[made]);
+
+            // the position and size
+            tb_long_t x = (made % grid) * GB_DEMO_CORE_SCENE_SPACING + gb_demo_core_scene_random(&seed, 8);
+            tb_long_t y = (made / grid) * GB_DEMO_CORE_SCENE_SPACING + gb_demo_core_scene_random(&seed, 8);
+            tb_size_t r = gb_demo_core_scene_random(&seed, 8) + 2;
+            if (made & 1) gb_path_add_circle2i(paths[made], x, y, r, GB_ROTATE_DIRECTION_CW);
+            else gb_path_add_rect2i(paths[made], x, y, r << 1, r, GB_ROTATE_DIRECTION_CW);
+
+            // add it
+            if (!gb_scene_add(scene, paths[made], paints[made % paints_count])) break;
+        }
+        tb_check_break(made == count);
+
+        // build the index
+        tb_hong_t time = tb_uclock();
+        gb_scene_bounds(scene);
+        time = tb_uclock() - time;
+        tb_trace_i("%lu items: index: %lld us", count, time);
+
+        // the viewport at the center of the map, scaled by 2
+        tb_size_t center = (grid * GB_DEMO_CORE_SCENE_SPACING) >> 1;
+        gb_canvas_save_matrix(canvas);
+        gb_canvas_scale(canvas, GB_TWO, GB_TWO);
+        gb_canvas_translate(canvas, -gb_long_to_float(center), -gb_long_to_float(center));
+
+        // draw the visible items
+        gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+        time = tb_uclock();
+        tb_size_t drawn = gb_scene_draw(scene, canvas);
+        time = tb_uclock() - time;
+        tb_trace_i("%lu items: draw %lu visible items: %lld us", count, drawn, time);
+
+        // cull all items by the application
+        gb_rect_t viewport;
+        gb_rect_imake(&viewport, center, center, GB_DEMO_CORE_SCENE_SIZE >> 1, GB_DEMO_CORE_SCENE_SIZE >> 1);
+        tb_size_t i = 0;
+        tb_size_t visible = 0;
+        time = tb_uclock();
+        for (i = 0; i < count; i++)
+        {
+            gb_rect_ref_t bounds = gb_path_bounds(paths[i]);
+            if (    bounds
+                &&  bounds->x <= viewport.x + viewport.w && bounds->x + bounds->w >= viewport.x
+                &&  bounds->y <= viewport.y + viewport.h && bounds->y + bounds->h >= viewport.y)
+                visible++;
+        }
+        time = tb_uclock() - time;
+        tb_trace_i("%lu items: cull %lu visible items without the scene: %lld us", count, visible, time);
+
+        // query the visible items twice, they must be in the drawing order
+        tb_size_t const*    items = tb_null;
+        tb_size_t           queried = gb_scene_query(scene, &viewport, &items);
+        tb_bool_t           ordered = gb_scene_query(scene, &viewport, &items) == queried;
+        for (i = 1; i < queried && ordered; i++) ordered = items[i - 1] < items[i];
+        tb_trace_i("%lu items: query %lu visible items: %s", count, queried, ordered? "ok" : "failed");
+
+        // load matrix
+        gb_canvas_load_matrix(canvas);
+
+        // hit the random points by the scene
+        tb_size_t   hits = 0;
+        gb_point_t  point;
+        tb_size_t   size = grid * GB_DEMO_CORE_SCENE_SPACING;
+        seed = 88675123u;
+        time = tb_uclock();
+        for (i = 0; i < GB_DEMO_CORE_SCENE_HITS; i++)
+        {
+            gb_point_imake(&point, gb_demo_core_scene_random(&seed, (tb_uint32_t)size), gb_demo_core_scene_random(&seed, (tb_uint32_t)size));
+            if (gb_scene_hit(scene, &point) >= 0) hits++;
+        }
+        time = tb_uclock() - time;
+        tb_trace_i("%lu items: hit %lu / %lu points: %lld us", count, hits, (tb_size_t)GB_DEMO_CORE_SCENE_HITS, time);
+
+        // hit the first points by testing all paths
+        tb_bool_t ok = tb_true;
+        seed = 88675123u;
+        time = tb_uclock();
+        for (i = 0; i < GB_DEMO_CORE_SCENE_HITS_ALL; i++)
+        {
+            gb_point_imake(&point, gb_demo_core_scene_random(&seed, (tb_uint32_t)size), gb_demo_core_scene_random(&seed, (tb_uint32_t)size));
+            if (gb_demo_core_scene_hit(paths, paints, paints_count, count, &point) != gb_scene_hit(scene, &point)) ok = tb_false;
+        }
+        time = tb_uclock() - time;
+        tb_trace_i("%lu items: hit %lu points without the scene: %lld us: %s", count, (tb_size_t)GB_DEMO_CORE_SCENE_HITS_ALL, time, ok? "ok" : "failed");
+
+    } while (0);
+
+    // exit scene and paths
+    if (scene) gb_scene_exit(scene);
+    if (paths)
+    {
+        tb_size_t i;
+        for (i = 0; i < made; i++) gb_path_exit(paths[i]);
+        tb_free(paths);
+    }
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * draw the visible items of the large map and pick the items by the scene,
+ * and compare them with culling and picking all paths by the application
+ *
+ * xmake r demo core_scene [items]
+ */
+tb_int_t gb_demo_core_scene_main(tb_int_t argc, tb_char_t** argv)
+{
+    // init bitmap and canvas
+    gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, GB_DEMO_CORE_SCENE_SIZE, GB_DEMO_CORE_SCENE_SIZE, 0, tb_false);
+    gb_canvas_ref_t canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+
+    // init paints
+    tb_size_t       i;
+    gb_paint_ref_t  paints[3];
+    for (i = 0; i < tb_arrayn(paints); i++) paints[i] = gb_paint_init();
+    if (canvas && paints[0] && paints[1] && paints[2])
+    {
+        // init the fill paints
+        gb_paint_mode_set(paints[0], GB_PAINT_MODE_FILL);
+        gb_paint_color_set(paints[0], GB_COLOR_RED);
+        gb_paint_mode_set(paints[1], GB_PAINT_MODE_FILL);
+        gb_paint_color_set(paints[1], GB_COLOR_BLUE);
+
+        // init the stroke paint
+        gb_paint_mode_set(paints[2], GB_PAINT_MODE_STROKE);
+        gb_paint_color_set(paints[2], GB_COLOR_BLACK);
+        gb_paint_stroke_width_set(paints[2], GB_TWO);
+
+        // the given items count? or 10k and 100k items, 1M items need about 1.5G memory for the paths
+        if (argv[1]) gb_demo_core_scene_done(canvas, paints, tb_arrayn(paints), tb_atoi(argv[1]));
+        else
+        {
+            gb_demo_core_scene_done(canvas, paints, tb_arrayn(paints), 10000);
+            gb_demo_core_scene_done(canvas, paints, tb_arrayn(paints), 100000);
+        }
+    }
+
+    // exit paints, canvas and bitmap
+    for (i = 0; i < tb_arrayn(paints); i++) if (paints[i]) gb_paint_exit(paints[i]);
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+    return 0;
+}
@@ -34,12 +34,30 @@ static gb_demo_t g_demo[] =
 {
     // core
     GB_DEMO_MAIN_ITEM(core_path)
+,   GB_DEMO_MAIN_ITEM(core_path_svg)
+,   GB_DEMO_MAIN_ITEM(core_path_data)
+,   GB_DEMO_MAIN_ITEM(core_path_live)
+,   GB_DEMO_MAIN_ITEM(core_path_lod)
+,   GB_DEMO_MAIN_ITEM(core_path_op)
+,   GB_DEMO_MAIN_ITEM(core_float)
+,   GB_DEMO_MAIN_ITEM(core_context)
+,   GB_DEMO_MAIN_ITEM(core_profiler)
+,   GB_DEMO_MAIN_ITEM(core_density)
+,   GB_DEMO_MAIN_ITEM(core_gl_fill)
+,   GB_DEMO_MAIN_ITEM(core_gl_texture)
+,   GB_DEMO_MAIN_ITEM(core_scene)
+,   GB_DEMO_MAIN_ITEM(core_raster_cache)
 ,   GB_DEMO_MAIN_ITEM(core_bitmap)
+,   GB_DEMO_MAIN_ITEM(core_bitmap_view)
 ,   GB_DEMO_MAIN_ITEM(core_vector)
 
     // utils
 ,   GB_DEMO_MAIN_ITEM(utils_mesh)
 ,   GB_DEMO_MAIN_ITEM(utils_geometry)
+,   GB_DEMO_MAIN_ITEM(utils_tessellator)
+
+    // svg
+,   GB_DEMO_MAIN_ITEM(svg_render)
 
     // ohter
 ,   GB_DEMO_MAIN_ITEM(other_test)
@@ -41,12 +41,30 @@
 
 // core
 GB_DEMO_MAIN_DECL(core_path);
+GB_DEMO_MAIN_DECL(core_path_svg);
+GB_DEMO_MAIN_DECL(core_path_data);
+GB_DEMO_MAIN_DECL(core_path_live);
+GB_DEMO_MAIN_DECL(core_path_lod);
+GB_DEMO_MAIN_DECL(core_path_op);
+GB_DEMO_MAIN_DECL(core_float);
+GB_DEMO_MAIN_DECL(core_context);
+GB_DEMO_MAIN_DECL(core_profiler);
+GB_DEMO_MAIN_DECL(core_density);
+GB_DEMO_MAIN_DECL(core_gl_fill);
+GB_DEMO_MAIN_DECL(core_gl_texture);
+GB_DEMO_MAIN_DECL(core_scene);
+GB_DEMO_MAIN_DECL(core_raster_cache);
 GB_DEMO_MAIN_DECL(core_bitmap);
+GB_DEMO_MAIN_DECL(core_bitmap_view);
 GB_DEMO_MAIN_DECL(core_vector);
 
 // utils
 GB_DEMO_MAIN_DECL(utils_mesh);
 GB_DEMO_MAIN_DECL(utils_geometry);
+GB_DEMO_MAIN_DECL(utils_tessellator);
+
+// svg
+GB_DEMO_MAIN_DECL(svg_render);
 
 // other
 GB_DEMO_MAIN_DECL(other_test);
@@ -0,0 +1,132 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */ 
+#include "../demo.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the frame count for rendering
+#define GB_DEMO_SVG_RENDER_FRAMES       (10)
+
+// the maximum canvas size
+#define GB_DEMO_SVG_RENDER_MAXN         (512)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the svg render stats type
+typedef struct __gb_demo_svg_render_stats_t
+{
+    // the file count
+    tb_size_t           count;
+
+    // the shape count
+    tb_size_t           shapes;
+
+    // the total parse time
+    tb_hong_t           parse;
+
+    // the total render time
+    tb_hong_t           render;
+
+}gb_demo_svg_render_stats_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_demo_svg_render_done(tb_char_t const* path, gb_demo_svg_render_stats_t* stats)
+{
+    // load svg
+    tb_hong_t       parse = tb_uclock();
+    gb_svg_ref_t    svg = gb_svg_init_from_url(path);
+    parse = tb_uclock() - parse;
+    if (!svg)
+    {
+        // trace
+        tb_trace_e("load %s failed!", path);
+        return ;
+    }
+
+    // the canvas size
+    gb_rect_ref_t   bounds = gb_svg_bounds(svg);
+    gb_float_t      w = bounds->w > 0? bounds->w : GB_ONE;
+    gb_float_t      h = bounds->h > 0? bounds->h : GB_ONE;
+    gb_float_t      scale = gb_div(gb_long_to_float(GB_DEMO_SVG_RENDER_MAXN), tb_max(w, h));
+    tb_size_t       width = tb_max(1, gb_float_to_long(gb_mul(w, scale)));
+    tb_size_t       height = tb_max(1, gb_float_to_long(gb_mul(h, scale)));
+
+    // init bitmap and canvas
+    tb_hong_t       render = 0;
+    gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, width, height, 0, tb_false);
+    gb_canvas_ref_t canvas = bitmap? gb_canvas_init_from_bitmap(bitmap) : tb_null;
+    if (canvas)
+    {
+        // fit the viewport to the canvas
+        gb_canvas_scale(canvas, scale, scale);
+        gb_canvas_translate(canvas, -bounds->x, -bounds->y);
+
+        // render it 
+        tb_size_t frames = GB_DEMO_SVG_RENDER_FRAMES;
+        render = tb_uclock();
+        while (frames--)
+        {
+            gb_canvas_draw_clear(canvas, GB_COLOR_WHITE);
+            gb_svg_draw(svg, canvas);
+        }
+        render = (tb_uclock() - render) / GB_DEMO_SVG_RENDER_FRAMES;
+    }
+
+    // trace
+    tb_trace_i("%s: shapes: %lu, size: %lux%lu, parse: %lld us, render: %lld us/frame", path, gb_svg_size(svg), width, height, parse, render);
+
+    // update stats
+    stats->count++;
+    stats->shapes += gb_svg_size(svg);
+    stats->parse += parse;
+    stats->render += render;
+
+    // exit canvas and bitmap
+    if (canvas) gb_canvas_exit(canvas);
+    if (bitmap) gb_bitmap_exit(bitmap);
+
+    // exit svg
+    gb_svg_exit(svg);
+}
+static tb_bool_t gb_demo_svg_render_walk(tb_char_t const* path, tb_file_info_t const* info, tb_cpointer_t priv)
+{
+    // check
+    tb_assert_and_check_return_val(path && info && priv, tb_false);
+
+    // the svg file?
+    tb_size_t size = tb_strlen(path);
+    if (info->type == TB_FILE_TYPE_FILE && size > 4 && !tb_stricmp(path + size - 4, ".svg"))
+        gb_demo_svg_render_done(path, (gb_demo_svg_render_stats_t*)priv);
+
+    // continue
+    return tb_true;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ */
+tb_int_t gb_demo_svg_render_main(tb_int_t argc, tb_char_t** argv)
+{
+    // check
+    tb_assert_and_check_return_val(argc > 1 && argv[1], 0);
+
+    // init stats
+    gb_demo_svg_render_stats_t stats = {0};
+
+    // the file or directory
+    tb_file_info_t info = {0};
+    if (tb_file_info(argv[1], &info) && info.type == TB_FILE_TYPE_DIRECTORY)
+        tb_directory_walk(argv[1], tb_true, tb_true, gb_demo_svg_render_walk, &stats);
+    else gb_demo_svg_render_done(argv[1], &stats);
+
+    // trace
+    tb_trace_i("total: files: %lu, shapes: %lu, parse: %lld ms, render: %lld ms/frame", stats.count, stats.shapes, stats.parse / 1000, stats.render / 1000);
+    return 0;
+}
@@ -34,6 +34,61 @@ static tb_void_t gb_demo_utils_geometry_is_ccw()
     if (gb_points_is_ccw(&p1, &p0, &p2)) tb_abort();
     if (gb_points_is_ccw(&p2, &p1, &p0)) tb_abort();
 }
+static tb_void_t gb_demo_utils_geometry_orientation()
+{
+    /* make the almost collinear points
+     *
+     *                                  . p2 (+ulp)
+     *                    . p1         
+     *    . p0   
+     */
+    gb_point_t p0;
+    gb_point_t p1;
+    gb_point_t p2;
+    gb_point_imake(&p0, 1, 1);
+    gb_point_imake(&p1, 3, 3);
+    gb_point_imake(&p2, 7, 7);
+
+    // check the collinear points
+    if (gb_points_orientation(&p0, &p1, &p2)) tb_abort();
+    if (gb_points_orientation(&p2, &p1, &p0)) tb_abort();
+
+    // move p2 up and down with the minimum unit
+#ifdef GB_CONFIG_FLOAT_FIXED
+    gb_float_t ulp = 1;
+#else
+    gb_float_t ulp = 1.0f / (1 << 21);
+#endif
+    gb_float_t y = p2.y;
+    p2.y = y + ulp;
+    if (gb_points_orientation(&p0, &p1, &p2) <= 0) tb_abort();
+    if (!gb_points_is_ccw(&p1, &p0, &p2)) tb_abort();
+    p2.y = y - ulp;
+    if (gb_points_orientation(&p0, &p1, &p2) >= 0) tb_abort();
+    if (gb_points_is_ccw(&p1, &p0, &p2)) tb_abort();
+
+    // clear random
+    tb_random_clear(tb_null);
+
+    // test performance
+    tb_size_t count = 1000000;
+    tb_size_t ccw = 0;
+    tb_hong_t dt = tb_mclock();
+    while (count--)
+    {
+        // make points
+        gb_point_imake(&p0, tb_random_range(tb_null, -GB_WIDTH_MAXN, GB_WIDTH_MAXN), tb_random_range(tb_null, -GB_HEIGHT_MAXN, GB_HEIGHT_MAXN));
+        gb_point_imake(&p1, tb_random_range(tb_null, -GB_WIDTH_MAXN, GB_WIDTH_MAXN), tb_random_range(tb_null, -GB_HEIGHT_MAXN, GB_HEIGHT_MAXN));
+        gb_point_imake(&p2, tb_random_range(tb_null, -GB_WIDTH_MAXN, GB_WIDTH_MAXN), tb_random_range(tb_null, -GB_HEIGHT_MAXN, GB_HEIGHT_MAXN));
+
+        // compute orientation
+        if (gb_points_orientation(&p0, &p1, &p2) > 0) ccw++;
+    }
+    dt = tb_mclock() - dt;
+
+    // trace
+    tb_trace_i("orientation: ccw: %lu, time: %lld ms", ccw, dt);
+}
 static tb_void_t gb_demo_utils_geometry_in_point()
 {
     /* make points
@@ -157,6 +212,9 @@ tb_int_t gb_demo_utils_geometry_main(tb_int_t argc, tb_char_t** argv)
     // test is ccw
     gb_demo_utils_geometry_is_ccw();
 
+    // test orientation
+    gb_demo_utils_geometry_orientation();
+
     // test in point
     gb_demo_utils_geometry_in_point();
 
@@ -556,6 +556,70 @@ static tb_void_t gb_demo_utils_mesh_tetrahedron()
         gb_mesh_exit(mesh);
     }
 }
+static tb_size_t gb_demo_utils_mesh_polygon(gb_mesh_ref_t mesh, tb_size_t count)
+{
+    // make a clockwise self-loop edge
+    gb_mesh_edge_ref_t edge = gb_mesh_edge_make_loop(mesh, tb_false);
+    tb_assert_and_check_return_val(edge, 0);
+
+    // make a polygon with the given edges count
+    tb_size_t i = 0;
+    for (i = 1; i < count; i++) gb_mesh_edge_split(mesh, edge);
+
+    // triangulate it as a fan
+    for (i = 3; i < count; i++)
+    {
+        gb_mesh_edge_ref_t edge_new = gb_mesh_edge_connect(mesh, gb_mesh_edge_lnext(edge), edge);
+        tb_assert_and_check_break(edge_new);
+
+        // the remaining polygon
+        edge = gb_mesh_edge_sym(edge_new);
+    }
+
+    // the edges count
+    return tb_iterator_size(gb_mesh_edge_itor(mesh));
+}
+static tb_void_t gb_demo_utils_mesh_bench(tb_size_t count, tb_size_t round, tb_bool_t reuse)
+{
+    // the elements without the user free function, the same as the tessellator
+    tb_element_t element = tb_element_mem(sizeof(tb_size_t), tb_null, tb_null);
+
+    // done
+    tb_size_t       i = 0;
+    tb_hize_t       edges = 0;
+    gb_mesh_ref_t   mesh = tb_null;
+    tb_hong_t       time = tb_mclock();
+    for (i = 0; i < round; i++)
+    {
+        // init mesh or clear the previous mesh for reusing it
+        if (!mesh) mesh = gb_mesh_init(element, element, element);
+        else gb_mesh_clear(mesh);
+        tb_assert_and_check_break(mesh);
+
+        // make polygon
+        edges += gb_demo_utils_mesh_polygon(mesh, count);
+
+        // exit mesh if not reuse it
+        if (!reuse)
+        {
+            gb_mesh_exit(mesh);
+            mesh = tb_null;
+        }
+    }
+    time = tb_mclock() - time;
+
+    // exit mesh
+    if (mesh) gb_mesh_exit(mesh);
+
+    // trace
+    tb_trace_i("bench: %s, polygon: %lu, rounds: %lu, edges: %llu, time: %lld ms, %llu edges/s"
+        ,   reuse? "reuse" : "fresh"
+        ,   count
+        ,   round
+        ,   edges
+        ,   time
+        ,   time? (edges * 1000) / time : 0);
+}
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * main
@@ -577,5 +641,14 @@ tb_int_t gb_demo_utils_mesh_main(tb_int_t argc, tb_char_t** argv)
     // test tetrahedron
     gb_demo_utils_mesh_tetrahedron();
 
+    // the benchmark of making and clearing the polygon meshes, e.g. xmake r demo utils_mesh [polygon] [rounds]
+    tb_size_t count = (argc > 1)? tb_atoi(argv[1]) : 64;
+    tb_size_t round = (argc > 2)? tb_atoi(argv[2]) : 10000;
+    if (count >= 3 && round)
+    {
+        gb_demo_utils_mesh_bench(count, round, tb_false);
+        gb_demo_utils_mesh_bench(count, round, tb_true);
+    }
+
     return 0;
 }
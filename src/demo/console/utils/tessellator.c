@@ -0,0 +1,214 @@
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "../demo.h"
+#include "../../core/tiger.g"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the tessellator stats demo type
+typedef struct __gb_demo_utils_tessellator_t
+{
+    // the stats stream
+    tb_stream_ref_t         stream;
+
+    // the current path index
+    tb_size_t               index;
+
+    // the slowest path index
+    tb_size_t               slowest;
+
+    // the stats of the slowest path
+    gb_tessellator_stats_t  stats;
+
+    // the total stats
+    gb_tessellator_stats_t  total;
+
+    // the output triangles count
+    tb_size_t               triangles;
+
+    // the output points count
+    tb_size_t               points;
+
+    // the invalid indices count
+    tb_size_t               invalid;
+
+}gb_demo_utils_tessellator_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_demo_utils_tessellator_func(gb_point_ref_t points, tb_uint16_t count, tb_cpointer_t priv)
+{
+    // check
+    gb_demo_utils_tessellator_t* demo = (gb_demo_utils_tessellator_t*)priv;
+    tb_assert_and_check_return(demo && count);
+
+    // count the triangle and its points, the contour is closed
+    demo->triangles++;
+    demo->points += count - 1;
+}
+static tb_void_t gb_demo_utils_tessellator_indexed_func(gb_point_ref_t points, tb_size_t points_count, tb_uint16_t const* indices, tb_size_t indices_count, tb_cpointer_t priv)
+{
+    // check
+    gb_demo_utils_tessellator_t* demo = (gb_demo_utils_tessellator_t*)priv;
+    tb_assert_and_check_return(demo && points && indices && !(indices_count % 3));
+
+    // count the triangles and the shared points
+    demo->triangles += indices_count / 3;
+    demo->points    += points_count;
+
+    // check indices
+    while (indices_count--) if (*indices++ >= points_count) demo->invalid++;
+}
+static tb_void_t gb_demo_utils_tessellator_stats_func(gb_tessellator_stats_ref_t stats, tb_cpointer_t priv)
+{
+    // check
+    gb_demo_utils_tessellator_t* demo = (gb_demo_utils_tessellator_t*)priv;
+    tb_assert_and_check_return(demo && stats);
+
+    // dump the stats of this polygon
+    if (demo->stream) gb_tessellator_stats_dump(stats, demo->stream);
+
+    // the slowest polygon?
+    if (stats->total > demo->stats.total)
+    {
+        demo->stats     = *stats;
+        demo->slowest   = demo->index;
+    }
+
+    // update the total stats
+    demo->total.total           += stats->total;
+    demo->total.mesh            += stats->mesh;
+    demo->total.monotone        += stats->monotone;
+    demo->total.triangulation   += stats->triangulation;
+    demo->total.convex_merge    += stats->convex_merge;
+    demo->total.output          += stats->output;
+    demo->total.intersections   += stats->intersections;
+    demo->total.outputs         += stats->outputs;
+    demo->total.points          += stats->points;
+}
+static tb_bool_t gb_demo_utils_tessellator_closed(gb_polygon_ref_t polygon)
+{
+    // check
+    tb_check_return_val(polygon && polygon->points && polygon->counts, tb_false);
+
+    // all contours are closed? the tessellator only accepts the closed contours
+    gb_point_ref_t      points = polygon->points;
+    tb_uint16_t const*  counts = polygon->counts;
+    while (*counts)
+    {
+        if (!gb_point_eq(points, points + *counts - 1)) return tb_false;
+        points += *counts++;
+    }
+
+    // ok
+    return tb_true;
+}
+
+static tb_void_t gb_demo_utils_tessellator_done(gb_tessellator_ref_t tessellator, gb_demo_utils_tessellator_t* demo)
+{
+    // tessellate the tiger paths
+    tb_size_t count = tb_arrayn(g_demo_tiger) >> 1;
+    for (demo->index = 0; demo->index < count; demo->index++)
+    {
+        gb_path_ref_t path = gb_path_init_from_svg_data(g_demo_tiger[(demo->index << 1) + 1]);
+        if (path)
+        {
+            gb_polygon_ref_t polygon = gb_path_polygon(path);
+            if (gb_demo_utils_tessellator_closed(polygon))
+                gb_tessellator_done(tessellator, polygon, gb_path_bounds(path));
+            gb_path_exit(path);
+        }
+    }
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * main
+ *
+ * tessellate the tiger paths and dump the stats of each polygon as json lines to the temporary directory,
+ * and compare the triangulation mode with the indexed mode
+ *
+ * xmake r demo utils_tessellator
+ */
+tb_int_t gb_demo_utils_tessellator_main(tb_int_t argc, tb_char_t** argv)
+{
+    // init demo
+    gb_demo_utils_tessellator_t demo;
+    tb_memset(&demo, 0, sizeof(gb_demo_utils_tessellator_t));
+
+    // init the stats stream
+    tb_char_t file[TB_PATH_MAXN] = {0};
+    if (tb_directory_temporary(file, sizeof(file) - 32))
+    {
+        tb_strcat(file, "/tessellator_stats.json");
+        demo.stream = tb_stream_init_from_file(file, TB_FILE_MODE_RW | TB_FILE_MODE_CREAT | TB_FILE_MODE_BINARY | TB_FILE_MODE_TRUNC);
+        if (demo.stream && !tb_stream_open(demo.stream))
+        {
+            tb_stream_exit(demo.stream);
+            demo.stream = tb_null;
+        }
+    }
+
+    // init tessellator
+    gb_tessellator_ref_t tessellator = gb_tessellator_init();
+    if (tessellator)
+    {
+        // init tessellator
+        gb_tessellator_mode_set(tessellator, GB_TESSELLATOR_MODE_CONVEX);
+        gb_tessellator_rule_set(tessellator, GB_TESSELLATOR_RULE_NONZERO);
+        gb_tessellator_func_set(tessellator, gb_demo_utils_tessellator_func, &demo);
+        gb_tessellator_stats_func_set(tessellator, gb_demo_utils_tessellator_stats_func, &demo);
+
+        // tessellate the tiger paths
+        gb_demo_utils_tessellator_done(tessellator, &demo);
+
+        // trace
+        tb_trace_i("total: %lld us, points: %lu, intersections: %lu, outputs: %lu", demo.total.total, demo.total.points, demo.total.intersections, demo.total.outputs);
+        tb_trace_i("phases: mesh: %lld us, monotone: %lld us, triangulation: %lld us, convex: %lld us, output: %lld us"
+            ,   demo.total.mesh
+            ,   demo.total.monotone
+            ,   demo.total.triangulation
+            ,   demo.total.convex_merge
+            ,   demo.total.output);
+        tb_trace_i("slowest: path %lu, %lld us, points: %lu, events: %lu, regions: %lu, intersections: %lu"
+            ,   demo.slowest
+            ,   demo.stats.total
+            ,   demo.stats.points
+            ,   demo.stats.events
+            ,   demo.stats.regions
+            ,   demo.stats.intersections);
+        if (demo.stream) tb_trace_i("stats: %s", file);
+
+        // disable stats
+        gb_tessellator_stats_func_set(tessellator, tb_null, tb_null);
+
+        // make the triangles with the duplicated points
+        demo.triangles  = 0;
+        demo.points     = 0;
+        gb_tessellator_mode_set(tessellator, GB_TESSELLATOR_MODE_TRIANGULATION);
+        tb_hong_t time = tb_uclock();
+        gb_demo_utils_tessellator_done(tessellator, &demo);
+        time = tb_uclock() - time;
+        tb_trace_i("triangulation: %lld us, triangles: %lu, points: %lu", time, demo.triangles, demo.points);
+
+        // make the indexed triangles with the shared points
+        demo.triangles  = 0;
+        demo.points     = 0;
+        gb_tessellator_mode_set(tessellator, GB_TESSELLATOR_MODE_INDEXED);
+        gb_tessellator_indexed_func_set(tessellator, gb_demo_utils_tessellator_indexed_func, &demo);
+        time = tb_uclock();
+        gb_demo_utils_tessellator_done(tessellator, &demo);
+        time = tb_uclock() - time;
+        tb_trace_i("indexed: %lld us, triangles: %lu, points: %lu, indices: %s", time, demo.triangles, demo.points, demo.invalid? "failed" : "ok");
+
+        // exit tessellator
+        gb_tessellator_exit(tessellator);
+    }
+
+    // exit the stats stream
+    if (demo.stream) tb_stream_exit(demo.stream);
+    return 0;
+}
@@ -32,7 +32,7 @@ target("console")
     end
 
     -- add packages
-    add_options("tbox", "opengl", "skia", "png", "jpeg", "freetype", "zlib", "base")
+    add_options("tbox", "opengl", "egl", "skia", "png", "jpeg", "freetype", "zlib", "base")
 
     -- add the source files
     add_files("**.c") 
@@ -15,6 +15,7 @@ tb_bool_t gb_application_init(gb_application_ref_t application, gb_window_info_r
     // init window
     info->title         = "demo";
     info->framerate     = 60;
+    info->flag          = GB_WINDOW_FLAG_ON_DEMAND;
     info->width         = 640;
     info->height        = 640;
     info->init          = gb_demo_init;
@@ -91,6 +91,18 @@ static tb_byte_t        g_alpha = 255;
 // transform it?
 static tb_bool_t        g_transform = tb_false;
 
+// the fill mode of the device
+static tb_size_t        g_fill_mode = GB_DEVICE_FILL_MODE_TESSELLATOR;
+
+// the shader type
+static tb_size_t        g_shader_type = GB_SHADER_TYPE_NONE;
+
+// the shaders
+static gb_shader_ref_t  g_shaders[GB_SHADER_TYPE_BITMAP + 1];
+
+// the bitmap of the bitmap shader
+static gb_bitmap_ref_t  g_bitmap = tb_null;
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
@@ -107,6 +119,59 @@ static tb_void_t gb_demo_info(tb_bool_t killed, tb_cpointer_t priv)
     tb_trace_i("framerate: %{float}", &framerate);
 }
 
+static gb_bitmap_ref_t gb_demo_bitmap()
+{
+    // make the checkerboard bitmap
+    gb_bitmap_ref_t bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_ARGB8888, 64, 64, 0, tb_true);
+    gb_pixmap_ref_t pixmap = gb_pixmap(GB_PIXFMT_ARGB8888, 0xff);
+    tb_check_return_val(bitmap && pixmap, bitmap);
+
+    // fill it
+    tb_size_t   x;
+    tb_size_t   y;
+    tb_byte_t*  data = (tb_byte_t*)gb_bitmap_data(bitmap);
+    for (y = 0; y < 64; y++)
+    {
+        for (x = 0; x < 64; x++)
+            pixmap->color_set(data + y * gb_bitmap_row_bytes(bitmap) + (x << 2), ((x >> 4) + (y >> 4)) & 1? GB_COLOR_BLUE : GB_COLOR_YELLOW);
+    }
+
+    // ok
+    return bitmap;
+}
+static gb_shader_ref_t gb_demo_shader(gb_canvas_ref_t canvas)
+{
+    // check
+    tb_check_return_val(g_shader_type != GB_SHADER_TYPE_NONE && g_shader_type < tb_arrayn(g_shaders), tb_null);
+
+    // the shader has been made?
+    if (g_shaders[g_shader_type]) return g_shaders[g_shader_type];
+
+    // the gradient
+    gb_color_t      colors[3] = {GB_COLOR_RED, GB_COLOR_GREEN, GB_COLOR_BLUE};
+    gb_gradient_t   gradient = {colors, tb_null, 3};
+
+    // make shader
+    switch (g_shader_type)
+    {
+    case GB_SHADER_TYPE_LINEAR:
+        g_shaders[g_shader_type] = gb_shader_init2i_linear(canvas, GB_SHADER_MODE_MIRROR, &gradient, -100, 0, 100, 0);
+        break;
+    case GB_SHADER_TYPE_RADIAL:
+        g_shaders[g_shader_type] = gb_shader_init2i_radial(canvas, GB_SHADER_MODE_REPEAT, &gradient, 0, 0, 100);
+        break;
+    case GB_SHADER_TYPE_BITMAP:
+        if (!g_bitmap) g_bitmap = gb_demo_bitmap();
+        if (g_bitmap) g_shaders[g_shader_type] = gb_shader_init_bitmap(canvas, GB_SHADER_MODE_REPEAT, g_bitmap);
+        break;
+    default:
+        break;
+    }
+
+    // ok
+    return g_shaders[g_shader_type];
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -156,6 +221,17 @@ tb_void_t gb_demo_exit(gb_window_ref_t window, gb_canvas_ref_t canvas, tb_cpoint
         // done clos
         if (g_entries[index].exit) g_entries[index].exit(window);
     }
+
+    // exit shaders
+    for (index = 0; index < tb_arrayn(g_shaders); index++)
+    {
+        if (g_shaders[index]) gb_shader_exit(g_shaders[index]);
+        g_shaders[index] = tb_null;
+    }
+
+    // exit bitmap
+    if (g_bitmap) gb_bitmap_exit(g_bitmap);
+    g_bitmap = tb_null;
 }
 tb_void_t gb_demo_draw(gb_window_ref_t window, gb_canvas_ref_t canvas, tb_cpointer_t priv)
 {
@@ -163,6 +239,9 @@ tb_void_t gb_demo_draw(gb_window_ref_t window, gb_canvas_ref_t canvas, tb_cpoint
     tb_assert(window && canvas);
     tb_assert(g_index < tb_arrayn(g_entries));
 
+    // apply the fill mode
+    gb_device_fill_mode_set(gb_canvas_device(canvas), g_fill_mode);
+
     // clear it
     gb_canvas_draw_clear(canvas, GB_COLOR_DEFAULT);
 
@@ -185,9 +264,15 @@ tb_void_t gb_demo_draw(gb_window_ref_t window, gb_canvas_ref_t canvas, tb_cpoint
     // apply alpha
     gb_canvas_alpha_set(canvas, g_alpha);
 
+    // apply shader
+    gb_canvas_shader_set(canvas, gb_demo_shader(canvas));
+
     // done draw
     entry->draw(window, canvas);
 
+    // clear shader
+    gb_canvas_shader_set(canvas, tb_null);
+
     // leave matrix
     gb_canvas_load_matrix(canvas);
 }
@@ -251,6 +336,14 @@ tb_void_t gb_demo_event(gb_window_ref_t window, gb_event_ref_t event, tb_cpointe
         case 't':
             g_transform = !g_transform;
             break;
+        case 's':
+            g_fill_mode = (g_fill_mode == GB_DEVICE_FILL_MODE_STENCIL)? GB_DEVICE_FILL_MODE_TESSELLATOR : GB_DEVICE_FILL_MODE_STENCIL;
+            tb_trace_i("fill mode: %s", g_fill_mode == GB_DEVICE_FILL_MODE_STENCIL? "stencil" : "tessellator");
+            break;
+        case 'g':
+            g_shader_type = (g_shader_type + 1) % tb_arrayn(g_shaders);
+            tb_trace_i("shader: %lu", g_shader_type);
+            break;
         case 'i':
             tb_timer_task_post(gb_window_timer(window), 1000, tb_true, gb_demo_info, (tb_cpointer_t)window);
             break;
@@ -318,5 +411,8 @@ tb_void_t gb_demo_event(gb_window_ref_t window, gb_event_ref_t event, tb_cpointe
 
     // done event
     entry->event(window, event);
+
+    // redraw it, the window only draws the invalidated frames
+    gb_window_invalidate(window, tb_null);
 }
 
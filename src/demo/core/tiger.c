@@ -49,11 +49,6 @@ static tb_size_t                    g_tiger_entries_count = 0;
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
-static __tb_inline__ tb_char_t const* gb_demo_tiger_entry_skip_separator(tb_char_t const* p)
-{
-	while (*p && (tb_isspace(*p) || *p == ',')) p++;
-	return p;
-}
 static tb_char_t const* gb_demo_tiger_entry_init_float(tb_char_t const* p, gb_float_t* value)
 {
     // skip space
@@ -228,320 +223,13 @@ static tb_void_t gb_demo_tiger_entry_init_style(gb_demo_tiger_entry_ref_t entry,
         else p++;
     }
 }
-static tb_char_t const* gb_demo_tiger_entry_init_path_d_xoy(gb_demo_tiger_entry_ref_t entry, tb_char_t const* p, tb_char_t mode)
-{
-    // xoy
-    gb_float_t xoy = 0; p = gb_demo_tiger_entry_init_float(p, &xoy); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // trace
-    tb_trace_d("path: d: %c: %{float}", mode, &(xoy));
-
-    // done path
-    if (entry->path)
-    {
-        // last point
-        gb_point_t pt = {0};
-        gb_path_last(entry->path, &pt);
-
-        // done
-        switch (mode)
-        {
-            case 'H':
-                gb_path_line2_to(entry->path, xoy, pt.y);
-                break;
-            case 'h':
-                gb_path_line2_to(entry->path, pt.x + xoy, pt.y);
-                break;
-            case 'V':
-                gb_path_line2_to(entry->path, pt.x, xoy);
-                break;
-            case 'v':
-                gb_path_line2_to(entry->path, pt.x, pt.y + xoy);
-                break;
-            default:
-                tb_trace_noimpl();
-                break;
-        }
-    }
-
-    // ok
-    return p;
-}
-static tb_char_t const* gb_demo_tiger_entry_init_path_d_xy1(gb_demo_tiger_entry_ref_t entry, tb_char_t const* p, tb_char_t mode)
-{
-    // x1
-    gb_float_t x1 = 0; p = gb_demo_tiger_entry_init_float(p, &x1); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y1
-    gb_float_t y1 = 0; p = gb_demo_tiger_entry_init_float(p, &y1); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // trace
-    tb_trace_d("path: d: %c: %{float}, %{float}", mode, &(x1), &(y1));
-
-    // init path
-    if (!entry->path) entry->path = gb_path_init();
-
-    // done path
-    if (entry->path)
-    {
-        // last point
-        gb_point_t pt = {0};
-        gb_path_last(entry->path, &pt);
-
-        // done
-        switch (mode)
-        {
-            case 'M':
-                gb_path_move2_to(entry->path, x1, y1);
-                break;
-            case 'm':
-                gb_path_move2_to(entry->path, pt.x + x1, pt.y + y1);
-                break;
-            case 'L':
-                gb_path_line2_to(entry->path, x1, y1);
-                break;
-            case 'l':
-                gb_path_line2_to(entry->path, pt.x + x1, pt.y + y1);
-                break;
-            default:
-                tb_trace_noimpl();
-                break;
-        }
-    }
-
-    // ok
-    return p;
-}
-static tb_char_t const* gb_demo_tiger_entry_init_path_d_xy2(gb_demo_tiger_entry_ref_t entry, tb_char_t const* p, tb_char_t mode)
-{
-    // x1
-    gb_float_t x1 = 0; p = gb_demo_tiger_entry_init_float(p, &x1); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y1
-    gb_float_t y1 = 0; p = gb_demo_tiger_entry_init_float(p, &y1); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // x2
-    gb_float_t x2 = 0; p = gb_demo_tiger_entry_init_float(p, &x2); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y2
-    gb_float_t y2 = 0; p = gb_demo_tiger_entry_init_float(p, &y2); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // trace
-    tb_trace_d("path: d: %c: %{float}, %{float}, %{float}, %{float}", mode, &(x1), &(y1), &(x2), &(y2));
-
-    // init path
-    if (!entry->path) entry->path = gb_path_init();
-
-    // done path
-    if (entry->path)
-    {
-        // done
-        switch (mode)
-        {
-            case 'Q':
-                gb_path_quad2_to(entry->path, x1, y1, x2, y2);
-                break;
-            case 'q':
-                {
-                    gb_point_t pt = {0};
-                    gb_path_last(entry->path, &pt);
-                    gb_path_quad2_to(entry->path, pt.x + x1, pt.y + y1, pt.x + x2, pt.y + y2);
-                }
-                break;
-            default:
-                tb_trace_noimpl();
-                break;
-        }
-    }
-
-    // ok
-    return p;
-}
-static tb_char_t const* gb_demo_tiger_entry_init_path_d_xy3(gb_demo_tiger_entry_ref_t entry, tb_char_t const* p, tb_char_t mode)
-{
-    // x1
-    gb_float_t x1 = 0; p = gb_demo_tiger_entry_init_float(p, &x1); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y1
-    gb_float_t y1 = 0; p = gb_demo_tiger_entry_init_float(p, &y1); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // x2
-    gb_float_t x2 = 0; p = gb_demo_tiger_entry_init_float(p, &x2); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y2
-    gb_float_t y2 = 0; p = gb_demo_tiger_entry_init_float(p, &y2); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // x3
-    gb_float_t x3 = 0; p = gb_demo_tiger_entry_init_float(p, &x3); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y3
-    gb_float_t y3 = 0; p = gb_demo_tiger_entry_init_float(p, &y3); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // trace
-    tb_trace_d("path: d: %c: %{float}, %{float}, %{float}, %{float}, %{float}, %{float}", mode, &(x1), &(y1), &(x2), &(y2), &(x3), &(y3));
-
-    // init path
-    if (!entry->path) entry->path = gb_path_init();
-
-    // done path
-    if (entry->path)
-    {
-        // done
-        switch (mode)
-        {
-            case 'C':
-                gb_path_cubic2_to(entry->path, x1, y1, x2, y2, x3, y3);
-                break;
-            case 'c':
-                {
-                    gb_point_t pt = {0};
-                    gb_path_last(entry->path, &pt);
-                    gb_path_cubic2_to(entry->path, pt.x + x1, pt.y + y1, pt.x + x2, pt.y + y2, pt.x + x3, pt.y + y3);
-                }
-                break;
-            default:
-                tb_trace_noimpl();
-                break;
-        }
-    }
-
-    // ok
-    return p;
-}
-static tb_char_t const* gb_demo_tiger_entry_init_path_d_a(gb_demo_tiger_entry_ref_t entry, tb_char_t const* p, tb_char_t mode)
-{
-    // rx
-    gb_float_t rx = 0; p = gb_demo_tiger_entry_init_float(p, &rx); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // ry
-    gb_float_t ry = 0; p = gb_demo_tiger_entry_init_float(p, &ry); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // x-axis-rotation
-    gb_float_t xr = 0; p = gb_demo_tiger_entry_init_float(p, &xr); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // large-arc-flag
-    gb_float_t af = 0; p = gb_demo_tiger_entry_init_float(p, &af); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // sweep-flag
-    gb_float_t sf = 0; p = gb_demo_tiger_entry_init_float(p, &sf); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // x
-    gb_float_t x = 0; p = gb_demo_tiger_entry_init_float(p, &x); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // y
-    gb_float_t y = 0; p = gb_demo_tiger_entry_init_float(p, &y); p = gb_demo_tiger_entry_skip_separator(p);
-
-    // trace
-    tb_trace_d("path: a: %c: %{float}, %{float}, %{float}, %{float}, %{float}, %{float}, %{float}", mode, &(rx), &(ry), &(xr), &(af), &(sf), &(x), &(y));
-
-    // init path
-    if (!entry->path) entry->path = gb_path_init();
-
-    // done path
-    if (entry->path)
-    {
-        // last point
-        gb_point_t pt = {0};
-        gb_path_last(entry->path, &pt);
-
-        // absolute x & y
-        if (mode == 'a') 
-        {
-            x += pt.x;
-            y += pt.y;
-        }
-
-        // arc-to
-//        gb_path_arc2_to(entry->path, x0, y0, rx, ry, ab, an);
-
-        // noimpl
-        tb_trace_noimpl();
-    }
-
-    // ok
-    return p;
-}
-static tb_char_t const* gb_demo_tiger_entry_init_path_d_z(gb_demo_tiger_entry_ref_t entry, tb_char_t const* data, tb_char_t mode)
-{
-    // trace
-    tb_trace_d("path: d: z");
-
-    // close path
-    if (entry->path) gb_path_clos(entry->path);
-
-    // ok
-    return data;
-}
-static tb_void_t gb_demo_tiger_entry_init_path(gb_demo_tiger_entry_ref_t entry, tb_char_t const* path)
-{
-    // check
-    tb_assert(entry && path);
-
-    // trace
-    tb_trace_d("path: d");
-
-    // done
-    tb_char_t const*    p = path;
-    tb_char_t           l = '\0';
-    tb_char_t           m = *p++;
-    while (m)
-    {
-        tb_size_t d = 0;
-        switch (m)
-        {
-        case 'M':
-        case 'm':
-        case 'L':
-        case 'l':
-        case 'T':
-        case 't':
-            p = gb_demo_tiger_entry_init_path_d_xy1(entry, p, m); l = m;
-            break;
-        case 'H':
-        case 'h':
-        case 'V':
-        case 'v':
-            p = gb_demo_tiger_entry_init_path_d_xoy(entry, p, m); l = m;
-            break;
-        case 'S':
-        case 's':
-        case 'Q':
-        case 'q':
-            p = gb_demo_tiger_entry_init_path_d_xy2(entry, p, m); l = m;
-            break;
-        case 'C':
-        case 'c':
-            p = gb_demo_tiger_entry_init_path_d_xy3(entry, p, m); l = m;
-            break;
-        case 'A':
-        case 'a':
-            p = gb_demo_tiger_entry_init_path_d_a(entry, p, m); l = m;
-            break;
-        case 'Z':
-        case 'z':
-            p = gb_demo_tiger_entry_init_path_d_z(entry, p, m); l = m;
-            break;
-        default:
-            d = 1;
-            break;
-        }
-
-        // no mode? use the last mode
-        if (d && (tb_isdigit(m) || m == '.' || m == '-')) 
-        {
-            m = l;
-            p--;
-        }
-        else m = *p++;
-    }
-}
 static tb_void_t gb_demo_tiger_entry_init(gb_demo_tiger_entry_ref_t entry, tb_char_t const* style, tb_char_t const* path)
 {
     // init style
     gb_demo_tiger_entry_init_style(entry, style);
 
     // init path
-    gb_demo_tiger_entry_init_path(entry, path);
+    entry->path = gb_path_init_from_svg_data(path);
 }
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -41,9 +41,15 @@ typedef struct __gb_bitmap_impl_t
 	// the size
 	tb_size_t 			size;
 
+	// the capacity of the data, the bitmap can be resized to be larger again within it
+	tb_size_t 			maxn;
+
 	// is owner?
 	tb_uint8_t 			is_owner    : 1;
 
+	// is view? the data is shared with the parent bitmap
+	tb_uint8_t 			is_view     : 1;
+
 	// has alpha?
 	tb_uint8_t 			has_alpha   : 1;
 
@@ -59,8 +65,78 @@ typedef struct __gb_bitmap_impl_t
 	// the lpitch
 	tb_uint16_t         row_bytes;
 
+    // the version, it is unique for all bitmaps
+    tb_size_t           version;
+
+    // the parent bitmap of the view, the versions of the view and parent are changed together
+    struct __gb_bitmap_impl_t* parent;
+
 }gb_bitmap_impl_t;
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+// the last bitmap version
+static tb_atomic_t      g_version = 0;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static __tb_inline__ tb_size_t gb_bitmap_version_make()
+{
+    // make a new version which is unique for all bitmaps, so the reused bitmap address will not hit the old caches
+    return (tb_size_t)tb_atomic_add_and_fetch(&g_version, 1);
+}
+static tb_bool_t gb_bitmap_data_done(gb_bitmap_ref_t bitmap, tb_pointer_t data, tb_size_t pixfmt, tb_size_t width, tb_size_t height, tb_size_t row_bytes, tb_bool_t has_alpha, tb_bool_t attach)
+{
+    // check
+	gb_bitmap_impl_t* impl = (gb_bitmap_impl_t*)bitmap;
+	tb_assert_and_check_return_val(impl && data, tb_false);
+
+    // done
+    tb_bool_t ok = tb_false;
+    do
+    {
+        // check
+        tb_assert_and_check_break(width && width <= GB_WIDTH_MAXN && height && height <= GB_HEIGHT_MAXN);
+
+        // the pixmap, only using btp
+        gb_pixmap_ref_t pixmap = gb_pixmap(pixfmt, 0xff);
+        tb_assert_and_check_break(pixmap);
+
+        // the row bytes
+        if (!row_bytes) row_bytes = width * pixmap->btp;
+        tb_assert_and_check_break(row_bytes && row_bytes >= width * pixmap->btp);
+
+        // exit it first
+        if (impl->data && impl->data != data && impl->is_owner) tb_free(impl->data);
+
+        // the attached data is not owned by the bitmap, but keep it if the data is not changed
+        if (attach && impl->data != data) impl->is_owner = 0;
+        impl->is_view       = 0;
+        impl->parent        = tb_null;
+
+        // update bitmap 
+        impl->pixfmt        = (tb_uint16_t)pixfmt;
+        impl->width 	    = (tb_uint16_t)width;
+        impl->height 	    = (tb_uint16_t)height;
+        impl->data          = data;
+        impl->size          = row_bytes * height;
+        impl->maxn          = impl->size;
+        impl->row_bytes 	= (tb_uint16_t)row_bytes;
+        impl->has_alpha     = !!has_alpha;
+        impl->version       = gb_bitmap_version_make();
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // ok?
+    return ok;
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -93,9 +169,11 @@ gb_bitmap_ref_t gb_bitmap_init(tb_pointer_t data, tb_size_t pixfmt, tb_size_t wi
         impl->height 	    = (tb_uint16_t)height;
         impl->row_bytes 	= (tb_uint16_t)row_bytes;
         impl->size 	        = row_bytes * height;
+        impl->maxn 	        = impl->size;
         impl->data          = data? data : tb_malloc0(impl->size);
         impl->has_alpha     = !!has_alpha;
         impl->is_owner      = !data;
+        impl->version       = gb_bitmap_version_make();
         tb_assert_and_check_break(impl->data);
 
         // ok
@@ -114,6 +192,62 @@ gb_bitmap_ref_t gb_bitmap_init(tb_pointer_t data, tb_size_t pixfmt, tb_size_t wi
     // ok?
     return (gb_bitmap_ref_t)impl;
 }
+gb_bitmap_ref_t gb_bitmap_init_view(gb_bitmap_ref_t bitmap, tb_size_t x, tb_size_t y, tb_size_t width, tb_size_t height)
+{
+    // check
+	gb_bitmap_impl_t* parent = (gb_bitmap_impl_t*)bitmap;
+	tb_assert_and_check_return_val(parent && parent->data, tb_null);
+
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_bitmap_impl_t*   impl = tb_null;
+    do
+    {
+        // check
+        tb_assert_and_check_break(width && height && x + width <= parent->width && y + height <= parent->height);
+
+        // the pixmap, only using btp
+        gb_pixmap_ref_t pixmap = gb_pixmap(parent->pixfmt, 0xff);
+        tb_assert_and_check_break(pixmap);
+
+        // make bitmap
+        impl = tb_malloc0_type(gb_bitmap_impl_t);
+        tb_assert_and_check_break(impl);
+
+        /* init view, share the parent data and row bytes
+         *
+         * the size is only the span from the first pixel to the last pixel of the view, 
+         * so the view will never touch the data after the parent
+         */
+        impl->pixfmt        = parent->pixfmt;
+        impl->width 	    = (tb_uint16_t)width;
+        impl->height 	    = (tb_uint16_t)height;
+        impl->row_bytes 	= parent->row_bytes;
+        impl->size 	        = (height - 1) * parent->row_bytes + width * pixmap->btp;
+        impl->maxn 	        = impl->size;
+        impl->data          = (tb_byte_t*)parent->data + y * parent->row_bytes + x * pixmap->btp;
+        impl->has_alpha     = parent->has_alpha;
+        impl->is_owner      = 0;
+        impl->is_view       = 1;
+        impl->version       = gb_bitmap_version_make();
+        impl->parent        = parent;
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_bitmap_exit((gb_bitmap_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_bitmap_ref_t)impl;
+}
 gb_bitmap_ref_t gb_bitmap_init_from_url(tb_size_t pixfmt, tb_char_t const* url)
 {
     // check
@@ -185,45 +319,13 @@ tb_pointer_t gb_bitmap_data(gb_bitmap_ref_t bitmap)
 }
 tb_bool_t gb_bitmap_data_set(gb_bitmap_ref_t bitmap, tb_pointer_t data, tb_size_t pixfmt, tb_size_t width, tb_size_t height, tb_size_t row_bytes, tb_bool_t has_alpha)
 {
-    // check
-	gb_bitmap_impl_t* impl = (gb_bitmap_impl_t*)bitmap;
-	tb_assert_and_check_return_val(impl && data, tb_false);
-
-    // done
-    tb_bool_t ok = tb_false;
-    do
-    {
-        // check
-        tb_assert_and_check_break(width && width <= GB_WIDTH_MAXN && height && height <= GB_HEIGHT_MAXN);
-
-        // the pixmap, only using btp
-        gb_pixmap_ref_t pixmap = gb_pixmap(pixfmt, 0xff);
-        tb_assert_and_check_break(pixmap);
-
-        // the row bytes
-        if (!row_bytes) row_bytes = width * pixmap->btp;
-        tb_assert_and_check_break(row_bytes && row_bytes >= width * pixmap->btp);
-
-        // exit it first
-        if (impl->data && impl->data != data && impl->is_owner) tb_free(impl->data);
-
-        // update bitmap 
-        impl->pixfmt        = (tb_uint16_t)pixfmt;
-        impl->width 	    = (tb_uint16_t)width;
-        impl->height 	    = (tb_uint16_t)height;
-        impl->data          = data;
-        impl->size          = row_bytes * height;
-        impl->row_bytes 	= (tb_uint16_t)row_bytes;
-        impl->is_owner      = 1;
-        impl->has_alpha     = !!has_alpha;
-
-        // ok
-        ok = tb_true;
-
-    } while (0);
-
-    // ok?
-    return ok;
+    // set data, the owned bitmap will own the new data
+    return gb_bitmap_data_done(bitmap, data, pixfmt, width, height, row_bytes, has_alpha, tb_false);
+}
+tb_bool_t gb_bitmap_data_attach(gb_bitmap_ref_t bitmap, tb_pointer_t data, tb_size_t pixfmt, tb_size_t width, tb_size_t height, tb_size_t row_bytes, tb_bool_t has_alpha)
+{
+    // attach data, the bitmap will not own the new data
+    return gb_bitmap_data_done(bitmap, data, pixfmt, width, height, row_bytes, has_alpha, tb_true);
 }
 tb_bool_t gb_bitmap_resize(gb_bitmap_ref_t bitmap, tb_size_t width, tb_size_t height)
 {
@@ -238,14 +340,14 @@ tb_bool_t gb_bitmap_resize(gb_bitmap_ref_t bitmap, tb_size_t width, tb_size_t he
     gb_pixmap_ref_t pixmap = gb_pixmap(impl->pixfmt, 0xff);
     tb_assert_and_check_return_val(pixmap, tb_false);
 
-    // space enough?
-    if (height * width * pixmap->btp <= impl->size)
+    // space enough? the external data and view must keep the row bytes 
+    if (impl->is_owner? (height * width * pixmap->btp <= impl->maxn) : (width * pixmap->btp <= impl->row_bytes && (height - 1) * impl->row_bytes + width * pixmap->btp <= impl->maxn))
     {
         // resize
         impl->width     = (tb_uint16_t)width;
         impl->height    = (tb_uint16_t)height;
         if (impl->is_owner) impl->row_bytes = (tb_uint16_t)(width * pixmap->btp);
-        impl->size      = impl->row_bytes * height;
+        impl->size      = impl->is_view? (height - 1) * impl->row_bytes + width * pixmap->btp : impl->row_bytes * height;
     }
     // grow?
     else
@@ -259,10 +361,14 @@ tb_bool_t gb_bitmap_resize(gb_bitmap_ref_t bitmap, tb_size_t width, tb_size_t he
         impl->height    = (tb_uint16_t)height;
 		impl->row_bytes = (tb_uint16_t)(width * pixmap->btp);
         impl->size      = impl->row_bytes * height;
+        impl->maxn      = impl->size;
         impl->data      = tb_ralloc(impl->data, impl->size);
         tb_assert_and_check_return_val(impl->data, tb_false);
     }
 
+    // update version
+    impl->version = gb_bitmap_version_make();
+
 	// ok
 	return tb_true;
 }
@@ -310,6 +416,18 @@ tb_void_t gb_bitmap_set_alpha(gb_bitmap_ref_t bitmap, tb_bool_t has_alpha)
 
     // done
     impl->has_alpha = has_alpha;
+
+    // update version
+    impl->version = gb_bitmap_version_make();
+}
+tb_bool_t gb_bitmap_is_view(gb_bitmap_ref_t bitmap)
+{
+    // check
+	gb_bitmap_impl_t* impl = (gb_bitmap_impl_t*)bitmap;
+	tb_assert_and_check_return_val(impl, tb_false);
+
+    // is view?
+	return impl->is_view? tb_true : tb_false;
 }
 tb_size_t gb_bitmap_row_bytes(gb_bitmap_ref_t bitmap)
 {
@@ -320,3 +438,27 @@ tb_size_t gb_bitmap_row_bytes(gb_bitmap_ref_t bitmap)
     // the row bytes
 	return impl->row_bytes;
 }
+tb_size_t gb_bitmap_version(gb_bitmap_ref_t bitmap)
+{
+    // check
+	gb_bitmap_impl_t* impl = (gb_bitmap_impl_t*)bitmap;
+	tb_assert_and_check_return_val(impl, 0);
+
+    // the version, the view is changed if the parent has been modified and the versions are increased
+    tb_size_t version = impl->version;
+    for (impl = impl->parent; impl; impl = impl->parent)
+    {
+        if (impl->version > version) version = impl->version;
+    }
+	return version;
+}
+tb_void_t gb_bitmap_modified(gb_bitmap_ref_t bitmap)
+{
+    // check
+	gb_bitmap_impl_t* impl = (gb_bitmap_impl_t*)bitmap;
+	tb_assert_and_check_return(impl);
+
+    // update the versions of the bitmap and its parents, the parent data has been modified by the view
+    tb_size_t version = gb_bitmap_version_make();
+    for (; impl; impl = impl->parent) impl->version = version;
+}
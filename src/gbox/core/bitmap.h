@@ -39,6 +39,9 @@ __tb_extern_c_enter__
  */
 
 /*! init bitmap 
+ *
+ * the external data will be not copied and freed, so we can render into the shared memory directly,
+ * e.g. the window surface or the buffer from the compositor, and the row bytes may be padded.
  *
  * @param data      the data, will auto make data if be null
  * @param pixfmt    the pixfmt 
@@ -51,6 +54,23 @@ __tb_extern_c_enter__
  */
 gb_bitmap_ref_t     gb_bitmap_init(tb_pointer_t data, tb_size_t pixfmt, tb_size_t width, tb_size_t height, tb_size_t row_bytes, tb_bool_t has_alpha);
 
+/*! init the view of the bitmap
+ *
+ * the view shares the data and row bytes of the given bitmap without copying,
+ * so we can render into the sub-rect of the bitmap directly.
+ *
+ * @note the given bitmap must be valid and cannot be resized before exiting the view
+ *
+ * @param bitmap    the bitmap
+ * @param x         the x-offset of the view
+ * @param y         the y-offset of the view
+ * @param width     the view width 
+ * @param height    the view height 
+ *
+ * @return          the bitmap view
+ */
+gb_bitmap_ref_t     gb_bitmap_init_view(gb_bitmap_ref_t bitmap, tb_size_t x, tb_size_t y, tb_size_t width, tb_size_t height);
+
 /*! init bitmap from url
  *
  * @param pixfmt    the pixfmt 
@@ -76,6 +96,9 @@ gb_bitmap_ref_t     gb_bitmap_init_from_stream(tb_size_t pixfmt, tb_stream_ref_t
 tb_void_t           gb_bitmap_exit(gb_bitmap_ref_t bitmap);
 
 /*! the bitmap data size
+ *
+ * @note the rows may be not contiguous if row bytes > width * btp, 
+ * and only the span from the first pixel to the last pixel for the view
  *
  * @param bitmap    the bitmap
  *
@@ -92,6 +115,11 @@ tb_size_t           gb_bitmap_size(gb_bitmap_ref_t bitmap);
 tb_pointer_t        gb_bitmap_data(gb_bitmap_ref_t bitmap);
 
 /*! set the bitmap data
+ *
+ * the bitmap will own the new data and free it by tb_free() if it owns the old data, 
+ * e.g. the bitmap is made by gb_bitmap_init(tb_null, ...), otherwise the new data will be not freed by the bitmap.
+ *
+ * please use gb_bitmap_data_attach() for the external data which is always not owned by the bitmap
  *
  * @param bitmap    the bitmap
  * @param data      the bitmap data, cannot be null
@@ -105,7 +133,26 @@ tb_pointer_t        gb_bitmap_data(gb_bitmap_ref_t bitmap);
  */
 tb_bool_t           gb_bitmap_data_set(gb_bitmap_ref_t bitmap, tb_pointer_t data, tb_size_t pixfmt, tb_size_t width, tb_size_t height, tb_size_t row_bytes, tb_bool_t has_alpha);
 
+/*! attach the external bitmap data
+ *
+ * the old data will be freed if it is owned by the bitmap, but the attached data will be not freed by the bitmap
+ *
+ * @param bitmap    the bitmap
+ * @param data      the bitmap data, cannot be null
+ * @param pixfmt    the pixfmt 
+ * @param width     the width 
+ * @param height    the height 
+ * @param row_bytes the row bytes, will auto calculate it using width if be zero
+ * @param has_alpha has alpha?
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_bitmap_data_attach(gb_bitmap_ref_t bitmap, tb_pointer_t data, tb_size_t pixfmt, tb_size_t width, tb_size_t height, tb_size_t row_bytes, tb_bool_t has_alpha);
+
 /*! resize the bitmap
+ *
+ * the bitmap can be resized within the capacity of its data, e.g. resized to be smaller and larger again,
+ * but only the bitmap which owns the data can grow beyond it.
  *
  * @param bitmap    the bitmap
  * @param width     the width 
@@ -154,6 +201,14 @@ tb_bool_t           gb_bitmap_has_alpha(gb_bitmap_ref_t bitmap);
  */
 tb_void_t           gb_bitmap_set_alpha(gb_bitmap_ref_t bitmap, tb_bool_t has_alpha);
 
+/*! is the bitmap view?
+ *
+ * @param bitmap    the bitmap
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_bitmap_is_view(gb_bitmap_ref_t bitmap);
+
 /*! the bitmap row bytes
  *
  * @param bitmap    the bitmap
@@ -162,6 +217,28 @@ tb_void_t           gb_bitmap_set_alpha(gb_bitmap_ref_t bitmap, tb_bool_t has_al
  */
 tb_size_t           gb_bitmap_row_bytes(gb_bitmap_ref_t bitmap);
 
+/*! the bitmap version
+ *
+ * the version is unique for all bitmaps and will be changed if the bitmap data is changed,
+ * so the caches of the bitmap, e.g. the gl textures, can be made from (bitmap, version)
+ *
+ * the version of the view is changed if the parent bitmap is modified, and the reverse.
+ *
+ * @param bitmap    the bitmap
+ *
+ * @return          the bitmap version 
+ */
+tb_size_t           gb_bitmap_version(gb_bitmap_ref_t bitmap);
+
+/*! mark the bitmap pixels as modified and change the bitmap version
+ *
+ * @note it should be called after the pixels of the bitmap have been drawn or written,
+ * otherwise the cached textures of the bitmap will not be updated
+ *
+ * @param bitmap    the bitmap
+ */
+tb_void_t           gb_bitmap_modified(gb_bitmap_ref_t bitmap);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
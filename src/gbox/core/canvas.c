@@ -128,6 +128,10 @@ gb_canvas_ref_t gb_canvas_init(gb_device_ref_t device)
     return (gb_canvas_ref_t)impl;
 }
 gb_canvas_ref_t gb_canvas_init_from_window(gb_window_ref_t window)
+{
+    return gb_canvas_init_from_window_with_context(window, tb_null);
+}
+gb_canvas_ref_t gb_canvas_init_from_window_with_context(gb_window_ref_t window, gb_context_ref_t context)
 {
     // done
     gb_canvas_ref_t canvas = tb_null;
@@ -135,7 +139,7 @@ gb_canvas_ref_t gb_canvas_init_from_window(gb_window_ref_t window)
     do
     {
         // init device 
-        device = gb_device_init(window);
+        device = gb_device_init_with_context(window, context);
         tb_assert_and_check_break(device);
 
         // init canvas 
@@ -185,6 +189,10 @@ gb_canvas_ref_t gb_canvas_init_from_skia(gb_bitmap_ref_t bitmap)
 #endif
 #ifdef GB_CONFIG_DEVICE_HAVE_BITMAP
 gb_canvas_ref_t gb_canvas_init_from_bitmap(gb_bitmap_ref_t bitmap)
+{
+    return gb_canvas_init_from_bitmap_with_context(bitmap, tb_null);
+}
+gb_canvas_ref_t gb_canvas_init_from_bitmap_with_context(gb_bitmap_ref_t bitmap, gb_context_ref_t context)
 {
     // check
     tb_assert_and_check_return_val(bitmap, tb_null);
@@ -195,7 +203,7 @@ gb_canvas_ref_t gb_canvas_init_from_bitmap(gb_bitmap_ref_t bitmap)
     do
     {
         // init device 
-        device = gb_device_init_bitmap(bitmap);
+        device = gb_device_init_bitmap_with_context(bitmap, context);
         tb_assert_and_check_break(device);
 
         // init canvas 
@@ -253,7 +261,7 @@ tb_size_t gb_canvas_pixfmt(gb_canvas_ref_t canvas)
     // the pixfmt
     return gb_device_pixfmt(impl->device);
 }
-tb_size_t gb_canvas_stroke_width(gb_canvas_ref_t canvas)
+tb_size_t gb_canvas_width(gb_canvas_ref_t canvas)
 {
     // check
     gb_canvas_impl_t* impl = (gb_canvas_impl_t*)canvas;
@@ -262,6 +270,11 @@ tb_size_t gb_canvas_stroke_width(gb_canvas_ref_t canvas)
     // the width
     return gb_device_width(impl->device);
 }
+tb_size_t gb_canvas_stroke_width(gb_canvas_ref_t canvas)
+{
+    // the canvas width, keep the old name for compatibility
+    return gb_canvas_width(canvas);
+}
 tb_size_t gb_canvas_height(gb_canvas_ref_t canvas)
 {
     // check
@@ -422,6 +435,37 @@ tb_void_t gb_canvas_load_clipper(gb_canvas_ref_t canvas)
     // bind clipper
     gb_device_bind_clipper(impl->device, gb_canvas_clipper(canvas));
 }
+tb_bool_t gb_canvas_save_layer(gb_canvas_ref_t canvas, gb_rect_ref_t bounds, tb_byte_t alpha)
+{
+    // check
+    gb_canvas_impl_t* impl = (gb_canvas_impl_t*)canvas;
+    tb_assert_and_check_return_val(impl && impl->device, tb_false);
+
+    // the whole device?
+    tb_check_return_val(bounds, gb_device_save_layer(impl->device, tb_null, alpha));
+
+    // apply matrix to the corners of the bounds
+    gb_point_t points[4];
+    gb_point_make(&points[0], bounds->x, bounds->y);
+    gb_point_make(&points[1], bounds->x + bounds->w, bounds->y);
+    gb_point_make(&points[2], bounds->x + bounds->w, bounds->y + bounds->h);
+    gb_point_make(&points[3], bounds->x, bounds->y + bounds->h);
+    gb_matrix_apply_points(&impl->matrix, points, tb_arrayn(points));
+
+    // save layer with the bounds in the device coordinates
+    gb_rect_t device_bounds;
+    gb_bounds_make(&device_bounds, points, tb_arrayn(points));
+    return gb_device_save_layer(impl->device, &device_bounds, alpha);
+}
+tb_void_t gb_canvas_load_layer(gb_canvas_ref_t canvas)
+{
+    // check
+    gb_canvas_impl_t* impl = (gb_canvas_impl_t*)canvas;
+    tb_assert_and_check_return(impl && impl->device);
+
+    // load layer
+    gb_device_load_layer(impl->device);
+}
 tb_void_t gb_canvas_clear_path(gb_canvas_ref_t canvas)
 {
     gb_path_clear(gb_canvas_path(canvas));
@@ -1191,3 +1235,12 @@ tb_void_t gb_canvas_draw_points(gb_canvas_ref_t canvas, gb_point_ref_t points, t
     // draw points
     gb_device_draw_points(impl->device, points, count, tb_null);
 }
+tb_void_t gb_canvas_draw_density(gb_canvas_ref_t canvas, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count)
+{
+    // check
+    gb_canvas_impl_t* impl = (gb_canvas_impl_t*)canvas;
+    tb_assert_and_check_return(impl && impl->device && density && colors && count);
+
+    // draw density
+    gb_device_draw_density(impl->device, density, colors, count);
+}
@@ -54,6 +54,15 @@ gb_canvas_ref_t     gb_canvas_init(gb_device_ref_t device);
  */
 gb_canvas_ref_t     gb_canvas_init_from_window(gb_window_ref_t window);
 
+/*! init canvas from the given window and context
+ *
+ * @param window    the window
+ * @param context   the context, uses a private context if be null
+ *
+ * @return          the canvas
+ */
+gb_canvas_ref_t     gb_canvas_init_from_window_with_context(gb_window_ref_t window, gb_context_ref_t context);
+
 #ifdef GB_CONFIG_PACKAGE_HAVE_SKIA
 /*! init canvas from skia
  *
@@ -72,6 +81,17 @@ gb_canvas_ref_t     gb_canvas_init_from_skia(gb_bitmap_ref_t bitmap);
  * @return          the canvas
  */
 gb_canvas_ref_t     gb_canvas_init_from_bitmap(gb_bitmap_ref_t bitmap);
+
+/*! init canvas from the given bitmap and context
+ *
+ * the canvases of the different contexts can be drawn from the different threads concurrently
+ *
+ * @param bitmap    the bitmap
+ * @param context   the context, uses a private context if be null
+ *
+ * @return          the canvas
+ */
+gb_canvas_ref_t     gb_canvas_init_from_bitmap_with_context(gb_bitmap_ref_t bitmap, gb_context_ref_t context);
 #endif
 
 /*! exit canvas
@@ -94,6 +114,16 @@ tb_size_t           gb_canvas_pixfmt(gb_canvas_ref_t canvas);
  *
  * @return          the width
  */
+tb_size_t           gb_canvas_width(gb_canvas_ref_t canvas);
+
+/*! the canvas width, the old name of gb_canvas_width
+ *
+ * @deprecated      uses gb_canvas_width instead, it does not return the stroke width
+ *
+ * @param canvas    the canvas
+ *
+ * @return          the width
+ */
 tb_size_t           gb_canvas_stroke_width(gb_canvas_ref_t canvas);
 
 /*! the canvas height
@@ -200,6 +230,42 @@ gb_clipper_ref_t    gb_canvas_save_clipper(gb_canvas_ref_t canvas);
  */
 tb_void_t           gb_canvas_load_clipper(gb_canvas_ref_t canvas);
 
+/*! save layer
+ *
+ * the next drawings will be drawn to the offscreen layer and be composited 
+ * to the parent with the group alpha at once after loading it, e.g.
+ *
+ * @code
+ *
+    // fade the overlay
+    if (gb_canvas_save_layer(canvas, &bounds, 0x80))
+    {
+        // draw the overlay, the overlapped shapes will not be blended with each other
+        gb_canvas_draw_rect(canvas, &rect0);
+        gb_canvas_draw_circle(canvas, &circle0);
+
+        // composite it
+        gb_canvas_load_layer(canvas);
+    }
+ * @endcode
+ *
+ * only the pixels of the bounds clipped by the canvas and the parent layer are allocated,
+ * and the drawings outside the bounds will be discarded.
+ *
+ * @param canvas    the canvas
+ * @param bounds    the bounds in the current matrix, uses the whole canvas if be null
+ * @param alpha     the group alpha
+ *
+ * @return          tb_true or tb_false, the layer is not saved and must not be loaded if failed
+ */
+tb_bool_t           gb_canvas_save_layer(gb_canvas_ref_t canvas, gb_rect_ref_t bounds, tb_byte_t alpha);
+
+/*! load layer and composite it to the parent
+ *
+ * @param canvas    the canvas
+ */
+tb_void_t           gb_canvas_load_layer(gb_canvas_ref_t canvas);
+
 /*! clear path 
  *
  * @param canvas    the canvas
@@ -1112,6 +1178,23 @@ tb_void_t           gb_canvas_draw_lines(gb_canvas_ref_t canvas, gb_point_ref_t
  */
 tb_void_t           gb_canvas_draw_points(gb_canvas_ref_t canvas, gb_point_ref_t points, tb_size_t count);
 
+/*! draw the density of the scatter points
+ *
+ * the density is in the device coordinates, so the points need be binned with the canvas matrix, e.g.
+ *
+ * @code
+    gb_density_clear(density);
+    gb_density_done(density, gb_canvas_matrix(canvas), points, count);
+    gb_canvas_draw_density(canvas, density, colors, tb_arrayn(colors));
+ * @endcode
+ *
+ * @param canvas    the canvas
+ * @param density   the density
+ * @param colors    the colors table from the lowest density to the highest density
+ * @param count     the colors count
+ */
+tb_void_t           gb_canvas_draw_density(gb_canvas_ref_t canvas, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
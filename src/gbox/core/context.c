@@ -0,0 +1,184 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        context.c
+ * @ingroup     core
+ *
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "context"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "context.h"
+#include "impl/context.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the quality is not set and uses the global quality
+#define GB_CONTEXT_QUALITY_GLOBAL           ((tb_size_t)-1)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the context impl type
+typedef struct __gb_context_impl_t
+{
+    // the quality
+    tb_size_t                   quality;
+
+    // the polygon raster
+    gb_polygon_raster_ref_t     raster;
+
+    // the stroker
+    gb_stroker_ref_t            stroker;
+
+    // the stroke cache
+    gb_stroke_cache_ref_t       stroke_cache;
+
+    // the profiler, it is not owned by the context
+    gb_profiler_ref_t           profiler;
+
+}gb_context_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_context_ref_t gb_context_init()
+{
+    // make context
+    gb_context_impl_t* impl = tb_malloc0_type(gb_context_impl_t);
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // init quality
+    impl->quality = GB_CONTEXT_QUALITY_GLOBAL;
+
+    // ok
+    return (gb_context_ref_t)impl;
+}
+tb_void_t gb_context_exit(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return(impl);
+
+    // exit stroke cache
+    if (impl->stroke_cache) gb_stroke_cache_exit(impl->stroke_cache);
+    impl->stroke_cache = tb_null;
+
+    // exit stroker
+    if (impl->stroker) gb_stroker_exit(impl->stroker);
+    impl->stroker = tb_null;
+
+    // exit raster
+    if (impl->raster) gb_polygon_raster_exit(impl->raster);
+    impl->raster = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_size_t gb_context_quality(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return_val(impl, gb_quality());
+
+    // the quality
+    return impl->quality != GB_CONTEXT_QUALITY_GLOBAL? impl->quality : gb_quality();
+}
+tb_void_t gb_context_quality_set(gb_context_ref_t context, tb_size_t quality)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return(impl && quality <= GB_QUALITY_TOP);
+
+    // save quality
+    impl->quality = quality;
+}
+gb_profiler_ref_t gb_context_profiler(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the profiler
+    return impl->profiler;
+}
+tb_void_t gb_context_profiler_set(gb_context_ref_t context, gb_profiler_ref_t profiler)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return(impl);
+
+    // save profiler
+    impl->profiler = profiler;
+}
+tb_void_t gb_context_clear(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return(impl);
+
+    // clear stroke cache
+    if (impl->stroke_cache) gb_stroke_cache_clear(impl->stroke_cache);
+}
+gb_polygon_raster_ref_t gb_context_raster(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // init raster if not exists
+    if (!impl->raster) impl->raster = gb_polygon_raster_init();
+
+    // the raster
+    return impl->raster;
+}
+gb_stroker_ref_t gb_context_stroker(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // init stroker if not exists
+    if (!impl->stroker) impl->stroker = gb_stroker_init();
+
+    // the stroker
+    return impl->stroker;
+}
+gb_stroke_cache_ref_t gb_context_stroke_cache(gb_context_ref_t context)
+{
+    // check
+    gb_context_impl_t* impl = (gb_context_impl_t*)context;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // init stroke cache if not exists
+    if (!impl->stroke_cache) impl->stroke_cache = gb_stroke_cache_init(GB_STROKE_CACHE_MAXN);
+
+    // the stroke cache
+    return impl->stroke_cache;
+}
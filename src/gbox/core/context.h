@@ -0,0 +1,120 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        context.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_CONTEXT_H
+#define GB_CORE_CONTEXT_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+#include "profiler.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/*! init context
+ *
+ * the context carries the quality, caches and scratch buffers for the devices and canvases.
+ *
+ * the context is not thread-safe, but the contexts are independent, 
+ * so we can render the different canvases concurrently by using one context for each thread, .e.g
+ *
+ * @code
+ *
+    // the worker thread
+    gb_context_ref_t context = gb_context_init();
+    gb_canvas_ref_t  canvas = gb_canvas_init_from_bitmap_with_context(bitmap, context);
+
+    // draw it
+    // ...
+
+    // exit them
+    gb_canvas_exit(canvas);
+    gb_context_exit(context);
+ * @endcode
+ *
+ * the path, paint, shader and bitmap objects can not be modified concurrently, 
+ * so do not share them between threads without a lock.
+ *
+ * @return          the context
+ */
+gb_context_ref_t    gb_context_init(tb_noarg_t);
+
+/*! exit context
+ *
+ * @note all devices and canvases of this context must be exited before
+ *
+ * @param context   the context
+ */
+tb_void_t           gb_context_exit(gb_context_ref_t context);
+
+/*! the context quality
+ *
+ * @param context   the context
+ *
+ * @return          the quality, uses the global quality if it has been not set
+ */
+tb_size_t           gb_context_quality(gb_context_ref_t context);
+
+/*! set the context quality
+ *
+ * @param context   the context
+ * @param quality   the quality
+ */
+tb_void_t           gb_context_quality_set(gb_context_ref_t context, tb_size_t quality);
+
+/*! the context profiler
+ *
+ * @param context   the context
+ *
+ * @return          the profiler, null if no profiler 
+ */
+gb_profiler_ref_t   gb_context_profiler(gb_context_ref_t context);
+
+/*! set the context profiler, all devices of this context will record into it
+ *
+ * @note the profiler is not owned by the context and must be exited after the context
+ *
+ * @param context   the context
+ * @param profiler  the profiler, disable it if be null
+ */
+tb_void_t           gb_context_profiler_set(gb_context_ref_t context, gb_profiler_ref_t profiler);
+
+/*! clear the caches of the context
+ *
+ * @param context   the context
+ */
+tb_void_t           gb_context_clear(gb_context_ref_t context);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+#endif
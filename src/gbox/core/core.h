@@ -29,12 +29,17 @@
 #include "prefix.h"
 #include "path.h"
 #include "paint.h"
+#include "context.h"
+#include "profiler.h"
 #include "shader.h"
 #include "pixmap.h"
 #include "bitmap.h"
 #include "canvas.h"
 #include "device.h"
 #include "clipper.h"
+#include "density.h"
+#include "scene.h"
+#include "raster_cache.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
@@ -0,0 +1,386 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ *
+ * @author      ruki
+ * @file        density.c
+ * @ingroup     core
+ *
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "density"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "density.h"
+#include "bitmap.h"
+#include "pixmap.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the density impl type
+typedef struct __gb_density_impl_t
+{
+    // the counts
+    tb_uint32_t*                counts;
+
+    // the width
+    tb_size_t                   width;
+
+    // the height
+    tb_size_t                   height;
+
+    // the maximum count, it will be computed again if be zero
+    tb_size_t                   maxn;
+
+    // the scale
+    tb_size_t                   scale;
+
+}gb_density_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static __tb_inline__ tb_uint32_t gb_density_log2(tb_uint32_t count)
+{
+    // check
+    tb_assert(count);
+
+    // the integer part
+    tb_uint32_t n = 31 - tb_bits_cl0_u32_be(count);
+
+    /* the fraction part with 8-bits, log2(count) * 256
+     *
+     * the fraction is interpolated linearly between the powers of two, 
+     * it is enough for indexing the colors table
+     */
+    tb_uint32_t f = n >= 8? (count >> (n - 8)) : (count << (8 - n));
+    return (n << 8) + (f & 0xff);
+}
+static __tb_inline__ tb_size_t gb_density_index(tb_uint32_t count, tb_size_t maxn, tb_uint32_t log2_maxn, tb_size_t scale, tb_size_t last)
+{
+    // the maximum count? log2_maxn will be not zero if maxn > 1
+    if (count >= maxn) return last;
+
+    // log? 
+    if (scale == GB_DENSITY_SCALE_LOG) return (tb_size_t)(((tb_hize_t)gb_density_log2(count) * last) / log2_maxn);
+
+    // linear
+    return (tb_size_t)(((tb_hize_t)count * last) / maxn);
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_density_ref_t gb_density_init(tb_size_t width, tb_size_t height)
+{
+    // check
+    tb_assert_and_check_return_val(width && height && width <= GB_WIDTH_MAXN && height <= GB_HEIGHT_MAXN, tb_null);
+
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_density_impl_t*  impl = tb_null;
+    do
+    {
+        // make density
+        impl = tb_malloc0_type(gb_density_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init density
+        impl->width     = width;
+        impl->height    = height;
+        impl->scale     = GB_DENSITY_SCALE_LOG;
+
+        // init counts
+        impl->counts    = tb_nalloc0_type(width * height, tb_uint32_t);
+        tb_assert_and_check_break(impl->counts);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_density_exit((gb_density_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_density_ref_t)impl;
+}
+tb_void_t gb_density_exit(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return(impl);
+
+    // exit counts
+    if (impl->counts) tb_free(impl->counts);
+    impl->counts = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_void_t gb_density_clear(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return(impl && impl->counts);
+
+    // clear counts
+    tb_memset(impl->counts, 0, impl->width * impl->height * sizeof(tb_uint32_t));
+
+    // clear the maximum count
+    impl->maxn = 0;
+}
+tb_size_t gb_density_width(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the width
+    return impl->width;
+}
+tb_size_t gb_density_height(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the height
+    return impl->height;
+}
+tb_size_t gb_density_scale(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return_val(impl, GB_DENSITY_SCALE_LOG);
+
+    // the scale
+    return impl->scale;
+}
+tb_void_t gb_density_scale_set(gb_density_ref_t density, tb_size_t scale)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return(impl);
+
+    // set the scale
+    impl->scale = scale;
+}
+tb_size_t gb_density_maxn(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return_val(impl && impl->counts, 0);
+
+    // compute the maximum count if the counts have been modified
+    if (!impl->maxn)
+    {
+        tb_uint32_t         maxn = 0;
+        tb_uint32_t const*  counts = impl->counts;
+        tb_uint32_t const*  tail = counts + impl->width * impl->height;
+        while (counts < tail)
+        {
+            if (*counts > maxn) maxn = *counts;
+            counts++;
+        }
+        impl->maxn = maxn;
+    }
+
+    // the maximum count
+    return impl->maxn;
+}
+tb_uint32_t const* gb_density_counts(gb_density_ref_t density)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the counts
+    return impl->counts;
+}
+tb_void_t gb_density_done(gb_density_ref_t density, gb_matrix_ref_t matrix, gb_point_ref_t points, tb_size_t count)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return(impl && impl->counts && points);
+
+    // the factors
+    tb_uint32_t*    counts = impl->counts;
+    tb_size_t       width = impl->width;
+    tb_size_t       height = impl->height;
+    gb_point_ref_t  tail = points + count;
+
+    // the counts will be modified
+    impl->maxn = 0;
+
+    // no matrix or only translate?
+    if (!matrix || (    matrix->sx == GB_ONE && matrix->sy == GB_ONE
+                    &&  matrix->kx == 0 && matrix->ky == 0))
+    {
+        // the offset
+        gb_float_t tx = matrix? matrix->tx : 0;
+        gb_float_t ty = matrix? matrix->ty : 0;
+
+        // bin points
+        gb_float_t x;
+        gb_float_t y;
+        tb_size_t  px;
+        tb_size_t  py;
+        for (; points < tail; points++)
+        {
+            // the point
+            x = points->x + tx;
+            y = points->y + ty;
+
+            // clip it, the negative coordinates will be truncated to zero
+            tb_check_continue(x >= 0 && y >= 0);
+            px = (tb_size_t)gb_float_to_long(x);
+            py = (tb_size_t)gb_float_to_long(y);
+            tb_check_continue(px < width && py < height);
+
+            // count it
+            counts[py * width + px]++;
+        }
+    }
+    else
+    {
+        // bin points
+        gb_float_t x;
+        gb_float_t y;
+        tb_size_t  px;
+        tb_size_t  py;
+        for (; points < tail; points++)
+        {
+            // apply matrix
+            x = gb_matrix_apply_x(matrix, points->x, points->y);
+            y = gb_matrix_apply_y(matrix, points->x, points->y);
+
+            // clip it
+            tb_check_continue(x >= 0 && y >= 0);
+            px = (tb_size_t)gb_float_to_long(x);
+            py = (tb_size_t)gb_float_to_long(y);
+            tb_check_continue(px < width && py < height);
+
+            // count it
+            counts[py * width + px]++;
+        }
+    }
+}
+tb_bool_t gb_density_merge(gb_density_ref_t density, gb_density_ref_t other)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    gb_density_impl_t* impl_other = (gb_density_impl_t*)other;
+    tb_assert_and_check_return_val(impl && impl->counts && impl_other && impl_other->counts, tb_false);
+
+    // check size
+    tb_assert_and_check_return_val(impl->width == impl_other->width && impl->height == impl_other->height, tb_false);
+
+    // merge counts
+    tb_uint32_t*        counts = impl->counts;
+    tb_uint32_t*        tail = counts + impl->width * impl->height;
+    tb_uint32_t const*  counts_other = impl_other->counts;
+    while (counts < tail) *counts++ += *counts_other++;
+
+    // the counts have been modified
+    impl->maxn = 0;
+
+    // ok
+    return tb_true;
+}
+tb_void_t gb_density_render(gb_density_ref_t density, gb_bitmap_ref_t bitmap, gb_color_t const* colors, tb_size_t count)
+{
+    gb_density_render_at(density, bitmap, 0, 0, colors, count);
+}
+tb_void_t gb_density_render_at(gb_density_ref_t density, gb_bitmap_ref_t bitmap, tb_size_t x, tb_size_t y, gb_color_t const* colors, tb_size_t count)
+{
+    // check
+    gb_density_impl_t* impl = (gb_density_impl_t*)density;
+    tb_assert_and_check_return(impl && impl->counts && bitmap && colors && count && count <= GB_DENSITY_COLORS_MAXN);
+
+    // the bitmap data
+    tb_byte_t* data = (tb_byte_t*)gb_bitmap_data(bitmap);
+    tb_assert_and_check_return(data);
+
+    // outside the density?
+    tb_check_return(x < impl->width && y < impl->height);
+
+    // the maximum count
+    tb_size_t maxn = gb_density_maxn(density);
+    tb_check_return(maxn);
+
+    // make the pixel and pixmap of each color, the transparent color has no pixmap
+    tb_size_t           index;
+    tb_size_t           pixfmt = gb_bitmap_pixfmt(bitmap);
+    gb_pixel_t          pixels[GB_DENSITY_COLORS_MAXN];
+    gb_pixmap_ref_t     pixmaps[GB_DENSITY_COLORS_MAXN];
+    for (index = 0; index < count; index++)
+    {
+        pixmaps[index] = gb_pixmap(pixfmt, colors[index].a);
+        pixels[index] = pixmaps[index]? pixmaps[index]->pixel(colors[index]) : 0;
+    }
+
+    // the factors
+    tb_size_t           scale = impl->scale;
+    tb_size_t           last = count - 1;
+    tb_uint32_t         log2_maxn = gb_density_log2((tb_uint32_t)maxn);
+    tb_size_t           width = tb_min(impl->width - x, gb_bitmap_width(bitmap));
+    tb_size_t           height = tb_min(impl->height - y, gb_bitmap_height(bitmap));
+    tb_size_t           row_bytes = gb_bitmap_row_bytes(bitmap);
+    gb_pixmap_ref_t     opaque = gb_pixmap(pixfmt, 0xff);
+    tb_size_t           btp = opaque? opaque->btp : 0;
+    tb_uint32_t const*  counts = impl->counts + y * impl->width + x;
+    tb_assert_and_check_return(btp);
+
+    // colorize counts
+    tb_size_t i;
+    tb_size_t j;
+    tb_uint32_t c;
+    gb_pixmap_ref_t pixmap;
+    for (j = 0; j < height; j++)
+    {
+        tb_byte_t* p = data + j * row_bytes;
+        for (i = 0; i < width; i++, p += btp)
+        {
+            // no points?
+            c = counts[i];
+            tb_check_continue(c);
+
+            // the color index
+            index = gb_density_index(c, maxn, log2_maxn, scale, last);
+
+            // set the pixel
+            pixmap = pixmaps[index];
+            if (pixmap) pixmap->pixel_set(p, pixels[index], colors[index].a);
+        }
+        counts += impl->width;
+    }
+}
@@ -0,0 +1,193 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        density.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_DENSITY_H
+#define GB_CORE_DENSITY_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum colors count of the density
+#define GB_DENSITY_COLORS_MAXN          (256)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/// the density scale enum
+typedef enum __gb_density_scale_e
+{
+    GB_DENSITY_SCALE_LINEAR     = 0 //!< the color index is proportional to the count
+,   GB_DENSITY_SCALE_LOG        = 1 //!< the color index is proportional to the logarithm of the count
+
+}gb_density_scale_e;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/*! init density
+ *
+ * the density counts the points of each pixel for drawing millions of scatter points,
+ * the points are binned in one pass and the counts are colorized by the colors table when drawing it, e.g.
+ *
+ * @code
+ *
+    // init density with the canvas size
+    gb_density_ref_t density = gb_density_init(gb_canvas_width(canvas), gb_canvas_height(canvas));
+
+    // bin the points with the canvas matrix
+    gb_density_done(density, gb_canvas_matrix(canvas), points, count);
+
+    // draw it
+    gb_canvas_draw_density(canvas, density, colors, tb_arrayn(colors));
+ * @endcode
+ *
+ * the density is not thread-safe, but we can bin the points of each part into the density of each thread,
+ * and merge them into the drawn density after all threads have been finished.
+ *
+ * @param width     the width
+ * @param height    the height
+ *
+ * @return          the density
+ */
+gb_density_ref_t    gb_density_init(tb_size_t width, tb_size_t height);
+
+/*! exit density
+ *
+ * @param density   the density
+ */
+tb_void_t           gb_density_exit(gb_density_ref_t density);
+
+/*! clear the counts of all pixels
+ *
+ * @param density   the density
+ */
+tb_void_t           gb_density_clear(gb_density_ref_t density);
+
+/*! the density width
+ *
+ * @param density   the density
+ *
+ * @return          the width
+ */
+tb_size_t           gb_density_width(gb_density_ref_t density);
+
+/*! the density height
+ *
+ * @param density   the density
+ *
+ * @return          the height
+ */
+tb_size_t           gb_density_height(gb_density_ref_t density);
+
+/*! the density scale
+ *
+ * @param density   the density
+ *
+ * @return          the scale
+ */
+tb_size_t           gb_density_scale(gb_density_ref_t density);
+
+/*! set the density scale, the default scale: GB_DENSITY_SCALE_LOG
+ *
+ * @param density   the density
+ * @param scale     the scale
+ */
+tb_void_t           gb_density_scale_set(gb_density_ref_t density, tb_size_t scale);
+
+/*! the maximum count of all pixels
+ *
+ * @param density   the density
+ *
+ * @return          the maximum count
+ */
+tb_size_t           gb_density_maxn(gb_density_ref_t density);
+
+/*! the counts of all pixels
+ *
+ * @param density   the density
+ *
+ * @return          the counts, width x height
+ */
+tb_uint32_t const*  gb_density_counts(gb_density_ref_t density);
+
+/*! bin the points into the density, the points out of the density will be discarded
+ *
+ * @param density   the density
+ * @param matrix    the matrix, uses the identity matrix if be null
+ * @param points    the points
+ * @param count     the points count
+ */
+tb_void_t           gb_density_done(gb_density_ref_t density, gb_matrix_ref_t matrix, gb_point_ref_t points, tb_size_t count);
+
+/*! merge the counts of the other density with the same size
+ *
+ * @param density   the density
+ * @param other     the other density
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_density_merge(gb_density_ref_t density, gb_density_ref_t other);
+
+/*! colorize the counts to the bitmap
+ *
+ * the pixels without any points will be not modified.
+ *
+ * @param density   the density
+ * @param bitmap    the bitmap
+ * @param colors    the colors table from the lowest density to the highest density
+ * @param count     the colors count, must be in [1, GB_DENSITY_COLORS_MAXN]
+ */
+tb_void_t           gb_density_render(gb_density_ref_t density, gb_bitmap_ref_t bitmap, gb_color_t const* colors, tb_size_t count);
+
+/*! colorize the counts from the given position of the density to the bitmap
+ *
+ * the pixel (0, 0) of the bitmap is colorized by the count at (x, y), e.g. for drawing to the layer.
+ *
+ * @param density   the density
+ * @param bitmap    the bitmap
+ * @param x         the x-coordinate in the density
+ * @param y         the y-coordinate in the density
+ * @param colors    the colors table from the lowest density to the highest density
+ * @param count     the colors count, must be in [1, GB_DENSITY_COLORS_MAXN]
+ */
+tb_void_t           gb_density_render_at(gb_density_ref_t density, gb_bitmap_ref_t bitmap, tb_size_t x, tb_size_t y, gb_color_t const* colors, tb_size_t count);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
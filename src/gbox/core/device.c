@@ -35,18 +35,23 @@
 #include "device/prefix.h"
 #include "path.h"
 #include "paint.h"
+#include "impl/path_lod.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * declaration
  */
 #ifdef GB_CONFIG_PACKAGE_HAVE_OPENGL
-__tb_extern_c__ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window);
+__tb_extern_c__ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window, gb_context_ref_t context);
 #endif
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
 gb_device_ref_t gb_device_init(gb_window_ref_t window)
+{
+    return gb_device_init_with_context(window, tb_null);
+}
+gb_device_ref_t gb_device_init_with_context(gb_window_ref_t window, gb_context_ref_t context)
 {
     // check
     tb_assert_and_check_return_val(window, tb_null);
@@ -61,14 +66,14 @@ gb_device_ref_t gb_device_init(gb_window_ref_t window)
     {
 #ifdef GB_CONFIG_PACKAGE_HAVE_OPENGL
     case GB_WINDOW_MODE_GL:
-        device = gb_device_init_gl(window);
+        device = gb_device_init_gl(window, context);
         break;
 #endif
     case GB_WINDOW_MODE_BITMAP:
 #if defined(GB_CONFIG_PACKAGE_HAVE_SKIA)
         device = gb_device_init_skia(gb_window_bitmap(window));
 #elif defined(GB_CONFIG_DEVICE_HAVE_BITMAP)
-        device = gb_device_init_bitmap(gb_window_bitmap(window));
+        device = gb_device_init_bitmap_with_context(gb_window_bitmap(window), context);
 #else
         // trace
         tb_trace_e("no bitmap device!");
@@ -156,6 +161,33 @@ tb_size_t gb_device_height(gb_device_ref_t device)
     // the height
     return impl->height;
 }
+gb_context_ref_t gb_device_context(gb_device_ref_t device)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the context
+    return impl->context;
+}
+tb_size_t gb_device_fill_mode(gb_device_ref_t device)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return_val(impl, GB_DEVICE_FILL_MODE_TESSELLATOR);
+
+    // the fill mode
+    return impl->fill_mode;
+}
+tb_void_t gb_device_fill_mode_set(gb_device_ref_t device, tb_size_t mode)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return(impl);
+
+    // set the fill mode
+    impl->fill_mode = (tb_uint8_t)mode;
+}
 tb_void_t gb_device_resize(gb_device_ref_t device, tb_size_t width, tb_size_t height)
 {
     // check
@@ -164,6 +196,10 @@ tb_void_t gb_device_resize(gb_device_ref_t device, tb_size_t width, tb_size_t he
 
     // resize
     impl->resize(impl, width, height);
+
+    // update the size
+    impl->width     = (tb_uint16_t)width;
+    impl->height    = (tb_uint16_t)height;
 }
 tb_void_t gb_device_bind_paint(gb_device_ref_t device, gb_paint_ref_t paint)
 {
@@ -198,6 +234,9 @@ tb_void_t gb_device_draw_clear(gb_device_ref_t device, gb_color_t color)
     gb_device_impl_t* impl = (gb_device_impl_t*)device;
     tb_assert_and_check_return(impl && impl->draw_clear);
 
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
     // clear it
     impl->draw_clear(impl, color);
 }
@@ -210,15 +249,23 @@ tb_void_t gb_device_draw_path(gb_device_ref_t device, gb_path_ref_t path)
     // null?
     if (gb_path_null(path)) return ;
 
+    // profile it
+    gb_profiler_ref_t profiler = gb_profiler_hook(impl->context);
+    gb_profiler_count(profiler, GB_PROFILER_COUNT_PATHS, 1);
+    gb_profiler_count(profiler, GB_PROFILER_COUNT_DRAWS, 1);
+
     // draw path
     if (impl->draw_path) impl->draw_path(impl, path);
-    else
+    else if (impl->draw_polygon)
     {
         /* draw the polygon for path
          *
          * @note the quality of drawing curve may be not higher and faster for stroking with the width > 1
          */
-        gb_device_draw_polygon(device, gb_path_polygon(path), gb_path_hint(path), gb_path_bounds(path));
+        tb_hong_t           time = gb_profiler_enter(profiler);
+        gb_polygon_ref_t    polygon = impl->matrix? gb_path_polygon_lod(path, gb_path_lod_tolerance(impl->matrix)) : gb_path_polygon(path);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_FLATTEN, time);
+        impl->draw_polygon(impl, polygon, gb_path_hint(path), gb_path_bounds(path));
     }
 }
 tb_void_t gb_device_draw_lines(gb_device_ref_t device, gb_point_ref_t points, tb_size_t count, gb_rect_ref_t bounds)
@@ -227,6 +274,9 @@ tb_void_t gb_device_draw_lines(gb_device_ref_t device, gb_point_ref_t points, tb
     gb_device_impl_t* impl = (gb_device_impl_t*)device;
     tb_assert_and_check_return(impl && impl->draw_lines);
 
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
     // draw lines
     impl->draw_lines(impl, points, count, bounds);
 }
@@ -236,6 +286,9 @@ tb_void_t gb_device_draw_points(gb_device_ref_t device, gb_point_ref_t points, t
     gb_device_impl_t* impl = (gb_device_impl_t*)device;
     tb_assert_and_check_return(impl && impl->draw_points);
 
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
     // draw points
     impl->draw_points(impl, points, count, bounds);
 }
@@ -245,7 +298,118 @@ tb_void_t gb_device_draw_polygon(gb_device_ref_t device, gb_polygon_ref_t polygo
     gb_device_impl_t* impl = (gb_device_impl_t*)device;
     tb_assert_and_check_return(impl && impl->draw_polygon);
 
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
     // draw polygon
     impl->draw_polygon(impl, polygon, hint, bounds);
 }
+tb_void_t gb_device_draw_density(gb_device_ref_t device, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return(impl && density && colors && count);
+
+    // not supported?
+    if (!impl->draw_density)
+    {
+        // trace
+        tb_trace_noimpl();
+        return ;
+    }
+
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
+    // draw density
+    impl->draw_density(impl, density, colors, count);
+}
+tb_void_t gb_device_draw_bitmap(gb_device_ref_t device, gb_bitmap_ref_t bitmap, tb_long_t x, tb_long_t y)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return(impl && bitmap);
+
+    // not supported?
+    if (!impl->draw_bitmap)
+    {
+        // trace
+        tb_trace_noimpl();
+        return ;
+    }
+
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
+    // draw bitmap
+    impl->draw_bitmap(impl, bitmap, x, y);
+}
+tb_bool_t gb_device_save_layer(gb_device_ref_t device, gb_rect_ref_t bounds, tb_byte_t alpha)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return_val(impl, tb_false);
+
+    // not supported?
+    if (!impl->save_layer || !impl->load_layer)
+    {
+        // trace
+        tb_trace_noimpl();
+        return tb_false;
+    }
+
+    // too many layers?
+    tb_assert_and_check_return_val(impl->layers_count < GB_DEVICE_LAYERS_MAXN, tb_false);
+
+    // the clip bounds: the parent layer or the whole device
+    tb_long_t x0 = 0;
+    tb_long_t y0 = 0;
+    tb_long_t x1 = impl->width;
+    tb_long_t y1 = impl->height;
+    if (impl->layers_count)
+    {
+        gb_device_layer_ref_t parent = &impl->layers[impl->layers_count - 1];
+        x0 = parent->x;
+        y0 = parent->y;
+        x1 = x0 + parent->width;
+        y1 = y0 + parent->height;
+    }
+
+    // clip the pixels covered by the bounds
+    if (bounds)
+    {
+        x0 = tb_max(x0, gb_floor(bounds->x));
+        y0 = tb_max(y0, gb_floor(bounds->y));
+        x1 = tb_min(x1, gb_ceil(bounds->x + bounds->w));
+        y1 = tb_min(y1, gb_ceil(bounds->y + bounds->h));
+    }
+
+    // init layer, the bounds may be empty and all drawings of this layer will be discarded
+    gb_device_layer_ref_t layer = &impl->layers[impl->layers_count];
+    layer->x        = (tb_uint16_t)x0;
+    layer->y        = (tb_uint16_t)y0;
+    layer->width    = (tb_uint16_t)(x1 > x0? x1 - x0 : 0);
+    layer->height   = (tb_uint16_t)(y1 > y0? y1 - y0 : 0);
+    layer->alpha    = alpha;
+
+    // save layer
+    tb_check_return_val(impl->save_layer(impl, layer), tb_false);
+
+    // ok
+    impl->layers_count++;
+    return tb_true;
+}
+tb_void_t gb_device_load_layer(gb_device_ref_t device)
+{
+    // check
+    gb_device_impl_t* impl = (gb_device_impl_t*)device;
+    tb_assert_and_check_return(impl && impl->load_layer && impl->layers_count);
+
+    // profile it
+    gb_profiler_count(gb_profiler_hook(impl->context), GB_PROFILER_COUNT_DRAWS, 1);
+
+    // load layer
+    impl->layers_count--;
+    impl->load_layer(impl, &impl->layers[impl->layers_count]);
+}
 
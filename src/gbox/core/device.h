@@ -35,6 +35,13 @@
  */
 __tb_extern_c_enter__
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum depth of the nested layers
+#define GB_DEVICE_LAYERS_MAXN           (16)
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * types
  */
@@ -49,6 +56,17 @@ typedef enum __gb_device_type_e
 
 }gb_device_type_e;
 
+/*! the device fill mode enum
+ *
+ * only the gl device supports the stencil mode now and the other devices will ignore it.
+ */
+typedef enum __gb_device_fill_mode_e
+{
+    GB_DEVICE_FILL_MODE_TESSELLATOR = 0     //!< fill the polygon with the triangles from the tessellator
+,   GB_DEVICE_FILL_MODE_STENCIL     = 1     //!< fill the polygon with stencil-then-cover and the polygon will not be tessellated
+
+}gb_device_fill_mode_e;
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * interfaces
  */
@@ -61,6 +79,15 @@ typedef enum __gb_device_type_e
  */
 gb_device_ref_t     gb_device_init(gb_window_ref_t window);
 
+/*! init device from window with the given context
+ *
+ * @param window    the window
+ * @param context   the context, uses a private context if be null
+ *
+ * @return          the device
+ */
+gb_device_ref_t     gb_device_init_with_context(gb_window_ref_t window, gb_context_ref_t context);
+
 #ifdef GB_CONFIG_PACKAGE_HAVE_SKIA
 /*! init skia device
  *
@@ -71,6 +98,21 @@ gb_device_ref_t     gb_device_init(gb_window_ref_t window);
 gb_device_ref_t     gb_device_init_skia(gb_bitmap_ref_t bitmap);
 #endif
 
+#ifdef GB_CONFIG_PACKAGE_HAVE_OPENGL
+/*! init gl device for the current gl context
+ *
+ * the gl context must be made current before, e.g. an offscreen egl surface without the window
+ *
+ * @param pixfmt    the pixfmt
+ * @param width     the width
+ * @param height    the height
+ * @param context   the context, uses a private context if be null
+ *
+ * @return          the device
+ */
+gb_device_ref_t     gb_device_init_gl_with_size(tb_size_t pixfmt, tb_size_t width, tb_size_t height, gb_context_ref_t context);
+#endif
+
 #ifdef GB_CONFIG_DEVICE_HAVE_BITMAP
 /*! init bitmap device
  *
@@ -79,6 +121,15 @@ gb_device_ref_t     gb_device_init_skia(gb_bitmap_ref_t bitmap);
  * @return          the device
  */
 gb_device_ref_t     gb_device_init_bitmap(gb_bitmap_ref_t bitmap);
+
+/*! init bitmap device with the given context
+ *
+ * @param bitmap    the bitmap
+ * @param context   the context, uses a private context if be null
+ *
+ * @return          the device
+ */
+gb_device_ref_t     gb_device_init_bitmap_with_context(gb_bitmap_ref_t bitmap, gb_context_ref_t context);
 #endif
 
 /*! exit device 
@@ -119,6 +170,29 @@ tb_size_t           gb_device_width(gb_device_ref_t device);
  */
 tb_size_t           gb_device_height(gb_device_ref_t device);
 
+/*! the device context
+ *
+ * @param device    the device
+ *
+ * @return          the context
+ */
+gb_context_ref_t    gb_device_context(gb_device_ref_t device);
+
+/*! the device fill mode
+ *
+ * @param device    the device
+ *
+ * @return          the fill mode
+ */
+tb_size_t           gb_device_fill_mode(gb_device_ref_t device);
+
+/*! set the device fill mode
+ *
+ * @param device    the device
+ * @param mode      the fill mode
+ */
+tb_void_t           gb_device_fill_mode_set(gb_device_ref_t device, tb_size_t mode);
+
 /*! resize the device
  *
  * @param device    the device
@@ -189,6 +263,46 @@ tb_void_t           gb_device_draw_points(gb_device_ref_t device, gb_point_ref_t
  */
 tb_void_t           gb_device_draw_polygon(gb_device_ref_t device, gb_polygon_ref_t polygon, gb_shape_ref_t hint, gb_rect_ref_t bounds);
 
+/*! draw density
+ *
+ * @param device    the device
+ * @param density   the density
+ * @param colors    the colors
+ * @param count     the colors count
+ */
+tb_void_t           gb_device_draw_density(gb_device_ref_t device, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count);
+
+/*! draw the bitmap at the device position
+ *
+ * the pixels are blended over the device by their alpha directly and the matrix and clipper are ignored,
+ * it is used to blit the cached rasters, see gb_raster_cache_draw.
+ *
+ * @param device    the device
+ * @param bitmap    the argb8888 bitmap
+ * @param x         the x in the device coordinates
+ * @param y         the y in the device coordinates
+ */
+tb_void_t           gb_device_draw_bitmap(gb_device_ref_t device, gb_bitmap_ref_t bitmap, tb_long_t x, tb_long_t y);
+
+/*! save layer
+ *
+ * the next drawings will be drawn to the offscreen layer of the bounds
+ * and be composited to the parent with the group alpha after loading it.
+ *
+ * @param device    the device
+ * @param bounds    the bounds in the device coordinates, uses the whole device if be null
+ * @param alpha     the group alpha
+ *
+ * @return          tb_true or tb_false, the layer is not saved if failed
+ */
+tb_bool_t           gb_device_save_layer(gb_device_ref_t device, gb_rect_ref_t bounds, tb_byte_t alpha);
+
+/*! load layer and composite it to the parent
+ *
+ * @param device    the device
+ */
+tb_void_t           gb_device_load_layer(gb_device_ref_t device);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
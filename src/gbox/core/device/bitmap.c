@@ -52,16 +52,19 @@ static tb_void_t gb_device_bitmap_resize(gb_device_impl_t* device, tb_size_t wid
 {
     // check
     gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
-    tb_assert_and_check_return(impl && impl->bitmap);
+    tb_assert_and_check_return(impl);
 
-    // resize
-    gb_bitmap_resize(impl->bitmap, width, height);
+    // resize the device bitmap, the current bitmap may be the layer bitmap
+    gb_bitmap_resize(device->layers_count? impl->layer_parents[0] : impl->bitmap, width, height);
 }
 static tb_void_t gb_device_bitmap_draw_clear(gb_device_impl_t* device, gb_color_t color)
 {
     // check
     gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
-    tb_assert_and_check_return(impl && impl->bitmap);
+    tb_assert_and_check_return(impl);
+
+    // the empty layer? discard it
+    tb_check_return(impl->bitmap);
 
     // the pixels data
     tb_pointer_t pixels = gb_bitmap_data(impl->bitmap);
@@ -71,12 +74,36 @@ static tb_void_t gb_device_bitmap_draw_clear(gb_device_impl_t* device, gb_color_
     gb_pixmap_ref_t pixmap = impl->pixmap;
     tb_assert(pixmap && pixmap->pixel && pixmap->pixels_fill);
 
-    // the pixels count
-    tb_size_t count = gb_bitmap_size(impl->bitmap) / pixmap->btp;
-    tb_assert(count);
+    // the bitmap info
+    tb_size_t   width       = gb_bitmap_width(impl->bitmap);
+    tb_size_t   height      = gb_bitmap_height(impl->bitmap);
+    tb_size_t   row_bytes   = gb_bitmap_row_bytes(impl->bitmap);
+    gb_pixel_t  pixel       = pixmap->pixel(color);
+    tb_assert(width && height && row_bytes >= width * pixmap->btp);
+
+    // profile it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    gb_profiler_count(profiler, GB_PROFILER_COUNT_PIXELS, width * height);
+
+    // clear it at once if the rows are contiguous
+    if (row_bytes == width * pixmap->btp) pixmap->pixels_fill(pixels, pixel, width * height, 0xff);
+    // clear it row by row, the padding bytes or the pixels outside the view will not be modified
+    else
+    {
+        tb_byte_t* data = (tb_byte_t*)pixels;
+        while (height--)
+        {
+            pixmap->pixels_fill(data, pixel, width, 0xff);
+            data += row_bytes;
+        }
+    }
 
-    // clear it
-    pixmap->pixels_fill(pixels, pixmap->pixel(color), count, 0xff);
+    // profile it
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_BLIT, time);
+
+    // the pixels have been modified
+    gb_bitmap_modified(impl->bitmap);
 }
 static tb_void_t gb_device_bitmap_draw_lines(gb_device_impl_t* device, gb_point_ref_t points, tb_size_t count, gb_rect_ref_t bounds)
 {
@@ -142,6 +169,266 @@ static tb_void_t gb_device_bitmap_draw_path(gb_device_impl_t* device, gb_path_re
         gb_bitmap_render_exit(impl);
     }
 }
+static tb_void_t gb_device_bitmap_draw_density(gb_device_impl_t* device, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count)
+{
+    // check
+    gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
+    tb_assert_and_check_return(impl && density);
+
+    // the empty layer? discard it
+    tb_check_return(impl->bitmap);
+
+    // profile it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+
+    // colorize the counts to the bitmap directly, the layer bitmap starts from the layer bounds
+    gb_device_layer_ref_t layer = device->layers_count? &device->layers[device->layers_count - 1] : tb_null;
+    gb_density_render_at(density, impl->bitmap, layer? layer->x : 0, layer? layer->y : 0, colors, count);
+
+    // profile it
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_BLIT, time);
+
+    // the pixels have been modified
+    gb_bitmap_modified(impl->bitmap);
+}
+static tb_void_t gb_device_bitmap_draw_bitmap(gb_device_impl_t* device, gb_bitmap_ref_t bitmap, tb_long_t x, tb_long_t y)
+{
+    // check
+    gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
+    tb_assert_and_check_return(impl && bitmap);
+
+    // the empty layer? discard it
+    tb_check_return(impl->bitmap);
+
+    // the layer bitmap starts from the layer bounds
+    gb_device_layer_ref_t layer = device->layers_count? &device->layers[device->layers_count - 1] : tb_null;
+    if (layer)
+    {
+        x -= layer->x;
+        y -= layer->y;
+    }
+
+    // clip the source rect to the target bitmap
+    tb_long_t sx = 0;
+    tb_long_t sy = 0;
+    tb_long_t width = (tb_long_t)gb_bitmap_width(bitmap);
+    tb_long_t height = (tb_long_t)gb_bitmap_height(bitmap);
+    if (x < 0)
+    {
+        sx = -x;
+        width += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        sy = -y;
+        height += y;
+        y = 0;
+    }
+    width = tb_min(width, (tb_long_t)gb_bitmap_width(impl->bitmap) - x);
+    height = tb_min(height, (tb_long_t)gb_bitmap_height(impl->bitmap) - y);
+    tb_check_return(width > 0 && height > 0);
+
+    // the pixmaps, only the little-endian argb8888 bitmap is supported now
+    gb_pixmap_ref_t source = gb_pixmap(gb_bitmap_pixfmt(bitmap), 0xff);
+    gb_pixmap_ref_t target = gb_pixmap(gb_bitmap_pixfmt(impl->bitmap), GB_ALPHA_MINN);
+    tb_assert_and_check_return(gb_bitmap_pixfmt(bitmap) == GB_PIXFMT_ARGB8888 && source && source->color && target && target->color_set);
+
+    // the pixels
+    tb_byte_t const*    data = (tb_byte_t const*)gb_bitmap_data(bitmap);
+    tb_byte_t*          pixels = (tb_byte_t*)gb_bitmap_data(impl->bitmap);
+    tb_assert_and_check_return(data && pixels);
+
+    // the bitmap info
+    tb_size_t btp           = target->btp;
+    tb_size_t row_bytes     = gb_bitmap_row_bytes(bitmap);
+    tb_size_t target_row_bytes = gb_bitmap_row_bytes(impl->bitmap);
+    tb_byte_t alpha_minn    = GB_QUALITY_ALPHA_MINN(gb_context_quality(device->context));
+
+    // profile it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    gb_profiler_count(profiler, GB_PROFILER_COUNT_PIXELS, width * height);
+
+    // composite the pixels: target = color * alpha + target * (1 - alpha)
+    tb_long_t i;
+    data += sy * row_bytes + (sx << 2);
+    pixels += y * target_row_bytes + x * btp;
+    while (height--)
+    {
+        tb_byte_t*          d = pixels;
+        tb_byte_t const*    s = data;
+        for (i = 0; i < width; i++, d += btp, s += 4)
+        {
+            // skip the transparent pixel quickly, the alpha is the highest byte
+            gb_pixel_t  pixel = tb_bits_get_u32_le(s);
+            tb_byte_t   alpha = (tb_byte_t)(pixel >> 24);
+            if (!alpha || alpha < alpha_minn) continue;
+
+            // blend it by the alpha of the color
+            target->color_set(d, source->color(pixel));
+        }
+        data += row_bytes;
+        pixels += target_row_bytes;
+    }
+
+    // profile it
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_BLIT, time);
+
+    // the pixels have been modified
+    gb_bitmap_modified(impl->bitmap);
+}
+static tb_bool_t gb_device_bitmap_save_layer(gb_device_impl_t* device, gb_device_layer_ref_t layer)
+{
+    // check
+    gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
+    tb_assert_and_check_return_val(impl && layer, tb_false);
+
+    // the depth of this layer
+    tb_size_t depth = device->layers_count;
+    tb_assert_and_check_return_val(depth < GB_DEVICE_LAYERS_MAXN, tb_false);
+
+    // the empty layer? all drawings will be discarded until loading it
+    gb_bitmap_ref_t parent = impl->bitmap;
+    if (!parent || !layer->width || !layer->height)
+    {
+        impl->layer_parents[depth] = parent;
+        impl->bitmap = tb_null;
+        return tb_true;
+    }
+
+    // the pooled bitmap of this depth, the pixfmt must be same as the parent
+    tb_size_t       pixfmt = gb_bitmap_pixfmt(parent);
+    gb_bitmap_ref_t bitmap = impl->layer_bitmaps[depth];
+    if (bitmap && (gb_bitmap_pixfmt(bitmap) != pixfmt || !gb_bitmap_resize(bitmap, layer->width, layer->height)))
+    {
+        gb_bitmap_exit(bitmap);
+        bitmap = tb_null;
+    }
+
+    // init bitmap
+    if (!bitmap) bitmap = gb_bitmap_init(tb_null, pixfmt, layer->width, layer->height, 0, gb_bitmap_has_alpha(parent));
+    impl->layer_bitmaps[depth] = bitmap;
+    tb_assert_and_check_return_val(bitmap, tb_false);
+
+    // the pixels
+    tb_byte_t* data = (tb_byte_t*)gb_bitmap_data(bitmap);
+    tb_byte_t* pixels = (tb_byte_t*)gb_bitmap_data(parent);
+    tb_assert_and_check_return_val(data && pixels && impl->pixmap, tb_false);
+
+    // the offset in the parent
+    gb_device_layer_ref_t parent_layer = depth? &device->layers[depth - 1] : tb_null;
+    tb_size_t x = layer->x - (parent_layer? parent_layer->x : 0);
+    tb_size_t y = layer->y - (parent_layer? parent_layer->y : 0);
+
+    // the bitmap info
+    tb_size_t btp       = impl->pixmap->btp;
+    tb_size_t row_bytes = gb_bitmap_row_bytes(bitmap);
+    tb_size_t parent_row_bytes = gb_bitmap_row_bytes(parent);
+    tb_size_t height    = layer->height;
+
+    // profile it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    gb_profiler_count(profiler, GB_PROFILER_COUNT_PIXELS, layer->width * layer->height);
+
+    /* copy the backdrop from the parent
+     *
+     * the layer is drawn over the backdrop, so the parent pixels can be blended with it by the group alpha directly
+     * when loading it and the pixels without any drawings will be not changed:
+     *
+     * parent = parent * (1 - alpha) + layer * alpha
+     */
+    pixels += y * parent_row_bytes + x * btp;
+    while (height--)
+    {
+        tb_memcpy(data, pixels, layer->width * btp);
+        data += row_bytes;
+        pixels += parent_row_bytes;
+    }
+
+    // profile it
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_BLIT, time);
+
+    // draw to the layer bitmap
+    impl->layer_parents[depth] = parent;
+    impl->bitmap = bitmap;
+
+    // ok
+    return tb_true;
+}
+static tb_void_t gb_device_bitmap_load_layer(gb_device_impl_t* device, gb_device_layer_ref_t layer)
+{
+    // check
+    gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
+    tb_assert_and_check_return(impl && layer);
+
+    // the depth of this layer
+    tb_size_t depth = device->layers_count;
+    tb_assert_and_check_return(depth < GB_DEVICE_LAYERS_MAXN);
+
+    // restore the parent bitmap
+    gb_bitmap_ref_t bitmap = impl->bitmap;
+    gb_bitmap_ref_t parent = impl->layer_parents[depth];
+    impl->bitmap = parent;
+    impl->layer_parents[depth] = tb_null;
+
+    // the empty layer? or the transparent layer? the parent pixels have not been modified
+    tb_size_t quality = gb_context_quality(device->context);
+    tb_check_return(bitmap && parent && layer->alpha >= GB_QUALITY_ALPHA_MINN(quality));
+
+    // the alpha of the context quality
+    tb_byte_t alpha     = layer->alpha;
+    tb_bool_t opaque    = alpha > GB_QUALITY_ALPHA_MAXN(quality);
+
+    // the pixels, the blend pixmap is got by the middle alpha for the thresholds of the global quality may be different
+    tb_byte_t const*    data = (tb_byte_t const*)gb_bitmap_data(bitmap);
+    tb_byte_t*          pixels = (tb_byte_t*)gb_bitmap_data(parent);
+    gb_pixmap_ref_t     pixmap = gb_pixmap(gb_bitmap_pixfmt(parent), opaque? 0xff : 0x80);
+    tb_assert_and_check_return(data && pixels && pixmap && pixmap->pixel_cpy);
+
+    // the offset in the parent
+    gb_device_layer_ref_t parent_layer = depth? &device->layers[depth - 1] : tb_null;
+    tb_size_t x = layer->x - (parent_layer? parent_layer->x : 0);
+    tb_size_t y = layer->y - (parent_layer? parent_layer->y : 0);
+
+    // the bitmap info
+    tb_size_t btp       = pixmap->btp;
+    tb_size_t width     = layer->width;
+    tb_size_t height    = layer->height;
+    tb_size_t row_bytes = gb_bitmap_row_bytes(bitmap);
+    tb_size_t parent_row_bytes = gb_bitmap_row_bytes(parent);
+
+    // profile it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    gb_profiler_count(profiler, GB_PROFILER_COUNT_PIXELS, width * height);
+
+    // composite the layer to the parent in one pass
+    tb_size_t i;
+    pixels += y * parent_row_bytes + x * btp;
+    while (height--)
+    {
+        // copy it directly if be opaque
+        if (opaque) tb_memcpy(pixels, data, width * btp);
+        // blend it with the group alpha
+        else
+        {
+            tb_byte_t*          d = pixels;
+            tb_byte_t const*    s = data;
+            for (i = 0; i < width; i++, d += btp, s += btp) pixmap->pixel_cpy(d, s, alpha);
+        }
+        data += row_bytes;
+        pixels += parent_row_bytes;
+    }
+
+    // profile it
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_BLIT, time);
+
+    // the pixels have been modified
+    gb_bitmap_modified(parent);
+}
 static gb_shader_ref_t gb_device_bitmap_shader_linear(gb_device_impl_t* device, tb_size_t mode, gb_gradient_ref_t gradient, gb_line_ref_t line)
 {
     // check
@@ -175,6 +462,14 @@ static tb_void_t gb_device_bitmap_exit(gb_device_impl_t* device)
     gb_bitmap_device_ref_t impl = (gb_bitmap_device_ref_t)device;
     tb_assert_and_check_return(impl);
 
+    // exit the pooled bitmaps of the layers
+    tb_size_t i = 0;
+    for (i = 0; i < GB_DEVICE_LAYERS_MAXN; i++)
+    {
+        if (impl->layer_bitmaps[i]) gb_bitmap_exit(impl->layer_bitmaps[i]);
+        impl->layer_bitmaps[i] = tb_null;
+    }
+
     // exit points
     if (impl->points) tb_vector_exit(impl->points);
     impl->points = tb_null;
@@ -183,13 +478,9 @@ static tb_void_t gb_device_bitmap_exit(gb_device_impl_t* device)
     if (impl->counts) tb_vector_exit(impl->counts);
     impl->counts = tb_null;
 
-    // exit stroker
-    if (impl->stroker) gb_stroker_exit(impl->stroker);
-    impl->stroker = tb_null;
-
-    // exit raster
-    if (impl->raster) gb_polygon_raster_exit(impl->raster);
-    impl->raster = tb_null;
+    // exit the owned context, the raster, stroker and stroke cache are referenced from it
+    if (impl->base.context && impl->base.context_owned) gb_context_exit(impl->base.context);
+    impl->base.context = tb_null;
 
     // exit it
     tb_free(impl);
@@ -199,6 +490,10 @@ static tb_void_t gb_device_bitmap_exit(gb_device_impl_t* device)
  * implementation
  */
 gb_device_ref_t gb_device_init_bitmap(gb_bitmap_ref_t bitmap)
+{
+    return gb_device_init_bitmap_with_context(bitmap, tb_null);
+}
+gb_device_ref_t gb_device_init_bitmap_with_context(gb_bitmap_ref_t bitmap, gb_context_ref_t context)
 {
     // check
     tb_assert_and_check_return_val(bitmap, tb_null);
@@ -225,11 +520,20 @@ gb_device_ref_t gb_device_init_bitmap(gb_bitmap_ref_t bitmap)
         impl->base.draw_lines       = gb_device_bitmap_draw_lines;
         impl->base.draw_points      = gb_device_bitmap_draw_points;
         impl->base.draw_polygon     = gb_device_bitmap_draw_polygon;
+        impl->base.draw_density     = gb_device_bitmap_draw_density;
+        impl->base.draw_bitmap      = gb_device_bitmap_draw_bitmap;
+        impl->base.save_layer       = gb_device_bitmap_save_layer;
+        impl->base.load_layer       = gb_device_bitmap_load_layer;
         impl->base.shader_linear    = gb_device_bitmap_shader_linear;
         impl->base.shader_radial    = gb_device_bitmap_shader_radial;
         impl->base.shader_bitmap    = gb_device_bitmap_shader_bitmap;
         impl->base.exit             = gb_device_bitmap_exit;
 
+        // init the pixfmt and size
+        impl->base.pixfmt           = (tb_uint16_t)gb_bitmap_pixfmt(bitmap);
+        impl->base.width            = (tb_uint16_t)width;
+        impl->base.height           = (tb_uint16_t)height;
+
         // init bitmap
         impl->bitmap = bitmap;
 
@@ -237,14 +541,23 @@ gb_device_ref_t gb_device_init_bitmap(gb_bitmap_ref_t bitmap)
         impl->pixmap = gb_pixmap(gb_bitmap_pixfmt(bitmap), 0xff);
         tb_assert_and_check_break(impl->pixmap);
 
+        // init context, make a private context if be null
+        impl->base.context          = context? context : gb_context_init();
+        impl->base.context_owned    = context? tb_false : tb_true;
+        tb_assert_and_check_break(impl->base.context);
+
         // init raster
-        impl->raster = gb_polygon_raster_init();
+        impl->raster = gb_context_raster(impl->base.context);
         tb_assert_and_check_break(impl->raster);
 
         // init stroker
-        impl->stroker = gb_stroker_init();
+        impl->stroker = gb_context_stroker(impl->base.context);
         tb_assert_and_check_break(impl->stroker);
 
+        // init stroke cache
+        impl->stroke_cache = gb_context_stroke_cache(impl->base.context);
+        tb_assert_and_check_break(impl->stroke_cache);
+
         // init points
         impl->points = tb_vector_init(GB_DEVICE_BITMAP_POINTS_GROW, tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
         tb_assert_and_check_break(impl->points);
@@ -35,6 +35,38 @@
 #include "biltter/solid.h"
 #include "biltter/shader.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_bool_t gb_bitmap_biltter_clip(gb_bitmap_biltter_ref_t biltter, tb_long_t* x, tb_long_t* y, tb_long_t* w, tb_long_t* h)
+{
+    // check
+    tb_assert(biltter && biltter->bitmap && x && y && w && h);
+
+    // the bitmap size
+    tb_long_t width = (tb_long_t)gb_bitmap_width(biltter->bitmap);
+    tb_long_t height = (tb_long_t)gb_bitmap_height(biltter->bitmap);
+
+    /* clip the left, top, right and bottom edges respectively
+     *
+     * the right and bottom edges are kept after moving the left and top edges,
+     * so the rect crossing the left or top edge is cut and not be moved
+     */
+    tb_long_t x0 = tb_max(*x, 0);
+    tb_long_t y0 = tb_max(*y, 0);
+    tb_long_t x1 = tb_min(*x + *w, width);
+    tb_long_t y1 = tb_min(*y + *h, height);
+
+    // the clipped rect
+    *x = x0;
+    *y = y0;
+    *w = x1 - x0;
+    *h = y1 - y0;
+
+    // ok?
+    return *w > 0 && *h > 0;
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -59,6 +91,12 @@ tb_void_t gb_bitmap_biltter_done_p(gb_bitmap_biltter_ref_t biltter, tb_long_t x,
     // check
     tb_assert(biltter && biltter->done_p);
 
+    // clip it
+    tb_check_return(x >= 0 && y >= 0 && x < (tb_long_t)gb_bitmap_width(biltter->bitmap) && y < (tb_long_t)gb_bitmap_height(biltter->bitmap));
+
+    // profile it
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_PIXELS, 1);
+
     // done it
     biltter->done_p(biltter, x, y);
 }
@@ -67,6 +105,14 @@ tb_void_t gb_bitmap_biltter_done_h(gb_bitmap_biltter_ref_t biltter, tb_long_t x,
     // check
     tb_assert(biltter && biltter->done_h);
 
+    // clip it
+    tb_long_t h = 1;
+    tb_check_return(gb_bitmap_biltter_clip(biltter, &x, &y, &w, &h));
+
+    // profile it
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_SPANS, 1);
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_PIXELS, w);
+
     // done it
     biltter->done_h(biltter, x, y, w);
 }
@@ -75,6 +121,14 @@ tb_void_t gb_bitmap_biltter_done_v(gb_bitmap_biltter_ref_t biltter, tb_long_t x,
     // check
     tb_assert(biltter && biltter->done_v);
 
+    // clip it
+    tb_long_t w = 1;
+    tb_check_return(gb_bitmap_biltter_clip(biltter, &x, &y, &w, &h));
+
+    // profile it
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_SPANS, h);
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_PIXELS, h);
+
     // done it
     biltter->done_v(biltter, x, y, h);
 }
@@ -83,6 +137,13 @@ tb_void_t gb_bitmap_biltter_done_r(gb_bitmap_biltter_ref_t biltter, tb_long_t x,
     // check
     tb_assert(biltter);
 
+    // clip it
+    tb_check_return(gb_bitmap_biltter_clip(biltter, &x, &y, &w, &h));
+
+    // profile it
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_SPANS, h);
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_PIXELS, w * h);
+
     // horizontal?
     if (h == 1) 
     {
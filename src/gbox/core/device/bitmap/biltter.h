@@ -70,6 +70,9 @@ typedef struct __gb_bitmap_biltter_t
     // the row bytes of the bitmap
     tb_size_t                       row_bytes;
 
+    // the profiler, only for the profile mode
+    gb_profiler_ref_t               profiler;
+
     /* exit the biltter
      *
      * @param biltter               the biltter 
@@ -108,11 +108,13 @@ static tb_void_t gb_bitmap_biltter_solid_done_r(gb_bitmap_biltter_ref_t biltter,
     tb_byte_t                       alpha = biltter->u.solid.alpha;
     gb_pixmap_func_pixels_fill_t    pixels_fill = biltter->pixmap->pixels_fill;
 
+    // the first row
+    pixels += y * row_bytes + x * btp;
+
     // done
     if (!x && (w * btp == row_bytes)) pixels_fill(pixels, pixel, h * w, alpha);
     else
     {
-        pixels += y * row_bytes + x * btp;
         while (h--) 
         {
             pixels_fill(pixels, pixel, w, alpha);
@@ -29,6 +29,7 @@
 #include "prefix.h"
 #include "biltter.h"
 #include "../../impl/stroker.h"
+#include "../../impl/stroke_cache.h"
 #include "../../impl/polygon_raster.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +69,21 @@ typedef struct __gb_bitmap_device_t
     // the stroker
     gb_stroker_ref_t                stroker;
 
+    // the stroke cache
+    gb_stroke_cache_ref_t           stroke_cache;
+
+    // the pooled bitmaps of the layers, they are reused by the next layers with the same depth
+    gb_bitmap_ref_t                 layer_bitmaps[GB_DEVICE_LAYERS_MAXN];
+
+    // the drawn bitmap before saving the layer, it is null if the parent layer is empty
+    gb_bitmap_ref_t                 layer_parents[GB_DEVICE_LAYERS_MAXN];
+
+    // the matrix with the offset of the current layer
+    gb_matrix_t                     layer_matrix;
+
+    // the bound matrix, the layer matrix is bound when drawing to the layer
+    gb_matrix_ref_t                 matrix;
+
 }gb_bitmap_device_t, *gb_bitmap_device_ref_t;
 
 #endif
@@ -36,6 +36,7 @@
 #include "render/render.h"
 #include "../../impl/bounds.h"
 #include "../../impl/stroker.h"
+#include "../../impl/path_lod.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
@@ -182,6 +183,41 @@ static tb_void_t gb_bitmap_render_stroke_fill(gb_bitmap_device_ref_t device, gb_
     // restore the fill mode
     gb_paint_fill_rule_set(device->base.paint, rule);
 }
+static gb_path_ref_t gb_bitmap_render_stroke_path(gb_bitmap_device_ref_t device, gb_path_ref_t path)
+{
+    // check
+    tb_assert(device && device->stroker && device->stroke_cache && device->base.paint && path);
+
+    // get the cached stroked path
+    gb_path_ref_t stroked = gb_stroke_cache_get(device->stroke_cache, device->base.paint, path);
+    tb_check_return_val(!stroked, stroked);
+
+    // stroke it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    stroked = gb_stroker_done_path(device->stroker, device->base.paint, path);
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+    // cache the stroked path
+    return gb_stroke_cache_add(device->stroke_cache, device->base.paint, path, stroked);
+}
+static gb_polygon_ref_t gb_bitmap_render_path_polygon(gb_bitmap_device_ref_t device, gb_path_ref_t path)
+{
+    // check
+    tb_assert(device && path);
+
+    /* make the polygon of the path, it will be flattened only once if the path is not changed
+     *
+     * the points of the large polygon in the same device pixel are removed by the scale of the matrix
+     */
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    gb_polygon_ref_t    polygon = gb_path_polygon_lod(path, gb_path_lod_tolerance(device->base.matrix));
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_FLATTEN, time);
+
+    // ok
+    return polygon;
+}
 static __tb_inline__ tb_bool_t gb_bitmap_render_stroke_only(gb_bitmap_device_ref_t device)
 {
     // check
@@ -202,6 +238,9 @@ tb_bool_t gb_bitmap_render_init(gb_bitmap_device_ref_t device)
     // check
     tb_assert_and_check_return_val(device && device->base.matrix && device->base.paint, tb_false);
 
+    // the empty layer? discard all drawings
+    tb_check_return_val(device->bitmap, tb_false);
+
     // done
     tb_bool_t ok = tb_false;
     do
@@ -209,9 +248,22 @@ tb_bool_t gb_bitmap_render_init(gb_bitmap_device_ref_t device)
         // init shader
         device->shader = gb_paint_shader(device->base.paint);
 
+        // bind the matrix with the offset of the layer, the points will be drawn to the layer bitmap
+        device->matrix = device->base.matrix;
+        if (device->base.layers_count)
+        {
+            gb_device_layer_ref_t layer = &device->base.layers[device->base.layers_count - 1];
+            device->layer_matrix = *device->base.matrix;
+            gb_matrix_translate_lhs(&device->layer_matrix, gb_long_to_float(-(tb_long_t)layer->x), gb_long_to_float(-(tb_long_t)layer->y));
+            device->base.matrix = &device->layer_matrix;
+        }
+
         // init biltter
         if (!gb_bitmap_biltter_init(&device->biltter, device->bitmap, device->base.paint)) break;
 
+        // init the profiler of the biltter
+        device->biltter.profiler = gb_profiler_hook(device->base.context);
+
         // ok
         ok = tb_true;
 
@@ -230,6 +282,13 @@ tb_void_t gb_bitmap_render_exit(gb_bitmap_device_ref_t device)
 
     // exit biltter
     gb_bitmap_biltter_exit(&device->biltter);
+
+    // restore the bound matrix
+    if (device->matrix) device->base.matrix = device->matrix;
+    device->matrix = tb_null;
+
+    // the pixels may have been modified, the cached textures of this bitmap will be updated
+    if (device->bitmap) gb_bitmap_modified(device->bitmap);
 }
 tb_void_t gb_bitmap_render_draw_path(gb_bitmap_device_ref_t device, gb_path_ref_t path)
 {
@@ -242,7 +301,7 @@ tb_void_t gb_bitmap_render_draw_path(gb_bitmap_device_ref_t device, gb_path_ref_
     // fill it
     if (mode & GB_PAINT_MODE_FILL)
     {
-        gb_bitmap_render_draw_polygon(device, gb_path_polygon(path), gb_path_hint(path), gb_path_bounds(path));
+        gb_bitmap_render_draw_polygon(device, gb_bitmap_render_path_polygon(device, path), gb_path_hint(path), gb_path_bounds(path));
     }
 
     // stroke it
@@ -251,10 +310,10 @@ tb_void_t gb_bitmap_render_draw_path(gb_bitmap_device_ref_t device, gb_path_ref_
         // only stroke?
         if (gb_bitmap_render_stroke_only(device))
         {
-            gb_bitmap_render_draw_polygon(device, gb_path_polygon(path), gb_path_hint(path), gb_path_bounds(path));
+            gb_bitmap_render_draw_polygon(device, gb_bitmap_render_path_polygon(device, path), gb_path_hint(path), gb_path_bounds(path));
         }
         // fill the stroked path
-        else gb_bitmap_render_stroke_fill(device, gb_stroker_done_path(device->stroker, device->base.paint, path));
+        else gb_bitmap_render_stroke_fill(device, gb_bitmap_render_stroke_path(device, path));
     }
 }
 tb_void_t gb_bitmap_render_draw_lines(gb_bitmap_device_ref_t device, gb_point_ref_t points, tb_size_t count, gb_rect_ref_t bounds)
@@ -268,6 +327,9 @@ tb_void_t gb_bitmap_render_draw_lines(gb_bitmap_device_ref_t device, gb_point_re
     // check width
     tb_check_return((gb_paint_stroke_width(device->base.paint) > 0));
 
+    // the profiler
+    gb_profiler_ref_t profiler = gb_profiler_hook(device->base.context);
+
     // only stroke?
     if (gb_bitmap_render_stroke_only(device))
     {
@@ -280,10 +342,21 @@ tb_void_t gb_bitmap_render_draw_lines(gb_bitmap_device_ref_t device, gb_point_re
         // ...
 
         // stroke lines
+        tb_hong_t time = gb_profiler_enter(profiler);
         gb_bitmap_render_stroke_lines(device, stroked_points, stroked_count);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_RASTER, time);
     }
     // fill the stroked lines
-    else gb_bitmap_render_stroke_fill(device, gb_stroker_done_lines(device->stroker, device->base.paint, points, count));
+    else
+    {
+        // stroke lines
+        tb_hong_t       time = gb_profiler_enter(profiler);
+        gb_path_ref_t   stroked = gb_stroker_done_lines(device->stroker, device->base.paint, points, count);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+        // fill it
+        gb_bitmap_render_stroke_fill(device, stroked);
+    }
 }
 tb_void_t gb_bitmap_render_draw_points(gb_bitmap_device_ref_t device, gb_point_ref_t points, tb_size_t count, gb_rect_ref_t bounds)
 {
@@ -296,22 +369,36 @@ tb_void_t gb_bitmap_render_draw_points(gb_bitmap_device_ref_t device, gb_point_r
     // check width
     tb_check_return((gb_paint_stroke_width(device->base.paint) > 0));
 
+    // the profiler
+    gb_profiler_ref_t profiler = gb_profiler_hook(device->base.context);
+
     // only stroke?
     if (gb_bitmap_render_stroke_only(device))
     {
-        // apply matrix to points
-        gb_point_ref_t  stroked_points  = tb_null;
-        tb_size_t       stroked_count   = gb_bitmap_render_apply_matrix_for_points(device, points, count, &stroked_points);
-        tb_assert(stroked_points && stroked_count);
-
-        // TODO: clip it
-        // ...
+        // stroke points, the matrix is applied and the points are clipped in one pass
+        tb_hong_t time = gb_profiler_enter(profiler);
+        gb_bitmap_render_stroke_points(device, points, count);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_RASTER, time);
+    }
+    // fill the stroked points
+    else
+    {
+        // splat the rasterized sprite for the wide points if the paint, layers, matrix and width are supported
+        tb_hong_t time = gb_profiler_enter(profiler);
+        if (gb_bitmap_render_splat_points(device, points, count))
+        {
+            gb_profiler_leave(profiler, GB_PROFILER_STAGE_RASTER, time);
+            return ;
+        }
 
         // stroke points
-        gb_bitmap_render_stroke_points(device, stroked_points, stroked_count);
+        time = gb_profiler_enter(profiler);
+        gb_path_ref_t   stroked = gb_stroker_done_points(device->stroker, device->base.paint, points, count);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+        // fill it
+        gb_bitmap_render_stroke_fill(device, stroked);
     }
-    // fill the stroked points
-    else gb_bitmap_render_stroke_fill(device, gb_stroker_done_points(device->stroker, device->base.paint, points, count));
 }
 tb_void_t gb_bitmap_render_draw_polygon(gb_bitmap_device_ref_t device, gb_polygon_ref_t polygon, gb_shape_ref_t hint, gb_rect_ref_t bounds)
 {
@@ -334,6 +421,9 @@ tb_void_t gb_bitmap_render_draw_polygon(gb_bitmap_device_ref_t device, gb_polygo
         return ;
     }
 
+    // the profiler
+    gb_profiler_ref_t profiler = gb_profiler_hook(device->base.context);
+
     // the mode
     tb_size_t mode = gb_paint_mode(device->base.paint);
 
@@ -360,10 +450,17 @@ tb_void_t gb_bitmap_render_draw_polygon(gb_bitmap_device_ref_t device, gb_polygo
             tb_assert(filled_hint.type == GB_SHAPE_TYPE_RECT);
 
             // fill rect
+            tb_hong_t time = gb_profiler_enter(profiler);
             gb_bitmap_render_fill_rect(device, &filled_hint.u.rect);
+            gb_profiler_leave(profiler, GB_PROFILER_STAGE_BLIT, time);
         }
         // fill polygon
-        else gb_bitmap_render_fill_polygon(device, &filled_polygon, filled_bounds);
+        else
+        {
+            tb_hong_t time = gb_profiler_enter(profiler);
+            gb_bitmap_render_fill_polygon(device, &filled_polygon, filled_bounds);
+            gb_profiler_leave(profiler, GB_PROFILER_STAGE_RASTER, time);
+        }
     }
 
     // stroke it
@@ -381,10 +478,21 @@ tb_void_t gb_bitmap_render_draw_polygon(gb_bitmap_device_ref_t device, gb_polygo
             // ...
 
             // stroke polygon
+            tb_hong_t time = gb_profiler_enter(profiler);
             if (stroked_count) gb_bitmap_render_stroke_polygon(device, &stroked_polygon);
+            gb_profiler_leave(profiler, GB_PROFILER_STAGE_RASTER, time);
         }
         // fill the stroked polygon
-        else gb_bitmap_render_stroke_fill(device, gb_stroker_done_polygon(device->stroker, device->base.paint, polygon, hint));
+        else
+        {
+            // stroke polygon
+            tb_hong_t       time = gb_profiler_enter(profiler);
+            gb_path_ref_t   stroked = gb_stroker_done_polygon(device->stroker, device->base.paint, polygon, hint);
+            gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+            // fill it
+            gb_bitmap_render_stroke_fill(device, stroked);
+        }
     }
 }
 
@@ -33,16 +33,140 @@
  */
 #include "points.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_bitmap_render_splat_sprite(tb_size_t size, tb_bool_t round, tb_uint16_t* offsets, tb_uint16_t* widths)
+{
+    // check
+    tb_assert(size && size <= GB_BITMAP_RENDER_SPRITE_MAXN && offsets && widths);
+
+    // square? all rows are full
+    tb_size_t i;
+    if (!round)
+    {
+        for (i = 0; i < size; i++)
+        {
+            offsets[i]  = 0;
+            widths[i]   = (tb_uint16_t)size;
+        }
+        return ;
+    }
+
+    /* make the spans of the circle with the diameter size
+     *
+     * the pixel (j, i) is covered if its center is in the circle, in half-pixel units:
+     *
+     * (2j + 1 - size)^2 + (2i + 1 - size)^2 <= size^2
+     */
+    tb_long_t d = (tb_long_t)size;
+    for (i = 0; i < size; i++)
+    {
+        // the half chord of this row, in half-pixel units
+        tb_long_t dy = (tb_long_t)(i << 1) + 1 - d;
+        tb_long_t s = (tb_long_t)tb_isqrti((tb_uint32_t)(d * d - dy * dy));
+
+        // the first covered pixel: 2j + 1 - d >= -s, s <= d
+        tb_long_t j = (d - s) >> 1;
+        offsets[i]  = (tb_uint16_t)j;
+        widths[i]   = (tb_uint16_t)(d > (j << 1)? d - (j << 1) : 0);
+    }
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
 tb_void_t gb_bitmap_render_stroke_points(gb_bitmap_device_ref_t device, gb_point_ref_t points, tb_size_t count)
 {
     // check
-    tb_assert(device && points && count);
+    tb_assert(device && device->base.matrix && device->biltter.done_p && points && count);
 
-    // done
-    tb_size_t i;
-    for (i = 0; i < count; i++) 
-        gb_bitmap_biltter_done_p(&device->biltter, gb_float_to_long(points[i].x), gb_float_to_long(points[i].y));
+    // the factors
+    gb_bitmap_biltter_ref_t biltter = &device->biltter;
+    gb_matrix_ref_t         matrix = device->base.matrix;
+    tb_size_t               width = gb_bitmap_width(device->bitmap);
+    tb_size_t               height = gb_bitmap_height(device->bitmap);
+    gb_point_ref_t          tail = points + count;
+    tb_size_t               pixels = 0;
+
+    // done, clip and blit all points in one pass without the temporary points
+    gb_float_t  x;
+    gb_float_t  y;
+    tb_size_t   px;
+    tb_size_t   py;
+    for (; points < tail; points++)
+    {
+        // apply matrix
+        x = gb_matrix_apply_x(matrix, points->x, points->y);
+        y = gb_matrix_apply_y(matrix, points->x, points->y);
+
+        // clip it
+        tb_check_continue(x >= 0 && y >= 0);
+        px = (tb_size_t)gb_float_to_long(x);
+        py = (tb_size_t)gb_float_to_long(y);
+        tb_check_continue(px < width && py < height);
+
+        // blit it
+        biltter->done_p(biltter, (tb_long_t)px, (tb_long_t)py);
+        pixels++;
+    }
+
+    // profile it
+    gb_profiler_count(biltter->profiler, GB_PROFILER_COUNT_PIXELS, pixels);
+}
+tb_bool_t gb_bitmap_render_splat_points(gb_bitmap_device_ref_t device, gb_point_ref_t points, tb_size_t count)
+{
+    // check
+    tb_assert(device && device->base.paint && device->base.matrix && points && count);
+
+    // only the opaque paint without shader? the overlapped translucent sprites will be blended twice
+    gb_paint_ref_t paint = device->base.paint;
+    tb_check_return_val(!device->shader && gb_paint_alpha(paint) == 0xff && gb_paint_color(paint).a == 0xff, tb_false);
+
+    // only the opaque layers?
+    tb_size_t layer = 0;
+    for (layer = 0; layer < device->base.layers_count; layer++)
+    {
+        tb_check_return_val(device->base.layers[layer].alpha == 0xff, tb_false);
+    }
+
+    // only scale and translate with the same scale for x and y?
+    gb_matrix_ref_t matrix = device->base.matrix;
+    tb_check_return_val(!matrix->kx && !matrix->ky && gb_abs(matrix->sx) == gb_abs(matrix->sy), tb_false);
+
+    // the sprite size
+    tb_long_t size = gb_round(gb_mul(gb_paint_stroke_width(paint), gb_abs(matrix->sx)));
+    tb_check_return_val(size > 0 && size <= GB_BITMAP_RENDER_SPRITE_MAXN, tb_false);
+
+    // make the sprite, the butt cap is the same as the square cap for the points
+    tb_uint16_t offsets[GB_BITMAP_RENDER_SPRITE_MAXN];
+    tb_uint16_t widths[GB_BITMAP_RENDER_SPRITE_MAXN];
+    gb_bitmap_render_splat_sprite((tb_size_t)size, gb_paint_stroke_cap(paint) == GB_PAINT_STROKE_CAP_ROUND, offsets, widths);
+
+    /* splat the sprite at all points
+     *
+     * the sprite of each point is blended independently, 
+     * it is the same as the filled union of the stroked points only for the opaque paint
+     */
+    tb_long_t               i;
+    tb_long_t               x0;
+    tb_long_t               y0;
+    gb_float_t              half = gb_half(gb_long_to_float(size - 1));
+    gb_point_ref_t          tail = points + count;
+    gb_bitmap_biltter_ref_t biltter = &device->biltter;
+    for (; points < tail; points++)
+    {
+        // the top-left corner of the sprite
+        x0 = gb_floor(gb_matrix_apply_x(matrix, points->x, points->y) - half);
+        y0 = gb_floor(gb_matrix_apply_y(matrix, points->x, points->y) - half);
+
+        // blit the spans, the spans will be clipped
+        for (i = 0; i < size; i++)
+        {
+            if (widths[i]) gb_bitmap_biltter_done_h(biltter, x0 + offsets[i], y0 + i, widths[i]);
+        }
+    }
+
+    // ok
+    return tb_true;
 }
@@ -34,11 +34,18 @@
  */
 __tb_extern_c_enter__
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum size of the point sprite, the larger points will be stroked and filled
+#define GB_BITMAP_RENDER_SPRITE_MAXN        (64)
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * interface
  */
 
-/* stroke points
+/* stroke points with the width 1, the matrix will be applied to the points
  *
  * @param device    the device
  * @param points    the points 
@@ -46,6 +53,18 @@ __tb_extern_c_enter__
  */
 tb_void_t           gb_bitmap_render_stroke_points(gb_bitmap_device_ref_t device, gb_point_ref_t points, tb_size_t count);
 
+/* splat the wide points with the rasterized round or square sprite, the matrix will be applied to the points
+ *
+ * the overlapped sprites are blended twice, so only the opaque paint and layers are supported
+ *
+ * @param device    the device
+ * @param points    the points 
+ * @param count     the points count
+ *
+ * @return          tb_false if the paint, layers, matrix or width is not supported for splatting it
+ */
+tb_bool_t           gb_bitmap_render_splat_points(gb_bitmap_device_ref_t device, gb_point_ref_t points, tb_size_t count);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
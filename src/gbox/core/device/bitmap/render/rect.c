@@ -41,6 +41,16 @@ tb_void_t gb_bitmap_render_fill_rect(gb_bitmap_device_ref_t device, gb_rect_ref_
     // check
     tb_assert(device && rect);
 
+    /* round the left, top, right and bottom edges to the pixel centers
+     *
+     * the edges are rounded respectively instead of truncating the position and size,
+     * otherwise the bottom edge of the rect with the negative y may be moved down.
+     */
+    tb_long_t x0 = gb_floor(rect->x + GB_HALF);
+    tb_long_t y0 = gb_floor(rect->y + GB_HALF);
+    tb_long_t x1 = gb_floor(rect->x + rect->w + GB_HALF);
+    tb_long_t y1 = gb_floor(rect->y + rect->h + GB_HALF);
+
     // done biltter
-    gb_bitmap_biltter_done_r(&device->biltter, gb_float_to_long(rect->x), gb_float_to_long(rect->y), gb_float_to_long(rect->w), gb_float_to_long(rect->h));
+    gb_bitmap_biltter_done_r(&device->biltter, x0, y0, x1 - x0, y1 - y0);
 }
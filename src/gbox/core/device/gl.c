@@ -45,7 +45,7 @@
  * declaration
  */
 #ifdef GB_CONFIG_PACKAGE_HAVE_OPENGL
-__tb_extern_c__ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window);
+__tb_extern_c__ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window, gb_context_ref_t context);
 #endif
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -107,9 +107,9 @@ static tb_void_t gb_device_gl_resize(gb_device_impl_t* device, tb_size_t width,
 }
 static tb_void_t gb_device_gl_draw_clear(gb_device_impl_t* device, gb_color_t color)
 {
-    // clear it
+    // clear the color and the stencil for the stencil fill mode
 	gb_glClearColor((gb_GLfloat_t)color.r / 0xff, (gb_GLfloat_t)color.g / 0xff, (gb_GLfloat_t)color.b / 0xff, (gb_GLfloat_t)color.a / 0xff);
-	gb_glClear(GB_GL_COLOR_BUFFER_BIT);
+	gb_glClear(GB_GL_COLOR_BUFFER_BIT | GB_GL_STENCIL_BUFFER_BIT);
 }
 static tb_void_t gb_device_gl_draw_path(gb_device_impl_t* device, gb_path_ref_t path)
 {
@@ -175,6 +175,184 @@ static tb_void_t gb_device_gl_draw_polygon(gb_device_impl_t* device, gb_polygon_
         gb_gl_render_exit(impl);
     }
 }
+static tb_void_t gb_device_gl_fill_rect(gb_device_impl_t* device, gb_paint_ref_t paint, tb_long_t x, tb_long_t y, tb_size_t width, tb_size_t height)
+{
+    // make the rect in the device coordinates
+    gb_matrix_t     matrix;
+    gb_shape_t      hint;
+    gb_point_t      points[5];
+    tb_uint16_t     counts[2] = {5, 0};
+    gb_polygon_t    polygon = {points, counts, tb_true};
+    gb_matrix_clear(&matrix);
+    gb_rect_imake(&hint.u.rect, x, y, width, height);
+    hint.type = GB_SHAPE_TYPE_RECT;
+    gb_point_imake(points + 0, x, y);
+    gb_point_imake(points + 1, x + width, y);
+    gb_point_imake(points + 2, x + width, y + height);
+    gb_point_imake(points + 3, x, y + height);
+    points[4] = points[0];
+
+    // fill it with the given paint and the identity matrix
+    gb_paint_ref_t  paint_base = device->paint;
+    gb_matrix_ref_t matrix_base = device->matrix;
+    device->paint   = paint;
+    device->matrix  = &matrix;
+    gb_device_gl_draw_polygon(device, &polygon, &hint, &hint.u.rect);
+    device->paint   = paint_base;
+    device->matrix  = matrix_base;
+}
+static tb_void_t gb_device_gl_clip_layer(gb_gl_device_ref_t impl, gb_device_layer_ref_t layer)
+{
+    // clip all drawings to the bounds of the layer, the origin of the framebuffer is at the left-bottom corner
+    if (layer)
+    {
+        gb_glEnable(GB_GL_SCISSOR_TEST);
+        gb_glScissor((gb_GLint_t)layer->x, (gb_GLint_t)impl->base.height - layer->y - layer->height, (gb_GLsizei_t)layer->width, (gb_GLsizei_t)layer->height);
+    }
+    else gb_glDisable(GB_GL_SCISSOR_TEST);
+}
+static tb_void_t gb_device_gl_draw_density(gb_device_impl_t* device, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count)
+{
+    // check
+    gb_gl_device_ref_t impl = (gb_gl_device_ref_t)device;
+    tb_assert_and_check_return(impl && density);
+
+    // the density size
+    tb_size_t width     = gb_density_width(density);
+    tb_size_t height    = gb_density_height(density);
+
+    // the size has been changed? remake the bitmap and shader
+    if (impl->density_bitmap && (gb_bitmap_width(impl->density_bitmap) != width || gb_bitmap_height(impl->density_bitmap) != height))
+    {
+        // exit shader
+        if (impl->density_shader) gb_shader_exit(impl->density_shader);
+        impl->density_shader = tb_null;
+
+        // exit bitmap
+        gb_bitmap_exit(impl->density_bitmap);
+        impl->density_bitmap = tb_null;
+    }
+
+    // init bitmap
+    if (!impl->density_bitmap) impl->density_bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_RGBA8888 | GB_PIXFMT_BENDIAN, width, height, 0, tb_true);
+    tb_assert_and_check_return(impl->density_bitmap);
+
+    // init shader
+    if (!impl->density_shader) impl->density_shader = gb_gl_shader_init_bitmap(impl, GB_SHADER_MODE_CLAMP, impl->density_bitmap);
+    tb_assert_and_check_return(impl->density_shader);
+
+    // init paint
+    if (!impl->density_paint) impl->density_paint = gb_paint_init();
+    tb_assert_and_check_return(impl->density_paint);
+
+    // clear the bitmap to the transparent pixels
+    tb_byte_t* data = (tb_byte_t*)gb_bitmap_data(impl->density_bitmap);
+    tb_assert_and_check_return(data);
+    tb_memset(data, 0, gb_bitmap_row_bytes(impl->density_bitmap) * height);
+
+    // colorize the counts, the texture will be uploaded again after it is modified
+    gb_density_render(density, impl->density_bitmap, colors, count);
+    gb_bitmap_modified(impl->density_bitmap);
+
+    // init paint
+    gb_paint_clear(impl->density_paint);
+    gb_paint_mode_set(impl->density_paint, GB_PAINT_MODE_FILL);
+    gb_paint_shader_set(impl->density_paint, impl->density_shader);
+
+    // draw the bitmap of the density
+    gb_device_gl_fill_rect(device, impl->density_paint, 0, 0, width, height);
+}
+static tb_bool_t gb_device_gl_save_layer(gb_device_impl_t* device, gb_device_layer_ref_t layer)
+{
+    // check
+    gb_gl_device_ref_t impl = (gb_gl_device_ref_t)device;
+    tb_assert_and_check_return_val(impl && layer, tb_false);
+
+    // the depth of this layer
+    tb_size_t depth = device->layers_count;
+    tb_assert_and_check_return_val(depth < GB_DEVICE_LAYERS_MAXN, tb_false);
+
+    /* copy the backdrop if the layer is not empty and not opaque
+     *
+     * the layer is drawn to the framebuffer directly and the backdrop is restored by the inverse alpha
+     * when loading it, so we need not switch the framebuffer and the stencil and multisample buffers are still used:
+     *
+     * parent = layer * alpha + backdrop * (1 - alpha)
+     */
+    if (layer->width && layer->height && layer->alpha <= GB_QUALITY_ALPHA_MAXN(gb_context_quality(device->context)))
+    {
+        // the pooled backdrop shader of this depth is too small? remake it
+        gb_shader_ref_t shader = impl->layer_shaders[depth];
+        if (shader && (impl->layer_widths[depth] < layer->width || impl->layer_heights[depth] < layer->height))
+        {
+            gb_shader_exit(shader);
+            shader = tb_null;
+        }
+
+        // init shader, the texture size is aligned by pow2 for reusing it and the gl 1.x
+        if (!shader)
+        {
+            tb_size_t width     = tb_align_pow2(tb_max(layer->width, impl->layer_widths[depth]));
+            tb_size_t height    = tb_align_pow2(tb_max(layer->height, impl->layer_heights[depth]));
+            shader = gb_gl_shader_init_texture(impl, width, height);
+            impl->layer_shaders[depth] = shader;
+            impl->layer_widths[depth]  = shader? (tb_uint16_t)width : 0;
+            impl->layer_heights[depth] = shader? (tb_uint16_t)height : 0;
+        }
+        tb_assert_and_check_return_val(shader, tb_false);
+
+        // copy the backdrop from the framebuffer, the rows are flipped
+        gb_glBindTexture(GB_GL_TEXTURE_2D, ((gb_gl_shader_ref_t)shader)->texture.id);
+        gb_glCopyTexSubImage2D(GB_GL_TEXTURE_2D, 0, 0, 0, (gb_GLint_t)layer->x, (gb_GLint_t)device->height - layer->y - layer->height, (gb_GLsizei_t)layer->width, (gb_GLsizei_t)layer->height);
+
+        // map the bounds of the layer to the backdrop texture
+        gb_GLfloat_t sx = 1.0f / impl->layer_widths[depth];
+        gb_GLfloat_t sy = 1.0f / impl->layer_heights[depth];
+        gb_gl_matrix_init(((gb_gl_shader_ref_t)shader)->matrix, sx, 0.0f, 0.0f, -sy, -layer->x * sx, (layer->y + layer->height) * sy);
+    }
+
+    // clip all drawings to the bounds of this layer
+    gb_device_gl_clip_layer(impl, layer);
+
+    // ok
+    return tb_true;
+}
+static tb_void_t gb_device_gl_load_layer(gb_device_impl_t* device, gb_device_layer_ref_t layer)
+{
+    // check
+    gb_gl_device_ref_t impl = (gb_gl_device_ref_t)device;
+    tb_assert_and_check_return(impl && layer);
+
+    // the depth of this layer
+    tb_size_t depth = device->layers_count;
+    tb_assert_and_check_return(depth < GB_DEVICE_LAYERS_MAXN);
+
+    // clip all drawings to the bounds of the parent layer
+    gb_device_gl_clip_layer(impl, depth? &device->layers[depth - 1] : tb_null);
+
+    // the empty layer or the opaque layer? the drawings have been in the parent
+    tb_check_return(layer->width && layer->height && layer->alpha <= GB_QUALITY_ALPHA_MAXN(gb_context_quality(device->context)));
+
+    // the backdrop shader
+    gb_shader_ref_t shader = impl->layer_shaders[depth];
+    tb_assert_and_check_return(shader);
+
+    // init paint
+    if (!impl->layer_paint) impl->layer_paint = gb_paint_init();
+    tb_assert_and_check_return(impl->layer_paint);
+
+    // init paint with the inverse alpha
+    gb_paint_clear(impl->layer_paint);
+    gb_paint_mode_set(impl->layer_paint, GB_PAINT_MODE_FILL);
+    gb_paint_alpha_set(impl->layer_paint, 0xff - layer->alpha);
+    gb_paint_shader_set(impl->layer_paint, shader);
+
+    // restore the backdrop over the layer
+    gb_device_gl_fill_rect(device, impl->layer_paint, layer->x, layer->y, layer->width, layer->height);
+
+    // release the backdrop shader
+    gb_paint_shader_set(impl->layer_paint, tb_null);
+}
 static gb_shader_ref_t gb_device_gl_shader_linear(gb_device_impl_t* device, tb_size_t mode, gb_gradient_ref_t gradient, gb_line_ref_t line)
 {
     // check
@@ -211,13 +389,34 @@ static tb_void_t gb_device_gl_exit(gb_device_impl_t* device)
     // exit tessellator
     if (impl->tessellator) gb_tessellator_exit(impl->tessellator);
     impl->tessellator = tb_null;
+
+    // exit the layer paint and the backdrop shaders
+    tb_size_t i = 0;
+    if (impl->layer_paint) gb_paint_exit(impl->layer_paint);
+    impl->layer_paint = tb_null;
+    for (i = 0; i < GB_DEVICE_LAYERS_MAXN; i++)
+    {
+        if (impl->layer_shaders[i]) gb_shader_exit(impl->layer_shaders[i]);
+        impl->layer_shaders[i] = tb_null;
+    }
+
+    // exit the density paint, shader and bitmap
+    if (impl->density_paint) gb_paint_exit(impl->density_paint);
+    impl->density_paint = tb_null;
+    if (impl->density_shader) gb_shader_exit(impl->density_shader);
+    impl->density_shader = tb_null;
+    if (impl->density_bitmap) gb_bitmap_exit(impl->density_bitmap);
+    impl->density_bitmap = tb_null;
+
+    // exit texture cache
+    if (impl->textures) gb_gl_texture_cache_exit(impl->textures);
+    impl->textures = tb_null;
  
-    // exit stroker
-    if (impl->stroker) gb_stroker_exit(impl->stroker);
-    impl->stroker = tb_null;
+    // exit the owned context, the stroker and stroke cache are referenced from it
+    if (impl->base.context && impl->base.context_owned) gb_context_exit(impl->base.context);
+    impl->base.context = tb_null;
  
     // exit programs 
-    tb_size_t i = 0;
     for (i = 0; i < GB_GL_PROGRAM_TYPE_MAXN; i++)
     {
         if (impl->programs[i]) gb_gl_program_exit(impl->programs[i]);
@@ -231,20 +430,31 @@ static tb_void_t gb_device_gl_exit(gb_device_impl_t* device)
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
-gb_device_ref_t gb_device_init_gl(gb_window_ref_t window)
+gb_device_ref_t gb_device_init_gl(gb_window_ref_t window, gb_context_ref_t context)
 {
     // check
     tb_assert_and_check_return_val(window, tb_null);
 
+    // init device
+    gb_gl_device_ref_t impl = (gb_gl_device_ref_t)gb_device_init_gl_with_size(gb_window_pixfmt(window), gb_window_width(window), gb_window_height(window), context);
+    tb_check_return_val(impl, tb_null);
+
+    // init window
+    impl->window = window;
+
+    // ok
+    return (gb_device_ref_t)impl;
+}
+gb_device_ref_t gb_device_init_gl_with_size(tb_size_t pixfmt, tb_size_t width, tb_size_t height, gb_context_ref_t context)
+{
+    // check
+    tb_assert_and_check_return_val(width && height && width <= GB_WIDTH_MAXN && height <= GB_HEIGHT_MAXN, tb_null);
+
     // done
     tb_bool_t               ok = tb_false;
     gb_gl_device_ref_t      impl = tb_null;
     do
     {
-        // the width and height
-        tb_size_t width     = gb_window_width(window);
-        tb_size_t height    = gb_window_height(window);
-        tb_assert_and_check_break(width && height && width <= GB_WIDTH_MAXN && height <= GB_HEIGHT_MAXN);
 
         // make device
         impl = tb_malloc0_type(gb_gl_device_t);
@@ -258,24 +468,38 @@ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window)
         impl->base.draw_lines       = gb_device_gl_draw_lines;
         impl->base.draw_points      = gb_device_gl_draw_points;
         impl->base.draw_polygon     = gb_device_gl_draw_polygon;
+        impl->base.draw_density     = gb_device_gl_draw_density;
+        impl->base.save_layer       = gb_device_gl_save_layer;
+        impl->base.load_layer       = gb_device_gl_load_layer;
         impl->base.shader_linear    = gb_device_gl_shader_linear;
         impl->base.shader_radial    = gb_device_gl_shader_radial;
         impl->base.shader_bitmap    = gb_device_gl_shader_bitmap;
         impl->base.exit             = gb_device_gl_exit;
 
-        // init window
-        impl->window                = window;
+        // init the pixfmt and size
+        impl->base.pixfmt           = (tb_uint16_t)pixfmt;
+        impl->base.width            = (tb_uint16_t)width;
+        impl->base.height           = (tb_uint16_t)height;
+
+        // init context, uses a private context if be null
+        impl->base.context          = context? context : gb_context_init();
+        impl->base.context_owned    = !context;
+        tb_assert_and_check_break(impl->base.context);
 
         // init stroker
-        impl->stroker = gb_stroker_init();
+        impl->stroker = gb_context_stroker(impl->base.context);
         tb_assert_and_check_break(impl->stroker);
 
+        // init stroke cache
+        impl->stroke_cache = gb_context_stroke_cache(impl->base.context);
+        tb_assert_and_check_break(impl->stroke_cache);
+
         // init tessellator
         impl->tessellator = gb_tessellator_init();
         tb_assert_and_check_break(impl->tessellator);
 
-        // init tessellator mode
-        gb_tessellator_mode_set(impl->tessellator, GB_TESSELLATOR_MODE_CONVEX);
+        // init tessellator mode, make the indexed triangles for drawing the polygon at once
+        gb_tessellator_mode_set(impl->tessellator, GB_TESSELLATOR_MODE_INDEXED);
 
         // init version 
         if (!impl->version)
@@ -301,6 +525,11 @@ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window)
         // init viewport
         gb_glViewport(0, 0, width, height);
 
+        // init the stencil bits of the framebuffer, the stencil fill mode will use the tessellator if no stencil buffer
+        gb_GLint_t stencil_bits = 0;
+        gb_glGetIntegerv(GB_GL_STENCIL_BITS, &stencil_bits);
+        impl->stencil_bits = stencil_bits > 0? (tb_size_t)stencil_bits : 0;
+
         // init gl >= 2.0
         if (impl->version >= 0x20)
         {
@@ -328,6 +557,10 @@ gb_device_ref_t gb_device_init_gl(gb_window_ref_t window)
             gb_glLoadIdentity();
         }
 
+        // init texture cache, the atlas images need wrapping them in the fragment shader for gl >= 2.0
+        impl->textures = gb_gl_texture_cache_init(0, impl->version >= 0x20);
+        tb_assert_and_check_break(impl->textures);
+
         // ok
         ok = tb_true;
 
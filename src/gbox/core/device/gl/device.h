@@ -29,7 +29,9 @@
 #include "interface.h"
 #include "program.h"
 #include "matrix.h"
+#include "texture.h"
 #include "../../impl/stroker.h"
+#include "../../impl/stroke_cache.h"
 #include "../../../utils/tessellator.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +50,9 @@ typedef struct __gb_gl_device_t
     // the version: 1.0, 2.x, ...
     tb_size_t                   version;
 
+    // the stencil bits of the framebuffer, the stencil fill mode is not supported if be zero
+    tb_size_t                   stencil_bits;
+
     // the programs
     gb_gl_program_ref_t         programs[GB_GL_PROGRAM_LOCATION_MAXN];
 
@@ -60,9 +65,42 @@ typedef struct __gb_gl_device_t
     // the shader
     gb_shader_ref_t             shader;
 
+    // the texture of the current shader
+    gb_gl_texture_ref_t         texture;
+
+    // the texcoord matrix of the current shader
+    gb_gl_matrix_t              matrix_texcoord;
+
+    // the texture cache
+    gb_gl_texture_cache_ref_t   textures;
+
+    // the colorized bitmap of the density
+    gb_bitmap_ref_t             density_bitmap;
+
+    // the bitmap shader of the density
+    gb_shader_ref_t             density_shader;
+
+    // the paint of the density
+    gb_paint_ref_t              density_paint;
+
+    // the backdrop shaders of the layers, they are reused by the next layers with the same depth
+    gb_shader_ref_t             layer_shaders[GB_DEVICE_LAYERS_MAXN];
+
+    // the texture widths of the backdrop shaders
+    tb_uint16_t                 layer_widths[GB_DEVICE_LAYERS_MAXN];
+
+    // the texture heights of the backdrop shaders
+    tb_uint16_t                 layer_heights[GB_DEVICE_LAYERS_MAXN];
+
+    // the paint for restoring the backdrop of the layer
+    gb_paint_ref_t              layer_paint;
+
     // the stroker
     gb_stroker_ref_t            stroker;
 
+    // the stroke cache
+    gb_stroke_cache_ref_t       stroke_cache;
+
     // the program
     gb_gl_program_ref_t         program;
 
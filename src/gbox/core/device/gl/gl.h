@@ -32,6 +32,7 @@
 #include "matrix.h"
 #include "render.h"
 #include "shader.h"
+#include "texture.h"
 
 #endif
 
@@ -56,6 +56,7 @@ GB_GL_INTERFACE_DEFINE(glColor4f);
 GB_GL_INTERFACE_DEFINE(glColorMask);
 GB_GL_INTERFACE_DEFINE(glColorPointer);
 GB_GL_INTERFACE_DEFINE(glCompileShader);
+GB_GL_INTERFACE_DEFINE(glCopyTexSubImage2D);
 GB_GL_INTERFACE_DEFINE(glCreateProgram);
 GB_GL_INTERFACE_DEFINE(glCreateShader);
 GB_GL_INTERFACE_DEFINE(glDeleteProgram);
@@ -65,11 +66,13 @@ GB_GL_INTERFACE_DEFINE(glDisable);
 GB_GL_INTERFACE_DEFINE(glDisableClientState);
 GB_GL_INTERFACE_DEFINE(glDisableVertexAttribArray);
 GB_GL_INTERFACE_DEFINE(glDrawArrays);
+GB_GL_INTERFACE_DEFINE(glDrawElements);
 GB_GL_INTERFACE_DEFINE(glEnable);
 GB_GL_INTERFACE_DEFINE(glEnableClientState);
 GB_GL_INTERFACE_DEFINE(glEnableVertexAttribArray);
 GB_GL_INTERFACE_DEFINE(glGenTextures);
 GB_GL_INTERFACE_DEFINE(glGetAttribLocation);
+GB_GL_INTERFACE_DEFINE(glGetIntegerv);
 GB_GL_INTERFACE_DEFINE(glGetProgramiv);
 GB_GL_INTERFACE_DEFINE(glGetProgramInfoLog);
 GB_GL_INTERFACE_DEFINE(glGetShaderiv);
@@ -96,13 +99,16 @@ GB_GL_INTERFACE_DEFINE(glShaderSource);
 GB_GL_INTERFACE_DEFINE(glStencilFunc);
 GB_GL_INTERFACE_DEFINE(glStencilMask);
 GB_GL_INTERFACE_DEFINE(glStencilOp);
+GB_GL_INTERFACE_DEFINE(glStencilOpSeparate);
 GB_GL_INTERFACE_DEFINE(glTexCoordPointer);
 GB_GL_INTERFACE_DEFINE(glTexEnvi);
 GB_GL_INTERFACE_DEFINE(glTexImage2D);
 GB_GL_INTERFACE_DEFINE(glTexParameterf);
 GB_GL_INTERFACE_DEFINE(glTexParameteri);
+GB_GL_INTERFACE_DEFINE(glTexSubImage2D);
 GB_GL_INTERFACE_DEFINE(glTranslatef);
 GB_GL_INTERFACE_DEFINE(glUniform1i);
+GB_GL_INTERFACE_DEFINE(glUniform4f);
 GB_GL_INTERFACE_DEFINE(glUniformMatrix4fv);
 GB_GL_INTERFACE_DEFINE(glUseProgram);
 GB_GL_INTERFACE_DEFINE(glVertexAttrib4f);
@@ -142,11 +148,14 @@ tb_bool_t gb_gl_interface_load()
             GB_GL_INTERFACE_LOAD_D(library, glClearColor);
             GB_GL_INTERFACE_LOAD_D(library, glClearStencil);
             GB_GL_INTERFACE_LOAD_D(library, glColorMask);
+            GB_GL_INTERFACE_LOAD_D(library, glCopyTexSubImage2D);
             GB_GL_INTERFACE_LOAD_D(library, glDeleteTextures);
             GB_GL_INTERFACE_LOAD_D(library, glDisable);
             GB_GL_INTERFACE_LOAD_D(library, glDrawArrays);
+            GB_GL_INTERFACE_LOAD_D(library, glDrawElements);
             GB_GL_INTERFACE_LOAD_D(library, glEnable);
             GB_GL_INTERFACE_LOAD_D(library, glGenTextures);
+            GB_GL_INTERFACE_LOAD_D(library, glGetIntegerv);
             GB_GL_INTERFACE_LOAD_D(library, glGetString);
             GB_GL_INTERFACE_LOAD_D(library, glIsTexture);
             GB_GL_INTERFACE_LOAD_D(library, glPixelStorei);
@@ -157,6 +166,7 @@ tb_bool_t gb_gl_interface_load()
             GB_GL_INTERFACE_LOAD_D(library, glTexImage2D);
             GB_GL_INTERFACE_LOAD_D(library, glTexParameterf);
             GB_GL_INTERFACE_LOAD_D(library, glTexParameteri);
+            GB_GL_INTERFACE_LOAD_D(library, glTexSubImage2D);
             GB_GL_INTERFACE_LOAD_D(library, glViewport);
 
             // load interfaces for gl >= 2.0
@@ -176,7 +186,9 @@ tb_bool_t gb_gl_interface_load()
             GB_GL_INTERFACE_LOAD_D(library, glGetUniformLocation);
             GB_GL_INTERFACE_LOAD_D(library, glLinkProgram);
             GB_GL_INTERFACE_LOAD_D(library, glShaderSource);
+            GB_GL_INTERFACE_LOAD_D(library, glStencilOpSeparate);
             GB_GL_INTERFACE_LOAD_D(library, glUniform1i);
+            GB_GL_INTERFACE_LOAD_D(library, glUniform4f);
             GB_GL_INTERFACE_LOAD_D(library, glUniformMatrix4fv);
             GB_GL_INTERFACE_LOAD_D(library, glUseProgram);
             GB_GL_INTERFACE_LOAD_D(library, glVertexAttrib4f);
@@ -194,11 +206,14 @@ tb_bool_t gb_gl_interface_load()
             GB_GL_INTERFACE_LOAD_D(library, glClearColor);
             GB_GL_INTERFACE_LOAD_D(library, glClearStencil);
             GB_GL_INTERFACE_LOAD_D(library, glColorMask);
+            GB_GL_INTERFACE_LOAD_D(library, glCopyTexSubImage2D);
             GB_GL_INTERFACE_LOAD_D(library, glDeleteTextures);
             GB_GL_INTERFACE_LOAD_D(library, glDisable);
             GB_GL_INTERFACE_LOAD_D(library, glDrawArrays);
+            GB_GL_INTERFACE_LOAD_D(library, glDrawElements);
             GB_GL_INTERFACE_LOAD_D(library, glEnable);
             GB_GL_INTERFACE_LOAD_D(library, glGenTextures);
+            GB_GL_INTERFACE_LOAD_D(library, glGetIntegerv);
             GB_GL_INTERFACE_LOAD_D(library, glGetString);
             GB_GL_INTERFACE_LOAD_D(library, glIsTexture);
             GB_GL_INTERFACE_LOAD_D(library, glPixelStorei);
@@ -209,6 +224,7 @@ tb_bool_t gb_gl_interface_load()
             GB_GL_INTERFACE_LOAD_D(library, glTexImage2D);
             GB_GL_INTERFACE_LOAD_D(library, glTexParameterf);
             GB_GL_INTERFACE_LOAD_D(library, glTexParameteri);
+            GB_GL_INTERFACE_LOAD_D(library, glTexSubImage2D);
             GB_GL_INTERFACE_LOAD_D(library, glViewport);
 
             // load interfaces for gl 1.x
@@ -243,11 +259,14 @@ tb_bool_t gb_gl_interface_load()
         GB_GL_INTERFACE_LOAD_S(glClearColor);
         GB_GL_INTERFACE_LOAD_S(glClearStencil);
         GB_GL_INTERFACE_LOAD_S(glColorMask);
+        GB_GL_INTERFACE_LOAD_S(glCopyTexSubImage2D);
         GB_GL_INTERFACE_LOAD_S(glDeleteTextures);
         GB_GL_INTERFACE_LOAD_S(glDisable);
         GB_GL_INTERFACE_LOAD_S(glDrawArrays);
+        GB_GL_INTERFACE_LOAD_S(glDrawElements);
         GB_GL_INTERFACE_LOAD_S(glEnable);
         GB_GL_INTERFACE_LOAD_S(glGenTextures);
+        GB_GL_INTERFACE_LOAD_S(glGetIntegerv);
         GB_GL_INTERFACE_LOAD_S(glGetString);
         GB_GL_INTERFACE_LOAD_S(glHint);
         GB_GL_INTERFACE_LOAD_S(glIsTexture);
@@ -260,6 +279,7 @@ tb_bool_t gb_gl_interface_load()
         GB_GL_INTERFACE_LOAD_S(glTexImage2D);
         GB_GL_INTERFACE_LOAD_S(glTexParameterf);
         GB_GL_INTERFACE_LOAD_S(glTexParameteri);
+        GB_GL_INTERFACE_LOAD_S(glTexSubImage2D);
         GB_GL_INTERFACE_LOAD_S(glViewport);
 
         // load interfaces for gl 1.x
@@ -304,7 +324,9 @@ tb_bool_t gb_gl_interface_load()
         GB_GL_INTERFACE_LOAD_S(glGetUniformLocation);
         GB_GL_INTERFACE_LOAD_S(glLinkProgram);
         GB_GL_INTERFACE_LOAD_S(glShaderSource);
+        GB_GL_INTERFACE_LOAD_S(glStencilOpSeparate);
         GB_GL_INTERFACE_LOAD_S(glUniform1i);
+        GB_GL_INTERFACE_LOAD_S(glUniform4f);
         GB_GL_INTERFACE_LOAD_S(glUniformMatrix4fv);
         GB_GL_INTERFACE_LOAD_S(glUseProgram);
         GB_GL_INTERFACE_LOAD_S(glVertexAttrib4f);
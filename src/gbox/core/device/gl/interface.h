@@ -174,6 +174,11 @@
 #define GB_GL_MIRRORED_REPEAT           (0x8370)
 #define GB_GL_CLAMP_TO_BORDER           (0x812D)
 
+// polygon face
+#define GB_GL_FRONT                     (0x0404)
+#define GB_GL_BACK                      (0x0405)
+#define GB_GL_FRONT_AND_BACK            (0x0408)
+
 // clear buffer mask 
 #define GB_GL_DEPTH_BUFFER_BIT          (0x00000100)
 #define GB_GL_STENCIL_BUFFER_BIT        (0x00000400)
@@ -198,6 +203,9 @@
 #define GB_GL_UNPACK_ALIGNMENT          (0x0CF5)
 #define GB_GL_PACK_ALIGNMENT            (0x0D05)
 
+// get parameter
+#define GB_GL_STENCIL_BITS              (0x0D57)
+
 // begin mode 
 #define GB_GL_POINTS                    (0x0000)
 #define GB_GL_LINES                     (0x0001)
@@ -298,6 +306,7 @@ typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glColor4f))
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glColorMask))                 (gb_GLboolean_t red, gb_GLboolean_t green, gb_GLboolean_t blue, gb_GLboolean_t alpha);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glColorPointer))              (gb_GLint_t size, gb_GLenum_t type, gb_GLsizei_t stride, gb_GLvoid_t const* pointer);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glCompileShader))             (gb_GLuint_t shader);
+typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glCopyTexSubImage2D))         (gb_GLenum_t target, gb_GLint_t level, gb_GLint_t xoffset, gb_GLint_t yoffset, gb_GLint_t x, gb_GLint_t y, gb_GLsizei_t width, gb_GLsizei_t height);
 typedef gb_GLuint_t             (GB_GL_INTERFACE_TYPE(glCreateProgram))             (gb_GLvoid_t);
 typedef gb_GLuint_t             (GB_GL_INTERFACE_TYPE(glCreateShader))              (gb_GLenum_t type);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glDeleteProgram))             (gb_GLuint_t program);
@@ -307,11 +316,13 @@ typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glDisable))
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glDisableClientState))        (gb_GLenum_t cap);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glDisableVertexAttribArray))  (gb_GLuint_t index);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glDrawArrays))                (gb_GLenum_t mode, gb_GLint_t first, gb_GLsizei_t count);
+typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glDrawElements))              (gb_GLenum_t mode, gb_GLsizei_t count, gb_GLenum_t type, gb_GLvoid_t const* indices);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glEnable))                    (gb_GLenum_t cap);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glEnableClientState))         (gb_GLenum_t cap);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glEnableVertexAttribArray))   (gb_GLuint_t index);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glGenTextures))               (gb_GLsizei_t n, gb_GLuint_t* textures);
 typedef gb_GLint_t              (GB_GL_INTERFACE_TYPE(glGetAttribLocation))         (gb_GLuint_t program, gb_GLchar_t const* name);
+typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glGetIntegerv))               (gb_GLenum_t pname, gb_GLint_t* params);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glGetProgramiv))              (gb_GLuint_t program, gb_GLenum_t pname, gb_GLint_t* params);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glGetProgramInfoLog))         (gb_GLuint_t program, gb_GLsizei_t bufsize, gb_GLsizei_t* length, gb_GLchar_t* infolog);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glGetShaderiv))               (gb_GLuint_t shader, gb_GLenum_t pname, gb_GLint_t* params);
@@ -338,13 +349,16 @@ typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glShaderSource))
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glStencilFunc))               (gb_GLenum_t func, gb_GLint_t ref, gb_GLuint_t mask);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glStencilMask))               (gb_GLuint_t mask);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glStencilOp))                 (gb_GLenum_t fail, gb_GLenum_t zfail, gb_GLenum_t zpass);
+typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glStencilOpSeparate))         (gb_GLenum_t face, gb_GLenum_t fail, gb_GLenum_t zfail, gb_GLenum_t zpass);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTexCoordPointer))           (gb_GLint_t size, gb_GLenum_t type, gb_GLsizei_t stride, gb_GLvoid_t const* ptr);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTexEnvi))                   (gb_GLenum_t target, gb_GLenum_t pname, gb_GLint_t param);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTexImage2D))                (gb_GLenum_t target, gb_GLint_t level, gb_GLint_t internalFormat, gb_GLsizei_t width, gb_GLsizei_t height, gb_GLint_t border, gb_GLenum_t format, gb_GLenum_t type, gb_GLvoid_t const* pixels);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTexParameterf))             (gb_GLenum_t target, gb_GLenum_t pname, gb_GLfloat_t param);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTexParameteri))             (gb_GLenum_t target, gb_GLenum_t pname, gb_GLint_t param);
+typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTexSubImage2D))             (gb_GLenum_t target, gb_GLint_t level, gb_GLint_t xoffset, gb_GLint_t yoffset, gb_GLsizei_t width, gb_GLsizei_t height, gb_GLenum_t format, gb_GLenum_t type, gb_GLvoid_t const* pixels);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glTranslatef))                (gb_GLfloat_t x, gb_GLfloat_t y, gb_GLfloat_t z);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glUniform1i))                 (gb_GLint_t location, gb_GLint_t x);
+typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glUniform4f))                 (gb_GLint_t location, gb_GLfloat_t x, gb_GLfloat_t y, gb_GLfloat_t z, gb_GLfloat_t w);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glUniformMatrix4fv))          (gb_GLint_t location, gb_GLsizei_t count, gb_GLboolean_t transpose, gb_GLfloat_t const* value);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glUseProgram))                (gb_GLuint_t program);
 typedef gb_GLvoid_t             (GB_GL_INTERFACE_TYPE(glVertexAttrib4f))            (gb_GLuint_t indx, gb_GLfloat_t x, gb_GLfloat_t y, gb_GLfloat_t z, gb_GLfloat_t w);
@@ -367,6 +381,7 @@ GB_GL_INTERFACE_EXTERN(glColor4f);
 GB_GL_INTERFACE_EXTERN(glColorMask);
 GB_GL_INTERFACE_EXTERN(glColorPointer);
 GB_GL_INTERFACE_EXTERN(glCompileShader);
+GB_GL_INTERFACE_EXTERN(glCopyTexSubImage2D);
 GB_GL_INTERFACE_EXTERN(glCreateProgram);
 GB_GL_INTERFACE_EXTERN(glCreateShader);
 GB_GL_INTERFACE_EXTERN(glDeleteProgram);
@@ -376,11 +391,13 @@ GB_GL_INTERFACE_EXTERN(glDisable);
 GB_GL_INTERFACE_EXTERN(glDisableClientState);
 GB_GL_INTERFACE_EXTERN(glDisableVertexAttribArray);
 GB_GL_INTERFACE_EXTERN(glDrawArrays);
+GB_GL_INTERFACE_EXTERN(glDrawElements);
 GB_GL_INTERFACE_EXTERN(glEnable);
 GB_GL_INTERFACE_EXTERN(glEnableClientState);
 GB_GL_INTERFACE_EXTERN(glEnableVertexAttribArray);
 GB_GL_INTERFACE_EXTERN(glGenTextures);
 GB_GL_INTERFACE_EXTERN(glGetAttribLocation);
+GB_GL_INTERFACE_EXTERN(glGetIntegerv);
 GB_GL_INTERFACE_EXTERN(glGetProgramiv);
 GB_GL_INTERFACE_EXTERN(glGetProgramInfoLog);
 GB_GL_INTERFACE_EXTERN(glGetShaderiv);
@@ -407,13 +424,16 @@ GB_GL_INTERFACE_EXTERN(glShaderSource);
 GB_GL_INTERFACE_EXTERN(glStencilFunc);
 GB_GL_INTERFACE_EXTERN(glStencilMask);
 GB_GL_INTERFACE_EXTERN(glStencilOp);
+GB_GL_INTERFACE_EXTERN(glStencilOpSeparate);
 GB_GL_INTERFACE_EXTERN(glTexCoordPointer);
 GB_GL_INTERFACE_EXTERN(glTexEnvi);
 GB_GL_INTERFACE_EXTERN(glTexImage2D);
 GB_GL_INTERFACE_EXTERN(glTexParameterf);
 GB_GL_INTERFACE_EXTERN(glTexParameteri);
+GB_GL_INTERFACE_EXTERN(glTexSubImage2D);
 GB_GL_INTERFACE_EXTERN(glTranslatef);
 GB_GL_INTERFACE_EXTERN(glUniform1i);
+GB_GL_INTERFACE_EXTERN(glUniform4f);
 GB_GL_INTERFACE_EXTERN(glUniformMatrix4fv);
 GB_GL_INTERFACE_EXTERN(glUseProgram);
 GB_GL_INTERFACE_EXTERN(glVertexAttrib4f);
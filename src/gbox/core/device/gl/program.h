@@ -58,7 +58,10 @@ typedef enum __gb_gl_program_location_e
 ,   GB_GL_PROGRAM_LOCATION_MATRIX_MODEL         = 4
 ,   GB_GL_PROGRAM_LOCATION_MATRIX_PROJECT       = 5
 ,   GB_GL_PROGRAM_LOCATION_MATRIX_TEXCOORD      = 6
-,   GB_GL_PROGRAM_LOCATION_MAXN                 = 7
+,   GB_GL_PROGRAM_LOCATION_TEXTURE_RECT         = 7
+,   GB_GL_PROGRAM_LOCATION_TEXTURE_CLAMP        = 8
+,   GB_GL_PROGRAM_LOCATION_TEXTURE_MODE         = 9
+,   GB_GL_PROGRAM_LOCATION_MAXN                 = 10
 
 }gb_gl_program_location_e;
 
@@ -55,7 +55,13 @@ gb_gl_program_ref_t gb_gl_program_init_bitmap()
         "   gl_Position = uMatrixProject * uMatrixModel * aVertices;                        \n"
         "}                                                                                  \n";
     
-    // the fragment shader
+    /* the fragment shader
+     *
+     * uTexMode.x: the shader mode, border, clamp, repeat or mirror
+     * uTexMode.y: is radial gradient? the texcoords are in the unit circle space
+     * uTexRect: the image rect in the texture, (x, y, w, h)
+     * uTexClamp: the clamped image rect in the texture for sampling it from the atlas, (x0, y0, x1, y1)
+     */
     static tb_char_t const* fshader = 
 #if defined(TB_CONFIG_OS_IOS) || defined(TB_CONFIG_OS_ANDROID)
         "precision mediump float;                                                           \n"
@@ -64,10 +70,23 @@ gb_gl_program_ref_t gb_gl_program_init_bitmap()
         "varying vec4 vColors;                                                              \n"
         "varying vec4 vTexcoords;                                                           \n"
         "uniform sampler2D uSampler;                                                        \n"
+        "uniform vec4 uTexRect;                                                             \n"
+        "uniform vec4 uTexClamp;                                                            \n"
+        "uniform vec4 uTexMode;                                                             \n"
         "                                                                                   \n"
         "void main()                                                                        \n"
         "{                                                                                  \n"
-        "   gl_FragColor = vColors * texture2D(uSampler, vec2(vTexcoords.x, vTexcoords.y)); \n"
+        "   vec2 t = vTexcoords.xy;                                                         \n"
+        "   if (uTexMode.y > 0.5) t = vec2(length(t), 0.5);                                 \n"
+        "   if (uTexMode.x < 1.5)                                                           \n"
+        "   {                                                                               \n"
+        "       if (t.x < 0.0 || t.x > 1.0 || t.y < 0.0 || t.y > 1.0) discard;              \n"
+        "   }                                                                               \n"
+        "   else if (uTexMode.x < 2.5) t = clamp(t, 0.0, 1.0);                              \n"
+        "   else if (uTexMode.x < 3.5) t = fract(t);                                        \n"
+        "   else t = 1.0 - abs(mod(t, 2.0) - 1.0);                                          \n"
+        "   t = clamp(uTexRect.xy + t * uTexRect.zw, uTexClamp.xy, uTexClamp.zw);           \n"
+        "   gl_FragColor = vColors * texture2D(uSampler, t);                                \n"
         "}                                                                                  \n";
 
     // init program
@@ -81,6 +100,10 @@ gb_gl_program_ref_t gb_gl_program_init_bitmap()
     gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_MATRIX_MODEL,    gb_gl_program_unif(program, "uMatrixModel"));
     gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_MATRIX_PROJECT,  gb_gl_program_unif(program, "uMatrixProject"));
     gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_MATRIX_TEXCOORD, gb_gl_program_unif(program, "uMatrixTexcoord"));
+    gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_SAMPLER,         gb_gl_program_unif(program, "uSampler"));
+    gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_TEXTURE_RECT,    gb_gl_program_unif(program, "uTexRect"));
+    gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_TEXTURE_CLAMP,   gb_gl_program_unif(program, "uTexClamp"));
+    gb_gl_program_location_set(program, GB_GL_PROGRAM_LOCATION_TEXTURE_MODE,    gb_gl_program_unif(program, "uTexMode"));
 
     // ok
     return program;
@@ -32,6 +32,8 @@
  * includes
  */
 #include "render.h"
+#include "shader.h"
+#include "../../impl/path_lod.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * macros
@@ -65,11 +67,17 @@ static tb_void_t gb_gl_render_apply_vertices(gb_gl_device_ref_t device, gb_point
 
         // apply it
         gb_glVertexAttribPointer(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_VERTICES), 2, GB_GL_VERTEX_TYPE, GB_GL_FALSE, 0, points);
+
+        // apply texcoords, the texcoord matrix maps the vertices to the texture
+        if (device->shader) gb_glVertexAttribPointer(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_TEXCOORDS), 2, GB_GL_VERTEX_TYPE, GB_GL_FALSE, 0, points);
     }
     else 
     {
         // apply it
         gb_glVertexPointer(2, GB_GL_VERTEX_TYPE, 0, points);
+
+        // apply texcoords, the texcoord matrix maps the vertices to the texture
+        if (device->shader) gb_glTexCoordPointer(2, GB_GL_VERTEX_TYPE, 0, points);
     }
 }
 static tb_void_t gb_gl_render_enter_solid(gb_gl_device_ref_t device)
@@ -132,19 +140,106 @@ static tb_void_t gb_gl_render_leave_solid(gb_gl_device_ref_t device)
 static tb_void_t gb_gl_render_enter_shader(gb_gl_device_ref_t device)
 {   
     // check
-    tb_assert(device && device->base.paint);
+    tb_assert(device && device->base.paint && device->shader && device->texture);
  
-    // disable blend
-    gb_glDisable(GB_GL_BLEND);
+    // the shader and texture
+    gb_gl_shader_ref_t  shader = (gb_gl_shader_ref_t)device->shader;
+    gb_gl_texture_ref_t texture = device->texture;
+
+    // the alpha
+    tb_byte_t alpha = gb_paint_alpha(device->base.paint);
+
+    // the mode
+    tb_size_t mode = gb_shader_mode(device->shader);
+
+    // exists alpha? the border mode will discard the outside fragments
+    if (alpha != 0xff || gb_gl_shader_alpha(shader))
+    {
+        // enable blend
+        gb_glEnable(GB_GL_BLEND);
+        gb_glBlendFunc(GB_GL_SRC_ALPHA, GB_GL_ONE_MINUS_SRC_ALPHA);
+    }
+    else
+    {
+        // disable blend
+        gb_glDisable(GB_GL_BLEND);
+    }
 
     // enable texture
     gb_glEnable(GB_GL_TEXTURE_2D);
+
+    // bind texture
+    if (device->version >= 0x20) gb_glActiveTexture(GB_GL_TEXTURE0);
+    gb_glBindTexture(GB_GL_TEXTURE_2D, texture->id);
+
+    // filter bitmap?
+    gb_GLint_t filter = (!shader->bitmap || (gb_paint_flag_with_quality(device->base.paint, gb_context_quality(device->base.context)) & GB_PAINT_FLAG_FILTER_BITMAP))? GB_GL_LINEAR : GB_GL_NEAREST;
+    gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_MIN_FILTER, filter);
+    gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_MAG_FILTER, filter);
+
+    // apply shader
+    if (device->version >= 0x20)
+    {
+        // check
+        tb_assert(device->program);
+
+        // apply sampler
+        gb_glUniform1i(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_SAMPLER), 0);
+
+        // apply the image rect in the texture
+        gb_glUniform4f(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_TEXTURE_RECT), texture->rect[0], texture->rect[1], texture->rect[2], texture->rect[3]);
+        gb_glUniform4f(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_TEXTURE_CLAMP), texture->clamp[0], texture->clamp[1], texture->clamp[2], texture->clamp[3]);
+
+        // apply mode, the wrap mode is done in the fragment shader for the atlas images
+        gb_glUniform4f(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_TEXTURE_MODE), (gb_GLfloat_t)mode, shader->radial? 1.0f : 0.0f, 0.0f, 0.0f);
+
+        // apply texcoord matrix
+        gb_glUniformMatrix4fv(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_MATRIX_TEXCOORD), 1, GB_GL_FALSE, device->matrix_texcoord);
+
+        // enable texcoords
+        gb_glEnableVertexAttribArray(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_TEXCOORDS));
+
+        // apply color
+        gb_glVertexAttrib4f(gb_gl_program_location(device->program, GB_GL_PROGRAM_LOCATION_COLORS), 1.0f, 1.0f, 1.0f, (gb_GLfloat_t)alpha / 0xff);
+    }
+    else
+    {
+        // apply wrap mode, the border mode is clamped for gl 1.x
+        gb_GLint_t wrap = GB_GL_CLAMP_TO_EDGE;
+        if (mode == GB_SHADER_MODE_REPEAT) wrap = GB_GL_REPEAT;
+        else if (mode == GB_SHADER_MODE_MIRROR) wrap = GB_GL_MIRRORED_REPEAT;
+        gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_WRAP_S, wrap);
+        gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_WRAP_T, wrap);
+
+        // modulate the texture with the paint alpha
+        gb_glTexEnvi(GB_GL_TEXTURE_ENV, GB_GL_TEXTURE_ENV_MODE, GB_GL_MODULATE);
+        gb_glColor4f(1.0f, 1.0f, 1.0f, (gb_GLfloat_t)alpha / 0xff);
+
+        // apply texcoord matrix
+        gb_glMatrixMode(GB_GL_TEXTURE);
+        gb_glLoadMatrixf(device->matrix_texcoord);
+        gb_glMatrixMode(GB_GL_MODELVIEW);
+
+        // enable texcoords
+        gb_glEnableClientState(GB_GL_TEXTURE_COORD_ARRAY);
+    }
 }
 static tb_void_t gb_gl_render_leave_shader(gb_gl_device_ref_t device)
 {   
     // check
     tb_assert(device);
  
+    // restore texcoord matrix
+    if (device->version < 0x20)
+    {
+        gb_glMatrixMode(GB_GL_TEXTURE);
+        gb_glLoadIdentity();
+        gb_glMatrixMode(GB_GL_MODELVIEW);
+    }
+
+    // disable blend
+    gb_glDisable(GB_GL_BLEND);
+
     // disable texture
     gb_glDisable(GB_GL_TEXTURE_2D);
 }
@@ -208,10 +303,100 @@ static tb_void_t gb_gl_render_fill_convex(gb_point_ref_t points, tb_uint16_t cou
     gb_glEnable(GB_GL_BLEND);
 #endif
 }
+static tb_void_t gb_gl_render_fill_indexed(gb_point_ref_t points, tb_size_t points_count, tb_uint16_t const* indices, tb_size_t indices_count, tb_cpointer_t priv)
+{
+    // check
+    tb_assert(priv && points && points_count && indices && indices_count);
+
+    // apply the shared vertices
+    gb_gl_render_apply_vertices((gb_gl_device_ref_t)priv, points);
+
+    // draw all triangles at once
+    gb_glDrawElements(GB_GL_TRIANGLES, (gb_GLsizei_t)indices_count, GB_GL_UNSIGNED_SHORT, indices);
+}
+static tb_bool_t gb_gl_render_fill_stencil(gb_gl_device_ref_t device, gb_polygon_ref_t polygon, gb_rect_ref_t bounds, tb_size_t rule)
+{
+    // check
+    tb_assert(device && polygon && polygon->points && polygon->counts && bounds);
+
+    // no stencil buffer? fill it with the tessellator
+    tb_check_return_val(device->stencil_bits, tb_false);
+
+    // the non-zero rule need the separate stencil operations of the front and back faces for gl >= 2.0
+    tb_bool_t nonzero = (rule == GB_PAINT_FILL_RULE_NONZERO)? tb_true : tb_false;
+    tb_check_return_val(!nonzero || (device->version >= 0x20 && gb_glStencilOpSeparate), tb_false);
+
+    // the stencil mask, only the lowest bit for the odd rule
+    gb_GLuint_t mask = nonzero? (gb_GLuint_t)((1 << tb_min(device->stencil_bits, 8)) - 1) : 0x01;
+
+    /* write the winding of the polygon into the stencil buffer without the color
+     *
+     * the triangle fan of each contour covers each pixel by the winding number of this contour,
+     * the front faces increase the winding and the back faces decrease it for the non-zero rule, 
+     * and we only invert the lowest bit for the odd rule.
+     */
+    gb_glEnable(GB_GL_STENCIL_TEST);
+    gb_glColorMask(GB_GL_FALSE, GB_GL_FALSE, GB_GL_FALSE, GB_GL_FALSE);
+    gb_glStencilMask(mask);
+    gb_glStencilFunc(GB_GL_ALWAYS, 0, mask);
+    if (nonzero)
+    {
+        gb_glStencilOpSeparate(GB_GL_FRONT, GB_GL_KEEP, GB_GL_KEEP, GB_GL_INCR_WRAP);
+        gb_glStencilOpSeparate(GB_GL_BACK, GB_GL_KEEP, GB_GL_KEEP, GB_GL_DECR_WRAP);
+    }
+    else gb_glStencilOp(GB_GL_KEEP, GB_GL_KEEP, GB_GL_INVERT);
+
+    // apply vertices
+    gb_gl_render_apply_vertices(device, polygon->points);
+
+    // draw the triangle fans of all contours
+    tb_uint16_t         count;
+    tb_size_t           index = 0;
+    tb_uint16_t const*  counts = polygon->counts;
+    while ((count = *counts++))
+    {
+        if (count > 2) gb_glDrawArrays(GB_GL_TRIANGLE_FAN, (gb_GLint_t)index, (gb_GLint_t)count);
+        index += count;
+    }
+
+    /* cover the bounds and only fill the pixels with the non-zero stencil value
+     *
+     * the fans are inside the bounds, so the stencil buffer will be cleared for the next polygon at the same time
+     */
+    gb_point_t cover[4];
+    gb_point_make(&cover[0], bounds->x, bounds->y);
+    gb_point_make(&cover[1], bounds->x + bounds->w, bounds->y);
+    gb_point_make(&cover[2], bounds->x + bounds->w, bounds->y + bounds->h);
+    gb_point_make(&cover[3], bounds->x, bounds->y + bounds->h);
+    gb_glColorMask(GB_GL_TRUE, GB_GL_TRUE, GB_GL_TRUE, GB_GL_TRUE);
+    gb_glStencilFunc(GB_GL_NOTEQUAL, 0, mask);
+    gb_glStencilOp(GB_GL_ZERO, GB_GL_ZERO, GB_GL_ZERO);
+    gb_gl_render_apply_vertices(device, cover);
+    gb_glDrawArrays(GB_GL_TRIANGLE_FAN, 0, 4);
+
+    // restore the stencil state
+    gb_glStencilMask(0xff);
+    gb_glDisable(GB_GL_STENCIL_TEST);
+
+    // ok
+    return tb_true;
+}
 static tb_void_t gb_gl_render_fill_polygon(gb_gl_device_ref_t device, gb_polygon_ref_t polygon, gb_rect_ref_t bounds, tb_size_t rule)
 {
     // check
-    tb_assert(device && device->tessellator);
+    tb_assert(device && device->tessellator && polygon && polygon->counts);
+
+#ifndef GB_GL_TESSELLATOR_TEST_ENABLE
+    // only one convex contour? fill the triangle fan directly
+    if (polygon->convex && !polygon->counts[1])
+    {
+        gb_gl_render_fill_convex(polygon->points, polygon->counts[0], device);
+        return ;
+    }
+
+    // fill it with stencil-then-cover? the gl 1.x will fill the non-zero polygon with the tessellator
+    if (device->base.fill_mode == GB_DEVICE_FILL_MODE_STENCIL && gb_gl_render_fill_stencil(device, polygon, bounds, rule)) return ;
+#endif
 
 #ifdef GB_GL_TESSELLATOR_TEST_ENABLE
     // set mode
@@ -222,11 +407,19 @@ static tb_void_t gb_gl_render_fill_polygon(gb_gl_device_ref_t device, gb_polygon
     // set rule
     gb_tessellator_rule_set(device->tessellator, rule);
 
+#ifdef GB_GL_TESSELLATOR_TEST_ENABLE
     // set func
     gb_tessellator_func_set(device->tessellator, gb_gl_render_fill_convex, device);
+#else
+    // set the indexed func, all triangles of the polygon will be drawn at once
+    gb_tessellator_indexed_func_set(device->tessellator, gb_gl_render_fill_indexed, device);
+#endif
 
-    // done tessellator
+    // done tessellator, the time includes submitting the convex polygons
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
     gb_tessellator_done(device->tessellator, polygon, bounds);
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_TESSELLATE, time);
 }
 static tb_void_t gb_gl_render_stroke_lines(gb_gl_device_ref_t device, gb_point_ref_t points, tb_size_t count)
 {
@@ -296,6 +489,41 @@ static tb_void_t gb_gl_render_stroke_fill(gb_gl_device_ref_t device, gb_path_ref
     // restore the fill mode
     gb_paint_fill_rule_set(device->base.paint, rule);
 }
+static gb_path_ref_t gb_gl_render_stroke_path(gb_gl_device_ref_t device, gb_path_ref_t path)
+{
+    // check
+    tb_assert(device && device->stroker && device->stroke_cache && device->base.paint && path);
+
+    // get the cached stroked path
+    gb_path_ref_t stroked = gb_stroke_cache_get(device->stroke_cache, device->base.paint, path);
+    tb_check_return_val(!stroked, stroked);
+
+    // stroke it
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    stroked = gb_stroker_done_path(device->stroker, device->base.paint, path);
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+    // cache the stroked path
+    return gb_stroke_cache_add(device->stroke_cache, device->base.paint, path, stroked);
+}
+static gb_polygon_ref_t gb_gl_render_path_polygon(gb_gl_device_ref_t device, gb_path_ref_t path)
+{
+    // check
+    tb_assert(device && path);
+
+    /* make the polygon of the path, it will be flattened only once if the path is not changed
+     *
+     * the points of the large polygon in the same device pixel are removed by the scale of the matrix
+     */
+    gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+    tb_hong_t           time = gb_profiler_enter(profiler);
+    gb_polygon_ref_t    polygon = gb_path_polygon_lod(path, gb_path_lod_tolerance(device->base.matrix));
+    gb_profiler_leave(profiler, GB_PROFILER_STAGE_FLATTEN, time);
+
+    // ok
+    return polygon;
+}
 static __tb_inline__ tb_bool_t gb_gl_render_stroke_only(gb_gl_device_ref_t device)
 {
     // check
@@ -308,6 +536,16 @@ static __tb_inline__ tb_bool_t gb_gl_render_stroke_only(gb_gl_device_ref_t devic
             &&  !device->shader)? tb_true : tb_false;
 }
 
+static tb_void_t gb_gl_render_texture_exit(gb_gl_device_ref_t device)
+{
+    // put back the bitmap texture to the texture cache, the gradient texture is owned by the shader
+    if (device->texture && device->shader && ((gb_gl_shader_ref_t)device->shader)->bitmap && device->textures)
+        gb_gl_texture_cache_put(device->textures, device->texture);
+
+    // clear texture
+    device->texture = tb_null;
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -321,7 +559,18 @@ tb_bool_t gb_gl_render_init(gb_gl_device_ref_t device)
     do
     {
         // init shader
-        device->shader = gb_paint_shader(device->base.paint);
+        device->shader  = gb_paint_shader(device->base.paint);
+        device->texture = tb_null;
+        if (device->shader)
+        {
+            // init texture and texcoord matrix, uses the solid color if the shader is not drawable
+            device->texture = gb_gl_shader_texture(device, (gb_gl_shader_ref_t)device->shader);
+            if (!device->texture || !gb_gl_shader_texcoord((gb_gl_shader_ref_t)device->shader, device->matrix_texcoord))
+            {
+                gb_gl_render_texture_exit(device);
+                device->shader  = tb_null;
+            }
+        }
 
         // init vertex matrix
         gb_gl_matrix_convert(device->matrix_vertex, device->base.matrix);
@@ -332,10 +581,17 @@ tb_bool_t gb_gl_render_init(gb_gl_device_ref_t device)
         device->matrix_vertex[1] /= 65536.0f;
         device->matrix_vertex[4] /= 65536.0f;
         device->matrix_vertex[5] /= 65536.0f;
+        if (device->shader)
+        {
+            device->matrix_texcoord[0] /= 65536.0f;
+            device->matrix_texcoord[1] /= 65536.0f;
+            device->matrix_texcoord[4] /= 65536.0f;
+            device->matrix_texcoord[5] /= 65536.0f;
+        }
 #endif
 
         // init antialiasing
-        if (gb_paint_flag(device->base.paint) & GB_PAINT_FLAG_ANTIALIASING) 
+        if (gb_context_quality(device->base.context) > GB_QUALITY_LOW) 
         {
             gb_glEnable(GB_GL_MULTISAMPLE);
 #if 0
@@ -384,6 +640,9 @@ tb_bool_t gb_gl_render_init(gb_gl_device_ref_t device)
 
     } while (0);
 
+    // failed? put back the texture
+    if (!ok) gb_gl_render_texture_exit(device);
+
     // ok?
     return ok;
 }
@@ -392,6 +651,9 @@ tb_void_t gb_gl_render_exit(gb_gl_device_ref_t device)
     // check
     tb_assert_and_check_return(device);
 
+    // exit texture
+    gb_gl_render_texture_exit(device);
+
     // exit vertex and matrix
     if (device->version >= 0x20)
     {   
@@ -431,16 +693,16 @@ tb_void_t gb_gl_render_draw_path(gb_gl_device_ref_t device, gb_path_ref_t path)
     // fill it
     if (mode & GB_PAINT_MODE_FILL)
     {
-        gb_gl_render_draw_polygon(device, gb_path_polygon(path), gb_path_hint(path), gb_path_bounds(path));
+        gb_gl_render_draw_polygon(device, gb_gl_render_path_polygon(device, path), gb_path_hint(path), gb_path_bounds(path));
     }
 
     // stroke it
     if ((mode & GB_PAINT_MODE_STROKE) && (gb_paint_stroke_width(device->base.paint) > 0))
     {
         // only stroke?
-        if (gb_gl_render_stroke_only(device)) gb_gl_render_draw_polygon(device, gb_path_polygon(path), gb_path_hint(path), gb_path_bounds(path));
+        if (gb_gl_render_stroke_only(device)) gb_gl_render_draw_polygon(device, gb_gl_render_path_polygon(device, path), gb_path_hint(path), gb_path_bounds(path));
         // fill the stroked path
-        else gb_gl_render_stroke_fill(device, gb_stroker_done_path(device->stroker, device->base.paint, path));
+        else gb_gl_render_stroke_fill(device, gb_gl_render_stroke_path(device, path));
     }
 }
 tb_void_t gb_gl_render_draw_lines(gb_gl_device_ref_t device, gb_point_ref_t points, tb_size_t count, gb_rect_ref_t bounds)
@@ -460,7 +722,17 @@ tb_void_t gb_gl_render_draw_lines(gb_gl_device_ref_t device, gb_point_ref_t poin
     // only stroke?
     if (gb_gl_render_stroke_only(device)) gb_gl_render_stroke_lines(device, points, count);
     // fill the stroked lines
-    else gb_gl_render_stroke_fill(device, gb_stroker_done_lines(device->stroker, device->base.paint, points, count));
+    else
+    {
+        // stroke lines
+        gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+        tb_hong_t           time = gb_profiler_enter(profiler);
+        gb_path_ref_t       stroked = gb_stroker_done_lines(device->stroker, device->base.paint, points, count);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+        // fill it
+        gb_gl_render_stroke_fill(device, stroked);
+    }
 
     // leave paint
     gb_gl_render_leave_paint(device);
@@ -482,7 +754,17 @@ tb_void_t gb_gl_render_draw_points(gb_gl_device_ref_t device, gb_point_ref_t poi
     // only stroke?
     if (gb_gl_render_stroke_only(device)) gb_gl_render_stroke_points(device, points, count);
     // fill the stroked points
-    else gb_gl_render_stroke_fill(device, gb_stroker_done_points(device->stroker, device->base.paint, points, count));
+    else
+    {
+        // stroke points
+        gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+        tb_hong_t           time = gb_profiler_enter(profiler);
+        gb_path_ref_t       stroked = gb_stroker_done_points(device->stroker, device->base.paint, points, count);
+        gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+        // fill it
+        gb_gl_render_stroke_fill(device, stroked);
+    }
 
     // leave paint
     gb_gl_render_leave_paint(device);
@@ -527,7 +809,17 @@ tb_void_t gb_gl_render_draw_polygon(gb_gl_device_ref_t device, gb_polygon_ref_t
         // only stroke?
         if (gb_gl_render_stroke_only(device)) gb_gl_render_stroke_polygon(device, polygon->points, polygon->counts);
         // fill the stroked polygon
-        else gb_gl_render_stroke_fill(device, gb_stroker_done_polygon(device->stroker, device->base.paint, polygon, hint));
+        else
+        {
+            // stroke polygon
+            gb_profiler_ref_t   profiler = gb_profiler_hook(device->base.context);
+            tb_hong_t           time = gb_profiler_enter(profiler);
+            gb_path_ref_t       stroked = gb_stroker_done_polygon(device->stroker, device->base.paint, polygon, hint);
+            gb_profiler_leave(profiler, GB_PROFILER_STAGE_STROKE, time);
+
+            // fill it
+            gb_gl_render_stroke_fill(device, stroked);
+        }
     }
 
     // leave paint
@@ -33,18 +33,299 @@
  */
 #include "shader.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the gradient texture width
+#define GB_GL_SHADER_GRADIENT_SIZE      (256)
+
+// the radial gradient texture size for gl 1.x
+#ifdef __gb_small__
+#   define GB_GL_SHADER_RADIAL_SIZE     (64)
+#else
+#   define GB_GL_SHADER_RADIAL_SIZE     (128)
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_gl_shader_exit(gb_shader_impl_t* shader)
+{
+    // check
+    gb_gl_shader_ref_t impl = (gb_gl_shader_ref_t)shader;
+    tb_assert_and_check_return(impl);
+
+    // exit the gradient texture
+    gb_gl_texture_exit(&impl->texture);
+
+    // exit it
+    tb_free(impl);
+}
+static gb_gl_shader_ref_t gb_gl_shader_init(tb_size_t type, tb_size_t mode)
+{
+    // make shader
+    gb_gl_shader_ref_t shader = tb_malloc0_type(gb_gl_shader_t);
+    tb_assert_and_check_return_val(shader, tb_null);
+
+    // init shader
+    shader->base.type   = (tb_uint8_t)type;
+    shader->base.mode   = (tb_uint8_t)mode;
+    shader->base.refn   = 1;
+    shader->base.exit   = gb_gl_shader_exit;
+    gb_matrix_clear(&shader->base.matrix);
+    gb_gl_matrix_clear(shader->matrix);
+
+    // ok
+    return shader;
+}
+static __tb_inline__ gb_GLfloat_t gb_gl_shader_gradient_radio(gb_gradient_ref_t gradient, tb_size_t index)
+{
+    // the radio of the given color, the colors are spaced evenly if no radios
+    return gradient->radios? gb_float_to_tb(gradient->radios[index]) : (gb_GLfloat_t)index / (gradient->count - 1);
+}
+static tb_void_t gb_gl_shader_gradient_color(gb_gradient_ref_t gradient, gb_GLfloat_t radio, tb_byte_t* pixel)
+{
+    // find the color stops of this radio
+    tb_size_t   count = gradient->count;
+    tb_size_t   index = 1;
+    while (index < count - 1 && gb_gl_shader_gradient_radio(gradient, index) < radio) index++;
+
+    // the interpolation factor between two color stops
+    gb_GLfloat_t r0 = gb_gl_shader_gradient_radio(gradient, index - 1);
+    gb_GLfloat_t r1 = gb_gl_shader_gradient_radio(gradient, index);
+    gb_GLfloat_t f  = (r1 > r0)? (radio - r0) / (r1 - r0) : 1.0f;
+    if (f < 0.0f) f = 0.0f;
+    if (f > 1.0f) f = 1.0f;
+
+    // interpolate color
+    gb_color_t c0 = gradient->colors[index - 1];
+    gb_color_t c1 = gradient->colors[index];
+    pixel[0] = (tb_byte_t)(c0.r + (c1.r - c0.r) * f + 0.5f);
+    pixel[1] = (tb_byte_t)(c0.g + (c1.g - c0.g) * f + 0.5f);
+    pixel[2] = (tb_byte_t)(c0.b + (c1.b - c0.b) * f + 0.5f);
+    pixel[3] = (tb_byte_t)(c0.a + (c1.a - c0.a) * f + 0.5f);
+}
+static tb_bool_t gb_gl_shader_gradient_init(gb_gl_shader_ref_t shader, gb_gradient_ref_t gradient, tb_bool_t radial)
+{
+    // check
+    tb_assert_and_check_return_val(shader && gradient && gradient->colors && gradient->count > 1, tb_false);
+
+    // has alpha?
+    tb_size_t i = 0;
+    for (i = 0; i < gradient->count; i++) if (gradient->colors[i].a != 0xff) shader->alpha = tb_true;
+
+    /* make the gradient colors
+     *
+     * the radial gradient of gl 1.x need the distance of each texel without the fragment shader, 
+     * so we make the 2d texture of the whole circle which covers [-1, 1] x [-1, 1]
+     */
+    tb_size_t   width = radial? GB_GL_SHADER_RADIAL_SIZE : GB_GL_SHADER_GRADIENT_SIZE;
+    tb_size_t   height = radial? GB_GL_SHADER_RADIAL_SIZE : 1;
+    tb_byte_t*  data = tb_malloc_bytes((width * height) << 2);
+    tb_assert_and_check_return_val(data, tb_false);
+
+    // done
+    tb_size_t   x;
+    tb_size_t   y;
+    tb_byte_t*  pixel = data;
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++, pixel += 4)
+        {
+            if (radial)
+            {
+                gb_GLfloat_t dx = ((x + 0.5f) * 2.0f) / width - 1.0f;
+                gb_GLfloat_t dy = ((y + 0.5f) * 2.0f) / height - 1.0f;
+                gb_gl_shader_gradient_color(gradient, tb_sqrtf(dx * dx + dy * dy), pixel);
+            }
+            else gb_gl_shader_gradient_color(gradient, (gb_GLfloat_t)x / (width - 1), pixel);
+        }
+    }
+
+    // init texture
+    tb_bool_t ok = gb_gl_texture_init(&shader->texture, data, width, height);
+
+    // exit data
+    tb_free(data);
+
+    // ok?
+    return ok;
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
 gb_shader_ref_t gb_gl_shader_init_linear(gb_gl_device_ref_t device, tb_size_t mode, gb_gradient_ref_t gradient, gb_line_ref_t line)
 {
-    return tb_null;
+    // check
+    tb_assert_and_check_return_val(device && gradient && line, tb_null);
+
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_gl_shader_ref_t  shader = tb_null;
+    do
+    {
+        // the line vector
+        gb_GLfloat_t x0 = gb_float_to_tb(line->p0.x);
+        gb_GLfloat_t y0 = gb_float_to_tb(line->p0.y);
+        gb_GLfloat_t dx = gb_float_to_tb(line->p1.x) - x0;
+        gb_GLfloat_t dy = gb_float_to_tb(line->p1.y) - y0;
+        gb_GLfloat_t dd = dx * dx + dy * dy;
+        tb_assert_and_check_break(dd > 0.0f);
+
+        // init shader
+        shader = gb_gl_shader_init(GB_SHADER_TYPE_LINEAR, mode);
+        tb_assert_and_check_break(shader);
+
+        // init gradient texture
+        if (!gb_gl_shader_gradient_init(shader, gradient, tb_false)) break;
+
+        // project the point to the line: u = ((x - x0) * dx + (y - y0) * dy) / (dx * dx + dy * dy), v = 0.5
+        gb_gl_matrix_init(shader->matrix, dx / dd, dy / dd, 0.0f, 0.0f, -(x0 * dx + y0 * dy) / dd, 0.5f);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (shader) gb_gl_shader_exit((gb_shader_impl_t*)shader);
+        shader = tb_null;
+    }
+
+    // ok?
+    return (gb_shader_ref_t)shader;
 }
 gb_shader_ref_t gb_gl_shader_init_radial(gb_gl_device_ref_t device, tb_size_t mode, gb_gradient_ref_t gradient, gb_circle_ref_t circle)
 {
-    return tb_null;
+    // check
+    tb_assert_and_check_return_val(device && gradient && circle, tb_null);
+
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_gl_shader_ref_t  shader = tb_null;
+    do
+    {
+        // the circle
+        gb_GLfloat_t x0 = gb_float_to_tb(circle->c.x);
+        gb_GLfloat_t y0 = gb_float_to_tb(circle->c.y);
+        gb_GLfloat_t r  = gb_float_to_tb(circle->r);
+        tb_assert_and_check_break(r > 0.0f);
+
+        // init shader
+        shader = gb_gl_shader_init(GB_SHADER_TYPE_RADIAL, mode);
+        tb_assert_and_check_break(shader);
+
+        // the fragment shader computes the distance for gl >= 2.0
+        shader->radial = (device->version >= 0x20)? tb_true : tb_false;
+
+        // init gradient texture
+        if (!gb_gl_shader_gradient_init(shader, gradient, !shader->radial)) break;
+
+        // map the circle to the unit circle for the fragment shader
+        if (shader->radial) gb_gl_matrix_init(shader->matrix, 1.0f / r, 0.0f, 0.0f, 1.0f / r, -x0 / r, -y0 / r);
+        // map the square of the circle to the 2d texture
+        else gb_gl_matrix_init(shader->matrix, 0.5f / r, 0.0f, 0.0f, 0.5f / r, 0.5f - 0.5f * x0 / r, 0.5f - 0.5f * y0 / r);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (shader) gb_gl_shader_exit((gb_shader_impl_t*)shader);
+        shader = tb_null;
+    }
+
+    // ok?
+    return (gb_shader_ref_t)shader;
 }
 gb_shader_ref_t gb_gl_shader_init_bitmap(gb_gl_device_ref_t device, tb_size_t mode, gb_bitmap_ref_t bitmap)
 {
-    return tb_null;
+    // check
+    tb_assert_and_check_return_val(device && bitmap, tb_null);
+
+    // the bitmap size
+    tb_size_t width     = gb_bitmap_width(bitmap);
+    tb_size_t height    = gb_bitmap_height(bitmap);
+    tb_assert_and_check_return_val(width && height, tb_null);
+
+    // init shader
+    gb_gl_shader_ref_t shader = gb_gl_shader_init(GB_SHADER_TYPE_BITMAP, mode);
+    tb_assert_and_check_return_val(shader, tb_null);
+
+    // init bitmap, the texture will be uploaded when drawing it
+    shader->bitmap = bitmap;
+
+    // map the bitmap to the texture
+    gb_gl_matrix_init_scale(shader->matrix, 1.0f / width, 1.0f / height);
+
+    // ok
+    return (gb_shader_ref_t)shader;
+}
+gb_shader_ref_t gb_gl_shader_init_texture(gb_gl_device_ref_t device, tb_size_t width, tb_size_t height)
+{
+    // check
+    tb_assert_and_check_return_val(device && width && height, tb_null);
+
+    // init shader
+    gb_gl_shader_ref_t shader = gb_gl_shader_init(GB_SHADER_TYPE_BITMAP, GB_SHADER_MODE_CLAMP);
+    tb_assert_and_check_return_val(shader, tb_null);
+
+    // init the empty texture
+    if (!gb_gl_texture_init(&shader->texture, tb_null, width, height))
+    {
+        gb_gl_shader_exit((gb_shader_impl_t*)shader);
+        return tb_null;
+    }
+
+    // map the texture size to the texture by default
+    gb_gl_matrix_init_scale(shader->matrix, 1.0f / width, 1.0f / height);
+
+    // ok
+    return (gb_shader_ref_t)shader;
+}
+gb_gl_texture_ref_t gb_gl_shader_texture(gb_gl_device_ref_t device, gb_gl_shader_ref_t shader)
+{
+    // check
+    tb_assert_and_check_return_val(device && shader, tb_null);
+
+    // the bitmap texture
+    if (shader->bitmap) return device->textures? gb_gl_texture_cache_get(device->textures, shader->bitmap) : tb_null;
+
+    // the gradient texture
+    return shader->texture.id? &shader->texture : tb_null;
+}
+tb_bool_t gb_gl_shader_texcoord(gb_gl_shader_ref_t shader, gb_gl_matrix_ref_t matrix)
+{
+    // check
+    tb_assert_and_check_return_val(shader && matrix, tb_false);
+
+    // the inverse shader matrix, it maps the vertex to the shader coordinate
+    gb_matrix_t inverse = shader->base.matrix;
+    tb_check_return_val(gb_matrix_invert(&inverse), tb_false);
+
+    // texcoord = matrix * inverse(shader matrix) * vertex
+    gb_gl_matrix_t factor;
+    gb_gl_matrix_convert(factor, &inverse);
+    gb_gl_matrix_copy(matrix, shader->matrix);
+    gb_gl_matrix_multiply(matrix, factor);
+
+    // ok
+    return tb_true;
+}
+tb_bool_t gb_gl_shader_alpha(gb_gl_shader_ref_t shader)
+{
+    // check
+    tb_assert_and_check_return_val(shader, tb_false);
+
+    // has alpha?
+    return shader->bitmap? gb_bitmap_has_alpha(shader->bitmap) : shader->alpha;
 }
@@ -38,6 +38,29 @@ __tb_extern_c_enter__
  * types
  */
 
+// the gl shader type
+typedef struct __gb_gl_shader_t
+{
+    // the base
+    gb_shader_impl_t        base;
+
+    // the bitmap of the bitmap shader, its texture will be got from the texture cache of the device
+    gb_bitmap_ref_t         bitmap;
+
+    // the gradient texture
+    gb_gl_texture_t         texture;
+
+    // the matrix from the shader coordinate to the texcoord
+    gb_gl_matrix_t          matrix;
+
+    // the gradient colors have alpha?
+    tb_bool_t               alpha;
+
+    // is the radial gradient for the fragment shader? the texcoords are in the unit circle space
+    tb_bool_t               radial;
+
+}gb_gl_shader_t, *gb_gl_shader_ref_t;
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * interface
  */
@@ -74,6 +97,49 @@ gb_shader_ref_t     gb_gl_shader_init_radial(gb_gl_device_ref_t device, tb_size_
  */
 gb_shader_ref_t     gb_gl_shader_init_bitmap(gb_gl_device_ref_t device, tb_size_t mode, gb_bitmap_ref_t bitmap);
 
+/*! init gl texture shader with the empty texture 
+ *
+ * the pixels of the texture will be copied from the framebuffer, e.g. the backdrop of the layer,
+ * and the shader matrix need be set by the caller for mapping the vertices to the texture.
+ *
+ * @param device    the device
+ * @param width     the texture width
+ * @param height    the texture height
+ *
+ * @return          the shader
+ */
+gb_shader_ref_t     gb_gl_shader_init_texture(gb_gl_device_ref_t device, tb_size_t width, tb_size_t height);
+
+/*! the texture of the gl shader
+ *
+ * the bitmap texture will be uploaded to the texture cache if the bitmap is new or has been modified
+ *
+ * @param device    the device
+ * @param shader    the shader
+ *
+ * @return          the texture
+ */
+gb_gl_texture_ref_t gb_gl_shader_texture(gb_gl_device_ref_t device, gb_gl_shader_ref_t shader);
+
+/*! make the texcoord matrix of the gl shader
+ *
+ * texcoord = matrix * inverse(shader matrix) * vertex
+ *
+ * @param shader    the shader
+ * @param matrix    the texcoord matrix
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_gl_shader_texcoord(gb_gl_shader_ref_t shader, gb_gl_matrix_ref_t matrix);
+
+/*! the gl shader has alpha?
+ *
+ * @param shader    the shader
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_gl_shader_alpha(gb_gl_shader_ref_t shader);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
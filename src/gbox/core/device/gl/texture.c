@@ -0,0 +1,565 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        texture.c
+ * @ingroup     core
+ *
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "gl_texture"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "texture.h"
+#include "../../pixmap.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the entries grow
+#ifdef __gb_small__
+#   define GB_GL_TEXTURE_CACHE_ENTRIES_GROW     (32)
+#else
+#   define GB_GL_TEXTURE_CACHE_ENTRIES_GROW     (128)
+#endif
+
+// the shelf height align of the atlas
+#define GB_GL_TEXTURE_ATLAS_SHELF_ALIGN         (4)
+
+// the maximum shelves count of the atlas
+#define GB_GL_TEXTURE_ATLAS_SHELF_MAXN          (GB_GL_TEXTURE_ATLAS_SIZE / GB_GL_TEXTURE_ATLAS_SHELF_ALIGN)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the texture cache entry type
+typedef struct __gb_gl_texture_cache_entry_t
+{
+    // the list entry, the least recently used entry is the head
+    tb_list_entry_t             entry;
+
+    // the bitmap
+    gb_bitmap_ref_t             bitmap;
+
+    // the bitmap version
+    tb_size_t                   version;
+
+    // the used memory size, it is zero for the atlas image
+    tb_size_t                   size;
+
+    // the reference count, the referenced texture will not be removed
+    tb_size_t                   refn;
+
+    // the texture
+    gb_gl_texture_t             texture;
+
+}gb_gl_texture_cache_entry_t, *gb_gl_texture_cache_entry_ref_t;
+
+// the atlas shelf type, the images with the similar height are packed into the same row
+typedef struct __gb_gl_texture_shelf_t
+{
+    // the y-coordinate
+    tb_uint16_t                 y;
+
+    // the height
+    tb_uint16_t                 height;
+
+    // the used width
+    tb_uint16_t                 width;
+
+}gb_gl_texture_shelf_t;
+
+// the texture cache impl type
+typedef struct __gb_gl_texture_cache_impl_t
+{
+    // the entries pool
+    tb_fixed_pool_ref_t         pool;
+
+    // the entries list of the single textures
+    tb_list_entry_head_t        list;
+
+    // the entries list of the atlas images
+    tb_list_entry_head_t        atlas_list;
+
+    // the entries hash, bitmap => entry
+    tb_hash_map_ref_t           hash;
+
+    // the used memory size of the single textures
+    tb_size_t                   size;
+
+    // the memory budget
+    tb_size_t                   maxn;
+
+    // the uploaded count
+    tb_size_t                   uploads;
+
+    // the rgba pixels for uploading
+    tb_byte_t*                  data;
+
+    // the rgba pixels size
+    tb_size_t                   data_size;
+
+    // enable the atlas?
+    tb_bool_t                   atlas_enabled;
+
+    // the atlas texture, it will be made when the first small image is added
+    gb_gl_texture_t             atlas;
+
+    // the atlas shelves
+    gb_gl_texture_shelf_t       shelves[GB_GL_TEXTURE_ATLAS_SHELF_MAXN];
+
+    // the atlas shelves count
+    tb_size_t                   shelves_count;
+
+    // the used height of the atlas
+    tb_size_t                   shelves_height;
+
+}gb_gl_texture_cache_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_gl_texture_cache_entry_exit(tb_pointer_t data, tb_cpointer_t priv)
+{
+    // check
+    gb_gl_texture_cache_entry_ref_t entry = (gb_gl_texture_cache_entry_ref_t)data;
+    tb_assert_and_check_return(entry);
+
+    // exit the single texture, the atlas is shared
+    if (!entry->texture.atlas) gb_gl_texture_exit(&entry->texture);
+}
+static tb_void_t gb_gl_texture_cache_entry_remove(gb_gl_texture_cache_impl_t* impl, gb_gl_texture_cache_entry_ref_t entry)
+{
+    // update the used size
+    tb_assert(impl->size >= entry->size);
+    impl->size -= entry->size;
+
+    // remove it from the hash
+    tb_hash_map_remove(impl->hash, entry->bitmap);
+
+    // remove it from the list
+    tb_list_entry_remove(entry->texture.atlas? &impl->atlas_list : &impl->list, &entry->entry);
+
+    // exit it
+    tb_fixed_pool_free(impl->pool, entry);
+}
+static tb_byte_t const* gb_gl_texture_cache_pixels(gb_gl_texture_cache_impl_t* impl, gb_bitmap_ref_t bitmap)
+{
+    // the pixmap
+    gb_pixmap_ref_t pixmap = gb_pixmap(gb_bitmap_pixfmt(bitmap), 0xff);
+    tb_assert_and_check_return_val(pixmap && pixmap->color_get, tb_null);
+
+    // the bitmap data
+    tb_byte_t const* data = (tb_byte_t const*)gb_bitmap_data(bitmap);
+    tb_assert_and_check_return_val(data, tb_null);
+
+    // grow the rgba pixels
+    tb_size_t width     = gb_bitmap_width(bitmap);
+    tb_size_t height    = gb_bitmap_height(bitmap);
+    tb_size_t size      = (width * height) << 2;
+    if (size > impl->data_size)
+    {
+        impl->data = (tb_byte_t*)tb_ralloc(impl->data, size);
+        tb_assert_and_check_return_val(impl->data, tb_null);
+        impl->data_size = size;
+    }
+
+    // convert the bitmap pixels to the rgba pixels
+    tb_size_t   x;
+    tb_size_t   y;
+    tb_size_t   btp = pixmap->btp;
+    tb_size_t   row_bytes = gb_bitmap_row_bytes(bitmap);
+    tb_bool_t   has_alpha = gb_bitmap_has_alpha(bitmap);
+    tb_byte_t*  pixels = impl->data;
+    for (y = 0; y < height; y++)
+    {
+        tb_byte_t const* p = data + y * row_bytes;
+        for (x = 0; x < width; x++, p += btp, pixels += 4)
+        {
+            gb_color_t color = pixmap->color_get(p);
+            pixels[0] = color.r;
+            pixels[1] = color.g;
+            pixels[2] = color.b;
+            pixels[3] = has_alpha? color.a : 0xff;
+        }
+    }
+
+    // ok
+    return impl->data;
+}
+static tb_bool_t gb_gl_texture_cache_atlas_reset(gb_gl_texture_cache_impl_t* impl)
+{
+    // the referenced images cannot be overwritten
+    tb_list_entry_ref_t item = tb_list_entry_head(&impl->atlas_list);
+    tb_list_entry_ref_t tail = tb_list_entry_tail(&impl->atlas_list);
+    for (; item != tail; item = tb_list_entry_next(&impl->atlas_list, item))
+    {
+        gb_gl_texture_cache_entry_ref_t entry = (gb_gl_texture_cache_entry_ref_t)tb_list_entry(&impl->atlas_list, item);
+        if (entry->refn) return tb_false;
+    }
+
+    // trace
+    tb_trace_d("atlas: reset %lu images", tb_list_entry_size(&impl->atlas_list));
+
+    // remove all atlas images
+    while (tb_list_entry_size(&impl->atlas_list))
+    {
+        gb_gl_texture_cache_entry_ref_t entry = (gb_gl_texture_cache_entry_ref_t)tb_list_entry(&impl->atlas_list, tb_list_entry_head(&impl->atlas_list));
+        gb_gl_texture_cache_entry_remove(impl, entry);
+    }
+
+    // clear shelves
+    impl->shelves_count     = 0;
+    impl->shelves_height    = 0;
+
+    // ok
+    return tb_true;
+}
+static tb_bool_t gb_gl_texture_cache_atlas_alloc(gb_gl_texture_cache_impl_t* impl, tb_size_t width, tb_size_t height, tb_size_t* px, tb_size_t* py)
+{
+    // the aligned height
+    tb_size_t aligned = tb_align(height, GB_GL_TEXTURE_ATLAS_SHELF_ALIGN);
+
+    // find the lowest shelf which has enough space and does not waste too much height
+    tb_size_t               i = 0;
+    gb_gl_texture_shelf_t*  best = tb_null;
+    for (i = 0; i < impl->shelves_count; i++)
+    {
+        gb_gl_texture_shelf_t* shelf = &impl->shelves[i];
+        if (    shelf->height >= aligned
+            &&  shelf->height <= aligned + (aligned >> 1)
+            &&  shelf->width + width <= GB_GL_TEXTURE_ATLAS_SIZE
+            &&  (!best || shelf->height < best->height))
+        {
+            best = shelf;
+        }
+    }
+
+    // make a new shelf
+    if (!best)
+    {
+        tb_check_return_val(impl->shelves_count < GB_GL_TEXTURE_ATLAS_SHELF_MAXN, tb_false);
+        tb_check_return_val(impl->shelves_height + aligned <= GB_GL_TEXTURE_ATLAS_SIZE, tb_false);
+
+        best = &impl->shelves[impl->shelves_count++];
+        best->y         = (tb_uint16_t)impl->shelves_height;
+        best->height    = (tb_uint16_t)aligned;
+        best->width     = 0;
+        impl->shelves_height += aligned;
+    }
+
+    // alloc it
+    *px = best->width;
+    *py = best->y;
+    best->width += (tb_uint16_t)width;
+
+    // ok
+    return tb_true;
+}
+static tb_bool_t gb_gl_texture_cache_atlas_add(gb_gl_texture_cache_impl_t* impl, gb_gl_texture_ref_t texture, tb_byte_t const* data, tb_size_t width, tb_size_t height)
+{
+    // make the atlas texture
+    if (!impl->atlas.id && !gb_gl_texture_init(&impl->atlas, tb_null, GB_GL_TEXTURE_ATLAS_SIZE, GB_GL_TEXTURE_ATLAS_SIZE)) return tb_false;
+
+    // alloc the image space, reset the atlas and try it again if it is full
+    tb_size_t x = 0;
+    tb_size_t y = 0;
+    if (!gb_gl_texture_cache_atlas_alloc(impl, width, height, &x, &y))
+    {
+        if (!gb_gl_texture_cache_atlas_reset(impl)) return tb_false;
+        if (!gb_gl_texture_cache_atlas_alloc(impl, width, height, &x, &y)) return tb_false;
+    }
+
+    // upload the image to the atlas
+    gb_glBindTexture(GB_GL_TEXTURE_2D, impl->atlas.id);
+    gb_glTexSubImage2D(GB_GL_TEXTURE_2D, 0, (gb_GLint_t)x, (gb_GLint_t)y, (gb_GLsizei_t)width, (gb_GLsizei_t)height, GB_GL_RGBA, GB_GL_UNSIGNED_BYTE, data);
+
+    // init texture
+    gb_GLfloat_t const scale = 1.0f / GB_GL_TEXTURE_ATLAS_SIZE;
+    texture->id         = impl->atlas.id;
+    texture->atlas      = tb_true;
+    texture->rect[0]    = x * scale;
+    texture->rect[1]    = y * scale;
+    texture->rect[2]    = width * scale;
+    texture->rect[3]    = height * scale;
+
+    // clamp the texels to the half-texel inside the image for the linear filter
+    texture->clamp[0]   = (x + 0.5f) * scale;
+    texture->clamp[1]   = (y + 0.5f) * scale;
+    texture->clamp[2]   = (x + width - 0.5f) * scale;
+    texture->clamp[3]   = (y + height - 0.5f) * scale;
+
+    // ok
+    return tb_true;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+tb_bool_t gb_gl_texture_init(gb_gl_texture_ref_t texture, tb_byte_t const* data, tb_size_t width, tb_size_t height)
+{
+    // check
+    tb_assert_and_check_return_val(texture && width && height, tb_false);
+
+    // init texture
+    tb_memset(texture, 0, sizeof(gb_gl_texture_t));
+    gb_glGenTextures(1, &texture->id);
+    tb_assert_and_check_return_val(texture->id, tb_false);
+
+    // init the texture parameters, the wrap mode of the shader is applied when drawing it
+    gb_glBindTexture(GB_GL_TEXTURE_2D, texture->id);
+    gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_MIN_FILTER, GB_GL_LINEAR);
+    gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_MAG_FILTER, GB_GL_LINEAR);
+    gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_WRAP_S, GB_GL_CLAMP_TO_EDGE);
+    gb_glTexParameteri(GB_GL_TEXTURE_2D, GB_GL_TEXTURE_WRAP_T, GB_GL_CLAMP_TO_EDGE);
+
+    // upload pixels, the rgba rows are always aligned by 4 bytes
+    gb_glPixelStorei(GB_GL_UNPACK_ALIGNMENT, 4);
+    gb_glTexImage2D(GB_GL_TEXTURE_2D, 0, GB_GL_RGBA, (gb_GLsizei_t)width, (gb_GLsizei_t)height, 0, GB_GL_RGBA, GB_GL_UNSIGNED_BYTE, data);
+
+    // init the whole rect
+    texture->rect[2]    = 1.0f;
+    texture->rect[3]    = 1.0f;
+    texture->clamp[2]   = 1.0f;
+    texture->clamp[3]   = 1.0f;
+
+    // ok
+    return tb_true;
+}
+tb_void_t gb_gl_texture_exit(gb_gl_texture_ref_t texture)
+{
+    // check
+    tb_assert_and_check_return(texture);
+
+    // exit texture
+    if (texture->id) gb_glDeleteTextures(1, &texture->id);
+    texture->id = 0;
+}
+gb_gl_texture_cache_ref_t gb_gl_texture_cache_init(tb_size_t maxn, tb_bool_t atlas)
+{
+    // done
+    tb_bool_t                   ok = tb_false;
+    gb_gl_texture_cache_impl_t* impl = tb_null;
+    do
+    {
+        // make cache
+        impl = tb_malloc0_type(gb_gl_texture_cache_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init budget
+        impl->maxn = maxn? maxn : GB_GL_TEXTURE_CACHE_MAXN;
+
+        // init atlas
+        impl->atlas_enabled = atlas;
+
+        // init pool
+        impl->pool = tb_fixed_pool_init(tb_null, GB_GL_TEXTURE_CACHE_ENTRIES_GROW, sizeof(gb_gl_texture_cache_entry_t), tb_null, gb_gl_texture_cache_entry_exit, (tb_cpointer_t)impl);
+        tb_assert_and_check_break(impl->pool);
+
+        // init lists
+        tb_list_entry_init(&impl->list, gb_gl_texture_cache_entry_t, entry, tb_null);
+        tb_list_entry_init(&impl->atlas_list, gb_gl_texture_cache_entry_t, entry, tb_null);
+
+        // init hash
+        impl->hash = tb_hash_map_init(TB_HASH_MAP_BUCKET_SIZE_SMALL, tb_element_ptr(tb_null, tb_null), tb_element_ptr(tb_null, tb_null));
+        tb_assert_and_check_break(impl->hash);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_gl_texture_cache_exit((gb_gl_texture_cache_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_gl_texture_cache_ref_t)impl;
+}
+tb_void_t gb_gl_texture_cache_exit(gb_gl_texture_cache_ref_t cache)
+{
+    // check
+    gb_gl_texture_cache_impl_t* impl = (gb_gl_texture_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl);
+
+    // exit hash
+    if (impl->hash) tb_hash_map_exit(impl->hash);
+    impl->hash = tb_null;
+
+    // exit lists
+    tb_list_entry_exit(&impl->list);
+    tb_list_entry_exit(&impl->atlas_list);
+
+    // exit pool and textures
+    if (impl->pool) tb_fixed_pool_exit(impl->pool);
+    impl->pool = tb_null;
+
+    // exit atlas
+    gb_gl_texture_exit(&impl->atlas);
+
+    // exit the rgba pixels
+    if (impl->data) tb_free(impl->data);
+    impl->data = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_void_t gb_gl_texture_cache_clear(gb_gl_texture_cache_ref_t cache)
+{
+    // check
+    gb_gl_texture_cache_impl_t* impl = (gb_gl_texture_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl);
+
+    // clear hash
+    if (impl->hash) tb_hash_map_clear(impl->hash);
+
+    // clear lists
+    tb_list_entry_clear(&impl->list);
+    tb_list_entry_clear(&impl->atlas_list);
+
+    // clear pool and textures
+    if (impl->pool) tb_fixed_pool_clear(impl->pool);
+
+    // clear shelves, the atlas texture will be reused
+    impl->shelves_count     = 0;
+    impl->shelves_height    = 0;
+
+    // clear size
+    impl->size = 0;
+}
+gb_gl_texture_ref_t gb_gl_texture_cache_get(gb_gl_texture_cache_ref_t cache, gb_bitmap_ref_t bitmap)
+{
+    // check
+    gb_gl_texture_cache_impl_t* impl = (gb_gl_texture_cache_impl_t*)cache;
+    tb_assert_and_check_return_val(impl && impl->hash && bitmap, tb_null);
+
+    // the bitmap version
+    tb_size_t version = gb_bitmap_version(bitmap);
+
+    // get entry
+    gb_gl_texture_cache_entry_ref_t entry = (gb_gl_texture_cache_entry_ref_t)tb_hash_map_get(impl->hash, bitmap);
+    if (entry)
+    {
+        /* hit? move it to the tail as the most recently used entry
+         *
+         * the referenced texture is still used for the modified bitmap, it will be uploaded again after it is released
+         */
+        if (entry->version == version || entry->refn)
+        {
+            if (!entry->texture.atlas) tb_list_entry_moveto_tail(&impl->list, &entry->entry);
+            entry->refn++;
+            return &entry->texture;
+        }
+
+        // the bitmap has been modified, remove the previous texture
+        gb_gl_texture_cache_entry_remove(impl, entry);
+        entry = tb_null;
+    }
+
+    // make the rgba pixels
+    tb_byte_t const* data = gb_gl_texture_cache_pixels(impl, bitmap);
+    tb_check_return_val(data, tb_null);
+
+    // make entry
+    entry = (gb_gl_texture_cache_entry_ref_t)tb_fixed_pool_malloc0(impl->pool);
+    tb_assert_and_check_return_val(entry, tb_null);
+
+    // init entry
+    entry->bitmap   = bitmap;
+    entry->version  = version;
+    entry->refn     = 1;
+
+    // add the small image to the atlas
+    tb_size_t width     = gb_bitmap_width(bitmap);
+    tb_size_t height    = gb_bitmap_height(bitmap);
+    if (    impl->atlas_enabled
+        &&  width <= GB_GL_TEXTURE_ATLAS_ITEM
+        &&  height <= GB_GL_TEXTURE_ATLAS_ITEM
+        &&  gb_gl_texture_cache_atlas_add(impl, &entry->texture, data, width, height))
+    {
+        tb_list_entry_insert_tail(&impl->atlas_list, &entry->entry);
+    }
+    // make the single texture
+    else if (gb_gl_texture_init(&entry->texture, data, width, height))
+    {
+        entry->size = (width * height) << 2;
+        tb_list_entry_insert_tail(&impl->list, &entry->entry);
+        impl->size += entry->size;
+    }
+    else
+    {
+        tb_fixed_pool_free(impl->pool, entry);
+        return tb_null;
+    }
+
+    // add entry
+    tb_hash_map_insert(impl->hash, bitmap, entry);
+    impl->uploads++;
+
+    // trace
+    tb_trace_d("upload: %p, %lux%lu, atlas: %d, size: %lu", bitmap, width, height, entry->texture.atlas, impl->size);
+
+    // remove the least recently used textures if be out of the budget, the referenced textures are skipped
+    tb_list_entry_ref_t item = tb_list_entry_head(&impl->list);
+    tb_list_entry_ref_t tail = tb_list_entry_tail(&impl->list);
+    while (impl->size > impl->maxn && item != tail)
+    {
+        // the next item
+        tb_list_entry_ref_t next = tb_list_entry_next(&impl->list, item);
+
+        // remove it if be not referenced
+        gb_gl_texture_cache_entry_ref_t head = (gb_gl_texture_cache_entry_ref_t)tb_list_entry(&impl->list, item);
+        if (!head->refn) gb_gl_texture_cache_entry_remove(impl, head);
+        item = next;
+    }
+
+    // ok
+    return &entry->texture;
+}
+tb_void_t gb_gl_texture_cache_put(gb_gl_texture_cache_ref_t cache, gb_gl_texture_ref_t texture)
+{
+    // check
+    gb_gl_texture_cache_impl_t* impl = (gb_gl_texture_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl && texture);
+
+    // release it
+    gb_gl_texture_cache_entry_ref_t entry = tb_container_of(gb_gl_texture_cache_entry_t, texture, texture);
+    tb_assert_and_check_return(entry->refn);
+    entry->refn--;
+}
+tb_size_t gb_gl_texture_cache_uploads(gb_gl_texture_cache_ref_t cache)
+{
+    // check
+    gb_gl_texture_cache_impl_t* impl = (gb_gl_texture_cache_impl_t*)cache;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the uploaded count
+    return impl->uploads;
+}
@@ -0,0 +1,160 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        texture.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_DEVICE_GL_TEXTURE_H
+#define GB_CORE_DEVICE_GL_TEXTURE_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+#include "../../bitmap.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the default memory budget of the texture cache
+#ifdef __gb_small__
+#   define GB_GL_TEXTURE_CACHE_MAXN         (8 << 20)
+#else
+#   define GB_GL_TEXTURE_CACHE_MAXN         (32 << 20)
+#endif
+
+// the atlas size
+#ifdef __gb_small__
+#   define GB_GL_TEXTURE_ATLAS_SIZE         (512)
+#else
+#   define GB_GL_TEXTURE_ATLAS_SIZE         (1024)
+#endif
+
+// the maximum image size for the atlas
+#define GB_GL_TEXTURE_ATLAS_ITEM            (64)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the gl texture type
+typedef struct __gb_gl_texture_t
+{
+    // the texture id
+    gb_GLuint_t                 id;
+
+    // the image rect in the texture: (x, y, w, h), normalized
+    gb_GLfloat_t                rect[4];
+
+    // the clamped image rect in the texture: (x0, y0, x1, y1), the sampled texels will not bleed into the neighbours of the atlas
+    gb_GLfloat_t                clamp[4];
+
+    // is in the atlas?
+    tb_bool_t                   atlas;
+
+}gb_gl_texture_t, *gb_gl_texture_ref_t;
+
+// the gl texture cache ref type
+typedef struct{}*               gb_gl_texture_cache_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* init texture from the rgba pixels
+ *
+ * @param texture           the texture
+ * @param data              the rgba pixels
+ * @param width             the width
+ * @param height            the height
+ *
+ * @return                  tb_true or tb_false
+ */
+tb_bool_t                   gb_gl_texture_init(gb_gl_texture_ref_t texture, tb_byte_t const* data, tb_size_t width, tb_size_t height);
+
+/* exit texture
+ *
+ * @param texture           the texture
+ */
+tb_void_t                   gb_gl_texture_exit(gb_gl_texture_ref_t texture);
+
+/* init the texture cache
+ *
+ * cache: (bitmap, version) => texture
+ *
+ * the small bitmaps are packed into the shared atlas texture if the atlas is enabled,
+ * and the other textures are removed by the least recently used order if be out of the budget.
+ * the texture got from the cache is referenced until it is put back, so it will not be removed or overwritten.
+ *
+ * @param maxn              the memory budget, uses the default budget if be zero
+ * @param atlas             enable the atlas? the wrap mode of the atlas image must be done in the fragment shader
+ *
+ * @return                  the texture cache
+ */
+gb_gl_texture_cache_ref_t   gb_gl_texture_cache_init(tb_size_t maxn, tb_bool_t atlas);
+
+/* exit the texture cache
+ *
+ * @param cache             the texture cache
+ */
+tb_void_t                   gb_gl_texture_cache_exit(gb_gl_texture_cache_ref_t cache);
+
+/* clear the texture cache
+ *
+ * @param cache             the texture cache
+ */
+tb_void_t                   gb_gl_texture_cache_clear(gb_gl_texture_cache_ref_t cache);
+
+/* get and reference the texture of the bitmap, upload it only if the bitmap is new or has been modified
+ *
+ * @param cache             the texture cache
+ * @param bitmap            the bitmap
+ *
+ * @return                  the texture, it must be put back after drawing it
+ */
+gb_gl_texture_ref_t         gb_gl_texture_cache_get(gb_gl_texture_cache_ref_t cache, gb_bitmap_ref_t bitmap);
+
+/* put back the texture got from the texture cache
+ *
+ * @param cache             the texture cache
+ * @param texture           the texture
+ */
+tb_void_t                   gb_gl_texture_cache_put(gb_gl_texture_cache_ref_t cache, gb_gl_texture_ref_t texture);
+
+/* the uploaded bitmaps count of the texture cache
+ *
+ * @param cache             the texture cache
+ *
+ * @return                  the uploaded count
+ */
+tb_size_t                   gb_gl_texture_cache_uploads(gb_gl_texture_cache_ref_t cache);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
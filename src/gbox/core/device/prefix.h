@@ -32,7 +32,11 @@
 #include "../paint.h"
 #include "../shader.h"
 #include "../device.h"
+#include "../context.h"
+#include "../impl/context.h"
+#include "../impl/profiler.h"
 #include "../bitmap.h"
+#include "../density.h"
 #include "../pixmap.h"
 #include "../../platform/platform.h"
 
@@ -40,12 +44,35 @@
  * types
  */
 
+// the device layer type
+typedef struct __gb_device_layer_t
+{
+    // the x-coordinate of the bounds
+    tb_uint16_t             x;
+
+    // the y-coordinate of the bounds
+    tb_uint16_t             y;
+
+    // the width of the bounds, the bounds have been clipped by the device and the parent layer
+    tb_uint16_t             width;
+
+    // the height of the bounds
+    tb_uint16_t             height;
+
+    // the group alpha
+    tb_byte_t               alpha;
+
+}gb_device_layer_t, *gb_device_layer_ref_t;
+
 // the device impl type
 typedef struct __gb_device_impl_t
 {
     // the device type
     tb_uint8_t              type;
 
+    // the fill mode
+    tb_uint8_t              fill_mode;
+
     // the pixfmt
     tb_uint16_t             pixfmt;
 
@@ -64,6 +91,18 @@ typedef struct __gb_device_impl_t
     // the clipper
     gb_clipper_ref_t        clipper;
 
+    // the context
+    gb_context_ref_t        context;
+
+    // the context is owned by this device? 
+    tb_bool_t               context_owned;
+
+    // the layers
+    gb_device_layer_t       layers[GB_DEVICE_LAYERS_MAXN];
+
+    // the layers count
+    tb_size_t               layers_count;
+
     /* resize
      *
      * @param device        the device
@@ -113,6 +152,48 @@ typedef struct __gb_device_impl_t
      */
     tb_void_t               (*draw_polygon)(struct __gb_device_impl_t* device, gb_polygon_ref_t polygon, gb_shape_ref_t hint, gb_rect_ref_t bounds);
 
+    /*! draw density, optional
+     *
+     * @param device        the device
+     * @param density       the density
+     * @param colors        the colors
+     * @param count         the colors count
+     */
+    tb_void_t               (*draw_density)(struct __gb_device_impl_t* device, gb_density_ref_t density, gb_color_t const* colors, tb_size_t count);
+
+    /*! draw the bitmap at the device position, optional
+     *
+     * the pixels are blended by their alpha, and the matrix and clipper are ignored
+     *
+     * @param device        the device
+     * @param bitmap        the argb8888 bitmap
+     * @param x             the x in the device coordinates
+     * @param y             the y in the device coordinates
+     */
+    tb_void_t               (*draw_bitmap)(struct __gb_device_impl_t* device, gb_bitmap_ref_t bitmap, tb_long_t x, tb_long_t y);
+
+    /*! save layer, optional
+     *
+     * the layer is at device->layers[device->layers_count] 
+     * and its parent is at device->layers[device->layers_count - 1] if exists
+     *
+     * @param device        the device
+     * @param layer         the layer, the bounds may be empty
+     *
+     * @return              tb_true or tb_false
+     */
+    tb_bool_t               (*save_layer)(struct __gb_device_impl_t* device, gb_device_layer_ref_t layer);
+
+    /*! load layer and composite it to the parent, optional
+     *
+     * the layer is at device->layers[device->layers_count] 
+     * and its parent is at device->layers[device->layers_count - 1] if exists
+     *
+     * @param device        the device
+     * @param layer         the layer
+     */
+    tb_void_t               (*load_layer)(struct __gb_device_impl_t* device, gb_device_layer_ref_t layer);
+
     /*! init linear gradient shader
      *
      * @param device        the device
@@ -139,7 +220,7 @@ typedef struct __gb_device_impl_t
      *
      * @param device        the device
      * @param mode          the mode 
-     * @param bitmap        the bitmap
+     * @param bitmap        the argb8888 bitmap
      *
      * @return              the shader
      */
@@ -220,8 +220,8 @@ tb_void_t gb_arc_make_quad2(gb_vector_ref_t start, gb_vector_ref_t stop, gb_matr
         tb_memcpy(points, g_quad_points_of_unit_circle, count * sizeof(gb_point_t));
 
         // patch the last quadratic curve
-        if (    sweep_abs_x <= GB_NEAR0
-            &&  sweep_abs_y <= GB_NEAR0
+        if (    sweep_abs_x > GB_NEAR0
+            &&  sweep_abs_y > GB_NEAR0
             &&  sweep_abs_x != GB_SQRT2_OVER2
             &&  sweep_abs_y != GB_SQRT2_OVER2)
         {
@@ -81,6 +81,35 @@ static __tb_inline__ tb_void_t  gb_bounds_make(gb_rect_ref_t bounds, gb_point_re
     bounds->h = y1 - y0;
 }
 
+/* extend bounds to the point
+ *
+ * @param bounds                the bounds
+ * @param point                 the point 
+ */
+static __tb_inline__ tb_void_t  gb_bounds_extend(gb_rect_ref_t bounds, gb_point_ref_t point)
+{
+    // check
+    tb_assert(bounds && point);
+
+    // the minimum and maximum point
+    gb_float_t x0 = bounds->x;
+    gb_float_t y0 = bounds->y;
+    gb_float_t x1 = x0 + bounds->w;
+    gb_float_t y1 = y0 + bounds->h;
+
+    // extend it
+    if (point->x < x0) x0 = point->x;
+    if (point->y < y0) y0 = point->y;
+    if (point->x > x1) x1 = point->x;
+    if (point->y > y1) y1 = point->y;
+
+    // make bounds
+    bounds->x = x0;
+    bounds->y = y0;
+    bounds->w = x1 - x0;
+    bounds->h = y1 - y0;
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
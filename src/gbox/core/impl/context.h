@@ -0,0 +1,72 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        context.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_CONTEXT_H
+#define GB_CORE_IMPL_CONTEXT_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+#include "stroker.h"
+#include "stroke_cache.h"
+#include "polygon_raster.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* the polygon raster of the context, it is shared by all devices of this context
+ *
+ * @param context       the context
+ *
+ * @return              the polygon raster
+ */
+gb_polygon_raster_ref_t gb_context_raster(gb_context_ref_t context);
+
+/* the stroker of the context, it is shared by all devices of this context
+ *
+ * @param context       the context
+ *
+ * @return              the stroker
+ */
+gb_stroker_ref_t        gb_context_stroker(gb_context_ref_t context);
+
+/* the stroke cache of the context, it is shared by all devices of this context
+ *
+ * @param context       the context
+ *
+ * @return              the stroke cache
+ */
+gb_stroke_cache_ref_t   gb_context_stroke_cache(gb_context_ref_t context);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
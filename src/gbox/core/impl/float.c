@@ -26,6 +26,23 @@
  */
 #include "float.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum digits of the fraction part
+#define GB_FLOAT_SCAN_FRACTION_MAXN     (9)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+// the scales of the fraction part
+static tb_uint32_t const g_float_scan_scales[] = 
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -64,3 +81,93 @@ tb_size_t gb_float_unit_divide(gb_float_t numer, gb_float_t denom, gb_float_t* r
     return 1;
 }
 
+tb_char_t const* gb_float_scan(tb_char_t const* data, gb_float_t* value)
+{
+    // check
+    tb_assert(data && value);
+
+    // the sign
+    tb_char_t const*    p = data;
+    tb_bool_t           sign = tb_false;
+    if (*p == '-')
+    {
+        sign = tb_true;
+        p++;
+    }
+    else if (*p == '+') p++;
+
+    // the integer part, only keep the significant digits and count the skipped digits
+    tb_char_t const*    b = p;
+    tb_uint32_t         integer = 0;
+    tb_long_t           skipped = 0;
+    while (tb_isdigit10(*p))
+    {
+        if (integer < 100000000) integer = integer * 10 + (*p - '0');
+        else skipped++;
+        p++;
+    }
+    tb_bool_t digits = p != b;
+
+    // the fraction part, only keep the significant digits
+    tb_uint32_t fraction = 0;
+    tb_size_t   fraction_n = 0;
+    if (*p == '.')
+    {
+        b = ++p;
+        while (tb_isdigit10(*p))
+        {
+            if (fraction_n < GB_FLOAT_SCAN_FRACTION_MAXN)
+            {
+                fraction = fraction * 10 + (*p - '0');
+                fraction_n++;
+            }
+            p++;
+        }
+        if (p != b) digits = tb_true;
+    }
+
+    // no number?
+    tb_check_return_val(digits, tb_null);
+
+    // the exponent part, e.g. 1e-5, but not the unit: 1em or 1ex
+    tb_long_t exponent = 0;
+    if (    (*p == 'e' || *p == 'E')
+        &&  (tb_isdigit10(p[1]) || ((p[1] == '-' || p[1] == '+') && tb_isdigit10(p[2]))))
+    {
+        tb_bool_t exponent_sign = tb_false;
+        p++;
+        if (*p == '-')
+        {
+            exponent_sign = tb_true;
+            p++;
+        }
+        else if (*p == '+') p++;
+        while (tb_isdigit10(*p))
+        {
+            if (exponent < 64) exponent = exponent * 10 + (*p - '0');
+            p++;
+        }
+        if (exponent_sign) exponent = -exponent;
+    }
+
+    // compute value
+    gb_float_t v;
+#ifdef GB_CONFIG_FLOAT_FIXED
+    // the skipped digits have been saturated to the fixed range
+    if (integer > TB_MAXS16) integer = TB_MAXS16;
+    v = (gb_float_t)((integer << 16) + (tb_uint32_t)(((tb_uint64_t)fraction << 16) / g_float_scan_scales[fraction_n]));
+#else
+    // the skipped integer digits scale the kept digits and the fraction is insignificant now
+    v = (gb_float_t)integer;
+    if (skipped) exponent += skipped;
+    else if (fraction) v += (gb_float_t)fraction / (gb_float_t)g_float_scan_scales[fraction_n];
+#endif
+    for (; exponent > 0; exponent--) v = gb_imul(v, 10);
+    for (; exponent < 0 && v; exponent++) v = gb_idiv(v, 10);
+
+    // save value
+    *value = sign? -v : v;
+
+    // ok
+    return p;
+}
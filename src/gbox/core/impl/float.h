@@ -55,6 +55,15 @@ __tb_extern_c_enter__
  */
 tb_size_t           gb_float_unit_divide(gb_float_t numer, gb_float_t denom, gb_float_t* result);
 
+/* scan the float value from the string, e.g. "-1.5e-3"
+ *
+ * @param data      the string data, will not skip the leading spaces
+ * @param value     the float value
+ *
+ * @return          the end of the number, return tb_null if no number
+ */
+tb_char_t const*    gb_float_scan(tb_char_t const* data, gb_float_t* value);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
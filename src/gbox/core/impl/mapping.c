@@ -0,0 +1,290 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        mapping.c
+ * @ingroup     core
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "mapping"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "mapping.h"
+#if defined(TB_CONFIG_OS_WINDOWS)
+#   include <windows.h>
+#elif defined(TB_CONFIG_POSIX_HAVE_OPEN)
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the mapping impl type
+typedef struct __gb_mapping_impl_t
+{
+    // the data
+    tb_byte_t*              data;
+
+    // the size
+    tb_size_t               size;
+
+    // is mapped? or the data is allocated
+    tb_bool_t               mapped;
+
+    // the reference count
+    tb_atomic_t             refn;
+
+}gb_mapping_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_bool_t gb_mapping_map(gb_mapping_impl_t* impl, tb_char_t const* path)
+{
+    // check
+    tb_assert(impl && path);
+
+#if defined(TB_CONFIG_OS_WINDOWS)
+
+    // open file
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, tb_null, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, tb_null);
+    tb_check_return_val(file != INVALID_HANDLE_VALUE, tb_false);
+
+    // done
+    HANDLE mapping = tb_null;
+    do
+    {
+        // the file size
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || !size.QuadPart || size.QuadPart > TB_MAXS32) break;
+
+        // map file
+        mapping = CreateFileMappingA(file, tb_null, PAGE_READONLY, 0, 0, tb_null);
+        tb_check_break(mapping);
+
+        // map the view, the view will keep the mapping after closing it
+        impl->data = (tb_byte_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        tb_check_break(impl->data);
+
+        // save size
+        impl->size      = (tb_size_t)size.QuadPart;
+        impl->mapped    = tb_true;
+
+    } while (0);
+
+    // close handles
+    if (mapping) CloseHandle(mapping);
+    CloseHandle(file);
+
+#elif defined(TB_CONFIG_POSIX_HAVE_OPEN)
+
+    // open file
+    tb_long_t fd = open(path, O_RDONLY);
+    tb_check_return_val(fd >= 0, tb_false);
+
+    // map file, the mapping will be kept after closing the file
+    struct stat st = {0};
+    if (!fstat(fd, &st) && st.st_size > 0 && st.st_size <= TB_MAXS32)
+    {
+        tb_pointer_t data = mmap(tb_null, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            impl->data      = (tb_byte_t*)data;
+            impl->size      = (tb_size_t)st.st_size;
+            impl->mapped    = tb_true;
+        }
+    }
+
+    // close file
+    close(fd);
+#endif
+
+    // ok?
+    return impl->mapped;
+}
+static tb_void_t gb_mapping_unmap(gb_mapping_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->mapped && impl->data);
+
+#if defined(TB_CONFIG_OS_WINDOWS)
+    UnmapViewOfFile(impl->data);
+#elif defined(TB_CONFIG_POSIX_HAVE_OPEN)
+    munmap(impl->data, impl->size);
+#endif
+}
+static tb_bool_t gb_mapping_load(gb_mapping_impl_t* impl, tb_char_t const* path)
+{
+    // check
+    tb_assert(impl && path);
+
+    // open file
+    tb_file_ref_t file = tb_file_init(path, TB_FILE_MODE_RO | TB_FILE_MODE_BINARY);
+    tb_check_return_val(file, tb_false);
+
+    // done
+    tb_bool_t ok = tb_false;
+    do
+    {
+        // the file size
+        tb_hize_t size = tb_file_size(file);
+        tb_check_break(size && size <= TB_MAXS32);
+
+        // make data
+        impl->data = tb_malloc_bytes((tb_size_t)size);
+        tb_assert_and_check_break(impl->data);
+
+        // read data
+        tb_size_t read = 0;
+        while (read < size)
+        {
+            tb_long_t real = tb_file_read(file, impl->data + read, (tb_size_t)size - read);
+            tb_check_break(real > 0);
+            read += real;
+        }
+        tb_check_break(read == size);
+
+        // save size
+        impl->size = (tb_size_t)size;
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed? exit data
+    if (!ok && impl->data)
+    {
+        tb_free(impl->data);
+        impl->data = tb_null;
+    }
+
+    // exit file
+    tb_file_exit(file);
+
+    // ok?
+    return ok;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_mapping_ref_t gb_mapping_init(tb_char_t const* path)
+{
+    // check
+    tb_assert_and_check_return_val(path, tb_null);
+
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_mapping_impl_t*  impl = tb_null;
+    do
+    {
+        // the absolute path
+        tb_char_t           data[TB_PATH_MAXN];
+        tb_char_t const*    absolute = tb_path_absolute(path, data, sizeof(data));
+        tb_assert_and_check_break(absolute);
+
+        // make mapping
+        impl = tb_malloc0_type(gb_mapping_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init the reference count
+        impl->refn = 1;
+
+        // map it first, read it if the mmap is not supported or failed
+        if (!gb_mapping_map(impl, absolute) && !gb_mapping_load(impl, absolute)) break;
+
+        // trace
+        tb_trace_d("init: %s: %lu bytes, mapped: %d", absolute, impl->size, impl->mapped);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_mapping_exit((gb_mapping_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_mapping_ref_t)impl;
+}
+tb_void_t gb_mapping_exit(gb_mapping_ref_t mapping)
+{
+    // check
+    gb_mapping_impl_t* impl = (gb_mapping_impl_t*)mapping;
+    tb_assert_and_check_return(impl);
+
+    // refn--, it is still referenced?
+    tb_check_return(tb_atomic_fetch_and_dec(&impl->refn) <= 1);
+
+    // exit data
+    if (impl->data)
+    {
+        if (impl->mapped) gb_mapping_unmap(impl);
+        else tb_free(impl->data);
+        impl->data = tb_null;
+    }
+
+    // exit it
+    tb_free(impl);
+}
+gb_mapping_ref_t gb_mapping_inc(gb_mapping_ref_t mapping)
+{
+    // check
+    gb_mapping_impl_t* impl = (gb_mapping_impl_t*)mapping;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // refn++
+    tb_atomic_fetch_and_inc(&impl->refn);
+
+    // the mapping
+    return mapping;
+}
+tb_byte_t const* gb_mapping_data(gb_mapping_ref_t mapping)
+{
+    // check
+    gb_mapping_impl_t* impl = (gb_mapping_impl_t*)mapping;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the data
+    return impl->data;
+}
+tb_size_t gb_mapping_size(gb_mapping_ref_t mapping)
+{
+    // check
+    gb_mapping_impl_t* impl = (gb_mapping_impl_t*)mapping;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the size
+    return impl->size;
+}
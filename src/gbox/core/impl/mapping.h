@@ -0,0 +1,92 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        mapping.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_MAPPING_H
+#define GB_CORE_IMPL_MAPPING_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the read-only file mapping ref type
+typedef struct{}*           gb_mapping_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* init the read-only mapping of the whole file
+ *
+ * the file will be read into the memory if the mmap is not supported on this platform
+ *
+ * @param path          the file path
+ *
+ * @return              the mapping
+ */
+gb_mapping_ref_t        gb_mapping_init(tb_char_t const* path);
+
+/* exit the mapping, it will be unmapped if the reference count is zero
+ *
+ * @param mapping       the mapping
+ */
+tb_void_t               gb_mapping_exit(gb_mapping_ref_t mapping);
+
+/* increase the reference count of the mapping, it will be kept until every reference is exited
+ *
+ * @param mapping       the mapping
+ *
+ * @return              the mapping
+ */
+gb_mapping_ref_t        gb_mapping_inc(gb_mapping_ref_t mapping);
+
+/* the mapped data, the address is aligned by 8 bytes at least
+ *
+ * @param mapping       the mapping
+ *
+ * @return              the data
+ */
+tb_byte_t const*        gb_mapping_data(gb_mapping_ref_t mapping);
+
+/* the mapped size
+ *
+ * @param mapping       the mapping
+ *
+ * @return              the size
+ */
+tb_size_t               gb_mapping_size(gb_mapping_ref_t mapping);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
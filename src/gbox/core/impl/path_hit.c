@@ -0,0 +1,503 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        path_hit.c
+ * @ingroup     core
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "path_hit"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "path_hit.h"
+#include "../paint.h"
+#include "../../utils/geometry.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the wide product of two floats
+#ifdef GB_CONFIG_FLOAT_FIXED
+#   define gb_path_hit_mul(a, b)        ((tb_hong_t)(a) * (b))
+#else
+#   define gb_path_hit_mul(a, b)        ((tb_double_t)(a) * (b))
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the wide product type
+#ifdef GB_CONFIG_FLOAT_FIXED
+typedef tb_hong_t                       gb_path_hit_product_t;
+#else
+typedef tb_double_t                     gb_path_hit_product_t;
+#endif
+
+// the path hit edge type
+typedef struct __gb_path_hit_edge_t
+{
+    // the upper point, upper.y <= lower.y
+    gb_point_t                  upper;
+
+    // the lower point
+    gb_point_t                  lower;
+
+    // the winding, +1 if the edge goes down, -1 if the edge goes up
+    tb_int8_t                   winding;
+
+    // is the implicit closing edge? it is only used for filling
+    tb_uint8_t                  closing;
+
+}gb_path_hit_edge_t, *gb_path_hit_edge_ref_t;
+
+// the path hit impl type
+typedef struct __gb_path_hit_impl_t
+{
+    // the edges
+    gb_path_hit_edge_ref_t      edges;
+
+    // the edges count
+    tb_size_t                   edges_count;
+
+    // the edges maxn
+    tb_size_t                   edges_maxn;
+
+    /* the edge indices of all cells
+     *
+     * the edges of the cell i are indices[offsets[i], offsets[i + 1]),
+     * and the edge is added to all cells crossed by the part of the edge in each row.
+     */
+    tb_uint32_t*                indices;
+
+    // the indices maxn
+    tb_size_t                   indices_maxn;
+
+    // the offsets of the cells
+    tb_uint32_t*                offsets;
+
+    /* the stamps of the edges
+     *
+     * the edge may be added to the multiple cells, so the stamp of the current query
+     * is marked to the tested edge for testing it only once.
+     */
+    tb_uint32_t*                stamps;
+
+    // the current stamp
+    tb_uint32_t                 stamp;
+
+    // the columns count
+    tb_size_t                   cols;
+
+    // the rows count
+    tb_size_t                   rows;
+
+    // the bounds
+    gb_rect_t                   bounds;
+
+    // the scale from the x-coordinate to the column index
+    gb_float_t                  scale_x;
+
+    // the scale from the y-coordinate to the row index
+    gb_float_t                  scale_y;
+
+    // the row height
+    gb_float_t                  row_height;
+
+}gb_path_hit_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static __tb_inline__ tb_size_t gb_path_hit_col(gb_path_hit_impl_t* impl, gb_float_t x)
+{
+    // clamp it to the columns
+    if (x <= impl->bounds.x) return 0;
+
+    // the column index
+    tb_long_t col = gb_float_to_long(gb_mul(x - impl->bounds.x, impl->scale_x));
+    return col < (tb_long_t)impl->cols? (tb_size_t)col : impl->cols - 1;
+}
+static __tb_inline__ tb_size_t gb_path_hit_row(gb_path_hit_impl_t* impl, gb_float_t y)
+{
+    // clamp it to the rows
+    if (y <= impl->bounds.y) return 0;
+
+    // the row index
+    tb_long_t row = gb_float_to_long(gb_mul(y - impl->bounds.y, impl->scale_y));
+    return row < (tb_long_t)impl->rows? (tb_size_t)row : impl->rows - 1;
+}
+static __tb_inline__ tb_uint32_t gb_path_hit_stamp(gb_path_hit_impl_t* impl)
+{
+    // the next stamp
+    if (!++impl->stamp)
+    {
+        // the stamp is wrapped, clear all stamps
+        tb_memset(impl->stamps, 0, impl->edges_count * sizeof(tb_uint32_t));
+        impl->stamp = 1;
+    }
+    return impl->stamp;
+}
+static tb_bool_t gb_path_hit_edge_add(gb_path_hit_impl_t* impl, gb_point_ref_t org, gb_point_ref_t dst, tb_bool_t closing)
+{
+    // the zero-length edge? ignore it
+    tb_check_return_val(org->x != dst->x || org->y != dst->y, tb_true);
+
+    // grow edges and stamps
+    if (impl->edges_count >= impl->edges_maxn)
+    {
+        tb_size_t maxn = impl->edges_maxn + (impl->edges_maxn >> 1) + 64;
+        gb_path_hit_edge_ref_t edges = tb_ralloc_type(impl->edges, maxn, gb_path_hit_edge_t);
+        tb_assert_and_check_return_val(edges, tb_false);
+        impl->edges = edges;
+
+        tb_uint32_t* stamps = tb_ralloc_type(impl->stamps, maxn, tb_uint32_t);
+        tb_assert_and_check_return_val(stamps, tb_false);
+        impl->stamps = stamps;
+
+        // save maxn
+        impl->edges_maxn = maxn;
+    }
+
+    // add edge
+    gb_path_hit_edge_ref_t edge = &impl->edges[impl->edges_count++];
+    tb_bool_t down  = org->y <= dst->y;
+    edge->upper     = down? *org : *dst;
+    edge->lower     = down? *dst : *org;
+    edge->winding   = down? 1 : -1;
+    edge->closing   = (tb_uint8_t)closing;
+    return tb_true;
+}
+static tb_void_t gb_path_hit_edge_cells(gb_path_hit_impl_t* impl, tb_size_t index, tb_bool_t fill)
+{
+    // the edge
+    gb_path_hit_edge_ref_t edge = &impl->edges[index];
+
+    // the rows of the edge
+    tb_size_t   head = gb_path_hit_row(impl, edge->upper.y);
+    tb_size_t   last = gb_path_hit_row(impl, edge->lower.y);
+    tb_size_t   row = head;
+    gb_float_t  dx = edge->lower.x - edge->upper.x;
+    gb_float_t  dy = edge->lower.y - edge->upper.y;
+    for (; row <= last; row++)
+    {
+        // the x-range of the part of the edge in this row
+        gb_float_t x0 = edge->upper.x;
+        gb_float_t x1 = edge->lower.x;
+        if (row > head)
+        {
+            // the x-coordinate at the top of this row, it is widened a little for the rounding error
+            gb_float_t y = impl->bounds.y + gb_mul(gb_long_to_float(row), impl->row_height);
+            x0 = edge->upper.x + gb_mul(gb_div(y - edge->upper.y, dy), dx);
+            x0 += dx > 0? -GB_NEAR0 : GB_NEAR0;
+        }
+        if (row < last)
+        {
+            // the x-coordinate at the bottom of this row
+            gb_float_t y = impl->bounds.y + gb_mul(gb_long_to_float(row + 1), impl->row_height);
+            x1 = edge->upper.x + gb_mul(gb_div(y - edge->upper.y, dy), dx);
+            x1 += dx > 0? GB_NEAR0 : -GB_NEAR0;
+        }
+
+        // add the edge to the crossed cells
+        tb_size_t col = gb_path_hit_col(impl, tb_min(x0, x1));
+        tb_size_t end = gb_path_hit_col(impl, tb_max(x0, x1));
+        for (; col <= end; col++)
+        {
+            tb_size_t cell = row * impl->cols + col;
+            if (fill) impl->indices[impl->offsets[cell]++] = (tb_uint32_t)index;
+            else impl->offsets[cell + 1]++;
+        }
+    }
+}
+static tb_bool_t gb_path_hit_edge_near(gb_path_hit_edge_ref_t edge, gb_point_ref_t point, gb_float_t distance)
+{
+    // outside the bounds of the edge?
+    gb_float_t x0 = tb_min(edge->upper.x, edge->lower.x);
+    gb_float_t x1 = tb_max(edge->upper.x, edge->lower.x);
+    if (    point->x < x0 - distance || point->x > x1 + distance
+        ||  point->y < edge->upper.y - distance || point->y > edge->lower.y + distance)
+        return tb_false;
+
+    // make vectors: upper => lower and upper => point
+    gb_vector_t e;
+    gb_vector_t v;
+    gb_vector_make(&e, edge->lower.x - edge->upper.x, edge->lower.y - edge->upper.y);
+    gb_vector_make(&v, point->x - edge->upper.x, point->y - edge->upper.y);
+
+    /* project the point to the edge by the wide products
+     *
+     * the unit vector of the edge is not precise enough for the fixed-point
+     */
+    gb_path_hit_product_t dot = gb_path_hit_mul(v.x, e.x) + gb_path_hit_mul(v.y, e.y);
+
+    // before the upper point?
+    if (dot <= 0) return gb_vector_length(&v) <= distance;
+
+    // after the lower point?
+    if (dot >= gb_path_hit_mul(e.x, e.x) + gb_path_hit_mul(e.y, e.y))
+    {
+        gb_vector_make(&v, point->x - edge->lower.x, point->y - edge->lower.y);
+        return gb_vector_length(&v) <= distance;
+    }
+
+    // the distance to the line: |e x v| / |e| <= distance
+    gb_path_hit_product_t cross = gb_path_hit_mul(e.x, v.y) - gb_path_hit_mul(e.y, v.x);
+    return tb_abs(cross) <= gb_path_hit_mul(distance, gb_vector_length(&e));
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_path_hit_ref_t gb_path_hit_init()
+{
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_path_hit_impl_t* impl = tb_null;
+    do
+    {
+        // make hit tester
+        impl = tb_malloc0_type(gb_path_hit_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // make offsets
+        impl->offsets = tb_nalloc0_type(GB_PATH_HIT_CELLS_MAXN + 1, tb_uint32_t);
+        tb_assert_and_check_break(impl->offsets);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_path_hit_exit((gb_path_hit_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_path_hit_ref_t)impl;
+}
+tb_void_t gb_path_hit_exit(gb_path_hit_ref_t hit)
+{
+    // check
+    gb_path_hit_impl_t* impl = (gb_path_hit_impl_t*)hit;
+    tb_assert_and_check_return(impl);
+
+    // exit edges, stamps, indices and offsets
+    if (impl->edges) tb_free(impl->edges);
+    if (impl->stamps) tb_free(impl->stamps);
+    if (impl->indices) tb_free(impl->indices);
+    if (impl->offsets) tb_free(impl->offsets);
+
+    // exit it
+    tb_free(impl);
+}
+tb_bool_t gb_path_hit_make(gb_path_hit_ref_t hit, gb_polygon_ref_t polygon, gb_rect_ref_t bounds)
+{
+    // check
+    gb_path_hit_impl_t* impl = (gb_path_hit_impl_t*)hit;
+    tb_assert_and_check_return_val(impl && polygon && polygon->points && polygon->counts && bounds, tb_false);
+
+    // clear it
+    impl->edges_count   = 0;
+    impl->cols          = 0;
+    impl->rows          = 0;
+
+    // make edges
+    tb_uint16_t*    counts = polygon->counts;
+    gb_point_ref_t  points = polygon->points;
+    tb_uint16_t     count;
+    while ((count = *counts++))
+    {
+        // add the edges of this contour
+        tb_size_t i;
+        for (i = 1; i < count; i++)
+        {
+            if (!gb_path_hit_edge_add(impl, &points[i - 1], &points[i], tb_false)) return tb_false;
+        }
+
+        // add the closing edge
+        if (!gb_path_hit_edge_add(impl, &points[count - 1], &points[0], tb_true)) return tb_false;
+
+        // the next contour
+        points += count;
+    }
+    tb_check_return_val(impl->edges_count, tb_true);
+
+    // clear stamps
+    tb_memset(impl->stamps, 0, impl->edges_count * sizeof(tb_uint32_t));
+    impl->stamp = 0;
+
+    /* the cells count, about two edges for each cell
+     *
+     * the columns and rows are proportional to the width and height of the bounds
+     */
+    tb_size_t cells = tb_max(tb_min(impl->edges_count >> 1, GB_PATH_HIT_CELLS_MAXN), 1);
+    impl->cols = 1;
+    impl->rows = 1;
+    if (bounds->w > GB_NEAR0 && bounds->h > GB_NEAR0)
+    {
+        // compute the shorter side first, the ratio <= 1 will not overflow the fixed-point
+        if (bounds->w >= bounds->h)
+        {
+            impl->rows = tb_max(gb_float_to_long(gb_sqrt(gb_mul(gb_long_to_float(cells), gb_div(bounds->h, bounds->w)))), 1);
+            impl->cols = tb_max(cells / impl->rows, 1);
+        }
+        else
+        {
+            impl->cols = tb_max(gb_float_to_long(gb_sqrt(gb_mul(gb_long_to_float(cells), gb_div(bounds->w, bounds->h)))), 1);
+            impl->rows = tb_max(cells / impl->cols, 1);
+        }
+    }
+    else if (bounds->w > GB_NEAR0) impl->cols = cells;
+    else if (bounds->h > GB_NEAR0) impl->rows = cells;
+    impl->bounds        = *bounds;
+    impl->scale_x       = bounds->w > GB_NEAR0? gb_div(gb_long_to_float(impl->cols), bounds->w) : 0;
+    impl->scale_y       = bounds->h > GB_NEAR0? gb_div(gb_long_to_float(impl->rows), bounds->h) : 0;
+    impl->row_height    = gb_div(bounds->h, gb_long_to_float(impl->rows));
+
+    // count the edges of all cells
+    tb_size_t i;
+    tb_size_t cell;
+    cells = impl->cols * impl->rows;
+    tb_memset(impl->offsets, 0, (cells + 1) * sizeof(tb_uint32_t));
+    for (i = 0; i < impl->edges_count; i++) gb_path_hit_edge_cells(impl, i, tb_false);
+
+    // make offsets
+    for (cell = 0; cell < cells; cell++) impl->offsets[cell + 1] += impl->offsets[cell];
+
+    // grow indices
+    tb_size_t total = impl->offsets[cells];
+    if (total > impl->indices_maxn)
+    {
+        tb_uint32_t* indices = tb_ralloc_type(impl->indices, total, tb_uint32_t);
+        tb_assert_and_check_return_val(indices, tb_false);
+
+        // save indices
+        impl->indices       = indices;
+        impl->indices_maxn  = total;
+    }
+
+    // fill the edge indices of all cells, the offsets are moved to the tail of each cell
+    for (i = 0; i < impl->edges_count; i++) gb_path_hit_edge_cells(impl, i, tb_true);
+
+    // restore the offsets to the head of each cell
+    for (cell = cells; cell > 0; cell--) impl->offsets[cell] = impl->offsets[cell - 1];
+    impl->offsets[0] = 0;
+
+    // ok
+    return tb_true;
+}
+tb_bool_t gb_path_hit_contains(gb_path_hit_ref_t hit, gb_point_ref_t point, tb_size_t rule)
+{
+    // check
+    gb_path_hit_impl_t* impl = (gb_path_hit_impl_t*)hit;
+    tb_assert_and_check_return_val(impl && point, tb_false);
+
+    // no edges?
+    tb_check_return_val(impl->cols, tb_false);
+
+    /* cast the ray to the right and accumulate the winding of the crossed edges
+     *
+     * the crossed edges are in the cells of this row from the column of the point,
+     * and the edge covers [upper.y, lower.y), so the vertex will be not counted twice
+     */
+    tb_uint32_t stamp = gb_path_hit_stamp(impl);
+    tb_long_t   winding = 0;
+    tb_size_t   row = gb_path_hit_row(impl, point->y);
+    tb_size_t   cell = row * impl->cols + gb_path_hit_col(impl, point->x);
+    tb_size_t   head = impl->offsets[cell];
+    tb_size_t   tail = impl->offsets[(row + 1) * impl->cols];
+    for (; head < tail; head++)
+    {
+        // tested?
+        tb_uint32_t index = impl->indices[head];
+        if (impl->stamps[index] == stamp) continue;
+        impl->stamps[index] = stamp;
+
+        // the edge
+        gb_path_hit_edge_ref_t edge = &impl->edges[index];
+
+        // on the horizontal edge?
+        if (edge->upper.y == edge->lower.y)
+        {
+            if (    point->y == edge->upper.y
+                &&  point->x >= tb_min(edge->upper.x, edge->lower.x)
+                &&  point->x <= tb_max(edge->upper.x, edge->lower.x))
+                return tb_true;
+            continue;
+        }
+
+        // outside the y-range of this edge?
+        if (point->y < edge->upper.y || point->y > edge->lower.y) continue;
+
+        // on the edge? or in the left of the edge?
+        tb_long_t orientation = gb_points_orientation(&edge->upper, point, &edge->lower);
+        if (!orientation) return tb_true;
+        if (orientation < 0 && point->y < edge->lower.y) winding += edge->winding;
+    }
+
+    // inside?
+    return rule == GB_PAINT_FILL_RULE_ODD? (winding & 1) : (winding != 0);
+}
+tb_bool_t gb_path_hit_near(gb_path_hit_ref_t hit, gb_point_ref_t point, gb_float_t distance)
+{
+    // check
+    gb_path_hit_impl_t* impl = (gb_path_hit_impl_t*)hit;
+    tb_assert_and_check_return_val(impl && point && distance >= 0, tb_false);
+
+    // no edges?
+    tb_check_return_val(impl->cols, tb_false);
+
+    // the cells around the point
+    tb_uint32_t stamp = gb_path_hit_stamp(impl);
+    tb_size_t   row = gb_path_hit_row(impl, point->y - distance);
+    tb_size_t   row_last = gb_path_hit_row(impl, point->y + distance);
+    tb_size_t   col_head = gb_path_hit_col(impl, point->x - distance);
+    tb_size_t   col_last = gb_path_hit_col(impl, point->x + distance);
+    for (; row <= row_last; row++)
+    {
+        // the edges of the cells in this row
+        tb_size_t head = impl->offsets[row * impl->cols + col_head];
+        tb_size_t tail = impl->offsets[row * impl->cols + col_last + 1];
+        for (; head < tail; head++)
+        {
+            // tested?
+            tb_uint32_t index = impl->indices[head];
+            if (impl->stamps[index] == stamp) continue;
+            impl->stamps[index] = stamp;
+
+            // near this edge?
+            gb_path_hit_edge_ref_t edge = &impl->edges[index];
+            if (!edge->closing && gb_path_hit_edge_near(edge, point, distance)) return tb_true;
+        }
+    }
+
+    // not found
+    return tb_false;
+}
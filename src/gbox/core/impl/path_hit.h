@@ -0,0 +1,112 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        path_hit.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_PATH_HIT_H
+#define GB_CORE_IMPL_PATH_HIT_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum cells count of the hit tester grid
+#ifdef __gb_small__
+#   define GB_PATH_HIT_CELLS_MAXN       (256)
+#else
+#   define GB_PATH_HIT_CELLS_MAXN       (1024)
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the path hit tester ref type
+typedef struct{}*       gb_path_hit_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* init the path hit tester
+ *
+ * the edges of the polygon are bucketed into the grid cells crossed by them,
+ * so only the edges of the cells around the point or on the right ray of the point need be tested.
+ *
+ * @return              the hit tester
+ */
+gb_path_hit_ref_t       gb_path_hit_init(tb_noarg_t);
+
+/* exit the path hit tester
+ *
+ * @param hit           the hit tester
+ */
+tb_void_t               gb_path_hit_exit(gb_path_hit_ref_t hit);
+
+/* make the grid from the polygon, the buffers of the previous polygon will be reused
+ *
+ * @param hit           the hit tester
+ * @param polygon       the polygon
+ * @param bounds        the polygon bounds
+ *
+ * @return              tb_true or tb_false
+ */
+tb_bool_t               gb_path_hit_make(gb_path_hit_ref_t hit, gb_polygon_ref_t polygon, gb_rect_ref_t bounds);
+
+/* the polygon contains the point?
+ *
+ * the contours are closed implicitly and the point on the edges is contained
+ *
+ * @param hit           the hit tester
+ * @param point         the point
+ * @param rule          the fill rule
+ *
+ * @return              tb_true or tb_false
+ */
+tb_bool_t               gb_path_hit_contains(gb_path_hit_ref_t hit, gb_point_ref_t point, tb_size_t rule);
+
+/* the distance of the point to the edges is not larger than the given distance?
+ *
+ * the contours are not closed implicitly
+ *
+ * @param hit           the hit tester
+ * @param point         the point
+ * @param distance      the distance
+ *
+ * @return              tb_true or tb_false
+ */
+tb_bool_t               gb_path_hit_near(gb_path_hit_ref_t hit, gb_point_ref_t point, gb_float_t distance);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
@@ -0,0 +1,448 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        path_lod.c
+ * @ingroup     core
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "path_lod"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "path_lod.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the wide product of two floats
+#ifdef GB_CONFIG_FLOAT_FIXED
+#   define gb_path_lod_mul(a, b)        ((tb_hong_t)(a) * (b))
+#else
+#   define gb_path_lod_mul(a, b)        ((tb_double_t)(a) * (b))
+#endif
+
+// the maximum exponent of the rounded tolerance
+#define GB_PATH_LOD_EXPONENT_MAXN       (12)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the wide product type
+#ifdef GB_CONFIG_FLOAT_FIXED
+typedef tb_hong_t                       gb_path_lod_product_t;
+#else
+typedef tb_double_t                     gb_path_lod_product_t;
+#endif
+
+// the path lod segment type
+typedef struct __gb_path_lod_segment_t
+{
+    // the head point index
+    tb_uint32_t                 head;
+
+    // the tail point index
+    tb_uint32_t                 tail;
+
+    // the importance of the point which splits this segment
+    gb_float_t                  limit;
+
+}gb_path_lod_segment_t, *gb_path_lod_segment_ref_t;
+
+// the path lod level type
+typedef struct __gb_path_lod_level_t
+{
+    // the exponent of the rounded tolerance
+    tb_long_t                   exponent;
+
+    // the used stamp, zero if this level is not made
+    tb_size_t                   stamp;
+
+    // no points are removed?
+    tb_bool_t                   same;
+
+    // the simplified polygon
+    gb_polygon_t                polygon;
+
+    // the points
+    gb_point_ref_t              points;
+
+    // the points maxn
+    tb_size_t                   points_maxn;
+
+    // the counts, ends with zero
+    tb_uint16_t*                counts;
+
+    // the counts maxn
+    tb_size_t                   counts_maxn;
+
+}gb_path_lod_level_t, *gb_path_lod_level_ref_t;
+
+// the path lod impl type
+typedef struct __gb_path_lod_impl_t
+{
+    // the made polygon
+    gb_polygon_ref_t            polygon;
+
+    // the points count of the made polygon
+    tb_size_t                   points_count;
+
+    // the contours count of the made polygon
+    tb_size_t                   contours_count;
+
+    // the importance of the points
+    gb_float_t*                 importance;
+
+    // the segments stack
+    gb_path_lod_segment_ref_t   segments;
+
+    // the maxn of the importance and segments
+    tb_size_t                   maxn;
+
+    // the levels
+    gb_path_lod_level_t         levels[GB_PATH_LOD_LEVELS_MAXN];
+
+    // the used stamp
+    tb_size_t                   stamp;
+
+}gb_path_lod_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_path_lod_make_contour(gb_path_lod_impl_t* impl, gb_point_ref_t points, tb_size_t head, tb_size_t tail)
+{
+    // the head and tail points are always kept
+    gb_float_t* importance = impl->importance;
+    importance[head] = GB_MAF;
+    importance[tail] = GB_MAF;
+    tb_check_return(tail > head + 1);
+
+    // push the whole contour
+    gb_path_lod_segment_ref_t   segments = impl->segments;
+    tb_size_t                   size = 0;
+    segments[size].head     = (tb_uint32_t)head;
+    segments[size].tail     = (tb_uint32_t)tail;
+    segments[size].limit    = GB_MAF;
+    size++;
+
+    // split the segments
+    while (size)
+    {
+        // pop segment
+        gb_path_lod_segment_t segment = segments[--size];
+
+        // the segment vector
+        gb_point_ref_t  org = points + segment.head;
+        gb_vector_t     e;
+        gb_vector_make(&e, points[segment.tail].x - org->x, points[segment.tail].y - org->y);
+
+        /* find the farthest point from the segment by the wide products
+         *
+         * the closed contour has the same head and tail point, so the distance to the head point is used,
+         * and the length of the zero vector may be not zero for the fixed float
+         */
+        tb_bool_t               closed = gb_point_eq(org, &points[segment.tail]);
+        gb_float_t              length = closed? 0 : gb_vector_length(&e);
+        tb_size_t               farthest = segment.head + 1;
+        gb_path_lod_product_t   maxd = -1;
+        tb_size_t               i;
+        for (i = segment.head + 1; i < segment.tail; i++)
+        {
+            gb_float_t              dx = points[i].x - org->x;
+            gb_float_t              dy = points[i].y - org->y;
+            gb_path_lod_product_t   d;
+            if (closed) d = gb_path_lod_mul(dx, dx) + gb_path_lod_mul(dy, dy);
+            else
+            {
+                d = gb_path_lod_mul(e.x, dy) - gb_path_lod_mul(e.y, dx);
+                if (d < 0) d = -d;
+            }
+            if (d > maxd)
+            {
+                maxd = d;
+                farthest = i;
+            }
+        }
+
+        // the distance of the farthest point: |e x v| / |e|
+        gb_float_t distance;
+        if (closed)
+        {
+            gb_vector_t v;
+            gb_vector_make(&v, points[farthest].x - org->x, points[farthest].y - org->y);
+            distance = gb_vector_length(&v);
+        }
+        else
+        {
+            gb_path_lod_product_t d = maxd / length;
+            distance = d < GB_MAF? (gb_float_t)d : GB_MAF;
+        }
+
+        /* the importance is not larger than the importance of the splitting point of this segment,
+         * so the points kept by any tolerance are the same as the douglas-peucker result
+         */
+        if (distance > segment.limit) distance = segment.limit;
+        importance[farthest] = distance;
+
+        // push the sub-segments with the inner points
+        if (farthest > segment.head + 1)
+        {
+            segments[size].head     = segment.head;
+            segments[size].tail     = (tb_uint32_t)farthest;
+            segments[size].limit    = distance;
+            size++;
+        }
+        if (segment.tail > farthest + 1)
+        {
+            segments[size].head     = (tb_uint32_t)farthest;
+            segments[size].tail     = segment.tail;
+            segments[size].limit    = distance;
+            size++;
+        }
+    }
+}
+static tb_bool_t gb_path_lod_make_level(gb_path_lod_impl_t* impl, gb_path_lod_level_ref_t level, gb_float_t tolerance)
+{
+    // check
+    tb_assert(impl && impl->polygon && impl->importance && level);
+
+    // grow points and counts
+    if (level->points_maxn < impl->points_count)
+    {
+        gb_point_ref_t points = tb_ralloc_type(level->points, impl->points_count, gb_point_t);
+        tb_assert_and_check_return_val(points, tb_false);
+        level->points       = points;
+        level->points_maxn  = impl->points_count;
+    }
+    if (level->counts_maxn < impl->contours_count + 1)
+    {
+        tb_uint16_t* counts = tb_ralloc_type(level->counts, impl->contours_count + 1, tb_uint16_t);
+        tb_assert_and_check_return_val(counts, tb_false);
+        level->counts       = counts;
+        level->counts_maxn  = impl->contours_count + 1;
+    }
+
+    // filter the points with the larger importance
+    gb_point_ref_t      points = impl->polygon->points;
+    tb_uint16_t const*  counts = impl->polygon->counts;
+    gb_float_t const*   importance = impl->importance;
+    tb_size_t           kept = 0;
+    tb_size_t           index = 0;
+    tb_size_t           contour = 0;
+    tb_uint16_t         count = 0;
+    while ((count = *counts++))
+    {
+        tb_size_t   head = kept;
+        tb_size_t   tail = index + count;
+        for (; index < tail; index++)
+        {
+            if (importance[index] > tolerance) level->points[kept++] = points[index];
+        }
+
+        /* the simplified contour is degenerate? keep the original contour
+         *
+         * e.g. only the head and the duplicate tail of the tiny closed contour are left,
+         * the tessellator cannot make the mesh for it
+         */
+        tb_size_t   size = kept - head;
+        tb_bool_t   closed = size > 1 && gb_point_eq(&level->points[head], &level->points[kept - 1]);
+        if (size < (closed? 4 : 3) && size < count)
+        {
+            tb_memcpy(level->points + head, points + tail - count, count * sizeof(gb_point_t));
+            kept = head + count;
+        }
+        level->counts[contour++] = (tb_uint16_t)(kept - head);
+    }
+    level->counts[contour] = 0;
+
+    // no points are removed? use the made polygon directly
+    level->same = (kept == impl->points_count);
+
+    // init polygon, the simplified contours of the convex polygon are still convex
+    level->polygon.points   = level->points;
+    level->polygon.counts   = level->counts;
+    level->polygon.convex   = impl->polygon->convex;
+    return tb_true;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_path_lod_ref_t gb_path_lod_init()
+{
+    // make lod
+    return (gb_path_lod_ref_t)tb_malloc0_type(gb_path_lod_impl_t);
+}
+tb_void_t gb_path_lod_exit(gb_path_lod_ref_t lod)
+{
+    // check
+    gb_path_lod_impl_t* impl = (gb_path_lod_impl_t*)lod;
+    tb_assert_and_check_return(impl);
+
+    // exit levels
+    tb_size_t i;
+    for (i = 0; i < GB_PATH_LOD_LEVELS_MAXN; i++)
+    {
+        if (impl->levels[i].points) tb_free(impl->levels[i].points);
+        if (impl->levels[i].counts) tb_free(impl->levels[i].counts);
+    }
+
+    // exit importance and segments
+    if (impl->importance) tb_free(impl->importance);
+    if (impl->segments) tb_free(impl->segments);
+
+    // exit it
+    tb_free(impl);
+}
+tb_bool_t gb_path_lod_make(gb_path_lod_ref_t lod, gb_polygon_ref_t polygon)
+{
+    // check
+    gb_path_lod_impl_t* impl = (gb_path_lod_impl_t*)lod;
+    tb_assert_and_check_return_val(impl && polygon && polygon->points && polygon->counts, tb_false);
+
+    // clear the cached levels
+    tb_size_t i;
+    for (i = 0; i < GB_PATH_LOD_LEVELS_MAXN; i++) impl->levels[i].stamp = 0;
+    impl->stamp = 0;
+
+    // the points and contours count
+    tb_uint16_t const*  counts = polygon->counts;
+    tb_size_t           points_count = 0;
+    tb_size_t           contours_count = 0;
+    while (counts[contours_count]) points_count += counts[contours_count++];
+
+    // save polygon
+    impl->polygon           = polygon;
+    impl->points_count      = points_count;
+    impl->contours_count    = contours_count;
+
+    // too few points? it will be drawn directly
+    tb_check_return_val(points_count >= GB_PATH_LOD_POINTS_MINN, tb_true);
+
+    // grow importance and segments, the segments in the stack are not more than the points
+    if (impl->maxn < points_count)
+    {
+        gb_float_t* importance = tb_ralloc_type(impl->importance, points_count, gb_float_t);
+        tb_assert_and_check_return_val(importance, tb_false);
+        impl->importance = importance;
+
+        gb_path_lod_segment_ref_t segments = tb_ralloc_type(impl->segments, points_count, gb_path_lod_segment_t);
+        tb_assert_and_check_return_val(segments, tb_false);
+        impl->segments = segments;
+
+        // save maxn
+        impl->maxn = points_count;
+    }
+
+    // make the importance of the points for each contour
+    tb_size_t head = 0;
+    for (i = 0; i < contours_count; i++)
+    {
+        gb_path_lod_make_contour(impl, polygon->points, head, head + counts[i] - 1);
+        head += counts[i];
+    }
+
+    // ok
+    return tb_true;
+}
+gb_polygon_ref_t gb_path_lod_polygon(gb_path_lod_ref_t lod, gb_float_t tolerance)
+{
+    // check
+    gb_path_lod_impl_t* impl = (gb_path_lod_impl_t*)lod;
+    tb_assert_and_check_return_val(impl && impl->polygon, tb_null);
+
+    // too few points? use the made polygon directly
+    tb_check_return_val(impl->points_count >= GB_PATH_LOD_POINTS_MINN, impl->polygon);
+
+    /* round the tolerance down to the power of two
+     *
+     * the near tolerances share the same level, so the levels are not made again for the small zooming
+     */
+    tb_long_t   exponent = 0;
+    gb_float_t  rounded = GB_ONE;
+    while (rounded > tolerance && exponent > -GB_PATH_LOD_EXPONENT_MAXN)
+    {
+        rounded = gb_half(rounded);
+        exponent--;
+    }
+    while (rounded + rounded <= tolerance && exponent < GB_PATH_LOD_EXPONENT_MAXN)
+    {
+        rounded += rounded;
+        exponent++;
+    }
+
+    // too small tolerance? use the made polygon directly
+    tb_check_return_val(rounded <= tolerance, impl->polygon);
+
+    // find the cached level or the least recently used level
+    tb_size_t               i;
+    gb_path_lod_level_ref_t level = tb_null;
+    gb_path_lod_level_ref_t oldest = &impl->levels[0];
+    for (i = 0; i < GB_PATH_LOD_LEVELS_MAXN; i++)
+    {
+        gb_path_lod_level_ref_t item = &impl->levels[i];
+        if (item->stamp && item->exponent == exponent)
+        {
+            level = item;
+            break;
+        }
+        if (item->stamp < oldest->stamp) oldest = item;
+    }
+
+    // make the new level
+    if (!level)
+    {
+        level = oldest;
+        level->stamp = 0;
+        if (!gb_path_lod_make_level(impl, level, rounded)) return impl->polygon;
+        level->exponent = exponent;
+    }
+
+    // update the used stamp
+    level->stamp = ++impl->stamp;
+
+    // ok
+    return level->same? impl->polygon : &level->polygon;
+}
+gb_float_t gb_path_lod_tolerance(gb_matrix_ref_t matrix)
+{
+    // check
+    tb_assert_and_check_return_val(matrix, 0);
+
+    /* the scale is the maximum length of the mapped unit vectors
+     *
+     * it is exact for the scaling and rotation, and the skewing is rare for drawing the large polylines
+     */
+    gb_vector_t x;
+    gb_vector_t y;
+    gb_vector_make(&x, matrix->sx, matrix->ky);
+    gb_vector_make(&y, matrix->kx, matrix->sy);
+    gb_float_t scale = tb_max(gb_vector_length(&x), gb_vector_length(&y));
+    tb_check_return_val(scale > GB_NEAR0, 0);
+
+    // the tolerance in the path coordinate
+    return gb_div(GB_PATH_LOD_TOLERANCE, scale);
+}
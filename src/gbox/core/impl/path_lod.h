@@ -0,0 +1,114 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        path_lod.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_PATH_LOD_H
+#define GB_CORE_IMPL_PATH_LOD_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the minimum points count of the simplified polygon, the smaller polygon will be drawn directly
+#ifdef __gb_small__
+#   define GB_PATH_LOD_POINTS_MINN      (256)
+#else
+#   define GB_PATH_LOD_POINTS_MINN      (1024)
+#endif
+
+// the maximum cached levels count
+#define GB_PATH_LOD_LEVELS_MAXN         (4)
+
+// the device tolerance, a quarter of pixel
+#define GB_PATH_LOD_TOLERANCE           (GB_ONE / 4)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the path lod ref type
+typedef struct{}*       gb_path_lod_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* init the path lod
+ *
+ * the importance of each point is the douglas-peucker distance at which it will be removed,
+ * so the simplified polygon for any tolerance is only an O(n) filter of the points.
+ *
+ * @return              the lod
+ */
+gb_path_lod_ref_t       gb_path_lod_init(tb_noarg_t);
+
+/* exit the path lod
+ *
+ * @param lod           the lod
+ */
+tb_void_t               gb_path_lod_exit(gb_path_lod_ref_t lod);
+
+/* make the importance of the polygon points and clear the cached levels
+ *
+ * the polygon must be valid until the lod is made again
+ *
+ * @param lod           the lod
+ * @param polygon       the polygon
+ *
+ * @return              tb_true or tb_false
+ */
+tb_bool_t               gb_path_lod_make(gb_path_lod_ref_t lod, gb_polygon_ref_t polygon);
+
+/* the simplified polygon
+ *
+ * the tolerance is rounded down to the power of two, and the recent levels are cached
+ *
+ * @param lod           the lod
+ * @param tolerance     the maximum distance of the removed points to the simplified contours
+ *
+ * @return              the simplified polygon, return the made polygon if no points are removed
+ */
+gb_polygon_ref_t        gb_path_lod_polygon(gb_path_lod_ref_t lod, gb_float_t tolerance);
+
+/* the tolerance in the path coordinate for drawing it with the given matrix
+ *
+ * @param matrix        the matrix
+ *
+ * @return              the tolerance, return zero if the matrix is degenerate
+ */
+gb_float_t              gb_path_lod_tolerance(gb_matrix_ref_t matrix);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
@@ -0,0 +1,212 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        path_op.c
+ * @ingroup     core
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "path_op"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "path_op.h"
+#include "bounds.h"
+#include "../path.h"
+#include "../../utils/tessellator.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the points grow
+#ifdef __gb_small__
+#   define GB_PATH_OP_POINTS_GROW       (64)
+#else
+#   define GB_PATH_OP_POINTS_GROW       (256)
+#endif
+
+// the counts grow
+#define GB_PATH_OP_COUNTS_GROW          (16)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the path operation type
+typedef struct __gb_path_op_t
+{
+    // the points of the boundary contours
+    tb_vector_ref_t             points;
+
+    // the counts of the boundary contours
+    tb_vector_ref_t             counts;
+
+    // reverse the appended contours?
+    tb_bool_t                   reverse;
+
+    // the result path
+    gb_path_ref_t               path;
+
+}gb_path_op_t, *gb_path_op_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_path_op_append(gb_point_ref_t points, tb_uint16_t count, tb_cpointer_t priv)
+{
+    // check
+    gb_path_op_ref_t op = (gb_path_op_ref_t)priv;
+    tb_assert(op && op->points && op->counts && points);
+
+    // the contour is closed and the last point is equal to the first point
+    tb_check_return(count > 3);
+
+    // append points, the reversed contour has the inverted winding
+    tb_uint16_t i;
+    if (op->reverse) for (i = count; i > 0; i--) tb_vector_insert_tail(op->points, points + i - 1);
+    else for (i = 0; i < count; i++) tb_vector_insert_tail(op->points, points + i);
+
+    // append count
+    tb_vector_insert_tail(op->counts, tb_u2p(count));
+}
+static tb_void_t gb_path_op_output(gb_point_ref_t points, tb_uint16_t count, tb_cpointer_t priv)
+{
+    // check
+    gb_path_op_ref_t op = (gb_path_op_ref_t)priv;
+    tb_assert(op && op->path && points);
+
+    // ignore the last point for closing the contour
+    if (count > 1 && gb_point_eq(points, points + count - 1)) count--;
+    tb_check_return(count > 2);
+
+    // add the closed contour
+    tb_uint16_t i;
+    gb_path_move_to(op->path, points);
+    for (i = 1; i < count; i++) gb_path_line_to(op->path, points + i);
+    gb_path_clos(op->path);
+}
+static tb_void_t gb_path_op_boundary(gb_tessellator_ref_t tessellator, gb_path_op_ref_t op, gb_path_ref_t path, tb_bool_t reverse)
+{
+    // check
+    tb_assert(tessellator && op && path);
+
+    // the empty path? nothing to append
+    gb_polygon_ref_t    polygon = gb_path_polygon(path);
+    gb_rect_ref_t       bounds = gb_path_bounds(path);
+    tb_check_return(polygon && bounds);
+
+    // append the boundary contours of this path
+    op->reverse = reverse;
+    gb_tessellator_done(tessellator, polygon, bounds);
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+tb_bool_t gb_path_op_done(gb_path_ref_t path, gb_path_ref_t other, tb_size_t op, tb_size_t rule)
+{
+    // check
+    tb_assert_and_check_return_val(path && other && op <= GB_PATH_OP_XOR, tb_false);
+
+    // done
+    tb_bool_t               ok = tb_false;
+    gb_path_op_t            data = {0};
+    gb_tessellator_ref_t    tessellator = tb_null;
+    do
+    {
+        // init points and counts
+        data.points = tb_vector_init(GB_PATH_OP_POINTS_GROW, tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
+        data.counts = tb_vector_init(GB_PATH_OP_COUNTS_GROW, tb_element_uint16());
+        tb_assert_and_check_break(data.points && data.counts);
+
+        // init tessellator
+        tessellator = gb_tessellator_init();
+        tb_assert_and_check_break(tessellator);
+
+        /* make the boundary contours of two paths
+         *
+         * the boundary contours are counter-clockwise and their inside points have the winding -1,
+         * and the contours of the other path are reversed for the difference, so its inside points have the winding 1
+         */
+        gb_tessellator_mode_set(tessellator, GB_TESSELLATOR_MODE_BOUNDARY);
+        gb_tessellator_rule_set(tessellator, rule);
+        gb_tessellator_func_set(tessellator, gb_path_op_append, &data);
+        gb_path_op_boundary(tessellator, &data, path, tb_false);
+        gb_path_op_boundary(tessellator, &data, other, op == GB_PATH_OP_DIFFERENCE);
+
+        // clear the result path
+        gb_path_clear(path);
+
+        // no contours? the result is empty
+        tb_size_t count = tb_vector_size(data.points);
+        if (!count)
+        {
+            ok = tb_true;
+            break;
+        }
+
+        // make the combined polygon, the tessellator needs the closed contours
+        tb_vector_insert_tail(data.counts, tb_u2p(0));
+        gb_polygon_t polygon = {(gb_point_ref_t)tb_vector_data(data.points), (tb_uint16_t*)tb_vector_data(data.counts), tb_false};
+
+        // make the bounds
+        gb_rect_t bounds;
+        gb_bounds_make(&bounds, polygon.points, count);
+
+        /* the rule of the operation for the winding of two paths: 
+         *
+         * union:       -1 + 0, 0 - 1, -1 - 1   => nonzero
+         * intersect:   -1 - 1                  => abs-geq-two
+         * difference:  -1 + 0                  => negative
+         * xor:         -1 + 0, 0 - 1           => odd
+         */
+        static tb_size_t s_rules[] =
+        {
+            GB_TESSELLATOR_RULE_NONZERO
+        ,   GB_TESSELLATOR_RULE_ABS_GEQ_TWO
+        ,   GB_TESSELLATOR_RULE_NEGATIVE
+        ,   GB_TESSELLATOR_RULE_ODD
+        };
+
+        // make the boundary contours of the combined polygon to the result path
+        data.path = path;
+        gb_tessellator_rule_set(tessellator, s_rules[op]);
+        gb_tessellator_func_set(tessellator, gb_path_op_output, &data);
+        gb_tessellator_done(tessellator, &polygon, &bounds);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // exit tessellator
+    if (tessellator) gb_tessellator_exit(tessellator);
+
+    // exit points and counts
+    if (data.points) tb_vector_exit(data.points);
+    if (data.counts) tb_vector_exit(data.counts);
+
+    // ok?
+    return ok;
+}
@@ -0,0 +1,59 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        path_op.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_PATH_OP_H
+#define GB_CORE_IMPL_PATH_OP_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* done the boolean operation of two paths: path = path op other
+ *
+ * the two paths are converted to the boundary contours by the tessellator at first,
+ * and then the combined contours are tessellated again by the winding rule of the operation.
+ *
+ * @param path          the path
+ * @param other         the other path, it can be the path self
+ * @param op            the operation
+ * @param rule          the fill rule of two paths
+ *
+ * @return              tb_true or tb_false
+ */
+tb_bool_t               gb_path_op_done(gb_path_ref_t path, gb_path_ref_t other, tb_size_t op, tb_size_t rule);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
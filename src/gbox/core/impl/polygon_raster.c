@@ -174,8 +174,28 @@ typedef struct __gb_polygon_raster_impl_t
     // the edge table maxn
     tb_size_t                       edge_table_maxn;
 
-    // the active edges
-    tb_uint16_t                     active_edges;
+    /* the active edges, be sorted by x and slope in ascending
+     *
+     * the fields are stored in the separate arrays for stepping all edges in a tight loop
+     */
+
+    // the x-coordinates of the active edges
+    tb_fixed_t*                     active_x;
+
+    // the slopes of the active edges
+    tb_fixed_t*                     active_slope;
+
+    // the bottom y-coordinates of the active edges
+    tb_int16_t*                     active_y_bottom;
+
+    // the windings of the active edges
+    tb_int8_t*                      active_winding;
+
+    // the active edges count
+    tb_size_t                       active_size;
+
+    // the active edges maxn
+    tb_size_t                       active_maxn;
 
     // the top of the polygon bounds
     tb_long_t                       top;
@@ -276,115 +296,116 @@ static tb_bool_t gb_polygon_raster_edge_table_make(gb_polygon_raster_impl_t* imp
     // init the edge pool
     if (!gb_polygon_raster_edge_pool_init(impl)) return tb_false; 
 
-    // init the edge table
-    if (!gb_polygon_raster_edge_table_init(impl, gb_round(bounds->y), gb_round(bounds->h) + 1)) return tb_false;
+    // init the edge table, the y-coordinates are rounded by the fixed-point as same as the edges
+    tb_long_t table_top     = tb_fixed6_round(gb_float_to_fixed6(bounds->y));
+    tb_long_t table_bottom  = tb_fixed6_round(gb_float_to_fixed6(bounds->y + bounds->h));
+    if (!gb_polygon_raster_edge_table_init(impl, table_top, table_bottom - table_top + 1)) return tb_false;
  
     // make the edge table
-    gb_point_t          pb;
-    gb_point_t          pe;
     tb_bool_t           first       = tb_true;
     tb_long_t           top         = 0;
     tb_long_t           bottom      = 0;
     tb_uint16_t         index       = 0;
     tb_long_t           table_index = 0;
+    tb_fixed6_t         xb          = 0;
+    tb_fixed6_t         yb          = 0;
+    tb_fixed6_t         xe          = 0;
+    tb_fixed6_t         ye          = 0;
+    tb_long_t           iyb         = 0;
+    tb_long_t           iye         = 0;
     gb_point_ref_t      points      = polygon->points;
     tb_uint16_t*        counts      = polygon->counts;
     tb_uint16_t         count       = *counts++;
     tb_uint16_t*        edge_table  = impl->edge_table;
     while (index < count)
     {
-        // the point
-        pe = *points++;
+        /* get the fixed-point coordinates of the end point
+         *
+         * each point is only converted once and the integer y-coordinate is rounded by the fixed-point, 
+         * so it is same for the fixed and float builds
+         */
+        xe  = gb_float_to_fixed6(points->x);
+        ye  = gb_float_to_fixed6(points->y);
+        iye = tb_fixed6_round(ye);
+        points++;
 
-        // exists edge?
-        if (index)
+        // exists edge and not horizontal edge?
+        if (index && iyb != iye)
         {
-            // get the integer y-coordinates
-            tb_long_t iyb = gb_round(pb.y);
-            tb_long_t iye = gb_round(pe.y);
+            // make a new edge from the edge pool
+            tb_uint16_t edge_index = gb_polygon_raster_edge_pool_aloc(impl);
+            tb_assert(edge_index);
+
+            // the edge
+            gb_polygon_raster_edge_ref_t edge = impl->edge_pool + edge_index;
+
+            // sort the points of the edge by the y-coordinate
+            tb_fixed6_t ex = xb;
+            tb_fixed6_t ey = yb;
+            tb_long_t   ie = iye;
+            tb_long_t   it = iyb;
+            if (yb > ye)
+            {
+                // reverse the edge points
+                ex = xe;
+                ey = ye;
+                ie = iyb;
+                it = iye;
+
+                // reverse the winding
+                edge->winding = -1;
+            }
+            // init the winding
+            else edge->winding = 1;
 
-            // not horizontal edge?
-            if (iyb != iye)
+            // compute the accurate bounds of the y-coordinate
+            if (first)
             {
-                // get the fixed-point coordinates
-                tb_fixed6_t xb = gb_float_to_fixed6(pb.x);
-                tb_fixed6_t yb = gb_float_to_fixed6(pb.y);
-                tb_fixed6_t xe = gb_float_to_fixed6(pe.x);
-                tb_fixed6_t ye = gb_float_to_fixed6(pe.y);
-
-                // compute the delta coordinates
-                tb_fixed6_t dx = xe - xb;
-                tb_fixed6_t dy = ye - yb;
-
-                // make a new edge from the edge pool
-                tb_uint16_t edge_index = gb_polygon_raster_edge_pool_aloc(impl);
-                tb_assert(edge_index);
-
-                // the edge
-                gb_polygon_raster_edge_ref_t edge = impl->edge_pool + edge_index;
-
-                // init the winding
-                edge->winding = 1;
-
-                // sort the points of the edge by the y-coordinate
-                if (yb > ye)
-                {
-                    // reverse the edge points
-                    tb_swap(tb_fixed6_t, xb, xe);
-                    tb_swap(tb_fixed6_t, yb, ye);
-                    tb_swap(tb_long_t, iyb, iye);
-
-                    // reverse the winding
-                    edge->winding = -1;
-                }
-
-                // compute the accurate bounds of the y-coordinate
-                if (first)
-                {
-                    top     = iyb;
-                    bottom  = iye;
-                    first   = tb_false;
-                }
-                else
-                {
-                    if (iyb < top)    top = iyb;
-                    if (iye > bottom) bottom = iye;
-                }
-
-                // check
-                tb_assert(iyb < iye);
-
-                // compute the slope 
-                edge->slope = tb_fixed6_div(dx, dy);
-
-                /* compute the more accurate start x-coordinate
-                 *
-                 * xb + (iyb - yb + 0.5) * dx / dy
-                 * => xb + ((0.5 - yb) % 1) * dx / dy
-                 */
-                edge->x = tb_fixed6_to_fixed(xb) + ((edge->slope * ((TB_FIXED6_HALF - yb) & 63)) >> 6);
+                top     = it;
+                bottom  = ie;
+                first   = tb_false;
+            }
+            else
+            {
+                if (it < top)    top = it;
+                if (ie > bottom) bottom = ie;
+            }
 
-                // init bottom y-coordinate
-                edge->y_bottom = (tb_int16_t)(iye - 1);
-                tb_assert(iye - 1 > TB_MINS16 && iye - 1 <= TB_MAXS16);
+            // check
+            tb_assert(it < ie);
 
-                // the table index
-                table_index = iyb - impl->edge_table_base;
-                tb_assert(table_index >= 0 && table_index < impl->edge_table_maxn);
-                
-                /* insert edge to the head of the edge table
-                 *
-                 * table[index]: => edge => edge => .. => 0
-                 *              |
-                 *            insert
-                 */
-                edge->next = edge_table[table_index];
-                edge_table[table_index] = edge_index;
-            }
+            // compute the slope 
+            edge->slope = (yb > ye)? tb_fixed6_div(xb - xe, yb - ye) : tb_fixed6_div(xe - xb, ye - yb);
+
+            /* compute the more accurate start x-coordinate
+             *
+             * xb + (iyb - yb + 0.5) * dx / dy
+             * => xb + ((0.5 - yb) % 1) * dx / dy
+             */
+            edge->x = tb_fixed6_to_fixed(ex) + ((edge->slope * ((TB_FIXED6_HALF - ey) & 63)) >> 6);
+
+            // init bottom y-coordinate
+            edge->y_bottom = (tb_int16_t)(ie - 1);
+            tb_assert(ie - 1 > TB_MINS16 && ie - 1 <= TB_MAXS16);
+
+            // the table index
+            table_index = it - impl->edge_table_base;
+            tb_assert(table_index >= 0 && table_index < impl->edge_table_maxn);
+            
+            /* insert edge to the head of the edge table
+             *
+             * table[index]: => edge => edge => .. => 0
+             *              |
+             *            insert
+             */
+            edge->next = edge_table[table_index];
+            edge_table[table_index] = edge_index;
         }
 
         // save the previous point
-        pb = pe;
+        xb  = xe;
+        yb  = ye;
+        iyb = iye;
         
         // next point
         index++;
@@ -405,99 +426,181 @@ static tb_bool_t gb_polygon_raster_edge_table_make(gb_polygon_raster_impl_t* imp
     // ok
     return tb_true;
 }
-static tb_void_t gb_polygon_raster_active_scan_line_convex(gb_polygon_raster_impl_t* impl, tb_long_t y, gb_polygon_raster_func_t func, tb_cpointer_t priv)
+static tb_bool_t gb_polygon_raster_active_init(gb_polygon_raster_impl_t* impl, tb_size_t maxn)
 {
     // check
-    tb_assert(impl && impl->edge_pool && func);
+    tb_assert(impl && maxn);
 
-    // the edge index
-    tb_uint16_t index = impl->active_edges; 
-    tb_check_return(index);
+    // enough?
+    tb_check_return_val(maxn > impl->active_maxn, tb_true);
 
-    // the edge
-    gb_polygon_raster_edge_ref_t edge = impl->edge_pool + index; 
+    // grow the active edges
+    impl->active_maxn       = maxn + (GB_POLYGON_RASTER_EDGES_GROW >> 2);
+    impl->active_x          = tb_ralloc_type(impl->active_x, impl->active_maxn, tb_fixed_t);
+    impl->active_slope      = tb_ralloc_type(impl->active_slope, impl->active_maxn, tb_fixed_t);
+    impl->active_y_bottom   = tb_ralloc_type(impl->active_y_bottom, impl->active_maxn, tb_int16_t);
+    impl->active_winding    = tb_ralloc_type(impl->active_winding, impl->active_maxn, tb_int8_t);
+    tb_assert_and_check_return_val(impl->active_x && impl->active_slope && impl->active_y_bottom && impl->active_winding, tb_false);
 
-    // the next edge index
-    tb_uint16_t index_next = edge->next; 
-    tb_check_return(index_next);
+    // ok
+    return tb_true;
+}
+static tb_void_t gb_polygon_raster_active_exit(gb_polygon_raster_impl_t* impl)
+{
+    // check
+    tb_assert(impl);
 
-    // the next edge
-    gb_polygon_raster_edge_ref_t edge_next = impl->edge_pool + index_next; 
+    // exit the active edges
+    if (impl->active_x) tb_free(impl->active_x);
+    if (impl->active_slope) tb_free(impl->active_slope);
+    if (impl->active_y_bottom) tb_free(impl->active_y_bottom);
+    if (impl->active_winding) tb_free(impl->active_winding);
+    impl->active_x          = tb_null;
+    impl->active_slope      = tb_null;
+    impl->active_y_bottom   = tb_null;
+    impl->active_winding    = tb_null;
+    impl->active_size       = 0;
+    impl->active_maxn       = 0;
+}
+static tb_void_t gb_polygon_raster_active_insert(gb_polygon_raster_impl_t* impl, tb_size_t index, tb_fixed_t x, tb_fixed_t slope, tb_int16_t y_bottom, tb_int8_t winding)
+{
+    // check
+    tb_assert(impl && index < impl->active_maxn);
 
+    // the active edges
+    tb_fixed_t*     active_x        = impl->active_x;
+    tb_fixed_t*     active_slope    = impl->active_slope;
+    tb_int16_t*     active_y_bottom = impl->active_y_bottom;
+    tb_int8_t*      active_winding  = impl->active_winding;
+
+    /* move the greater edges backward and insert this edge by x and slope in ascending
+     *
+     * x: 1 2 3     5 6
+     *               |
+     *             4 or 5
+     *
+     * if the edges have the same vertex, the edge with the smaller slope (dx / dy) is at the left-hand 
+     *
+     * x: 1 2 3     5 6 
+     *               |   .
+     *               5    .
+     *             .       .
+     *           .          .
+     *         .        active_edge
+     *       .
+     *     edge
+     */
+    while (index && (active_x[index - 1] > x || (active_x[index - 1] == x && active_slope[index - 1] > slope)))
+    {
+        active_x[index]         = active_x[index - 1];
+        active_slope[index]     = active_slope[index - 1];
+        active_y_bottom[index]  = active_y_bottom[index - 1];
+        active_winding[index]   = active_winding[index - 1];
+        index--;
+    }
+
+    // insert it
+    active_x[index]         = x;
+    active_slope[index]     = slope;
+    active_y_bottom[index]  = y_bottom;
+    active_winding[index]   = winding;
+}
+static tb_void_t gb_polygon_raster_active_append(gb_polygon_raster_impl_t* impl, tb_uint16_t index)
+{
     // check
-    tb_assert(edge->x < edge_next->x || tb_fixed_abs(edge->x - edge_next->x) <= TB_FIXED_HALF);
+    tb_assert(impl && impl->edge_pool);
 
-    // trace
-    tb_trace_d("y: %ld, %{fixed} => %{fixed}", y, edge->x, edge_next->x);
+    // insert the edges of the edge table to the sorted active edges
+    gb_polygon_raster_edge_ref_t edge = tb_null;
+    gb_polygon_raster_edge_ref_t edge_pool = impl->edge_pool;
+    while (index)
+    {
+        // the edge
+        edge = edge_pool + index;
 
-    // init the end y-coordinate for the only one line
-    tb_long_t ye = y + 1;
+        // insert it
+        gb_polygon_raster_active_insert(impl, impl->active_size++, edge->x, edge->slope, edge->y_bottom, edge->winding);
 
-    /* scan rect region? may be faster
+        // the next edge index
+        index = edge->next;
+    }
+}
+static tb_void_t gb_polygon_raster_active_sort(gb_polygon_raster_impl_t* impl)
+{
+    // check
+    tb_assert(impl);
+
+    /* sort the active edges by x and slope in ascending using the insertion sort
      *
-     * |    | 
-     * |    |
-     * |    |
+     * only few edges are crossed between the adjacent scan-lines,
+     * so the active edges are almost sorted and it is nearly O(n)
      */
-    if (tb_fixed_abs(edge->slope) <= TB_FIXED_NEAR0 && tb_fixed_abs(edge_next->slope) <= TB_FIXED_NEAR0)        
+    tb_size_t       i = 1;
+    tb_size_t       n = impl->active_size;
+    tb_fixed_t*     active_x = impl->active_x;
+    tb_fixed_t*     active_slope = impl->active_slope;
+    for (i = 1; i < n; i++)
     {
-        // get the min and max edge for the y-bottom
-        gb_polygon_raster_edge_ref_t    edge_min    = edge; 
-        gb_polygon_raster_edge_ref_t    edge_max    = edge_next; 
-        tb_uint16_t                     index_max   = index_next;
-        if (edge_min->y_bottom > edge_max->y_bottom)
-        {
-            edge_min    = edge_next; 
-            edge_max    = edge; 
-            index_max   = index;
-        }
+        // need sort?
+        if (active_x[i - 1] > active_x[i] || (active_x[i - 1] == active_x[i] && active_slope[i - 1] > active_slope[i]))
+            gb_polygon_raster_active_insert(impl, i, active_x[i], active_slope[i], impl->active_y_bottom[i], impl->active_winding[i]);
+    }
+}
+static tb_long_t gb_polygon_raster_active_scan_line_convex(gb_polygon_raster_impl_t* impl, tb_long_t y, gb_polygon_raster_func_t func, tb_cpointer_t priv)
+{
+    // check
+    tb_assert(impl && func);
 
-        // compute the ye
-        ye = edge_min->y_bottom + 1;
+    // only one line
+    tb_long_t ye = y + 1;
 
-        // clear the active edges, only two edges
-        impl->active_edges = 0;
+    // the convex polygon has only two active edges
+    tb_check_return_val(impl->active_size > 1, ye);
 
-        // re-insert the max edge to the edge table using the new top-y coordinate
-        if (ye < edge_max->y_bottom)
-        {
-            // check
-            tb_assert(ye >= impl->edge_table_base && ye - impl->edge_table_base < impl->edge_table_maxn);
+    // the active edges
+    tb_fixed_t* active_x        = impl->active_x;
+    tb_fixed_t* active_slope    = impl->active_slope;
 
-            /* re-insert to the edge table using the new top-y coordinate
-             *
-             * table[index]: => edge => edge => .. => 0
-             *              |
-             *            insert
-             */
-            edge_max->next = impl->edge_table[ye - impl->edge_table_base];
-            impl->edge_table[ye - impl->edge_table_base] = index_max;
-        }
-    }
+    // check
+    tb_assert(active_x[0] < active_x[1] || tb_fixed_abs(active_x[0] - active_x[1]) <= TB_FIXED_HALF);
+
+    // trace
+    tb_trace_d("y: %ld, %{fixed} => %{fixed}", y, active_x[0], active_x[1]);
+
+    /* scan rect region? may be faster
+     *
+     * |    | 
+     * |    |
+     * |    |
+     *
+     * the next lines until the shorter edge end will be skipped
+     */
+    if (tb_fixed_abs(active_slope[0]) <= TB_FIXED_NEAR0 && tb_fixed_abs(active_slope[1]) <= TB_FIXED_NEAR0)        
+        ye = tb_min(impl->active_y_bottom[0], impl->active_y_bottom[1]) + 1;
 
     // done it
-    func(tb_fixed_round(edge->x), tb_fixed_round(edge_next->x), y, ye, priv);
+    func(tb_fixed_round(active_x[0]), tb_fixed_round(active_x[1]), y, ye, priv);
+
+    // the end y-coordinate
+    return ye;
 }
 static tb_void_t gb_polygon_raster_active_scan_line_concave(gb_polygon_raster_impl_t* impl, tb_long_t y, tb_size_t rule, gb_polygon_raster_func_t func, tb_cpointer_t priv)
 {
     // check
-    tb_assert(impl && impl->edge_pool && func);
+    tb_assert(impl && func);
 
     // done
-    tb_long_t                       done            = 0;
-    tb_long_t                       winding         = 0; 
-    tb_uint16_t                     index           = impl->active_edges; 
-    tb_uint16_t                     index_next      = 0; 
-    gb_polygon_raster_edge_ref_t    edge            = tb_null; 
-    gb_polygon_raster_edge_ref_t    edge_next       = tb_null; 
-    gb_polygon_raster_edge_ref_t    edge_cache      = tb_null; 
-    gb_polygon_raster_edge_ref_t    edge_cache_next = tb_null; 
-    gb_polygon_raster_edge_ref_t    edge_pool       = impl->edge_pool;
-    while (index) 
+    tb_long_t       done            = 0;
+    tb_long_t       winding         = 0; 
+    tb_size_t       index           = 0; 
+    tb_size_t       count           = impl->active_size;
+    tb_long_t       cache_lx        = 0;
+    tb_long_t       cache_rx        = 0;
+    tb_bool_t       cache_ok        = tb_false;
+    tb_fixed_t*     active_x        = impl->active_x;
+    tb_int8_t*      active_winding  = impl->active_winding;
+    for (index = 0; index + 1 < count; index++) 
     { 
-        // the edge
-        edge = edge_pool + index; 
-
         /* compute the winding
          *   
          *    /\
@@ -507,17 +610,10 @@ static tb_void_t gb_polygon_raster_active_scan_line_concave(gb_polygon_raster_im
          *    |            |
          *                \/
          */
-        winding += edge->winding; 
-
-        // the next edge index
-        index_next = edge->next; 
-        tb_check_break(index_next);
-
-        // the next edge
-        edge_next = edge_pool + index_next; 
+        winding += active_winding[index]; 
 
         // check
-        tb_assert(edge->x <= edge_next->x);
+        tb_assert(active_x[index] <= active_x[index + 1]);
 
         // compute the rule
         switch (rule)
@@ -568,70 +664,57 @@ static tb_void_t gb_polygon_raster_active_scan_line_concave(gb_polygon_raster_im
         }
 
         // trace
-        tb_trace_d("y: %ld, winding: %ld, %{fixed} => %{fixed}", y, winding, edge->x, edge_next->x);
+        tb_trace_d("y: %ld, winding: %ld, %{fixed} => %{fixed}", y, winding, active_x[index], active_x[index + 1]);
 
-#if 0
-        // done it for winding?
-        if (done) func(tb_fixed_round(edge->x), tb_fixed_round(edge_next->x), y, y + 1, priv);
-#else
-        // cache the conjoint edges and done them together
+        // cache the conjoint spans and done them together
         if (done)
         {
-            // no edge cache?
-            if (!edge_cache && !edge_cache_next) 
+            // the span
+            tb_long_t lx = tb_fixed_round(active_x[index]);
+            tb_long_t rx = tb_fixed_round(active_x[index + 1]);
+
+            // no span cache?
+            if (!cache_ok) 
             {
-                // init edge cache
-                edge_cache = edge;
-                edge_cache_next = edge_next;
+                // init span cache
+                cache_lx = lx;
+                cache_rx = rx;
+                cache_ok = tb_true;
             }
             // is conjoint? merge it
-            else if (edge_cache_next && tb_fixed_round(edge_cache_next->x) == tb_fixed_round(edge->x))
-            {
-                // merge the edges to the edge cache
-                edge_cache_next = edge_next;
-            }
+            else if (cache_rx == lx) cache_rx = rx;
             else
             {
-                // check
-                tb_assert(edge_cache && edge_cache_next);
-
-                // done edge cache
-                func(tb_fixed_round(edge_cache->x), tb_fixed_round(edge_cache_next->x), y, y + 1, priv);
+                // done span cache
+                func(cache_lx, cache_rx, y, y + 1, priv);
 
-                // update edge cache
-                edge_cache = edge;
-                edge_cache_next = edge_next;
+                // update span cache
+                cache_lx = lx;
+                cache_rx = rx;
             }
         }
-#endif
-
-        // the next edge index
-        index = index_next; 
     }
 
-    // done the left edge cache
-    if (edge_cache && edge_cache_next) func(tb_fixed_round(edge_cache->x), tb_fixed_round(edge_cache_next->x), y, y + 1, priv);
+    // done the left span cache
+    if (cache_ok) func(cache_lx, cache_rx, y, y + 1, priv);
 }
-static tb_void_t gb_polygon_raster_active_scan_next(gb_polygon_raster_impl_t* impl, tb_long_t y, tb_size_t* porder)
+static tb_void_t gb_polygon_raster_active_scan_next(gb_polygon_raster_impl_t* impl, tb_long_t y)
 {
     // check
-    tb_assert(impl && impl->edge_pool && impl->edge_table && y <= impl->bottom);
+    tb_assert(impl && y <= impl->bottom);
 
     // done
-    tb_size_t                       first = 1;
-    tb_size_t                       order = 1;
-    tb_fixed_t                      x_prev = 0;
-    tb_uint16_t                     index_prev = 0;
-    tb_uint16_t                     index = impl->active_edges;
-    gb_polygon_raster_edge_ref_t    edge = tb_null; 
-    gb_polygon_raster_edge_ref_t    edge_prev = tb_null; 
-    gb_polygon_raster_edge_ref_t    edge_pool = impl->edge_pool;
-    tb_uint16_t                     active_edges = impl->active_edges;
-    while (index)
+    tb_bool_t       order           = tb_true;
+    tb_size_t       index           = 0;
+    tb_size_t       count           = impl->active_size;
+    tb_size_t       active_size     = 0;
+    tb_fixed_t      x               = 0;
+    tb_fixed_t*     active_x        = impl->active_x;
+    tb_fixed_t*     active_slope    = impl->active_slope;
+    tb_int16_t*     active_y_bottom = impl->active_y_bottom;
+    tb_int8_t*      active_winding  = impl->active_winding;
+    for (index = 0; index < count; index++)
     {
-        // the edge
-        edge = edge_pool + index;
-
         /* remove edge from the active edges if (y >= edge->y_bottom)
          *            
          *             .
@@ -643,280 +726,30 @@ static tb_void_t gb_polygon_raster_active_scan_next(gb_polygon_raster_impl_t* im
          *          .   .   
          *            .      <- bottom
          */
-        if (edge->y_bottom < y + 1)
-        {
-            // the next edge index
-            index = edge->next;
-
-            // remove this edge from head
-            if (!index_prev) active_edges = index;
-            else 
-            {
-                // the previous edge 
-                edge_prev = edge_pool + index_prev;
-
-                // remove this edge from the body
-                edge_prev->next = index;
-            }
-
-            // continue 
-            continue;
-        }
+        if (active_y_bottom[index] < y + 1) continue;
 
         // update the x-coordinate
-        edge->x += edge->slope;
+        x = active_x[index] + active_slope[index];
 
         // is order?
-        if (porder)
-        {
-            if (first) first = 0;
-            else if (order && edge->x < x_prev) order = 0;
-        }
-
-        // update the previous x-coordinate
-        x_prev = edge->x;
-
-        // update the previous edge index
-        index_prev = index;
-
-        // update the edge index
-        index = edge->next;
-    }
-
-    // save order
-    if (porder) *porder = order; 
-
-    // update the active edges 
-    impl->active_edges = active_edges;
-}
-static tb_void_t gb_polygon_raster_active_append(gb_polygon_raster_impl_t* impl, tb_uint16_t index)
-{
-    // check
-    tb_assert(impl && impl->edge_pool);
-
-    // done
-    tb_uint16_t                     next = 0;
-    gb_polygon_raster_edge_ref_t    edge = tb_null;
-    gb_polygon_raster_edge_ref_t    edge_pool = impl->edge_pool;
-    tb_uint16_t                     active_edges = impl->active_edges;
-    while (index)
-    {
-        // the edge
-        edge = edge_pool + index;
-
-        // save the next edge index
-        next = edge->next;
-
-        // insert the edge to the head of the active edges
-        edge->next = active_edges;
-        active_edges = index;
-
-        // the next edge index
-        index = next;
-    }
-
-    // update the active edges 
-    impl->active_edges = active_edges;
-}
-static tb_void_t gb_polygon_raster_active_sorted_insert(gb_polygon_raster_impl_t* impl, tb_uint16_t edge_index)
-{
-    // check
-    tb_assert(impl && impl->edge_pool && edge_index);
-
-    // the edge pool
-    gb_polygon_raster_edge_ref_t edge_pool = impl->edge_pool;
+        if (order && active_size && (x < active_x[active_size - 1] || (x == active_x[active_size - 1] && active_slope[index] < active_slope[active_size - 1])))
+            order = tb_false;
 
-    // the edge
-    gb_polygon_raster_edge_ref_t edge = edge_pool + edge_index;
-
-    // insert edge to the active edges by x in ascending
-    edge->next = 0;
-    if (!impl->active_edges) impl->active_edges = edge_index;
-    else 
-    {
-        // find an inserted position
-        gb_polygon_raster_edge_ref_t    edge_prev       = tb_null;
-        gb_polygon_raster_edge_ref_t    edge_active     = tb_null;
-        tb_uint16_t                     index_active    = impl->active_edges;
-        while (index_active)
+        // move the edge forward if some edges have been removed
+        if (active_size != index)
         {
-            // the active edge
-            edge_active = edge_pool + index_active;
-
-            // check
-            tb_assert(edge_index != index_active);
-
-            /* is this?
-             *
-             * x: 1 2 3     5 6
-             *               |
-             *             4 or 5
-             */
-            if (edge->x <= edge_active->x) 
-            {
-                /* same vertex?
-                 *
-                 *
-                 * x: 1 2 3     5 6
-                 *               |   .
-                 *               5    .
-                 *             .       .
-                 *           .          .
-                 *         .          active_edge
-                 *       .
-                 *     edge
-                 *
-                 * x: 1 2 3   5         6
-                 *                 .    |
-                 *                  .   5
-                 *                   .    .
-                 *                    .     .
-                 *          active_edge       .
-                 *                              . 
-                 *                                .  
-                 *                                  .
-                 *                                   edge
-                 *
-                 *  x: 1 2 3   5         6
-                 *                 .    |
-                 *                .     5
-                 *              .    .
-                 *            .     .
-                 *  active_edge    .
-                 *                . 
-                 *               .  
-                 *              .
-                 *             edge
-                 *
-                 *
-                 * x: 1 2 3     5 6
-                 *               |   .
-                 *               5      .
-                 *                 .       .
-                 *                   .       active_edge 
-                 *                     .           
-                 *                       .
-                 *                         .
-                 *                           .
-                 *                             .
-                 *                               .
-                 *                                 .
-                 *                                 edge
-                 */
-                if (edge->x == edge_active->x)
-                {
-                    /* the edge is at the left-hand of the active edge?
-                     * 
-                     * x: 1 2 3     5 6    <- active_edges
-                     *               |   .
-                     *               5    .
-                     *             .       .
-                     *           .          .
-                     *         .        active_edge
-                     *       .
-                     *     edge
-                     *
-                     * if (edge->dx / edge->dy < active->dx / active->dy)?
-                     */
-                    if (edge->slope < edge_active->slope) break;
-                }
-                else break;
-            }
-            
-            // the previous active edge
-            edge_prev = edge_active;
-
-            // the next active edge index
-            index_active = edge_prev->next;
-        }
-
-        // insert edge to the active edges: edge_prev -> edge -> edge_active
-        if (!edge_prev)
-        {
-            // insert to the head
-            edge->next          = impl->active_edges;
-            impl->active_edges  = edge_index;
-        }
-        else
-        {
-            // insert to the body
-            edge->next      = index_active;
-            edge_prev->next = edge_index;
+            active_slope[active_size]       = active_slope[index];
+            active_y_bottom[active_size]    = active_y_bottom[index];
+            active_winding[active_size]     = active_winding[index];
         }
+        active_x[active_size++] = x;
     }
-}
-static tb_void_t gb_polygon_raster_active_sorted_append(gb_polygon_raster_impl_t* impl, tb_uint16_t edge_index)
-{
-    // check
-    tb_assert(impl && impl->edge_pool);
 
-    // done
-    tb_uint16_t                     index_next = 0;
-    gb_polygon_raster_edge_ref_t    edge = tb_null;
-    gb_polygon_raster_edge_ref_t    edge_pool = impl->edge_pool;
-    while (edge_index)
-    {
-        // the edge
-        edge = edge_pool + edge_index;
-
-        // save the next edge index
-        index_next = edge->next;
+    // update the active edges count
+    impl->active_size = active_size;
 
-        // insert the edge to the active edges
-        gb_polygon_raster_active_sorted_insert(impl, edge_index);
-
-        // the next edge index
-        edge_index = index_next;
-    }
-}
-static tb_void_t gb_polygon_raster_active_sort(gb_polygon_raster_impl_t* impl)
-{
-    // check
-    tb_assert(impl && impl->edge_pool);
-
-    // done
-    tb_uint16_t                     index       = impl->active_edges;
-    tb_uint16_t                     index_next  = 0;
-    gb_polygon_raster_edge_ref_t    edge        = tb_null;
-    gb_polygon_raster_edge_ref_t    edge_next   = tb_null;
-    gb_polygon_raster_edge_t        edge_tmp;
-    gb_polygon_raster_edge_ref_t    edge_pool   = impl->edge_pool;
-    while (index)
-    {
-        // the edge
-        edge = edge_pool + index;
-
-        // the next edge index
-        index_next = edge->next;
-        while (index_next)
-        {
-            // the next edge
-            edge_next = edge_pool + index_next;
-
-            // need sort? swap them
-            if (edge->x > edge_next->x || (edge->x == edge_next->x && edge->slope > edge_next->slope))
-            {
-                // save the edge
-                edge_tmp = *edge;
-
-                // swap the edge
-                *edge = *edge_next;
-
-                // restore the next index
-                edge->next = edge_tmp.next;
-                edge_tmp.next = edge_next->next;
-
-                // swap the next edge
-                *edge_next = edge_tmp;
-            }
-        
-            // the next edge index
-            index_next = edge_next->next;
-        }
-
-        // the next edge index
-        index = edge->next;
-    }
+    // the crossed edges have been unordered? sort them
+    if (!order) gb_polygon_raster_active_sort(impl);
 }
 static tb_void_t gb_polygon_raster_done_convex(gb_polygon_raster_impl_t* impl, gb_polygon_ref_t polygon, gb_rect_ref_t bounds, gb_polygon_raster_func_t func, tb_cpointer_t priv)
 {
@@ -924,30 +757,34 @@ static tb_void_t gb_polygon_raster_done_convex(gb_polygon_raster_impl_t* impl, g
     tb_assert(impl && polygon && polygon->convex && bounds);
 
     // init the active edges
-    impl->active_edges = 0;
+    impl->active_size = 0;
 
     // make the edge table
     if (!gb_polygon_raster_edge_table_make(impl, polygon, bounds)) return ;
 
+    // init the active edges for all edges
+    if (!gb_polygon_raster_active_init(impl, impl->edge_pool_size)) return ;
+
     // done scan
     tb_long_t       y;
+    tb_long_t       ye          = 0;
     tb_long_t       top         = impl->top; 
     tb_long_t       bottom      = impl->bottom; 
     tb_long_t       base        = impl->edge_table_base; 
     tb_uint16_t*    edge_table  = impl->edge_table;
-    for (y = top; y < bottom; y++)
+    for (y = top, ye = top; y < bottom; y++)
     {
         // append edges to the sorted active edges by x in ascending
-        gb_polygon_raster_active_sorted_append(impl, edge_table[y - base]); 
+        gb_polygon_raster_active_append(impl, edge_table[y - base]); 
 
-        // scan line from the active edges
-        gb_polygon_raster_active_scan_line_convex(impl, y, func, priv); 
+        // scan line from the active edges if the previous rect region has been done
+        if (y >= ye) ye = gb_polygon_raster_active_scan_line_convex(impl, y, func, priv); 
 
         // end?
         tb_check_break(y < bottom - 1);
 
         // scan the next line from the active edges
-        gb_polygon_raster_active_scan_next(impl, y, tb_null); 
+        gb_polygon_raster_active_scan_next(impl, y); 
     }
 }
 static tb_void_t gb_polygon_raster_done_concave(gb_polygon_raster_impl_t* impl, gb_polygon_ref_t polygon, gb_rect_ref_t bounds, tb_size_t rule, gb_polygon_raster_func_t func, tb_cpointer_t priv)
@@ -956,30 +793,24 @@ static tb_void_t gb_polygon_raster_done_concave(gb_polygon_raster_impl_t* impl,
     tb_assert(impl && polygon && !polygon->convex && bounds);
 
     // init the active edges
-    impl->active_edges = 0;
+    impl->active_size = 0;
 
     // make the edge table
     if (!gb_polygon_raster_edge_table_make(impl, polygon, bounds)) return ;
 
+    // init the active edges for all edges
+    if (!gb_polygon_raster_active_init(impl, impl->edge_pool_size)) return ;
+
     // done scan
     tb_long_t       y;
-    tb_size_t       order       = 1; 
     tb_long_t       top         = impl->top; 
     tb_long_t       bottom      = impl->bottom; 
     tb_long_t       base        = impl->edge_table_base; 
     tb_uint16_t*    edge_table  = impl->edge_table;
     for (y = top; y < bottom; y++)
     {
-        // order? append edges to the sorted active edges by x in ascending
-        if (order) gb_polygon_raster_active_sorted_append(impl, edge_table[y - base]); 
-        else
-        {
-            // append edges to the active edges from the edge table
-            gb_polygon_raster_active_append(impl, edge_table[y - base]); 
-
-            // sort by x in ascending at the active edges
-            gb_polygon_raster_active_sort(impl); 
-        }
+        // append edges to the sorted active edges by x in ascending
+        gb_polygon_raster_active_append(impl, edge_table[y - base]); 
 
         // scan line from the active edges
         gb_polygon_raster_active_scan_line_concave(impl, y, rule, func, priv); 
@@ -987,11 +818,10 @@ static tb_void_t gb_polygon_raster_done_concave(gb_polygon_raster_impl_t* impl,
         // end?
         tb_check_break(y < bottom - 1);
 
-        // scan the next line from the active edges
-        gb_polygon_raster_active_scan_next(impl, y, &order); 
+        // scan the next line from the active edges and keep them sorted
+        gb_polygon_raster_active_scan_next(impl, y); 
     }
 }
-
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -1012,6 +842,9 @@ tb_void_t gb_polygon_raster_exit(gb_polygon_raster_ref_t raster)
     // exit the edge pool
     gb_polygon_raster_edge_pool_exit(impl);
 
+    // exit the active edges
+    gb_polygon_raster_active_exit(impl);
+
     // exit it
     tb_free(impl);
 }
@@ -0,0 +1,95 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        profiler.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_PROFILER_H
+#define GB_CORE_IMPL_PROFILER_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+#include "../context.h"
+#include "../profiler.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+/* the profiler of the context for the hot paths
+ *
+ * it is always null if not in the profile mode, 
+ * so the instrumentation will be removed by the compiler.
+ */
+#ifdef __gb_profile__
+#   define gb_profiler_hook(context)        gb_context_profiler(context)
+#else
+#   define gb_profiler_hook(context)        ((gb_profiler_ref_t)tb_null)
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * inline interfaces
+ */
+
+/* enter the stage
+ *
+ * @param profiler      the profiler, ignore it if be null
+ *
+ * @return              the start time
+ */
+static __tb_inline__ tb_hong_t gb_profiler_enter(gb_profiler_ref_t profiler)
+{
+    return profiler? tb_uclock() : 0;
+}
+
+/* leave the stage and add the spent time
+ *
+ * @param profiler      the profiler, ignore it if be null
+ * @param stage         the stage
+ * @param time          the start time
+ */
+static __tb_inline__ tb_void_t gb_profiler_leave(gb_profiler_ref_t profiler, tb_size_t stage, tb_hong_t time)
+{
+    if (profiler) gb_profiler_stage_add(profiler, stage, tb_uclock() - time);
+}
+
+/* add the count
+ *
+ * @param profiler      the profiler, ignore it if be null
+ * @param count         the count type
+ * @param value         the added value
+ */
+static __tb_inline__ tb_void_t gb_profiler_count(gb_profiler_ref_t profiler, tb_size_t count, tb_size_t value)
+{
+    if (profiler) gb_profiler_count_add(profiler, count, value);
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
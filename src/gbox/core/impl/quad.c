@@ -152,7 +152,16 @@ static gb_float_t gb_quad_find_max_curvature(gb_point_t const points[3])
         numer = -numer;
         denom = -denom;
     }
-    if (denom && numer < denom) factor = (gb_float_t)((numer / denom) << 16);
+
+    // scale them down for avoiding to overflow when shifting the numerator
+    while (numer > (TB_MAXS64 >> 16))
+    {
+        numer >>= 1;
+        denom >>= 1;
+    }
+
+    // the factor must be in range: [0, 1)
+    if (denom && numer < denom) factor = (gb_float_t)((numer << 16) / denom);
 #else
     gb_float_unit_divide(-(ax * bx + ay * by), bx * bx + by * by, &factor);
 #endif
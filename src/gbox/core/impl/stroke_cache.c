@@ -0,0 +1,367 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        stroke_cache.c
+ * @ingroup     core
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "stroke_cache"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "stroke_cache.h"
+#include "../path.h"
+#include "../paint.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the entries grow
+#ifdef __gb_small__
+#   define GB_STROKE_CACHE_ENTRIES_GROW     (64)
+#else
+#   define GB_STROKE_CACHE_ENTRIES_GROW     (256)
+#endif
+
+// the maximum strokes count of the same path, the oldest stroke will be removed if be out of it
+#define GB_STROKE_CACHE_STROKES_MAXN        (4)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the stroke cache entry type
+typedef struct __gb_stroke_cache_entry_t
+{
+    // the list entry, the least recently used entry is the head
+    tb_list_entry_t         entry;
+
+    // the next entry of the same path generation with the other stroke
+    struct __gb_stroke_cache_entry_t*   next;
+
+    // the path generation
+    tb_size_t               generation;
+
+    // the stroke width
+    gb_float_t              width;
+
+    // the stroke miter limit
+    gb_float_t              miter;
+
+    // the stroke cap
+    tb_uint8_t              cap;
+
+    // the stroke join
+    tb_uint8_t              join;
+
+    // the used memory size
+    tb_size_t               size;
+
+    // the stroked path, tb_null if the path has been stroked only once
+    gb_path_ref_t           stroked;
+
+}gb_stroke_cache_entry_t, *gb_stroke_cache_entry_ref_t;
+
+// the stroke cache impl type
+typedef struct __gb_stroke_cache_impl_t
+{
+    // the entries pool
+    tb_fixed_pool_ref_t     pool;
+
+    // the entries list
+    tb_list_entry_head_t    list;
+
+    // the entries hash, generation => the entries list of the different strokes
+    tb_hash_map_ref_t       hash;
+
+    // the used memory size
+    tb_size_t               size;
+
+    // the memory budget
+    tb_size_t               maxn;
+
+}gb_stroke_cache_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_stroke_cache_entry_exit(tb_pointer_t data, tb_cpointer_t priv)
+{
+    // check
+    gb_stroke_cache_entry_ref_t entry = (gb_stroke_cache_entry_ref_t)data;
+    tb_assert_and_check_return(entry);
+
+    // exit the stroked path
+    if (entry->stroked) gb_path_exit(entry->stroked);
+    entry->stroked = tb_null;
+}
+static tb_bool_t gb_stroke_cache_entry_same(gb_stroke_cache_entry_ref_t entry, gb_paint_ref_t paint)
+{
+    // the same stroke?
+    return (    entry->width == gb_paint_stroke_width(paint)
+            &&  entry->miter == gb_paint_stroke_miter(paint)
+            &&  entry->cap == (tb_uint8_t)gb_paint_stroke_cap(paint)
+            &&  entry->join == (tb_uint8_t)gb_paint_stroke_join(paint))? tb_true : tb_false;
+}
+static gb_stroke_cache_entry_ref_t gb_stroke_cache_entry_find(gb_stroke_cache_impl_t* impl, tb_size_t generation, gb_paint_ref_t paint)
+{
+    // find the entry of the same stroke from the entries of this path generation
+    gb_stroke_cache_entry_ref_t entry = (gb_stroke_cache_entry_ref_t)tb_hash_map_get(impl->hash, (tb_cpointer_t)generation);
+    while (entry && !gb_stroke_cache_entry_same(entry, paint)) entry = entry->next;
+
+    // ok?
+    return entry;
+}
+static tb_void_t gb_stroke_cache_entry_remove(gb_stroke_cache_impl_t* impl, gb_stroke_cache_entry_ref_t entry)
+{
+    // update the used size
+    tb_assert(impl->size >= entry->size);
+    impl->size -= entry->size;
+
+    // remove it from the entries of this path generation
+    gb_stroke_cache_entry_ref_t first = (gb_stroke_cache_entry_ref_t)tb_hash_map_get(impl->hash, (tb_cpointer_t)entry->generation);
+    if (first == entry)
+    {
+        if (entry->next) tb_hash_map_insert(impl->hash, (tb_cpointer_t)entry->generation, entry->next);
+        else tb_hash_map_remove(impl->hash, (tb_cpointer_t)entry->generation);
+    }
+    else
+    {
+        while (first && first->next != entry) first = first->next;
+        tb_assert(first);
+        if (first) first->next = entry->next;
+    }
+
+    // remove it from the list
+    tb_list_entry_remove(&impl->list, &entry->entry);
+
+    // exit it
+    tb_fixed_pool_free(impl->pool, entry);
+}
+static tb_size_t gb_stroke_cache_path_size(gb_path_ref_t path)
+{
+    // the polygon
+    gb_polygon_ref_t polygon = gb_path_polygon(path);
+    tb_check_return_val(polygon && polygon->counts, 0);
+
+    // the points count
+    tb_size_t           count = 0;
+    tb_size_t           contours = 1;
+    tb_uint16_t const*  counts = polygon->counts;
+    while (*counts) 
+    {
+        count += *counts++;
+        contours++;
+    }
+
+    // the approximate size: path points + polygon points + polygon counts
+    return sizeof(gb_stroke_cache_entry_t) + (count << 1) * sizeof(gb_point_t) + contours * sizeof(tb_uint16_t);
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_stroke_cache_ref_t gb_stroke_cache_init(tb_size_t maxn)
+{
+    // done
+    tb_bool_t               ok = tb_false;
+    gb_stroke_cache_impl_t* impl = tb_null;
+    do
+    {
+        // make cache
+        impl = tb_malloc0_type(gb_stroke_cache_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init budget
+        impl->maxn = maxn? maxn : GB_STROKE_CACHE_MAXN;
+
+        // init pool
+        impl->pool = tb_fixed_pool_init(tb_null, GB_STROKE_CACHE_ENTRIES_GROW, sizeof(gb_stroke_cache_entry_t), tb_null, gb_stroke_cache_entry_exit, (tb_cpointer_t)impl);
+        tb_assert_and_check_break(impl->pool);
+
+        // init list
+        tb_list_entry_init(&impl->list, gb_stroke_cache_entry_t, entry, tb_null);
+
+        // init hash
+        impl->hash = tb_hash_map_init(TB_HASH_MAP_BUCKET_SIZE_SMALL, tb_element_size(), tb_element_ptr(tb_null, tb_null));
+        tb_assert_and_check_break(impl->hash);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_stroke_cache_exit((gb_stroke_cache_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_stroke_cache_ref_t)impl;
+}
+tb_void_t gb_stroke_cache_exit(gb_stroke_cache_ref_t cache)
+{
+    // check
+    gb_stroke_cache_impl_t* impl = (gb_stroke_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl);
+
+    // exit hash
+    if (impl->hash) tb_hash_map_exit(impl->hash);
+    impl->hash = tb_null;
+
+    // exit list
+    tb_list_entry_exit(&impl->list);
+
+    // exit pool
+    if (impl->pool) tb_fixed_pool_exit(impl->pool);
+    impl->pool = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_void_t gb_stroke_cache_clear(gb_stroke_cache_ref_t cache)
+{
+    // check
+    gb_stroke_cache_impl_t* impl = (gb_stroke_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl);
+
+    // clear hash
+    if (impl->hash) tb_hash_map_clear(impl->hash);
+
+    // clear list
+    tb_list_entry_clear(&impl->list);
+
+    // clear pool
+    if (impl->pool) tb_fixed_pool_clear(impl->pool);
+
+    // clear size
+    impl->size = 0;
+}
+gb_path_ref_t gb_stroke_cache_get(gb_stroke_cache_ref_t cache, gb_paint_ref_t paint, gb_path_ref_t path)
+{
+    // check
+    gb_stroke_cache_impl_t* impl = (gb_stroke_cache_impl_t*)cache;
+    tb_assert_and_check_return_val(impl && impl->hash && paint && path, tb_null);
+
+    // get entry
+    gb_stroke_cache_entry_ref_t entry = gb_stroke_cache_entry_find(impl, gb_path_generation(path), paint);
+    tb_check_return_val(entry && entry->stroked, tb_null);
+
+    // move it to the tail as the most recently used entry
+    tb_list_entry_moveto_tail(&impl->list, &entry->entry);
+
+    // ok
+    return entry->stroked;
+}
+gb_path_ref_t gb_stroke_cache_add(gb_stroke_cache_ref_t cache, gb_paint_ref_t paint, gb_path_ref_t path, gb_path_ref_t stroked)
+{
+    // check
+    gb_stroke_cache_impl_t* impl = (gb_stroke_cache_impl_t*)cache;
+    tb_assert_and_check_return_val(impl && impl->hash && paint && path, stroked);
+
+    // null?
+    tb_check_return_val(stroked && !gb_path_null(stroked), stroked);
+
+    // the generation
+    tb_size_t generation = gb_path_generation(path);
+
+    // get entry
+    gb_stroke_cache_entry_ref_t entry = gb_stroke_cache_entry_find(impl, generation, paint);
+
+    /* the first stroking for this path and stroke? 
+     *
+     * the same path may be stroked with the different paints, e.g. an outline under a thinner highlight,
+     * so the entries of the other strokes are kept in the list of this path generation
+     */
+    if (!entry)
+    {
+        // too many strokes for this path? remove the oldest one, e.g. the stroke width is animated
+        tb_size_t                   count = 0;
+        gb_stroke_cache_entry_ref_t last = (gb_stroke_cache_entry_ref_t)tb_hash_map_get(impl->hash, (tb_cpointer_t)generation);
+        while (last && last->next) 
+        {
+            last = last->next;
+            count++;
+        }
+        if (last && count + 1 >= GB_STROKE_CACHE_STROKES_MAXN) gb_stroke_cache_entry_remove(impl, last);
+
+        // make entry
+        entry = (gb_stroke_cache_entry_ref_t)tb_fixed_pool_malloc0(impl->pool);
+        tb_assert_and_check_return_val(entry, stroked);
+
+        // init entry, only mark it and not copy the stroked path
+        entry->generation   = generation;
+        entry->width        = gb_paint_stroke_width(paint);
+        entry->miter        = gb_paint_stroke_miter(paint);
+        entry->cap          = (tb_uint8_t)gb_paint_stroke_cap(paint);
+        entry->join         = (tb_uint8_t)gb_paint_stroke_join(paint);
+        entry->size         = sizeof(gb_stroke_cache_entry_t);
+
+        // add entry
+        entry->next         = (gb_stroke_cache_entry_ref_t)tb_hash_map_get(impl->hash, (tb_cpointer_t)generation);
+        tb_hash_map_insert(impl->hash, (tb_cpointer_t)generation, entry);
+        tb_list_entry_insert_tail(&impl->list, &entry->entry);
+        impl->size += entry->size;
+    }
+    // stroked again and not cached? copy it 
+    else if (!entry->stroked)
+    {
+        // the used size, the polygon of the stroked path will be used for filling it later
+        tb_size_t size = gb_stroke_cache_path_size(stroked);
+        tb_check_return_val(size && size <= (impl->maxn >> 2), stroked);
+
+        // make the stroked path
+        gb_path_ref_t copied = gb_path_init();
+        tb_assert_and_check_return_val(copied, stroked);
+
+        // copy it
+        gb_path_copy(copied, stroked);
+
+        // save it
+        entry->stroked = copied;
+        impl->size += size - entry->size;
+        entry->size = size;
+
+        // move it to the tail as the most recently used entry
+        tb_list_entry_moveto_tail(&impl->list, &entry->entry);
+    }
+
+    // remove the least recently used entries if be out of the budget
+    while (impl->size > impl->maxn && tb_list_entry_size(&impl->list) > 1)
+    {
+        // the head entry
+        gb_stroke_cache_entry_ref_t head = (gb_stroke_cache_entry_ref_t)tb_list_entry(&impl->list, tb_list_entry_head(&impl->list));
+        tb_assert_and_check_break(head && head != entry);
+
+        // remove it
+        gb_stroke_cache_entry_remove(impl, head);
+    }
+
+    // ok
+    return entry->stroked? entry->stroked : stroked;
+}
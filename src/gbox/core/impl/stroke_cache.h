@@ -0,0 +1,108 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        stroke_cache.h
+ * @ingroup     core
+ */
+#ifndef GB_CORE_IMPL_STROKE_CACHE_H
+#define GB_CORE_IMPL_STROKE_CACHE_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the default memory budget of the stroke cache 
+#define GB_STROKE_CACHE_MAXN            (4 << 20)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the stroke cache ref type
+typedef struct{}*       gb_stroke_cache_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* init the stroke cache
+ *
+ * cache: (path generation, width, cap, join, miter) => stroked path
+ *
+ * the stroked path is made in the path coordinates, 
+ * so it can be reused after the matrix is changed.
+ *
+ * @param maxn          the memory budget, uses the default budget if be zero
+ *
+ * @return              the stroke cache
+ */
+gb_stroke_cache_ref_t   gb_stroke_cache_init(tb_size_t maxn);
+
+/* exit the stroke cache
+ *
+ * @param cache         the stroke cache
+ */
+tb_void_t               gb_stroke_cache_exit(gb_stroke_cache_ref_t cache);
+
+/* clear the stroke cache
+ *
+ * @param cache         the stroke cache
+ */
+tb_void_t               gb_stroke_cache_clear(gb_stroke_cache_ref_t cache);
+
+/* get the cached stroked path 
+ *
+ * @param cache         the stroke cache
+ * @param paint         the paint
+ * @param path          the path
+ * 
+ * @return              the stroked path, return tb_null if not found
+ */
+gb_path_ref_t           gb_stroke_cache_get(gb_stroke_cache_ref_t cache, gb_paint_ref_t paint, gb_path_ref_t path);
+
+/* add the stroked path to the cache
+ *
+ * the stroked path will be copied only if the path has been stroked with the same paint before,
+ * so the paths which are modified for every frame will not be copied 
+ *
+ * @param cache         the stroke cache
+ * @param paint         the paint
+ * @param path          the path
+ * @param stroked       the stroked path
+ *
+ * @return              the cached stroked path or the given stroked path if not be cached
+ */
+gb_path_ref_t           gb_stroke_cache_add(gb_stroke_cache_ref_t cache, gb_paint_ref_t paint, gb_path_ref_t path, gb_path_ref_t stroked);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
@@ -2008,8 +2008,12 @@ gb_path_ref_t gb_stroker_done_points(gb_stroker_ref_t stroker, gb_paint_ref_t pa
     // add points to the stroker
     gb_stroker_add_points(stroker, points, count);
 
-    // done the stroker
-    return gb_stroker_done(stroker, tb_true);
+    /* done the stroker
+     *
+     * the overlapped contours of the multiple points are not convex, 
+     * they will be blended twice if the contours are filled as the convex polygon
+     */
+    return gb_stroker_done(stroker, count == 1);
 }
 gb_path_ref_t gb_stroker_done_polygon(gb_stroker_ref_t stroker, gb_paint_ref_t paint, gb_polygon_ref_t polygon, gb_shape_ref_t hint)
 {
@@ -191,17 +191,17 @@ tb_void_t gb_paint_mode_set(gb_paint_ref_t paint, tb_size_t mode)
     impl->mode = (tb_uint32_t)mode;
 }
 tb_size_t gb_paint_flag(gb_paint_ref_t paint)
+{
+    return gb_paint_flag_with_quality(paint, gb_quality());
+}
+tb_size_t gb_paint_flag_with_quality(gb_paint_ref_t paint, tb_size_t quality)
 {
     // check
     gb_paint_impl_t* impl = (gb_paint_impl_t*)paint;
     tb_assert_and_check_return_val(impl, GB_PAINT_FLAG_NONE);
 
-    // modify flag for quality
-    if (gb_quality() > GB_QUALITY_LOW) impl->flag |= (GB_PAINT_FLAG_ANTIALIASING | GB_PAINT_FLAG_FILTER_BITMAP);
-    else impl->flag &= ~(GB_PAINT_FLAG_ANTIALIASING | GB_PAINT_FLAG_FILTER_BITMAP);
-
-    // the flag
-    return impl->flag;
+    // the flag for quality, do not modify the paint for reading it from the different threads
+    return (quality > GB_QUALITY_LOW)? (impl->flag | GB_PAINT_FLAG_ANTIALIASING | GB_PAINT_FLAG_FILTER_BITMAP) : (impl->flag & ~(GB_PAINT_FLAG_ANTIALIASING | GB_PAINT_FLAG_FILTER_BITMAP));
 }
 tb_void_t gb_paint_flag_set(gb_paint_ref_t paint, tb_size_t flag)
 {
@@ -135,6 +135,17 @@ tb_void_t           gb_paint_mode_set(gb_paint_ref_t paint, tb_size_t mode);
  */
 tb_size_t           gb_paint_flag(gb_paint_ref_t paint);
 
+/*! the paint flag for the given quality
+ *
+ * the antialiasing and bitmap filter flags are enabled only if the quality is higher than GB_QUALITY_LOW
+ *
+ * @param paint     the paint 
+ * @param quality   the quality, e.g. gb_context_quality(context)
+ *
+ * @return          the paint flag
+ */
+tb_size_t           gb_paint_flag_with_quality(gb_paint_ref_t paint, tb_size_t quality);
+
 /*! set the paint flag
  *
  * @param paint     the paint 
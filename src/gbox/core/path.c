@@ -35,6 +35,11 @@
 #include "impl/quad.h"
 #include "impl/cubic.h"
 #include "impl/bounds.h"
+#include "impl/float.h"
+#include "impl/mapping.h"
+#include "impl/path_hit.h"
+#include "impl/path_lod.h"
+#include "impl/path_op.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * macros
@@ -50,6 +55,28 @@
 // the point step for code
 #define gb_path_point_step(code)    ((code) < 1? 1 : (code) - 1)
 
+// the average characters of one point for the svg path data, e.g. "12.345 67.89 "
+#define GB_PATH_SVG_DATA_POINT_SIZE (12)
+
+// the path data magic: "gbph"
+#define GB_PATH_DATA_MAGIC          (0x68706267)
+
+// the path data version
+#define GB_PATH_DATA_VERSION        (1)
+
+// the path data format for the current platform
+#ifdef GB_CONFIG_FLOAT_FIXED
+#   define GB_PATH_DATA_FORMAT_FLOAT    GB_PATH_DATA_FORMAT_FIXED
+#else
+#   define GB_PATH_DATA_FORMAT_FLOAT    (0)
+#endif
+#ifdef TB_WORDS_BIGENDIAN
+#   define GB_PATH_DATA_FORMAT_ENDIAN   GB_PATH_DATA_FORMAT_BIGENDIAN
+#else
+#   define GB_PATH_DATA_FORMAT_ENDIAN   (0)
+#endif
+#define GB_PATH_DATA_FORMAT_NATIVE      (GB_PATH_DATA_FORMAT_FLOAT | GB_PATH_DATA_FORMAT_ENDIAN)
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * types
  */
@@ -69,6 +96,82 @@ typedef enum __gb_path_flag_e
 
 }gb_path_flag_e;
 
+// the path data format enum
+typedef enum __gb_path_data_format_e
+{
+    GB_PATH_DATA_FORMAT_FIXED           = 1     //< the points are tb_fixed_t, otherwise tb_float_t
+,   GB_PATH_DATA_FORMAT_BIGENDIAN       = 2     //< the data is big-endian
+,   GB_PATH_DATA_FORMAT_HINT            = 4     //< have the hint shape?
+,   GB_PATH_DATA_FORMAT_POLYGON         = 8     //< have the polygon?
+
+}gb_path_data_format_e;
+
+/* the sliding queue type of the ring path
+ *
+ * the monotonic queue keeps the sequences of the live points which may be the minimum or maximum value later,
+ * so the bounds of the sliding window can be updated in amortized O(1) after appending or dropping one point.
+ */
+typedef struct __gb_path_ring_queue_t
+{
+    // the head index of the queue data
+    tb_size_t           head;
+
+    // the size of the queue
+    tb_size_t           size;
+
+}gb_path_ring_queue_t;
+
+/* the path data head type
+ *
+ * the layout of the path data, all sections are aligned by 4 bytes and stored by the native float and endian:
+ *
+ * - head
+ * - hint:              the hint shape union, hint_size bytes, if GB_PATH_DATA_FORMAT_HINT
+ * - points:            gb_point_t[points_count]
+ * - polygon points:    gb_point_t[polygon_points_count], uses the path points if be zero
+ * - polygon counts:    tb_uint16_t[polygon_counts_count], ends with zero, if GB_PATH_DATA_FORMAT_POLYGON
+ * - codes:             tb_uint8_t[codes_count]
+ */
+typedef struct __gb_path_data_head_t
+{
+    // the magic
+    tb_uint32_t         magic;
+
+    // the version
+    tb_uint16_t         version;
+
+    // the format
+    tb_uint16_t         format;
+
+    // the whole data size, include the head
+    tb_uint32_t         size;
+
+    // the path flag without the dirty flags
+    tb_uint8_t          flag;
+
+    // the hint type
+    tb_uint8_t          hint_type;
+
+    // the hint size
+    tb_uint16_t         hint_size;
+
+    // the codes count
+    tb_uint32_t         codes_count;
+
+    // the points count
+    tb_uint32_t         points_count;
+
+    // the polygon points count
+    tb_uint32_t         polygon_points_count;
+
+    // the polygon counts count
+    tb_uint32_t         polygon_counts_count;
+
+    // the bounds
+    gb_rect_t           bounds;
+
+}gb_path_data_head_t;
+
 // the path impl type
 typedef struct __gb_path_impl_t
 {
@@ -90,6 +193,9 @@ typedef struct __gb_path_impl_t
     // the head for the current contour
     gb_point_t          head;
 
+    // the index of the head in the points vector, it is used to move the head after dropping it from the ring path
+    tb_size_t           head_index;
+
     // the itor item
     gb_path_item_t      item;
 
@@ -105,19 +211,135 @@ typedef struct __gb_path_impl_t
     // the polygon counts, gb_uint16_t[]
     tb_vector_ref_t     polygon_counts;
 
+    // the read-only codes referenced from the path data, the path is read-only if exists
+    tb_uint8_t const*   data_codes;
+
+    // the read-only points referenced from the path data
+    gb_point_ref_t      data_points;
+
+    // the read-only codes count
+    tb_size_t           data_codes_count;
+
+    // the read-only points count
+    tb_size_t           data_points_count;
+
+    // the mapping of the path data file
+    gb_mapping_ref_t    mapping;
+
+    // the generation, zero if the path has been modified and the new generation is not made
+    tb_size_t           generation;
+
+    // the hit tester, it will be made again after the generation is changed
+    gb_path_hit_ref_t   hit;
+
+    // the generation of the hit tester
+    tb_size_t           hit_generation;
+
+    // the lod of the polygon, it will be made again after the generation is changed
+    gb_path_lod_ref_t   lod;
+
+    // the generation of the lod
+    tb_size_t           lod_generation;
+
+    // the maximum points count of the ring path, zero if the path is not a ring path
+    tb_size_t           ring;
+
+    /* the offset of the live codes and points
+     *
+     * the oldest points of the ring path are dropped from the head by moving the offset,
+     * and they will be removed at once if the dropped points are more than the live points.
+     */
+    tb_size_t           offset;
+
+    // the queues data of the ring path for the min-x, max-x, min-y and max-y of the bounds, tb_size_t[4 * ring]
+    tb_size_t*          ring_data;
+
+    // the sliding queues of the ring path
+    gb_path_ring_queue_t ring_queues[4];
+
+    // the sequence of the first live point of the ring path
+    tb_size_t           ring_first;
+
+    // the sequence of the next appended point of the ring path, zero if the queues are invalid
+    tb_size_t           ring_next;
+
 }gb_path_impl_t;
 
+// the path pack impl type
+typedef struct __gb_path_pack_impl_t
+{
+    // the mapping of the path file
+    gb_mapping_ref_t    mapping;
+
+    // the offsets of the paths, tb_size_t[count + 1]
+    tb_size_t*          offsets;
+
+    // the paths count
+    tb_size_t           count;
+
+}gb_path_pack_impl_t;
+
+// the svg path data parser type
+typedef struct __gb_path_svg_parser_t
+{
+    // the path
+    gb_path_ref_t       path;
+
+    // the current point
+    gb_point_t          point;
+
+    // the start point of the current contour
+    gb_point_t          start;
+
+    // the last ctrl point for the smooth curves
+    gb_point_t          ctrl;
+
+    // the last code
+    tb_char_t           code;
+
+    // the contour is closed?
+    tb_bool_t           closed;
+
+}gb_path_svg_parser_t, *gb_path_svg_parser_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+// the path generation
+static tb_atomic_t      g_generation = 0;
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
+static __tb_inline__ tb_uint8_t const* gb_path_codes_data(gb_path_impl_t* impl)
+{
+    // the read-only codes or the codes vector
+    return impl->data_codes? impl->data_codes : (tb_uint8_t const*)tb_vector_data(impl->codes) + impl->offset;
+}
+static __tb_inline__ tb_size_t gb_path_codes_size(gb_path_impl_t* impl)
+{
+    // the read-only codes count or the codes vector size
+    return impl->data_codes? impl->data_codes_count : tb_vector_size(impl->codes) - impl->offset;
+}
+static __tb_inline__ gb_point_ref_t gb_path_points_data(gb_path_impl_t* impl)
+{
+    // the read-only points or the points vector
+    return impl->data_codes? impl->data_points : (gb_point_ref_t)tb_vector_data(impl->points) + impl->offset;
+}
+static __tb_inline__ tb_size_t gb_path_points_size(gb_path_impl_t* impl)
+{
+    // the read-only points count or the points vector size
+    return impl->data_codes? impl->data_points_count : tb_vector_size(impl->points) - impl->offset;
+}
 static tb_size_t gb_path_itor_size(tb_iterator_ref_t iterator)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)iterator;
-    tb_assert_return_val(impl && impl->codes, 0);
+    tb_assert_return_val(impl, 0);
 
     // size
-    return tb_vector_size(impl->codes);
+    return gb_path_codes_size(impl);
 }
 static tb_size_t gb_path_itor_head(tb_iterator_ref_t iterator)
 {
@@ -131,18 +353,18 @@ static tb_size_t gb_path_itor_last(tb_iterator_ref_t iterator)
     tb_assert_return_val(impl, 0);
 
     // the last code index
-    tb_size_t code_last = tb_vector_size(impl->codes);
+    tb_size_t code_last = gb_path_codes_size(impl);
     if (code_last) code_last--;
     
     // the last code
-    tb_long_t code = (tb_long_t)tb_iterator_item(impl->codes, code_last);
+    tb_long_t code = gb_path_codes_data(impl)[code_last];
     tb_assert(code >= 0 && code < GB_PATH_CODE_MAXN);
 
     // the last point step
     tb_size_t point_step = gb_path_point_step(code);
 
     // the last point index
-    tb_size_t point_last = tb_vector_size(impl->points);
+    tb_size_t point_last = gb_path_points_size(impl);
     if (point_last >= point_step) point_last -= point_step;
 
     // last
@@ -152,11 +374,11 @@ static tb_size_t gb_path_itor_tail(tb_iterator_ref_t iterator)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)iterator;
-    tb_assert_return_val(impl && impl->codes && impl->points, 0);
+    tb_assert_return_val(impl, 0);
 
     // the code and point tail
-    tb_size_t code_tail     = tb_vector_size(impl->codes);
-    tb_size_t point_tail    = tb_vector_size(impl->points);
+    tb_size_t code_tail     = gb_path_codes_size(impl);
+    tb_size_t point_tail    = gb_path_points_size(impl);
     tb_assert(code_tail <= TB_MAXU16 && point_tail <= TB_MAXU16);
 
     // tail
@@ -166,10 +388,10 @@ static tb_size_t gb_path_itor_next(tb_iterator_ref_t iterator, tb_size_t itor)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)iterator;
-    tb_assert_return_val(impl && impl->codes, 0);
+    tb_assert_return_val(impl, 0);
 
     // the code
-    tb_long_t code = (tb_long_t)tb_iterator_item(impl->codes, itor >> 16);
+    tb_long_t code = gb_path_codes_data(impl)[itor >> 16];
     tb_assert(code >= 0 && code < GB_PATH_CODE_MAXN);
 
     /* the next
@@ -183,13 +405,13 @@ static tb_size_t gb_path_itor_prev(tb_iterator_ref_t iterator, tb_size_t itor)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)iterator;
-    tb_assert_return_val(impl && impl->codes, 0);
+    tb_assert_return_val(impl, 0);
 
     // check the code index
     tb_assert(itor >> 16);
 
     // the code
-    tb_long_t code = (tb_size_t)tb_iterator_item(impl->codes, (itor >> 16) - 1);
+    tb_long_t code = gb_path_codes_data(impl)[(itor >> 16) - 1];
     tb_assert(code >= 0 && code < GB_PATH_CODE_MAXN);
 
     // check the point index
@@ -206,28 +428,99 @@ static tb_pointer_t gb_path_itor_item(tb_iterator_ref_t iterator, tb_size_t itor
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)iterator;
-    tb_assert_return_val(impl && impl->codes && impl->points, tb_null);
+    tb_assert_return_val(impl, tb_null);
     
     // the code and point index
     tb_size_t code_index    = itor >> 16;
     tb_size_t point_index   = itor & 0xffff;
+    tb_assert(code_index < gb_path_codes_size(impl) && point_index <= gb_path_points_size(impl));
 
     // the code
-    tb_size_t code = (tb_size_t)tb_iterator_item(impl->codes, code_index);
+    tb_size_t code = gb_path_codes_data(impl)[code_index];
     tb_assert(code < 1 || point_index);
 
     // init item
     impl->item.code     = code;
-    impl->item.points   = (gb_point_ref_t)tb_iterator_item(impl->points, code < 1? point_index : point_index - 1);
+    impl->item.points   = gb_path_points_data(impl) + (code < 1? point_index : point_index - 1);
     tb_assert(impl->item.points);
 
     // data
     return &impl->item;
 }
+static tb_void_t gb_path_make_head(gb_path_impl_t* impl, tb_uint8_t const* codes, tb_size_t codes_count, gb_point_ref_t points, tb_size_t points_count)
+{
+    // find the move-to point of the last contour
+    tb_size_t i = codes_count;
+    tb_size_t n = points_count;
+    while (i--)
+    {
+        tb_size_t code = codes[i];
+        if (code == GB_PATH_CODE_MOVE)
+        {
+            impl->head          = points[n - 1];
+            impl->head_index    = n - 1;
+            break;
+        }
+        n -= gb_path_point_step(code);
+    }
+}
+static tb_bool_t gb_path_make_writable(gb_path_impl_t* impl, tb_bool_t copy)
+{
+    // check
+    tb_assert(impl);
+
+    // the path will be modified, discard the current generation
+    impl->generation = 0;
+
+    // init codes
+    if (!impl->codes) impl->codes = tb_vector_init(GB_PATH_POINTS_GROW >> 1, tb_element_uint8());
+    tb_assert_and_check_return_val(impl->codes, tb_false);
+
+    // init points
+    if (!impl->points) impl->points = tb_vector_init(GB_PATH_POINTS_GROW, tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
+    tb_assert_and_check_return_val(impl->points, tb_false);
+
+    // writable now?
+    tb_check_return_val(impl->data_codes, tb_true);
+
+    // the codes and points will be copied from the read-only data or discarded
+    impl->offset = 0;
+
+    // copy the read-only codes and points
+    if (copy)
+    {
+        // copy codes
+        if (!tb_vector_resize(impl->codes, impl->data_codes_count)) return tb_false;
+        tb_memcpy(tb_vector_data(impl->codes), impl->data_codes, impl->data_codes_count);
+
+        // copy points
+        if (!tb_vector_resize(impl->points, impl->data_points_count)) return tb_false;
+        tb_memcpy(tb_vector_data(impl->points), impl->data_points, impl->data_points_count * sizeof(gb_point_t));
+
+        // the head of the last contour
+        gb_path_make_head(impl, impl->data_codes, impl->data_codes_count, impl->data_points, impl->data_points_count);
+    }
+
+    // the polygon may reference the read-only data, remake it
+    impl->flag |= GB_PATH_FLAG_DIRTY_POLYGON;
+
+    // detach the read-only data
+    impl->data_codes        = tb_null;
+    impl->data_points       = tb_null;
+    impl->data_codes_count  = 0;
+    impl->data_points_count = 0;
+
+    // exit mapping
+    if (impl->mapping) gb_mapping_exit(impl->mapping);
+    impl->mapping = tb_null;
+
+    // ok
+    return tb_true;
+}
 static tb_bool_t gb_path_make_hint(gb_path_impl_t* impl)
 { 
     // check
-    tb_assert_and_check_return_val(impl && impl->codes && impl->points, tb_false);
+    tb_assert_and_check_return_val(impl, tb_false);
 
     // clear hint first
     impl->hint.type = GB_SHAPE_TYPE_NONE;
@@ -236,15 +529,15 @@ static tb_bool_t gb_path_make_hint(gb_path_impl_t* impl)
     if (!(impl->flag & GB_PATH_FLAG_CURVE))
     {
         // the codes 
-        tb_uint8_t const* codes = (tb_uint8_t const*)tb_vector_data(impl->codes);
+        tb_uint8_t const* codes = gb_path_codes_data(impl);
         tb_assert_and_check_return_val(codes, tb_false);
 
         // the points 
-        gb_point_ref_t points = (gb_point_ref_t)tb_vector_data(impl->points);
+        gb_point_ref_t points = gb_path_points_data(impl);
         tb_assert_and_check_return_val(points, tb_false);
 
         // the points count
-        tb_size_t count = tb_vector_size(impl->points);
+        tb_size_t count = gb_path_points_size(impl);
 
         // rect?
         if (    count == 5
@@ -329,7 +622,7 @@ static tb_bool_t gb_path_make_hint(gb_path_impl_t* impl)
 static tb_bool_t gb_path_make_convex(gb_path_impl_t* impl)
 {
     // check
-    tb_assert_and_check_return_val(impl && impl->codes && impl->points, tb_false);
+    tb_assert_and_check_return_val(impl, tb_false);
 
     // clear convex first
     impl->flag &= ~GB_PATH_FLAG_CONVEX;
@@ -357,7 +650,7 @@ static tb_bool_t gb_path_make_convex(gb_path_impl_t* impl)
     if (    !(impl->flag & GB_PATH_FLAG_CONVEX) 
         &&  (impl->flag & GB_PATH_FLAG_SINGLE)
         &&  (impl->flag & GB_PATH_FLAG_CLOSED)
-        &&  tb_vector_size(impl->codes) > 3)
+        &&  gb_path_codes_size(impl) > 3)
     {
         // init flag first
         impl->flag |= GB_PATH_FLAG_CONVEX;
@@ -524,10 +817,10 @@ static tb_bool_t gb_path_make_convex(gb_path_impl_t* impl)
             case GB_PATH_CODE_CLOS:
                 {
                     // the points
-                    gb_point_ref_t points = (gb_point_ref_t)tb_vector_data(impl->points);
+                    gb_point_ref_t points = gb_path_points_data(impl);
 
                     // check
-                    tb_assert(points && tb_vector_size(impl->points) > 1);
+                    tb_assert(points && gb_path_points_size(impl) > 1);
                     tb_assert(points[0].x == item->points[0].x && points[0].y == item->points[0].y);
 
                     // update the points
@@ -613,7 +906,7 @@ static tb_void_t gb_path_make_line_for_curve_to(gb_point_ref_t point, tb_cpointe
 static tb_bool_t gb_path_make_python(gb_path_impl_t* impl)
 { 
     // check
-    tb_assert_and_check_return_val(impl && impl->codes && impl->points, tb_false);
+    tb_assert_and_check_return_val(impl, tb_false);
 
     // make polygon counts
     if (!impl->polygon_counts) impl->polygon_counts = tb_vector_init(8, tb_element_uint16());
@@ -623,7 +916,7 @@ static tb_bool_t gb_path_make_python(gb_path_impl_t* impl)
     if (impl->flag & GB_PATH_FLAG_CURVE)
     {
         // make polygon points
-        if (!impl->polygon_points) impl->polygon_points = tb_vector_init(tb_vector_size(impl->points), tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
+        if (!impl->polygon_points) impl->polygon_points = tb_vector_init(gb_path_points_size(impl), tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
         tb_assert_and_check_return_val(impl->polygon_points, tb_false);
 
         // clear polygon points and counts
@@ -697,10 +990,16 @@ static tb_bool_t gb_path_make_python(gb_path_impl_t* impl)
     else
     {
         // init polygon counts
-        tb_uint16_t count = 0;
+        tb_size_t           i = 0;
+        tb_uint16_t         count = 0;
+        tb_uint8_t const*   codes = gb_path_codes_data(impl);
+        tb_size_t           codes_size = gb_path_codes_size(impl);
         tb_vector_clear(impl->polygon_counts);
-        tb_for_all (tb_long_t, code, impl->codes)
+        for (i = 0; i < codes_size; i++)
         {
+            // the code
+            tb_long_t code = codes[i];
+
             // check
             tb_assert(code >= 0 && code < GB_PATH_CODE_MAXN);
 
@@ -722,22 +1021,731 @@ static tb_bool_t gb_path_make_python(gb_path_impl_t* impl)
             count = 0;
         }
 
-        // append the tail count
-        tb_vector_insert_tail(impl->polygon_counts, (tb_cpointer_t)0);
+        // append the tail count
+        tb_vector_insert_tail(impl->polygon_counts, (tb_cpointer_t)0);
+
+        // init polygon
+        impl->polygon.points = gb_path_points_data(impl);
+        impl->polygon.counts = (tb_uint16_t*)tb_vector_data(impl->polygon_counts);
+    }
+
+    // check
+    tb_assert_and_check_return_val(impl->polygon.points && impl->polygon.counts, tb_false);
+
+    // is convex polygon?
+    impl->polygon.convex = gb_path_convex((gb_path_ref_t)impl);
+
+    // ok
+    return tb_true;
+}
+static tb_void_t gb_path_make_line_to(gb_path_impl_t* impl, gb_point_ref_t point)
+{
+    // check
+    tb_assert(impl && point);
+
+    // the hint shape is invalid now
+    impl->flag |= GB_PATH_FLAG_DIRTY_HINT;
+
+    // extend the bounds if it has been made
+    if (!(impl->flag & GB_PATH_FLAG_DIRTY_BOUNDS)) gb_bounds_extend(&impl->bounds, point);
+
+    // the last contour is not closed and the hint shape will be none, so the path is not convex now 
+    impl->flag &= ~(GB_PATH_FLAG_CONVEX | GB_PATH_FLAG_DIRTY_CONVEX);
+
+    // append the point to the last contour of the polygon if it has been made
+    if (!(impl->flag & GB_PATH_FLAG_DIRTY_POLYGON))
+    {
+        // the polygon counts, ends with zero
+        tb_size_t       size = tb_vector_size(impl->polygon_counts);
+        tb_uint16_t*    counts = (tb_uint16_t*)tb_vector_data(impl->polygon_counts);
+        if (size > 1 && counts[size - 2] < TB_MAXU16)
+        {
+            // update the points count of the last contour
+            counts[size - 2]++;
+
+            // append the point, the polygon uses the path points directly if no curve
+            if (impl->flag & GB_PATH_FLAG_CURVE)
+            {
+                tb_vector_insert_tail(impl->polygon_points, point);
+                impl->polygon.points = (gb_point_ref_t)tb_vector_data(impl->polygon_points);
+            }
+            else impl->polygon.points = gb_path_points_data(impl);
+
+            // not convex
+            impl->polygon.convex = tb_false;
+        }
+        // remake it
+        else impl->flag |= GB_PATH_FLAG_DIRTY_POLYGON;
+    }
+}
+static __tb_inline__ gb_float_t gb_path_ring_value(gb_path_impl_t* impl, tb_size_t index, tb_size_t seq)
+{
+    // the point of the sequence
+    gb_point_ref_t point = gb_path_points_data(impl) + (seq - impl->ring_first);
+
+    // the x-coordinate for the min-x and max-x queues, the y-coordinate for the min-y and max-y queues
+    return (index & 2)? point->y : point->x;
+}
+static tb_void_t gb_path_ring_push(gb_path_impl_t* impl, tb_size_t seq)
+{
+    // check
+    tb_assert(impl && impl->ring_data);
+
+    // push the point to all queues
+    tb_size_t index = 0;
+    for (index = 0; index < 4; index++)
+    {
+        // the queue
+        gb_path_ring_queue_t*   queue = &impl->ring_queues[index];
+        tb_size_t*              data = impl->ring_data + index * impl->ring;
+        gb_float_t              value = gb_path_ring_value(impl, index, seq);
+
+        // pop the tail points which will never be the min or max value before the new point is dropped
+        while (queue->size)
+        {
+            gb_float_t tail = gb_path_ring_value(impl, index, data[(queue->head + queue->size - 1) % impl->ring]);
+            if ((index & 1)? tail > value : tail < value) break;
+            queue->size--;
+        }
+
+        // push it
+        tb_assert(queue->size < impl->ring);
+        data[(queue->head + queue->size) % impl->ring] = seq;
+        queue->size++;
+    }
+}
+static tb_void_t gb_path_ring_bounds(gb_path_impl_t* impl, tb_size_t size)
+{
+    // check
+    tb_assert(impl && size && size <= impl->ring);
+
+    // init the queues data
+    if (!impl->ring_data) impl->ring_data = tb_nalloc_type(impl->ring << 2, tb_size_t);
+    if (!impl->ring_data)
+    {
+        // remake the bounds from all points
+        impl->flag |= GB_PATH_FLAG_DIRTY_BOUNDS;
+        impl->ring_next = 0;
+        return ;
+    }
+
+    // the last point is only appended and the bounds are valid? update the queues
+    tb_size_t index = 0;
+    if (    impl->ring_next
+        &&  impl->ring_next == impl->ring_first + size - 1
+        &&  !(impl->flag & GB_PATH_FLAG_DIRTY_BOUNDS))
+    {
+        // remove the dropped points
+        for (index = 0; index < 4; index++)
+        {
+            gb_path_ring_queue_t*   queue = &impl->ring_queues[index];
+            tb_size_t*              data = impl->ring_data + index * impl->ring;
+            while (queue->size && data[queue->head] < impl->ring_first)
+            {
+                queue->head = (queue->head + 1) % impl->ring;
+                queue->size--;
+            }
+        }
+
+        // push the last point
+        gb_path_ring_push(impl, impl->ring_next++);
+    }
+    // remake the queues from all live points
+    else
+    {
+        // clear the queues
+        tb_memset(impl->ring_queues, 0, sizeof(impl->ring_queues));
+
+        // push all live points
+        impl->ring_first    = 0;
+        impl->ring_next     = 0;
+        while (impl->ring_next < size) gb_path_ring_push(impl, impl->ring_next++);
+    }
+
+    // make the bounds from the queue heads
+    gb_float_t x0 = gb_path_ring_value(impl, 0, impl->ring_data[impl->ring_queues[0].head]);
+    gb_float_t x1 = gb_path_ring_value(impl, 1, impl->ring_data[impl->ring + impl->ring_queues[1].head]);
+    gb_float_t y0 = gb_path_ring_value(impl, 2, impl->ring_data[(impl->ring << 1) + impl->ring_queues[2].head]);
+    gb_float_t y1 = gb_path_ring_value(impl, 3, impl->ring_data[impl->ring * 3 + impl->ring_queues[3].head]);
+    impl->bounds.x = x0;
+    impl->bounds.y = y0;
+    impl->bounds.w = x1 - x0;
+    impl->bounds.h = y1 - y0;
+    impl->flag &= ~GB_PATH_FLAG_DIRTY_BOUNDS;
+}
+static tb_void_t gb_path_make_ring(gb_path_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->codes && impl->points && !impl->data_codes);
+
+    // only drop the head points of the path with move-to and line-to, the codes and points are one-to-one
+    tb_size_t size = gb_path_points_size(impl);
+    tb_check_return(impl->ring && size && !(impl->flag & GB_PATH_FLAG_CURVE) && size == gb_path_codes_size(impl));
+
+    // the polygon counts if the polygon has been made
+    tb_uint16_t* counts = (size > impl->ring && !(impl->flag & GB_PATH_FLAG_DIRTY_POLYGON))? (tb_uint16_t*)tb_vector_data(impl->polygon_counts) : tb_null;
+
+    // drop the oldest points
+    tb_uint8_t*     codes = (tb_uint8_t*)gb_path_codes_data(impl);
+    gb_point_ref_t  points = gb_path_points_data(impl);
+    while (size > impl->ring)
+    {
+        // the next point will be the head of the first contour
+        if (size > 1 && codes[1] == GB_PATH_CODE_LINE) codes[1] = GB_PATH_CODE_MOVE;
+
+        // update the points count of the first contour and remove it if be empty
+        if (counts && !--counts[0])
+        {
+            tb_vector_remove_head(impl->polygon_counts);
+            counts = (tb_uint16_t*)tb_vector_data(impl->polygon_counts);
+        }
+
+        // drop it
+        codes++;
+        points++;
+        size--;
+        impl->offset++;
+        impl->ring_first++;
+
+        // the head of the current contour has been dropped? the next point is the head now
+        if (impl->head_index < impl->offset)
+        {
+            impl->head          = *points;
+            impl->head_index    = impl->offset;
+        }
+    }
+
+    // update the bounds of the sliding window
+    gb_path_ring_bounds(impl, size);
+
+    // remove the dropped codes and points if they are more than the live codes and points
+    if (impl->offset && impl->offset >= size)
+    {
+        tb_vector_nremove_head(impl->codes, impl->offset);
+        tb_vector_nremove_head(impl->points, impl->offset);
+        impl->head_index -= impl->offset;
+        impl->offset = 0;
+    }
+
+    // update the polygon
+    if (counts)
+    {
+        impl->polygon.points = gb_path_points_data(impl);
+        impl->polygon.counts = counts;
+    }
+
+    // the path has been modified
+    impl->flag |= GB_PATH_FLAG_DIRTY_HINT;
+}
+static tb_void_t gb_path_reserve(gb_path_impl_t* impl, tb_size_t codes, tb_size_t points)
+{
+    // check
+    tb_assert(impl && impl->codes && impl->points);
+
+    // reserve codes, the vector will keep the grown space after resizing it back
+    tb_size_t size = tb_vector_size(impl->codes);
+    if (tb_vector_resize(impl->codes, size + codes)) tb_vector_resize(impl->codes, size);
+
+    // reserve points
+    size = tb_vector_size(impl->points);
+    if (tb_vector_resize(impl->points, size + points)) tb_vector_resize(impl->points, size);
+}
+static __tb_inline__ tb_char_t const* gb_path_svg_skip_separator(tb_char_t const* p)
+{
+    // skip spaces and the comma
+    while (tb_isspace(*p)) p++;
+    if (*p == ',') p++;
+    while (tb_isspace(*p)) p++;
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_path_svg_scan_floats(tb_char_t const* p, gb_float_t* values, tb_size_t count)
+{
+    // done
+    tb_size_t i = 0;
+    for (i = 0; i < count && p; i++) p = gb_float_scan(gb_path_svg_skip_separator(p), &values[i]);
+
+    // ok?
+    return p;
+}
+static tb_char_t const* gb_path_svg_scan_flag(tb_char_t const* p, tb_bool_t* value)
+{
+    // check
+    tb_assert(p && value);
+
+    // skip separator
+    p = gb_path_svg_skip_separator(p);
+
+    // the flag may be not separated from the next number, e.g. "a1,1 0 00 10,10"
+    tb_check_return_val(*p == '0' || *p == '1', tb_null);
+
+    // save value
+    *value = *p == '1';
+
+    // ok
+    return p + 1;
+}
+static tb_void_t gb_path_svg_arc_to(gb_path_svg_parser_ref_t parser, gb_float_t rx, gb_float_t ry, gb_float_t angle, tb_bool_t large, tb_bool_t sweep, gb_point_ref_t point)
+{
+    // check
+    tb_assert(parser && point);
+
+    // the same point? skip it
+    gb_point_ref_t start = &parser->point;
+    tb_check_return(!gb_point_eq(start, point));
+
+    // the radius is zero? make line
+    rx = gb_abs(rx);
+    ry = gb_abs(ry);
+    if (gb_near0(rx) || gb_near0(ry))
+    {
+        gb_path_line_to(parser->path, point);
+        return ;
+    }
+
+    /* compute the center from the endpoint parameterization
+     *
+     * (x1', y1') = rotate(-angle) * ((x0 - x1) / 2, (y0 - y1) / 2)
+     *
+     * we use the normalized coordinates (x1' / rx, y1' / ry) for avoiding the overflow of the fixed
+     */
+    gb_float_t sin;
+    gb_float_t cos;
+    gb_sincos(gb_degree_to_radian(angle), &sin, &cos);
+    gb_float_t dx = gb_half(start->x - point->x);
+    gb_float_t dy = gb_half(start->y - point->y);
+    gb_float_t px = gb_div(gb_mul(cos, dx) + gb_mul(sin, dy), rx);
+    gb_float_t py = gb_div(gb_mul(cos, dy) - gb_mul(sin, dx), ry);
+
+    // scale up the radius if be too small
+    gb_float_t lambda = gb_sqre(px) + gb_sqre(py);
+    gb_float_t factor = 0;
+    if (lambda > GB_ONE)
+    {
+        gb_float_t scale = gb_sqrt(lambda);
+        rx = gb_mul(rx, scale);
+        ry = gb_mul(ry, scale);
+        px = gb_div(px, scale);
+        py = gb_div(py, scale);
+    }
+    else if (lambda > 0)
+    {
+        // factor = sqrt((1 - lambda) / lambda)
+        factor = gb_div(gb_sqrt(GB_ONE - lambda), gb_sqrt(lambda));
+        if (large == sweep) factor = -factor;
+    }
+
+    // the normalized center
+    gb_float_t cx = gb_mul(factor, py);
+    gb_float_t cy = -gb_mul(factor, px);
+
+    // the start and stop unit vector
+    gb_vector_t start_unit;
+    gb_vector_t stop_unit;
+    if (!gb_vector_make_unit(&start_unit, px - cx, py - cy)) return ;
+    if (!gb_vector_make_unit(&stop_unit, -px - cx, -py - cy)) return ;
+
+    /* init matrix
+     *
+     * matrix = translate(center) * rotate(angle) * scale(rx, ry)
+     */
+    gb_matrix_t matrix;
+    gb_matrix_init_translate(&matrix,   gb_mul(cos, gb_mul(cx, rx)) - gb_mul(sin, gb_mul(cy, ry)) + gb_avg(start->x, point->x)
+                                    ,   gb_mul(sin, gb_mul(cx, rx)) + gb_mul(cos, gb_mul(cy, ry)) + gb_avg(start->y, point->y));
+    gb_matrix_rotate(&matrix, angle);
+    gb_matrix_scale(&matrix, rx, ry);
+
+    // make quad curves
+    gb_arc_make_quad2(&start_unit, &stop_unit, &matrix, sweep? GB_ROTATE_DIRECTION_CW : GB_ROTATE_DIRECTION_CCW, gb_path_make_quad_for_arc_to, parser->path);
+
+    // patch the last point
+    gb_path_last_set(parser->path, point);
+}
+static tb_bool_t gb_path_svg_done(gb_path_ref_t path, tb_char_t const* data)
+{
+    // check
+    tb_assert(path && data);
+
+    // init parser
+    gb_path_svg_parser_t parser;
+    tb_memset(&parser, 0, sizeof(gb_path_svg_parser_t));
+    parser.path = path;
+
+    // done
+    tb_char_t const*    p = data;
+    tb_char_t           code = 0;
+    gb_float_t          values[7];
+    while (1)
+    {
+        // skip spaces and separators
+        while (tb_isspace(*p) || *p == ',') p++;
+        tb_check_break(*p);
+
+        // the new code?
+        if (tb_isalpha(*p)) code = *p++;
+        // no code?
+        else if (!code) break;
+        // the implicit line-to after move-to
+        else if (code == 'M') code = 'L';
+        else if (code == 'm') code = 'l';
+
+        // is relative?
+        tb_bool_t   relative = tb_islower(code);
+        gb_float_t  x0 = relative? parser.point.x : 0;
+        gb_float_t  y0 = relative? parser.point.y : 0;
+
+        // move to the start point if the contour has been closed
+        if (parser.closed && code != 'M' && code != 'm' && code != 'Z' && code != 'z')
+        {
+            gb_path_move_to(path, &parser.start);
+            parser.closed = tb_false;
+        }
+
+        // done code
+        gb_point_t ctrl0;
+        gb_point_t ctrl1;
+        gb_point_t point;
+        switch (code)
+        {
+        case 'M':
+        case 'm':
+            {
+                // parse point
+                p = gb_path_svg_scan_floats(p, values, 2);
+                tb_check_break(p);
+
+                // move-to
+                gb_point_make(&point, x0 + values[0], y0 + values[1]);
+                gb_path_move_to(path, &point);
+                parser.start    = point;
+                parser.closed   = tb_false;
+            }
+            break;
+        case 'L':
+        case 'l':
+            {
+                // parse point
+                p = gb_path_svg_scan_floats(p, values, 2);
+                tb_check_break(p);
+
+                // line-to
+                gb_point_make(&point, x0 + values[0], y0 + values[1]);
+                gb_path_line_to(path, &point);
+            }
+            break;
+        case 'H':
+        case 'h':
+            {
+                // parse x
+                p = gb_path_svg_scan_floats(p, values, 1);
+                tb_check_break(p);
+
+                // line-to
+                gb_point_make(&point, x0 + values[0], parser.point.y);
+                gb_path_line_to(path, &point);
+            }
+            break;
+        case 'V':
+        case 'v':
+            {
+                // parse y
+                p = gb_path_svg_scan_floats(p, values, 1);
+                tb_check_break(p);
+
+                // line-to
+                gb_point_make(&point, parser.point.x, y0 + values[0]);
+                gb_path_line_to(path, &point);
+            }
+            break;
+        case 'C':
+        case 'c':
+            {
+                // parse points
+                p = gb_path_svg_scan_floats(p, values, 6);
+                tb_check_break(p);
+
+                // cubic-to
+                gb_point_make(&ctrl0, x0 + values[0], y0 + values[1]);
+                gb_point_make(&ctrl1, x0 + values[2], y0 + values[3]);
+                gb_point_make(&point, x0 + values[4], y0 + values[5]);
+                gb_path_cubic_to(path, &ctrl0, &ctrl1, &point);
+                parser.ctrl = ctrl1;
+            }
+            break;
+        case 'S':
+        case 's':
+            {
+                // parse points
+                p = gb_path_svg_scan_floats(p, values, 4);
+                tb_check_break(p);
+
+                // the first ctrl point is the reflection of the last ctrl point of the previous cubic curve
+                if (parser.code == 'C' || parser.code == 'c' || parser.code == 'S' || parser.code == 's')
+                    gb_point_make(&ctrl0, gb_lsh(parser.point.x, 1) - parser.ctrl.x, gb_lsh(parser.point.y, 1) - parser.ctrl.y);
+                else ctrl0 = parser.point;
+
+                // cubic-to
+                gb_point_make(&ctrl1, x0 + values[0], y0 + values[1]);
+                gb_point_make(&point, x0 + values[2], y0 + values[3]);
+                gb_path_cubic_to(path, &ctrl0, &ctrl1, &point);
+                parser.ctrl = ctrl1;
+            }
+            break;
+        case 'Q':
+        case 'q':
+            {
+                // parse points
+                p = gb_path_svg_scan_floats(p, values, 4);
+                tb_check_break(p);
+
+                // quad-to
+                gb_point_make(&ctrl0, x0 + values[0], y0 + values[1]);
+                gb_point_make(&point, x0 + values[2], y0 + values[3]);
+                gb_path_quad_to(path, &ctrl0, &point);
+                parser.ctrl = ctrl0;
+            }
+            break;
+        case 'T':
+        case 't':
+            {
+                // parse point
+                p = gb_path_svg_scan_floats(p, values, 2);
+                tb_check_break(p);
+
+                // the ctrl point is the reflection of the ctrl point of the previous quadratic curve
+                if (parser.code == 'Q' || parser.code == 'q' || parser.code == 'T' || parser.code == 't')
+                    gb_point_make(&ctrl0, gb_lsh(parser.point.x, 1) - parser.ctrl.x, gb_lsh(parser.point.y, 1) - parser.ctrl.y);
+                else ctrl0 = parser.point;
+
+                // quad-to
+                gb_point_make(&point, x0 + values[0], y0 + values[1]);
+                gb_path_quad_to(path, &ctrl0, &point);
+                parser.ctrl = ctrl0;
+            }
+            break;
+        case 'A':
+        case 'a':
+            {
+                // parse rx, ry and x-axis-rotation
+                tb_bool_t large = tb_false;
+                tb_bool_t sweep = tb_false;
+                p = gb_path_svg_scan_floats(p, values, 3);
+                if (p) p = gb_path_svg_scan_flag(p, &large);
+                if (p) p = gb_path_svg_scan_flag(p, &sweep);
+                if (p) p = gb_path_svg_scan_floats(p, values + 3, 2);
+                tb_check_break(p);
+
+                // arc-to
+                gb_point_make(&point, x0 + values[3], y0 + values[4]);
+                gb_path_svg_arc_to(&parser, values[0], values[1], values[2], large, sweep, &point);
+            }
+            break;
+        case 'Z':
+        case 'z':
+            {
+                // close path
+                gb_path_clos(path);
+                point           = parser.start;
+                parser.closed   = tb_true;
+            }
+            break;
+        default:
+            {
+                // trace
+                tb_trace_d("unknown path code: %c", code);
+
+                // invalid data
+                p = tb_null;
+            }
+            break;
+        }
+
+        // failed?
+        tb_check_break(p);
+
+        // update the current point and code
+        parser.point    = point;
+        parser.code     = code;
+    }
+
+    // ok?
+    return !gb_path_null(path);
+}
+static gb_path_ref_t gb_path_init_impl(tb_bool_t writable)
+{
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_path_impl_t*     impl = tb_null;
+    do
+    {
+        // make path
+        impl = tb_malloc0_type(gb_path_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init hint
+        impl->hint.type = GB_SHAPE_TYPE_NONE;
+
+        // init flag
+        impl->flag = GB_PATH_FLAG_DIRTY_ALL | GB_PATH_FLAG_CLOSED | GB_PATH_FLAG_SINGLE;
+
+        // init codes and points, the read-only path will init them when be modified
+        if (writable && !gb_path_make_writable(impl, tb_false)) break;
+
+        // init iterator
+        impl->itor.mode = TB_ITERATOR_MODE_FORWARD | TB_ITERATOR_MODE_REVERSE | TB_ITERATOR_MODE_READONLY;
+        impl->itor.priv = tb_null;
+        impl->itor.step = sizeof(gb_path_item_t);
+        impl->itor.size = gb_path_itor_size;
+        impl->itor.head = gb_path_itor_head;
+        impl->itor.last = gb_path_itor_last;
+        impl->itor.tail = gb_path_itor_tail;
+        impl->itor.next = gb_path_itor_next;
+        impl->itor.prev = gb_path_itor_prev;
+        impl->itor.item = gb_path_itor_item;
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_path_exit((gb_path_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_path_ref_t)impl;
+}
+static tb_size_t gb_path_data_check(tb_byte_t const* data, tb_size_t size)
+{
+    // check
+    tb_assert_and_check_return_val(data && size >= sizeof(gb_path_data_head_t), 0);
+
+    // must be aligned by 4 bytes for the points
+    tb_assert_and_check_return_val(!((tb_size_t)data & 0x3), 0);
+
+    // check the magic and version
+    gb_path_data_head_t const* head = (gb_path_data_head_t const*)data;
+    tb_check_return_val(head->magic == GB_PATH_DATA_MAGIC && head->version == GB_PATH_DATA_VERSION, 0);
+
+    // check the float type and endian
+    if ((head->format & (GB_PATH_DATA_FORMAT_FIXED | GB_PATH_DATA_FORMAT_BIGENDIAN)) != GB_PATH_DATA_FORMAT_NATIVE)
+    {
+        // trace
+        tb_trace_e("the path data format: %#x is not supported for this platform", head->format);
+        return 0;
+    }
+
+    // check the counts
+    tb_check_return_val(head->codes_count <= TB_MAXU16 && head->points_count <= TB_MAXU16, 0);
+    tb_check_return_val(head->polygon_points_count <= TB_MAXU16 && head->polygon_counts_count <= TB_MAXU16, 0);
+
+    // compute the data size
+    tb_size_t need = sizeof(gb_path_data_head_t);
+    if (head->format & GB_PATH_DATA_FORMAT_HINT) need += tb_align4(head->hint_size);
+    need += (head->points_count + head->polygon_points_count) * sizeof(gb_point_t);
+    need += tb_align4(head->polygon_counts_count * sizeof(tb_uint16_t));
+    need += tb_align4(head->codes_count);
+
+    // check the data size
+    tb_check_return_val(head->size == need && head->size <= size, 0);
+
+    // check the hint type, the hint union will be interpreted by it
+    tb_byte_t const* p = data + sizeof(gb_path_data_head_t);
+    if (head->format & GB_PATH_DATA_FORMAT_HINT)
+    {
+        switch (head->hint_type)
+        {
+        case GB_SHAPE_TYPE_NONE:
+        case GB_SHAPE_TYPE_ARC:
+        case GB_SHAPE_TYPE_LINE:
+        case GB_SHAPE_TYPE_RECT:
+        case GB_SHAPE_TYPE_POINT:
+        case GB_SHAPE_TYPE_CIRCLE:
+        case GB_SHAPE_TYPE_ELLIPSE:
+        case GB_SHAPE_TYPE_TRIANGLE:
+        case GB_SHAPE_TYPE_ROUND_RECT:
+            break;
+        default:
+            return 0;
+        }
+        p += tb_align4(head->hint_size);
+    }
+
+    // the polygon counts and codes
+    p += (head->points_count + head->polygon_points_count) * sizeof(gb_point_t);
+    tb_uint16_t const*  counts = (tb_uint16_t const*)p;
+    tb_uint8_t const*   codes = p + tb_align4(head->polygon_counts_count * sizeof(tb_uint16_t));
+
+    // check the codes and the points consumed by them, the path must begin with the move-to code
+    tb_size_t i = 0;
+    tb_size_t points = 0;
+    tb_check_return_val(!head->codes_count || codes[0] == GB_PATH_CODE_MOVE, 0);
+    for (i = 0; i < head->codes_count; i++)
+    {
+        tb_check_return_val(codes[i] < GB_PATH_CODE_MAXN, 0);
+        points += gb_path_point_step(codes[i]);
+    }
+    tb_check_return_val(points == head->points_count, 0);
+
+    // check the polygon counts, they must end with zero and not use more than the polygon points
+    if ((head->format & GB_PATH_DATA_FORMAT_POLYGON) && head->polygon_counts_count)
+    {
+        tb_size_t count = head->polygon_counts_count - 1;
+        tb_check_return_val(!counts[count], 0);
+        for (i = 0, points = 0; i < count; i++)
+        {
+            tb_check_return_val(counts[i], 0);
+            points += counts[i];
+        }
+        tb_check_return_val(points <= (head->polygon_points_count? head->polygon_points_count : head->points_count), 0);
+    }
+
+    // ok
+    return head->size;
+}
+static tb_bool_t gb_path_data_writ(tb_stream_ref_t stream, tb_cpointer_t data, tb_size_t size)
+{
+    // writ data
+    if (size && !tb_stream_bwrit(stream, (tb_byte_t const*)data, size)) return tb_false;
 
-        // init polygon
-        impl->polygon.points = (gb_point_ref_t)tb_vector_data(impl->points);
-        impl->polygon.counts = (tb_uint16_t*)tb_vector_data(impl->polygon_counts);
-    }
+    // writ the padding
+    tb_byte_t padding[4] = {0};
+    return (size & 0x3)? tb_stream_bwrit(stream, padding, 4 - (size & 0x3)) : tb_true;
+}
 
+static gb_path_hit_ref_t gb_path_hit_tester(gb_path_impl_t* impl)
+{
     // check
-    tb_assert_and_check_return_val(impl->polygon.points && impl->polygon.counts, tb_false);
+    tb_assert(impl);
 
-    // is convex polygon?
-    impl->polygon.convex = gb_path_convex((gb_path_ref_t)impl);
+    // the current generation
+    tb_size_t generation = gb_path_generation((gb_path_ref_t)impl);
+
+    // the hit tester has been made for this generation?
+    tb_check_return_val(!impl->hit || impl->hit_generation != generation, impl->hit);
+
+    // init hit tester
+    if (!impl->hit) impl->hit = gb_path_hit_init();
+    tb_assert_and_check_return_val(impl->hit, tb_null);
+
+    // make it from the polygon
+    gb_polygon_ref_t    polygon = gb_path_polygon((gb_path_ref_t)impl);
+    gb_rect_ref_t       bounds = gb_path_bounds((gb_path_ref_t)impl);
+    tb_check_return_val(polygon && bounds, tb_null);
+    if (!gb_path_hit_make(impl->hit, polygon, bounds))
+    {
+        impl->hit_generation = 0;
+        return tb_null;
+    }
 
     // ok
-    return tb_true;
+    impl->hit_generation = generation;
+    return impl->hit;
 }
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -745,40 +1753,29 @@ static tb_bool_t gb_path_make_python(gb_path_impl_t* impl)
  */
 gb_path_ref_t gb_path_init()
 {
+    // init a writable path
+    return gb_path_init_impl(tb_true);
+}
+gb_path_ref_t gb_path_init_from_svg_data(tb_char_t const* data)
+{
+    // check
+    tb_assert_and_check_return_val(data, tb_null);
+
     // done
-    tb_bool_t           ok = tb_false;
-    gb_path_impl_t*     impl = tb_null;
+    tb_bool_t       ok = tb_false;
+    gb_path_ref_t   path = tb_null;
     do
     {
-        // make path
-        impl = tb_malloc0_type(gb_path_impl_t);
-        tb_assert_and_check_break(impl);
-
-        // init hint
-        impl->hint.type = GB_SHAPE_TYPE_NONE;
-
-        // init flag
-        impl->flag = GB_PATH_FLAG_DIRTY_ALL | GB_PATH_FLAG_CLOSED | GB_PATH_FLAG_SINGLE;
+        // init path
+        path = gb_path_init();
+        tb_assert_and_check_break(path);
 
-        // init codes
-        impl->codes = tb_vector_init(GB_PATH_POINTS_GROW >> 1, tb_element_uint8());
-        tb_assert_and_check_break(impl->codes);
+        // reserve the codes and points for the estimated size
+        tb_size_t points = tb_strlen(data) / GB_PATH_SVG_DATA_POINT_SIZE + 2;
+        gb_path_reserve((gb_path_impl_t*)path, (points >> 1) + 1, points);
 
-        // init points
-        impl->points = tb_vector_init(GB_PATH_POINTS_GROW, tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
-        tb_assert_and_check_break(impl->points);
-
-        // init iterator
-        impl->itor.mode = TB_ITERATOR_MODE_FORWARD | TB_ITERATOR_MODE_REVERSE | TB_ITERATOR_MODE_READONLY;
-        impl->itor.priv = tb_null;
-        impl->itor.step = sizeof(gb_path_item_t);
-        impl->itor.size = gb_path_itor_size;
-        impl->itor.head = gb_path_itor_head;
-        impl->itor.last = gb_path_itor_last;
-        impl->itor.tail = gb_path_itor_tail;
-        impl->itor.next = gb_path_itor_next;
-        impl->itor.prev = gb_path_itor_prev;
-        impl->itor.item = gb_path_itor_item;
+        // make path
+        if (!gb_path_svg_done(path, data)) break;
 
         // ok
         ok = tb_true;
@@ -789,9 +1786,88 @@ gb_path_ref_t gb_path_init()
     if (!ok)
     {
         // exit it
-        if (impl) gb_path_exit((gb_path_ref_t)impl);
-        impl = tb_null;
+        if (path) gb_path_exit(path);
+        path = tb_null;
+    }
+
+    // ok?
+    return path;
+}
+gb_path_ref_t gb_path_init_from_data(tb_byte_t const* data, tb_size_t size)
+{
+    // check data
+    tb_check_return_val(gb_path_data_check(data, size), tb_null);
+
+    // empty? init a writable path
+    gb_path_data_head_t const* head = (gb_path_data_head_t const*)data;
+    if (!head->codes_count) return gb_path_init();
+
+    // init a read-only path
+    gb_path_impl_t* impl = (gb_path_impl_t*)gb_path_init_impl(tb_false);
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // init flag, all states have been made
+    impl->flag = head->flag & ~GB_PATH_FLAG_DIRTY_ALL;
+
+    // init bounds
+    impl->bounds = head->bounds;
+
+    // init hint, remake it if the hint size is not matched
+    tb_byte_t const* p = data + sizeof(gb_path_data_head_t);
+    if (head->format & GB_PATH_DATA_FORMAT_HINT)
+    {
+        if (head->hint_size == sizeof(impl->hint.u))
+        {
+            impl->hint.type = head->hint_type;
+            tb_memcpy(&impl->hint.u, p, sizeof(impl->hint.u));
+        }
+        else impl->flag |= GB_PATH_FLAG_DIRTY_HINT;
+        p += tb_align4(head->hint_size);
+    }
+    else impl->flag |= GB_PATH_FLAG_DIRTY_HINT;
+
+    // init points, the points are referenced directly and will not be modified
+    impl->data_points       = (gb_point_ref_t)p;
+    impl->data_points_count = head->points_count;
+    p += head->points_count * sizeof(gb_point_t);
+
+    // init polygon
+    gb_point_ref_t polygon_points = (gb_point_ref_t)p;
+    p += head->polygon_points_count * sizeof(gb_point_t);
+    if ((head->format & GB_PATH_DATA_FORMAT_POLYGON) && head->polygon_counts_count)
+    {
+        impl->polygon.points = head->polygon_points_count? polygon_points : impl->data_points;
+        impl->polygon.counts = (tb_uint16_t*)p;
+        impl->polygon.convex = (impl->flag & GB_PATH_FLAG_CONVEX)? tb_true : tb_false;
     }
+    else impl->flag |= GB_PATH_FLAG_DIRTY_POLYGON;
+    p += tb_align4(head->polygon_counts_count * sizeof(tb_uint16_t));
+
+    // init codes
+    impl->data_codes        = p;
+    impl->data_codes_count  = head->codes_count;
+
+    // ok
+    return (gb_path_ref_t)impl;
+}
+gb_path_ref_t gb_path_init_from_file(tb_char_t const* file)
+{
+    // check
+    tb_assert_and_check_return_val(file, tb_null);
+
+    // init mapping
+    gb_mapping_ref_t mapping = gb_mapping_init(file);
+    tb_check_return_val(mapping, tb_null);
+
+    // init path
+    gb_path_impl_t* impl = (gb_path_impl_t*)gb_path_init_from_data(gb_mapping_data(mapping), gb_mapping_size(mapping));
+
+    // the read-only path will own the mapping
+    if (impl && impl->data_codes) impl->mapping = mapping;
+    else gb_mapping_exit(mapping);
+
+    // trace
+    tb_trace_d("init: %s: %s", file, impl? "ok" : "no");
 
     // ok?
     return (gb_path_ref_t)impl;
@@ -818,6 +1894,22 @@ tb_void_t gb_path_exit(gb_path_ref_t path)
     if (impl->codes) tb_vector_exit(impl->codes);
     impl->codes = tb_null;
 
+    // exit the queues data of the ring path
+    if (impl->ring_data) tb_free(impl->ring_data);
+    impl->ring_data = tb_null;
+
+    // exit mapping
+    if (impl->mapping) gb_mapping_exit(impl->mapping);
+    impl->mapping = tb_null;
+
+    // exit hit tester
+    if (impl->hit) gb_path_hit_exit(impl->hit);
+    impl->hit = tb_null;
+
+    // exit lod
+    if (impl->lod) gb_path_lod_exit(impl->lod);
+    impl->lod = tb_null;
+
     // exit it
     tb_free(impl);
 }
@@ -825,7 +1917,10 @@ tb_void_t gb_path_clear(gb_path_ref_t path)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points);
+    tb_assert_and_check_return(impl);
+
+    // make writable and discard the read-only data
+    if (!gb_path_make_writable(impl, tb_false)) return ;
 
     // mark dirty
     impl->flag = GB_PATH_FLAG_DIRTY_ALL | GB_PATH_FLAG_SINGLE;
@@ -835,14 +1930,17 @@ tb_void_t gb_path_clear(gb_path_ref_t path)
 
     // clear points
     tb_vector_clear(impl->points);
+    impl->offset = 0;
+
+    // the queues of the ring path will be remade
+    impl->ring_next = 0;
 }
 tb_void_t gb_path_copy(gb_path_ref_t path, gb_path_ref_t copied)
 {
     // check
     gb_path_impl_t* impl        = (gb_path_impl_t*)path;
     gb_path_impl_t* impl_copied = (gb_path_impl_t*)copied;
-    tb_assert_and_check_return(impl && impl->codes && impl->points);
-    tb_assert_and_check_return(impl_copied && impl_copied->codes && impl_copied->points);
+    tb_assert_and_check_return(impl && impl_copied);
 
     // null? clear it
     if (gb_path_null(copied)) 
@@ -851,11 +1949,27 @@ tb_void_t gb_path_copy(gb_path_ref_t path, gb_path_ref_t copied)
         return ;
     }
 
+    // make writable and discard the read-only data
+    if (!gb_path_make_writable(impl, tb_false)) return ;
+
     // copy codes
-    tb_vector_copy(impl->codes, impl_copied->codes);
+    if (impl_copied->data_codes)
+    {
+        if (!tb_vector_resize(impl->codes, impl_copied->data_codes_count)) return ;
+        tb_memcpy(tb_vector_data(impl->codes), impl_copied->data_codes, impl_copied->data_codes_count);
+    }
+    else tb_vector_copy(impl->codes, impl_copied->codes);
 
     // copy points
-    tb_vector_copy(impl->points, impl_copied->points);
+    if (impl_copied->data_codes)
+    {
+        if (!tb_vector_resize(impl->points, impl_copied->data_points_count)) return ;
+        tb_memcpy(tb_vector_data(impl->points), impl_copied->data_points, impl_copied->data_points_count * sizeof(gb_point_t));
+    }
+    else tb_vector_copy(impl->points, impl_copied->points);
+
+    // copy the offset of the live codes and points
+    impl->offset = impl_copied->data_codes? 0 : impl_copied->offset;
 
     // copy flag
     impl->flag = impl_copied->flag | GB_PATH_FLAG_DIRTY_POLYGON;
@@ -864,7 +1978,15 @@ tb_void_t gb_path_copy(gb_path_ref_t path, gb_path_ref_t copied)
     impl->hint = impl_copied->hint;
 
     // copy head
-    impl->head = impl_copied->head;
+    if (impl_copied->data_codes) gb_path_make_head(impl, impl_copied->data_codes, impl_copied->data_codes_count, impl_copied->data_points, impl_copied->data_points_count);
+    else 
+    {
+        impl->head          = impl_copied->head;
+        impl->head_index    = impl_copied->head_index;
+    }
+
+    // the queues of the ring path will be remade
+    impl->ring_next = 0;
 
     // copy bounds
     impl->bounds = impl_copied->bounds;
@@ -873,16 +1995,16 @@ tb_bool_t gb_path_null(gb_path_ref_t path)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return_val(impl && impl->codes, tb_true);
+    tb_assert_and_check_return_val(impl, tb_true);
 
     // null?
-    return tb_vector_size(impl->codes)? tb_false : tb_true;
+    return gb_path_codes_size(impl)? tb_false : tb_true;
 }
 gb_rect_ref_t gb_path_bounds(gb_path_ref_t path)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return_val(impl && impl->points, tb_null);
+    tb_assert_and_check_return_val(impl, tb_null);
 
     // null?
     if (gb_path_null(path)) return tb_null;
@@ -941,11 +2063,11 @@ gb_rect_ref_t gb_path_bounds(gb_path_ref_t path)
         if (impl->flag & GB_PATH_FLAG_DIRTY_BOUNDS)
         {
             // the points
-            gb_point_ref_t points = (gb_point_ref_t)tb_vector_data(impl->points);
+            gb_point_ref_t points = gb_path_points_data(impl);
             tb_assert_and_check_return_val(points, tb_null);
 
             // make bounds
-            gb_bounds_make(&impl->bounds, points, tb_vector_size(impl->points));
+            gb_bounds_make(&impl->bounds, points, gb_path_points_size(impl));
 
             // trace
             tb_trace_d("make: bounds: %{rect} from points", &impl->bounds);
@@ -1000,8 +2122,9 @@ tb_bool_t gb_path_last(gb_path_ref_t path, gb_point_ref_t point)
     tb_assert_and_check_return_val(impl && point, tb_false);
 
     // the last point
-    gb_point_ref_t last = tb_null;
-    if (tb_vector_size(impl->points)) last = (gb_point_ref_t)tb_vector_last(impl->points);
+    gb_point_ref_t  last = tb_null;
+    tb_size_t       size = gb_path_points_size(impl);
+    if (size) last = gb_path_points_data(impl) + size - 1;
 
     // save it
     if (last) *point = *last;
@@ -1015,6 +2138,9 @@ tb_void_t gb_path_last_set(gb_path_ref_t path, gb_point_ref_t point)
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
     tb_assert_and_check_return(impl && point);
 
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
+
     // the last point
     gb_point_ref_t last = tb_null;
     if (tb_vector_size(impl->points)) last = (gb_point_ref_t)tb_vector_last(impl->points);
@@ -1045,6 +2171,50 @@ gb_shape_ref_t gb_path_hint(gb_path_ref_t path)
     // ok?
     return impl->hint.type != GB_SHAPE_TYPE_NONE? &impl->hint : tb_null;
 }
+tb_size_t gb_path_generation(gb_path_ref_t path)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // modified? make a new generation
+    if (!impl->generation) impl->generation = (tb_size_t)tb_atomic_add_and_fetch(&g_generation, 1);
+
+    // ok
+    return impl->generation;
+}
+tb_size_t gb_path_ring(gb_path_ref_t path)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the maximum points count
+    return impl->ring;
+}
+tb_void_t gb_path_ring_set(gb_path_ref_t path, tb_size_t maxn)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return(impl);
+
+    // the path iterator only supports TB_MAXU16 points
+    tb_assert_and_check_return(maxn <= TB_MAXU16);
+
+    // the queues data of the ring path will be reallocated for the new size
+    if (impl->ring != maxn)
+    {
+        if (impl->ring_data) tb_free(impl->ring_data);
+        impl->ring_data = tb_null;
+        impl->ring_next = 0;
+    }
+
+    // set the maximum points count
+    impl->ring = maxn;
+
+    // drop the oldest points now
+    if (impl->ring && !gb_path_null(path) && gb_path_make_writable(impl, tb_true)) gb_path_make_ring(impl);
+}
 gb_polygon_ref_t gb_path_polygon(gb_path_ref_t path)
 {
     // check
@@ -1063,34 +2233,130 @@ gb_polygon_ref_t gb_path_polygon(gb_path_ref_t path)
         // remove dirty
         impl->flag &= ~GB_PATH_FLAG_DIRTY_POLYGON;
     }
+    // convex dirty? only update the convex of the polygon, e.g. the contour has been closed
+    else if (impl->flag & GB_PATH_FLAG_DIRTY_CONVEX) impl->polygon.convex = gb_path_convex(path);
 
     // ok?
     return &impl->polygon;
 }
+gb_polygon_ref_t gb_path_polygon_lod(gb_path_ref_t path, gb_float_t tolerance)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the polygon
+    gb_polygon_ref_t polygon = gb_path_polygon(path);
+    tb_check_return_val(polygon && tolerance > 0, polygon);
+
+    // make the lod for the current generation
+    tb_size_t generation = gb_path_generation(path);
+    if (!impl->lod || impl->lod_generation != generation)
+    {
+        // init lod
+        if (!impl->lod) impl->lod = gb_path_lod_init();
+        tb_assert_and_check_return_val(impl->lod, polygon);
+
+        // make it
+        if (!gb_path_lod_make(impl->lod, polygon))
+        {
+            impl->lod_generation = 0;
+            return polygon;
+        }
+        impl->lod_generation = generation;
+    }
+
+    // the simplified polygon
+    return gb_path_lod_polygon(impl->lod, tolerance);
+}
+tb_bool_t gb_path_contains_point(gb_path_ref_t path, gb_point_ref_t point, tb_size_t rule)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return_val(impl && point, tb_false);
+
+    // outside the bounds?
+    gb_rect_ref_t bounds = gb_path_bounds(path);
+    tb_check_return_val(bounds, tb_false);
+    if (    point->x < bounds->x || point->x > bounds->x + bounds->w
+        ||  point->y < bounds->y || point->y > bounds->y + bounds->h)
+        return tb_false;
+
+    // the hit tester
+    gb_path_hit_ref_t hit = gb_path_hit_tester(impl);
+    tb_check_return_val(hit, tb_false);
+
+    // contains it?
+    return gb_path_hit_contains(hit, point, rule);
+}
+tb_bool_t gb_path_contains_stroke_point(gb_path_ref_t path, gb_point_ref_t point, gb_float_t width, gb_float_t tolerance)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return_val(impl && point && width >= 0 && tolerance >= 0, tb_false);
+
+    // the maximum distance to the polygon
+    gb_float_t distance = gb_half(width) + tolerance;
+
+    // outside the bounds?
+    gb_rect_ref_t bounds = gb_path_bounds(path);
+    tb_check_return_val(bounds, tb_false);
+    if (    point->x < bounds->x - distance || point->x > bounds->x + bounds->w + distance
+        ||  point->y < bounds->y - distance || point->y > bounds->y + bounds->h + distance)
+        return tb_false;
+
+    // the hit tester
+    gb_path_hit_ref_t hit = gb_path_hit_tester(impl);
+    tb_check_return_val(hit, tb_false);
+
+    // near the polygon?
+    return gb_path_hit_near(hit, point, distance);
+}
+tb_bool_t gb_path_op(gb_path_ref_t path, gb_path_ref_t other, tb_size_t op, tb_size_t rule)
+{
+    // check
+    tb_assert_and_check_return_val(path && other, tb_false);
+
+    // done it
+    return gb_path_op_done(path, other, op, rule);
+}
 tb_void_t gb_path_apply(gb_path_ref_t path, gb_matrix_ref_t matrix)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->points && matrix);
+    tb_assert_and_check_return(impl && matrix);
 
     // empty?
     tb_check_return(!gb_path_null(path));
 
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
+
     // done
     tb_for_all_if (gb_point_ref_t, point, impl->points, point)
     {
         // apply it
         gb_point_apply(point, matrix);
     }
+
+    // apply the head of the current contour
+    gb_point_apply(&impl->head, matrix);
+
+    // mark dirty, the queues of the ring path will be remade
+    impl->flag |= GB_PATH_FLAG_DIRTY_ALL;
+    impl->ring_next = 0;
 }
 tb_void_t gb_path_clos(gb_path_ref_t path)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points);
+    tb_assert_and_check_return(impl);
+
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
 
     // close it for avoiding be double closed
-    if (tb_vector_size(impl->points) > 2 && tb_vector_size(impl->codes) && tb_vector_last(impl->codes) != (tb_cpointer_t)GB_PATH_CODE_CLOS) 
+    if (gb_path_points_size(impl) > 2 && gb_path_codes_size(impl) && tb_vector_last(impl->codes) != (tb_cpointer_t)GB_PATH_CODE_CLOS) 
     {
         // patch a line segment if the current point is not equal to the first point of the contour
         gb_point_t last = {0};
@@ -1101,20 +2367,26 @@ tb_void_t gb_path_clos(gb_path_ref_t path)
         tb_vector_insert_tail(impl->codes, (tb_cpointer_t)GB_PATH_CODE_CLOS);
     }
 
-    // mark closed
-    impl->flag |= GB_PATH_FLAG_CLOSED;
+    // mark closed and the convex need be analyzed again
+    impl->flag |= GB_PATH_FLAG_CLOSED | GB_PATH_FLAG_DIRTY_CONVEX;
 }
 tb_void_t gb_path_move_to(gb_path_ref_t path, gb_point_ref_t point)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points && point);
+    tb_assert_and_check_return(impl && point);
+
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
 
     // replace the last point for avoiding one lone move-to point
     if (tb_vector_size(impl->codes) && tb_vector_last(impl->codes) == (tb_cpointer_t)GB_PATH_CODE_MOVE) 
     {
         // replace point
         tb_vector_replace_last(impl->points, point);
+
+        // the replaced point may be on the bounds, remake it
+        impl->flag |= GB_PATH_FLAG_DIRTY_BOUNDS;
     }
     // move-to
     else
@@ -1126,17 +2398,25 @@ tb_void_t gb_path_move_to(gb_path_ref_t path, gb_point_ref_t point)
         tb_vector_insert_tail(impl->points, point);
 
         // clear single if the contour count > 1
-        if (tb_vector_size(impl->codes) > 1) impl->flag &= ~GB_PATH_FLAG_SINGLE;
+        if (gb_path_codes_size(impl) > 1) impl->flag &= ~GB_PATH_FLAG_SINGLE;
+
+        // extend the bounds if it has been made, the appended point is not the only point
+        if (gb_path_points_size(impl) > 1 && !(impl->flag & GB_PATH_FLAG_DIRTY_BOUNDS)) gb_bounds_extend(&impl->bounds, point);
+        else impl->flag |= GB_PATH_FLAG_DIRTY_BOUNDS;
     }
 
     // save point
-    impl->head = *point;
+    impl->head          = *point;
+    impl->head_index    = tb_vector_size(impl->points) - 1;
 
     // clear closed
     impl->flag &= ~GB_PATH_FLAG_CLOSED;
 
-    // mark dirty
-    impl->flag |= GB_PATH_FLAG_DIRTY_ALL;
+    // mark dirty, the bounds has been updated
+    impl->flag |= GB_PATH_FLAG_DIRTY_HINT | GB_PATH_FLAG_DIRTY_POLYGON | GB_PATH_FLAG_DIRTY_CONVEX;
+
+    // drop the oldest points of the ring path
+    if (impl->ring) gb_path_make_ring(impl);
 }
 tb_void_t gb_path_move2_to(gb_path_ref_t path, gb_float_t x, gb_float_t y)
 {
@@ -1160,7 +2440,10 @@ tb_void_t gb_path_line_to(gb_path_ref_t path, gb_point_ref_t point)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points && point);
+    tb_assert_and_check_return(impl && point);
+
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
 
     // closed? patch one move-to point first using the last point
     if (impl->flag & GB_PATH_FLAG_CLOSED)
@@ -1177,8 +2460,11 @@ tb_void_t gb_path_line_to(gb_path_ref_t path, gb_point_ref_t point)
     // append point
     tb_vector_insert_tail(impl->points, point);
 
-    // mark dirty
-    impl->flag |= GB_PATH_FLAG_DIRTY_ALL;
+    // update the bounds, convex and polygon incrementally
+    gb_path_make_line_to(impl, point);
+
+    // drop the oldest points of the ring path
+    if (impl->ring) gb_path_make_ring(impl);
 }
 tb_void_t gb_path_line2_to(gb_path_ref_t path, gb_float_t x, gb_float_t y)
 {
@@ -1202,7 +2488,10 @@ tb_void_t gb_path_quad_to(gb_path_ref_t path, gb_point_ref_t ctrl, gb_point_ref_
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points && ctrl && point);
+    tb_assert_and_check_return(impl && ctrl && point);
+
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
 
     // closed? patch one move-to point first using the last point
     if (impl->flag & GB_PATH_FLAG_CLOSED)
@@ -1253,7 +2542,10 @@ tb_void_t gb_path_cubic_to(gb_path_ref_t path, gb_point_ref_t ctrl0, gb_point_re
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points && ctrl0 && ctrl1 && point);
+    tb_assert_and_check_return(impl && ctrl0 && ctrl1 && point);
+
+    // make writable
+    if (!gb_path_make_writable(impl, tb_true)) return ;
 
     // closed? patch one move-to point first using the last point
     if (impl->flag & GB_PATH_FLAG_CLOSED)
@@ -1577,7 +2869,7 @@ tb_void_t gb_path_add_arc(gb_path_ref_t path, gb_arc_ref_t arc)
 {
     // check
     gb_path_impl_t* impl = (gb_path_impl_t*)path;
-    tb_assert_and_check_return(impl && impl->codes && impl->points && arc);
+    tb_assert_and_check_return(impl && arc);
 
     // ellipse? add it
     if (arc->an >= GB_DEGREE_360 || arc->an <= -GB_DEGREE_360)
@@ -2094,6 +3386,191 @@ tb_void_t gb_path_add_ellipse2i(gb_path_ref_t path, tb_long_t x0, tb_long_t y0,
     // add ellipse
     gb_path_add_ellipse(path, &ellipse, direction);
 }
+tb_bool_t gb_path_save(gb_path_ref_t path, tb_stream_ref_t stream, tb_size_t flags)
+{
+    // check
+    gb_path_impl_t* impl = (gb_path_impl_t*)path;
+    tb_assert_and_check_return_val(impl && stream, tb_false);
+
+    // init head
+    gb_path_data_head_t head;
+    tb_memset(&head, 0, sizeof(gb_path_data_head_t));
+    head.magic      = GB_PATH_DATA_MAGIC;
+    head.version    = GB_PATH_DATA_VERSION;
+    head.format     = GB_PATH_DATA_FORMAT_NATIVE;
+
+    // make the hint, bounds, convex and polygon first
+    gb_polygon_ref_t    polygon = tb_null;
+    tb_size_t           polygon_counts_count = 0;
+    if (!gb_path_null(path))
+    {
+        // make hint, save it even if no hint shape to avoid remaking it after loading
+        gb_path_hint(path);
+        if (!(impl->flag & GB_PATH_FLAG_DIRTY_HINT))
+        {
+            head.format     |= GB_PATH_DATA_FORMAT_HINT;
+            head.hint_type  = (tb_uint8_t)impl->hint.type;
+            head.hint_size  = sizeof(impl->hint.u);
+        }
+
+        // make bounds
+        gb_rect_ref_t bounds = gb_path_bounds(path);
+        tb_assert_and_check_return_val(bounds, tb_false);
+        head.bounds = *bounds;
+
+        // make convex
+        gb_path_convex(path);
+
+        // make polygon
+        if (flags & GB_PATH_SAVE_FLAG_POLYGON)
+        {
+            polygon = gb_path_polygon(path);
+            tb_assert_and_check_return_val(polygon && polygon->points && polygon->counts, tb_false);
+
+            // the polygon points and counts count
+            tb_uint16_t const* counts = polygon->counts;
+            while (*counts) head.polygon_points_count += *counts++;
+            polygon_counts_count = counts - polygon->counts + 1;
+            head.format |= GB_PATH_DATA_FORMAT_POLYGON;
+
+            // reuse the path points if the polygon is not flattened from the curves
+            if (polygon->points == gb_path_points_data(impl)) head.polygon_points_count = 0;
+        }
+    }
+
+    // init the other head info
+    head.flag                   = impl->flag & ~GB_PATH_FLAG_DIRTY_ALL;
+    head.codes_count            = (tb_uint32_t)gb_path_codes_size(impl);
+    head.points_count           = (tb_uint32_t)gb_path_points_size(impl);
+    head.polygon_counts_count   = (tb_uint32_t)polygon_counts_count;
+    head.size                   = (tb_uint32_t)(sizeof(gb_path_data_head_t)
+                                +   ((head.format & GB_PATH_DATA_FORMAT_HINT)? tb_align4(head.hint_size) : 0)
+                                +   (head.points_count + head.polygon_points_count) * sizeof(gb_point_t)
+                                +   tb_align4(head.polygon_counts_count * sizeof(tb_uint16_t))
+                                +   tb_align4(head.codes_count));
+
+    // writ head
+    if (!gb_path_data_writ(stream, &head, sizeof(gb_path_data_head_t))) return tb_false;
+
+    // writ hint
+    if ((head.format & GB_PATH_DATA_FORMAT_HINT) && !gb_path_data_writ(stream, &impl->hint.u, head.hint_size)) return tb_false;
+
+    // writ points
+    if (!gb_path_data_writ(stream, gb_path_points_data(impl), head.points_count * sizeof(gb_point_t))) return tb_false;
+
+    // writ polygon
+    if (polygon)
+    {
+        if (!gb_path_data_writ(stream, head.polygon_points_count? polygon->points : tb_null, head.polygon_points_count * sizeof(gb_point_t))) return tb_false;
+        if (!gb_path_data_writ(stream, polygon->counts, head.polygon_counts_count * sizeof(tb_uint16_t))) return tb_false;
+    }
+
+    // writ codes
+    return gb_path_data_writ(stream, gb_path_codes_data(impl), head.codes_count);
+}
+tb_size_t gb_path_data_size(tb_byte_t const* data, tb_size_t size)
+{
+    // check it and get the path data size
+    return gb_path_data_check(data, size);
+}
+gb_path_pack_ref_t gb_path_pack_init(tb_char_t const* file)
+{
+    // check
+    tb_assert_and_check_return_val(file, tb_null);
+
+    // done
+    tb_bool_t               ok = tb_false;
+    gb_path_pack_impl_t*    impl = tb_null;
+    do
+    {
+        // make pack
+        impl = tb_malloc0_type(gb_path_pack_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init mapping
+        impl->mapping = gb_mapping_init(file);
+        tb_check_break(impl->mapping);
+
+        // count the paths
+        tb_byte_t const*    data = gb_mapping_data(impl->mapping);
+        tb_size_t           size = gb_mapping_size(impl->mapping);
+        tb_size_t           read = 0;
+        tb_size_t           need = 0;
+        for (read = 0; read < size && (need = gb_path_data_size(data + read, size - read)); read += need) impl->count++;
+
+        // the file must only contain the valid paths
+        tb_check_break(read == size);
+
+        // make offsets
+        impl->offsets = tb_nalloc_type(impl->count + 1, tb_size_t);
+        tb_assert_and_check_break(impl->offsets);
+
+        // init offsets
+        tb_size_t index = 0;
+        for (read = 0; index < impl->count; read += gb_path_data_size(data + read, size - read)) impl->offsets[index++] = read;
+        impl->offsets[index] = read;
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // trace
+    tb_trace_d("pack: init: %s: %lu paths: %s", file, impl? impl->count : 0, ok? "ok" : "no");
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_path_pack_exit((gb_path_pack_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_path_pack_ref_t)impl;
+}
+tb_void_t gb_path_pack_exit(gb_path_pack_ref_t pack)
+{
+    // check
+    gb_path_pack_impl_t* impl = (gb_path_pack_impl_t*)pack;
+    tb_assert_and_check_return(impl);
+
+    // exit offsets
+    if (impl->offsets) tb_free(impl->offsets);
+    impl->offsets = tb_null;
+
+    // exit mapping, it is kept if the paths still reference it
+    if (impl->mapping) gb_mapping_exit(impl->mapping);
+    impl->mapping = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_size_t gb_path_pack_size(gb_path_pack_ref_t pack)
+{
+    // check
+    gb_path_pack_impl_t* impl = (gb_path_pack_impl_t*)pack;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the paths count
+    return impl->count;
+}
+gb_path_ref_t gb_path_pack_path(gb_path_pack_ref_t pack, tb_size_t index)
+{
+    // check
+    gb_path_pack_impl_t* impl = (gb_path_pack_impl_t*)pack;
+    tb_assert_and_check_return_val(impl && impl->mapping && impl->offsets && index < impl->count, tb_null);
+
+    // init path
+    tb_size_t       offset = impl->offsets[index];
+    gb_path_impl_t* path = (gb_path_impl_t*)gb_path_init_from_data(gb_mapping_data(impl->mapping) + offset, impl->offsets[index + 1] - offset);
+
+    // the read-only path will keep the mapping after the pack is exited
+    if (path && path->data_codes) path->mapping = gb_mapping_inc(impl->mapping);
+
+    // ok?
+    return (gb_path_ref_t)path;
+}
 #ifdef __gb_debug__
 tb_void_t gb_path_dump(gb_path_ref_t path)
 {
@@ -71,6 +71,30 @@ typedef struct __gb_path_item_t
 
 }gb_path_item_t, *gb_path_item_ref_t;
 
+/// the path save flag enum
+typedef enum __gb_path_save_flag_e
+{
+    GB_PATH_SAVE_FLAG_NONE      = 0 //!< only save the codes, points, bounds and hint
+,   GB_PATH_SAVE_FLAG_POLYGON   = 1 //!< save the flattened polygon too
+
+}gb_path_save_flag_e;
+
+/// the path operation enum
+typedef enum __gb_path_op_e
+{
+    GB_PATH_OP_UNION            = 0 //!< the union of two paths
+,   GB_PATH_OP_INTERSECT        = 1 //!< the intersection of two paths
+,   GB_PATH_OP_DIFFERENCE       = 2 //!< the path minus the other path
+,   GB_PATH_OP_XOR              = 3 //!< the exclusive-or of two paths
+
+}gb_path_op_e;
+
+/*! the path pack ref type
+ *
+ * the mapped file of the paths saved by gb_path_save one by one
+ */
+typedef struct{}*   gb_path_pack_ref_t;
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * interfaces
  */
@@ -81,6 +105,38 @@ typedef struct __gb_path_item_t
  */
 gb_path_ref_t       gb_path_init(tb_noarg_t);
 
+/*! init path from the svg path data
+ *
+ * supports the full grammar of the "d" attribute, e.g. "M10 10h20v20H10z" or "m5,5 a10,10 0 1,0 20,0"
+ *
+ * @param data      the svg path data
+ *
+ * @return          the path, return tb_null if the data is empty or invalid
+ */
+gb_path_ref_t       gb_path_init_from_svg_data(tb_char_t const* data);
+
+/*! init path from the binary path data saved by gb_path_save
+ *
+ * the path references the data directly without copying and is read-only until it is modified,
+ * so the data must be aligned by 4 bytes and be kept until the path is exited or modified
+ *
+ * @param data      the path data
+ * @param size      the data size
+ *
+ * @return          the path, return tb_null if the data is invalid or not native format
+ */
+gb_path_ref_t       gb_path_init_from_data(tb_byte_t const* data, tb_size_t size);
+
+/*! init path from the binary path file saved by gb_path_save
+ *
+ * the file will be mapped to the memory and the path references it directly
+ *
+ * @param file      the file path
+ *
+ * @return          the path
+ */
+gb_path_ref_t       gb_path_init_from_file(tb_char_t const* file);
+
 /*! exit path
  *
  * @param path      the path
@@ -156,6 +212,38 @@ tb_void_t           gb_path_last_set(gb_path_ref_t path, gb_point_ref_t point);
  */
 gb_shape_ref_t      gb_path_hint(gb_path_ref_t path);
 
+/*! the path generation
+ *
+ * the generation is unique for all paths and will be changed after the path is modified,
+ * so it can be used as the key of the caches which are made from the path
+ *
+ * @param path      the path
+ *
+ * @return          the generation
+ */
+tb_size_t           gb_path_generation(gb_path_ref_t path);
+
+/*! the maximum points count of the ring path
+ *
+ * @param path      the path
+ *
+ * @return          the maximum points count, zero if the path is not a ring path
+ */
+tb_size_t           gb_path_ring(gb_path_ref_t path);
+
+/*! set the maximum points count and make it as the ring path
+ *
+ * the oldest points will be dropped from the head if the points count exceeds the maximum count,
+ * it is used to draw the scrolling polyline, e.g. the live chart.
+ *
+ * only the path with move-to and line-to supports it, 
+ * the head points of the path with curves or closed contours will not be dropped.
+ *
+ * @param path      the path
+ * @param maxn      the maximum points count, disable it if be zero
+ */
+tb_void_t           gb_path_ring_set(gb_path_ref_t path, tb_size_t maxn);
+
 /*! the path polygon 
  *
  * @param path      the path
@@ -164,6 +252,67 @@ gb_shape_ref_t      gb_path_hint(gb_path_ref_t path);
  */
 gb_polygon_ref_t    gb_path_polygon(gb_path_ref_t path);
 
+/*! the simplified path polygon for the level of detail
+ *
+ * the points whose distance to the simplified contours is not larger than the tolerance are removed by the douglas-peucker,
+ * e.g. the points of the large polyline in the same device pixel. the importance of all points is made once for each generation,
+ * and the recent simplified levels are cached, so the polygon for the new tolerance is only an O(n) filter of the points.
+ *
+ * the tolerance is rounded down to the power of two and the small polygon is not simplified.
+ *
+ * @param path      the path
+ * @param tolerance the tolerance in the path coordinate, e.g. a quarter of the device pixel divided by the scale
+ *
+ * @return          the polygon
+ */
+gb_polygon_ref_t    gb_path_polygon_lod(gb_path_ref_t path, gb_float_t tolerance);
+
+/*! the path contains the point?
+ *
+ * the point out of the bounds is rejected at first,
+ * and the edges of the polygon are bucketed into the grid cells for the winding query,
+ * so only the edges of the cells on the right of the point are tested,
+ * the grid will be made at the first query after the path is modified.
+ *
+ * the contours are closed implicitly and the point on the edges is contained.
+ *
+ * @param path      the path
+ * @param point     the point
+ * @param rule      the fill rule, e.g. GB_PAINT_FILL_RULE_ODD, GB_PAINT_FILL_RULE_NONZERO
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_path_contains_point(gb_path_ref_t path, gb_point_ref_t point, tb_size_t rule);
+
+/*! the stroked path contains the point?
+ *
+ * the point is contained if its distance to the polygon of the path is not larger than width / 2 + tolerance,
+ * the joins and caps are regarded as the round joins and caps.
+ *
+ * @param path      the path
+ * @param point     the point
+ * @param width     the stroke width
+ * @param tolerance the tolerance, e.g. for picking the thin lines by the cursor
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_path_contains_stroke_point(gb_path_ref_t path, gb_point_ref_t point, gb_float_t width, gb_float_t tolerance);
+
+/*! the boolean operation of two paths: path = path op other
+ *
+ * the result path only contains the closed polygons without the overlapped contours,
+ * the outline contours are counter-clockwise and the hole contours are clockwise in the screen coordinate,
+ * so it can be filled by any fill rule, e.g. merge thousands of static shapes to one path before drawing them.
+ *
+ * @param path      the path
+ * @param other     the other path, it can be the path self
+ * @param op        the operation, e.g. GB_PATH_OP_UNION, GB_PATH_OP_INTERSECT, ...
+ * @param rule      the fill rule of two paths, e.g. GB_PAINT_FILL_RULE_ODD, GB_PAINT_FILL_RULE_NONZERO
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_path_op(gb_path_ref_t path, gb_path_ref_t other, tb_size_t op, tb_size_t rule);
+
 /*! apply the matrix to the path 
  *
  * @param path      the path
@@ -551,6 +700,101 @@ tb_void_t           gb_path_add_ellipse2(gb_path_ref_t path, gb_float_t x0, gb_f
  */
 tb_void_t           gb_path_add_ellipse2i(gb_path_ref_t path, tb_long_t x0, tb_long_t y0, tb_size_t rx, tb_size_t ry, tb_size_t direction);
 
+/*! save path to the binary path data
+ *
+ * the data is stored by the native float type and endian, 
+ * and multiple paths can be saved to the same stream one by one
+ *
+ * @param path      the path
+ * @param stream    the stream
+ * @param flags     the save flags, .e.g GB_PATH_SAVE_FLAG_POLYGON
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_path_save(gb_path_ref_t path, tb_stream_ref_t stream, tb_size_t flags);
+
+/*! the size of the binary path data at the given data
+ *
+ * @code
+    tb_size_t read = 0;
+    while (read < size)
+    {
+        tb_size_t n = gb_path_data_size(data + read, size - read);
+        if (!n) break;
+
+        gb_path_ref_t path = gb_path_init_from_data(data + read, n);
+        if (path)
+        {
+            // ...
+            gb_path_exit(path);
+        }
+        read += n;
+    }
+ * @endcode
+ *
+ * @param data      the path data
+ * @param size      the data size
+ *
+ * @return          the path data size, return zero if the data is invalid
+ */
+tb_size_t           gb_path_data_size(tb_byte_t const* data, tb_size_t size);
+
+/*! init the path pack from the binary path file saved by gb_path_save
+ *
+ * the file will be mapped to the memory once and all paths in it are referenced directly
+ *
+ * @code
+    gb_path_pack_ref_t pack = gb_path_pack_init("/tmp/icons.path");
+    if (pack)
+    {
+        tb_size_t i = 0;
+        tb_size_t n = gb_path_pack_size(pack);
+        for (i = 0; i < n; i++)
+        {
+            gb_path_ref_t path = gb_path_pack_path(pack, i);
+            if (path)
+            {
+                // ...
+                gb_path_exit(path);
+            }
+        }
+        gb_path_pack_exit(pack);
+    }
+ * @endcode
+ *
+ * @param file      the file path
+ *
+ * @return          the path pack, return tb_null if the file is not a valid path file
+ */
+gb_path_pack_ref_t  gb_path_pack_init(tb_char_t const* file);
+
+/*! exit the path pack
+ *
+ * the paths made from it are still valid and the file is unmapped after all of them are exited
+ *
+ * @param pack      the path pack
+ */
+tb_void_t           gb_path_pack_exit(gb_path_pack_ref_t pack);
+
+/*! the paths count of the path pack
+ *
+ * @param pack      the path pack
+ *
+ * @return          the paths count
+ */
+tb_size_t           gb_path_pack_size(gb_path_pack_ref_t pack);
+
+/*! init the path at the given index of the path pack
+ *
+ * the path references the mapped file without copying and must be exited by gb_path_exit
+ *
+ * @param pack      the path pack
+ * @param index     the path index
+ *
+ * @return          the path
+ */
+gb_path_ref_t       gb_path_pack_path(gb_path_pack_ref_t pack, tb_size_t index);
+
 #ifdef __gb_debug__
 /*! dump path
  *
@@ -40,6 +40,7 @@
 #include "pixmap/rgbx4444.h"
 #include "pixmap/rgba8888.h"
 #include "pixmap/rgbx8888.h"
+#include "pixmap/bgr.h"
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * globals 
@@ -64,20 +65,20 @@ static gb_pixmap_ref_t g_pixmaps_lo[] =
 ,	&g_pixmap_lo_rgba8888
 ,	&g_pixmap_lo_rgbx8888
 
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
+,	&g_pixmap_lo_bgr565
+,	&g_pixmap_lo_bgr888
+,	&g_pixmap_lo_abgr1555
+,	&g_pixmap_lo_xbgr1555
+,	&g_pixmap_lo_abgr4444
+,	&g_pixmap_lo_xbgr4444
+,	&g_pixmap_lo_abgr8888
+,	&g_pixmap_lo_xbgr8888
+,	&g_pixmap_lo_bgra5551
+,	&g_pixmap_lo_bgrx5551
+,	&g_pixmap_lo_bgra4444
+,	&g_pixmap_lo_bgrx4444
+,	&g_pixmap_lo_bgra8888
+,	&g_pixmap_lo_bgrx8888
 
 };
 
@@ -100,20 +101,20 @@ static gb_pixmap_ref_t g_pixmaps_bo[] =
 ,	&g_pixmap_bo_rgba8888
 ,	&g_pixmap_bo_rgbx8888
 
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
+,	&g_pixmap_bo_bgr565
+,	&g_pixmap_bo_bgr888
+,	&g_pixmap_bo_abgr1555
+,	&g_pixmap_bo_xbgr1555
+,	&g_pixmap_bo_abgr4444
+,	&g_pixmap_bo_xbgr4444
+,	&g_pixmap_bo_abgr8888
+,	&g_pixmap_bo_xbgr8888
+,	&g_pixmap_bo_bgra5551
+,	&g_pixmap_bo_bgrx5551
+,	&g_pixmap_bo_bgra4444
+,	&g_pixmap_bo_bgrx4444
+,	&g_pixmap_bo_bgra8888
+,	&g_pixmap_bo_bgrx8888
 
 };
 
@@ -136,20 +137,20 @@ static gb_pixmap_ref_t g_pixmaps_la[] =
 ,	&g_pixmap_la_rgba8888
 ,	&g_pixmap_la_rgbx8888
 
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
+,	&g_pixmap_la_bgr565
+,	&g_pixmap_la_bgr888
+,	&g_pixmap_la_abgr1555
+,	&g_pixmap_la_xbgr1555
+,	&g_pixmap_la_abgr4444
+,	&g_pixmap_la_xbgr4444
+,	&g_pixmap_la_abgr8888
+,	&g_pixmap_la_xbgr8888
+,	&g_pixmap_la_bgra5551
+,	&g_pixmap_la_bgrx5551
+,	&g_pixmap_la_bgra4444
+,	&g_pixmap_la_bgrx4444
+,	&g_pixmap_la_bgra8888
+,	&g_pixmap_la_bgrx8888
 
 };
 
@@ -172,20 +173,20 @@ static gb_pixmap_ref_t g_pixmaps_ba[] =
 ,	&g_pixmap_ba_rgba8888
 ,	&g_pixmap_ba_rgbx8888
 
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
-,	tb_null
+,	&g_pixmap_ba_bgr565
+,	&g_pixmap_ba_bgr888
+,	&g_pixmap_ba_abgr1555
+,	&g_pixmap_ba_xbgr1555
+,	&g_pixmap_ba_abgr4444
+,	&g_pixmap_ba_xbgr4444
+,	&g_pixmap_ba_abgr8888
+,	&g_pixmap_ba_xbgr8888
+,	&g_pixmap_ba_bgra5551
+,	&g_pixmap_ba_bgrx5551
+,	&g_pixmap_ba_bgra4444
+,	&g_pixmap_ba_bgrx4444
+,	&g_pixmap_ba_bgra8888
+,	&g_pixmap_ba_bgrx8888
 
 };
 
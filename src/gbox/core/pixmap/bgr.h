@@ -0,0 +1,184 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        bgr.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_PIXMAP_BGR_H
+#define GB_CORE_PIXMAP_BGR_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+#include "rgb565.h"
+#include "rgb888.h"
+#include "argb1555.h"
+#include "xrgb1555.h"
+#include "argb4444.h"
+#include "xrgb4444.h"
+#include "argb8888.h"
+#include "xrgb8888.h"
+#include "rgba5551.h"
+#include "rgbx5551.h"
+#include "rgba4444.h"
+#include "rgbx4444.h"
+#include "rgba8888.h"
+#include "rgbx8888.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+/* define the bgr pixmaps from the rgb pixmap with the same channel layout
+ *
+ * the bgr pixel only swaps the r and b channels of the rgb pixel, e.g. bgra8888 <=> rgba8888,
+ * and the blending and filling of the pixels do not depend on the channel order, 
+ * so the pixels kernels of the rgb pixmap are reused and only the pixel and color conversions are swizzled.
+ *
+ * the pixel is converted only once for filling the span, so drawing the bgr bitmap is as fast as the rgb bitmap.
+ *
+ * @param bgr       the bgr pixmap name, e.g. bgra8888
+ * @param rgb       the rgb pixmap name, e.g. rgba8888
+ * @param bits      the pixels kernels of the opaque rgb pixmap, e.g. rgb16, rgb24, rgb32
+ * @param bpp       the bits per pixel
+ * @param btp       the bytes per pixel
+ * @param pixfmt    the bgr pixfmt
+ */
+#define GB_PIXMAP_BGR_DEFINE(bgr, rgb, bits, bpp, btp, pixfmt) \
+    static __tb_inline__ gb_color_t gb_pixmap_##bgr##_swap(gb_color_t color) \
+    { \
+        tb_byte_t r = color.r; \
+        color.r = color.b; \
+        color.b = r; \
+        return color; \
+    } \
+    static __tb_inline__ gb_pixel_t gb_pixmap_##bgr##_pixel(gb_color_t color) \
+    { \
+        return gb_pixmap_##rgb##_pixel(gb_pixmap_##bgr##_swap(color)); \
+    } \
+    static __tb_inline__ gb_color_t gb_pixmap_##bgr##_color(gb_pixel_t pixel) \
+    { \
+        return gb_pixmap_##bgr##_swap(gb_pixmap_##rgb##_color(pixel)); \
+    } \
+    static __tb_inline__ tb_void_t gb_pixmap_##bgr##_color_set_lo(tb_pointer_t data, gb_color_t color) \
+    { \
+        gb_pixmap_##rgb##_color_set_lo(data, gb_pixmap_##bgr##_swap(color)); \
+    } \
+    static __tb_inline__ tb_void_t gb_pixmap_##bgr##_color_set_bo(tb_pointer_t data, gb_color_t color) \
+    { \
+        gb_pixmap_##rgb##_color_set_bo(data, gb_pixmap_##bgr##_swap(color)); \
+    } \
+    static __tb_inline__ tb_void_t gb_pixmap_##bgr##_color_set_la(tb_pointer_t data, gb_color_t color) \
+    { \
+        gb_pixmap_##rgb##_color_set_la(data, gb_pixmap_##bgr##_swap(color)); \
+    } \
+    static __tb_inline__ tb_void_t gb_pixmap_##bgr##_color_set_ba(tb_pointer_t data, gb_color_t color) \
+    { \
+        gb_pixmap_##rgb##_color_set_ba(data, gb_pixmap_##bgr##_swap(color)); \
+    } \
+    static __tb_inline__ gb_color_t gb_pixmap_##bgr##_color_get_l(tb_cpointer_t data) \
+    { \
+        return gb_pixmap_##bgr##_swap(gb_pixmap_##rgb##_color_get_l(data)); \
+    } \
+    static __tb_inline__ gb_color_t gb_pixmap_##bgr##_color_get_b(tb_cpointer_t data) \
+    { \
+        return gb_pixmap_##bgr##_swap(gb_pixmap_##rgb##_color_get_b(data)); \
+    } \
+    static gb_pixmap_t const g_pixmap_lo_##bgr = \
+    { \
+        #bgr \
+    ,   bpp \
+    ,   btp \
+    ,   pixfmt \
+    ,   gb_pixmap_##bgr##_pixel \
+    ,   gb_pixmap_##bgr##_color \
+    ,   gb_pixmap_##bits##_pixel_get_l \
+    ,   gb_pixmap_##bits##_pixel_set_lo \
+    ,   gb_pixmap_##bits##_pixel_cpy_o \
+    ,   gb_pixmap_##bgr##_color_get_l \
+    ,   gb_pixmap_##bgr##_color_set_lo \
+    ,   gb_pixmap_##bits##_pixels_fill_lo \
+    }; \
+    static gb_pixmap_t const g_pixmap_bo_##bgr = \
+    { \
+        #bgr \
+    ,   bpp \
+    ,   btp \
+    ,   pixfmt | GB_PIXFMT_BENDIAN \
+    ,   gb_pixmap_##bgr##_pixel \
+    ,   gb_pixmap_##bgr##_color \
+    ,   gb_pixmap_##bits##_pixel_get_b \
+    ,   gb_pixmap_##bits##_pixel_set_bo \
+    ,   gb_pixmap_##bits##_pixel_cpy_o \
+    ,   gb_pixmap_##bgr##_color_get_b \
+    ,   gb_pixmap_##bgr##_color_set_bo \
+    ,   gb_pixmap_##bits##_pixels_fill_bo \
+    }; \
+    static gb_pixmap_t const g_pixmap_la_##bgr = \
+    { \
+        #bgr \
+    ,   bpp \
+    ,   btp \
+    ,   pixfmt \
+    ,   gb_pixmap_##bgr##_pixel \
+    ,   gb_pixmap_##bgr##_color \
+    ,   gb_pixmap_##bits##_pixel_get_l \
+    ,   gb_pixmap_##rgb##_pixel_set_la \
+    ,   gb_pixmap_##rgb##_pixel_cpy_la \
+    ,   gb_pixmap_##bgr##_color_get_l \
+    ,   gb_pixmap_##bgr##_color_set_la \
+    ,   gb_pixmap_##rgb##_pixels_fill_la \
+    }; \
+    static gb_pixmap_t const g_pixmap_ba_##bgr = \
+    { \
+        #bgr \
+    ,   bpp \
+    ,   btp \
+    ,   pixfmt | GB_PIXFMT_BENDIAN \
+    ,   gb_pixmap_##bgr##_pixel \
+    ,   gb_pixmap_##bgr##_color \
+    ,   gb_pixmap_##bits##_pixel_get_b \
+    ,   gb_pixmap_##rgb##_pixel_set_ba \
+    ,   gb_pixmap_##rgb##_pixel_cpy_ba \
+    ,   gb_pixmap_##bgr##_color_get_b \
+    ,   gb_pixmap_##bgr##_color_set_ba \
+    ,   gb_pixmap_##rgb##_pixels_fill_ba \
+    };
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+GB_PIXMAP_BGR_DEFINE(bgr565,    rgb565,     rgb16, 16, 2, GB_PIXFMT_BGR565)
+GB_PIXMAP_BGR_DEFINE(bgr888,    rgb888,     rgb24, 24, 3, GB_PIXFMT_BGR888)
+GB_PIXMAP_BGR_DEFINE(abgr1555,  argb1555,   rgb16, 16, 2, GB_PIXFMT_ABGR1555)
+GB_PIXMAP_BGR_DEFINE(xbgr1555,  xrgb1555,   rgb16, 16, 2, GB_PIXFMT_XBGR1555)
+GB_PIXMAP_BGR_DEFINE(abgr4444,  argb4444,   rgb16, 16, 2, GB_PIXFMT_ABGR4444)
+GB_PIXMAP_BGR_DEFINE(xbgr4444,  xrgb4444,   rgb16, 16, 2, GB_PIXFMT_XBGR4444)
+GB_PIXMAP_BGR_DEFINE(abgr8888,  argb8888,   rgb32, 32, 4, GB_PIXFMT_ABGR8888)
+GB_PIXMAP_BGR_DEFINE(xbgr8888,  xrgb8888,   rgb32, 32, 4, GB_PIXFMT_XBGR8888)
+GB_PIXMAP_BGR_DEFINE(bgra5551,  rgba5551,   rgb16, 16, 2, GB_PIXFMT_BGRA5551)
+GB_PIXMAP_BGR_DEFINE(bgrx5551,  rgbx5551,   rgb16, 16, 2, GB_PIXFMT_BGRX5551)
+GB_PIXMAP_BGR_DEFINE(bgra4444,  rgba4444,   rgb16, 16, 2, GB_PIXFMT_BGRA4444)
+GB_PIXMAP_BGR_DEFINE(bgrx4444,  rgbx4444,   rgb16, 16, 2, GB_PIXFMT_BGRX4444)
+GB_PIXMAP_BGR_DEFINE(bgra8888,  rgba8888,   rgb32, 32, 4, GB_PIXFMT_BGRA8888)
+GB_PIXMAP_BGR_DEFINE(bgrx8888,  rgbx8888,   rgb32, 32, 4, GB_PIXFMT_BGRX8888)
+
+#endif
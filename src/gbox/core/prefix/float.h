@@ -158,7 +158,11 @@ __tb_extern_c_enter__
 #define gb_float_to_fixed(x)    tb_float_to_fixed(x)
 
 #define gb_fixed6_to_float(x)   tb_fixed6_to_float(x)
-#define gb_float_to_fixed6(x)   tb_float_to_fixed6(x)
+
+/* the fixed6 coordinates of the rasterizer are floored like the fixed-point build,
+ * the truncated negative coordinates will make the rasterized pixels be changed after translating
+ */
+#define gb_float_to_fixed6(x)   ((tb_fixed6_t)tb_floor((x) * TB_FIXED6_ONE))
 
 #define gb_fixed30_to_float(x)  tb_fixed30_to_float(x)
 #define gb_float_to_fixed30(x)  tb_float_to_fixed30(x)
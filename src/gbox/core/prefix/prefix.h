@@ -52,11 +52,17 @@
 /// the height maxn
 #define GB_HEIGHT_MAXN          (8192)
 
+/// the min-alpha for the given quality
+#define GB_QUALITY_ALPHA_MINN(quality)  ((tb_byte_t)((GB_QUALITY_TOP - (quality)) << 3))
+
+/// the max-alpha for the given quality
+#define GB_QUALITY_ALPHA_MAXN(quality)  ((tb_byte_t)(0xff - ((GB_QUALITY_TOP - (quality)) << 3)))
+
 /*! the min-alpha
  *
  * is_transparent = alpha < GB_ALPHA_MINN? tb_true : tb_false
  */
-#define GB_ALPHA_MINN           ((tb_byte_t)((GB_QUALITY_TOP - gb_quality()) << 3))
+#define GB_ALPHA_MINN           GB_QUALITY_ALPHA_MINN(gb_quality())
 
 /*! the max-alpha 
  *
@@ -64,7 +70,7 @@
  * has_alpha = alpha <= GB_QUALITY_ALPHA_MAXN? tb_true : tb_false
  * @endcode
  */
-#define GB_ALPHA_MAXN           ((tb_byte_t)(0xff - ((GB_QUALITY_TOP - gb_quality()) << 3)))
+#define GB_ALPHA_MAXN           GB_QUALITY_ALPHA_MAXN(gb_quality())
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
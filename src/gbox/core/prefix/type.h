@@ -36,7 +36,11 @@
 
 /*! @def gb_float_t
  *
- * the float type
+ * the float type for the geometry, stroker and tessellator
+ *
+ * it is tb_fixed_t if the fixed option is enabled, otherwise tb_float_t.
+ * the polygon raster and lines renderer always step the edges in fixed-point 
+ * and convert the points by gb_float_to_fixed6, so they are same for the both builds.
  */
 #ifdef GB_CONFIG_FLOAT_FIXED
 typedef tb_fixed_t      gb_float_t;
@@ -349,6 +353,12 @@ typedef struct __gb_shape_t
 
 }gb_shape_t, *gb_shape_ref_t;
 
+/// the context ref type
+typedef struct{}*       gb_context_ref_t;
+
+/// the profiler ref type
+typedef struct{}*       gb_profiler_ref_t;
+
 /// the device ref type
 typedef struct{}*       gb_device_ref_t;
 
@@ -367,6 +377,15 @@ typedef struct{}*       gb_shader_ref_t;
 /// the clipper ref type
 typedef struct{}*       gb_clipper_ref_t;
 
+/// the density ref type
+typedef struct{}*       gb_density_ref_t;
+
+/// the scene ref type
+typedef struct{}*       gb_scene_ref_t;
+
+/// the raster cache ref type
+typedef struct{}*       gb_raster_cache_ref_t;
+
 #endif
 
 
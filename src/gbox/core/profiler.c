@@ -0,0 +1,275 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        profiler.c
+ * @ingroup     core
+ *
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "profiler"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "profiler.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the profiler impl type
+typedef struct __gb_profiler_impl_t
+{
+    // the frames
+    gb_profiler_frame_t*        frames;
+
+    // the maximum frames count
+    tb_size_t                   maxn;
+
+    // the head index of the frames
+    tb_size_t                   head;
+
+    // the recorded frames count
+    tb_size_t                   size;
+
+    // the current frame
+    gb_profiler_frame_t         frame;
+
+    // the frames count, the index of the next frame
+    tb_size_t                   count;
+
+    // in frame?
+    tb_bool_t                   in_frame;
+
+}gb_profiler_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+// the stage names
+static tb_char_t const* g_stage_names[] = 
+{
+    "flatten"
+,   "stroke"
+,   "tessellate"
+,   "raster"
+,   "blit"
+};
+
+// the count names
+static tb_char_t const* g_count_names[] = 
+{
+    "paths"
+,   "spans"
+,   "pixels"
+,   "draws"
+};
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_profiler_ref_t gb_profiler_init(tb_size_t maxn)
+{
+    // done
+    tb_bool_t           ok = tb_false;
+    gb_profiler_impl_t* impl = tb_null;
+    do
+    {
+        // make profiler
+        impl = tb_malloc0_type(gb_profiler_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init frames
+        impl->maxn      = maxn? maxn : GB_PROFILER_FRAMES_DEFAULT;
+        impl->frames    = tb_nalloc0_type(impl->maxn, gb_profiler_frame_t);
+        tb_assert_and_check_break(impl->frames);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_profiler_exit((gb_profiler_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_profiler_ref_t)impl;
+}
+tb_void_t gb_profiler_exit(gb_profiler_ref_t profiler)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return(impl);
+
+    // exit frames
+    if (impl->frames) tb_free(impl->frames);
+    impl->frames = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_void_t gb_profiler_clear(gb_profiler_ref_t profiler)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return(impl);
+
+    // clear frames
+    impl->head      = 0;
+    impl->size      = 0;
+    impl->count     = 0;
+    impl->in_frame  = tb_false;
+    tb_memset(&impl->frame, 0, sizeof(gb_profiler_frame_t));
+}
+tb_void_t gb_profiler_frame_begin(gb_profiler_ref_t profiler)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return(impl);
+
+    // init the current frame
+    tb_memset(&impl->frame, 0, sizeof(gb_profiler_frame_t));
+    impl->frame.index   = impl->count;
+    impl->frame.time    = tb_uclock();
+    impl->in_frame      = tb_true;
+}
+tb_void_t gb_profiler_frame_end(gb_profiler_ref_t profiler)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return(impl && impl->frames && impl->maxn);
+
+    // not in frame? ignore it
+    tb_check_return(impl->in_frame);
+
+    // the frame duration
+    impl->frame.duration = tb_uclock() - impl->frame.time;
+
+    // drop the oldest frame if full
+    if (impl->size == impl->maxn)
+    {
+        impl->head = (impl->head + 1) % impl->maxn;
+        impl->size--;
+    }
+
+    // record the current frame
+    impl->frames[(impl->head + impl->size) % impl->maxn] = impl->frame;
+    impl->size++;
+
+    // trace
+    tb_trace_d("frame: %lu, %lld us", impl->frame.index, impl->frame.duration);
+
+    // next frame
+    impl->count++;
+    impl->in_frame = tb_false;
+}
+tb_size_t gb_profiler_size(gb_profiler_ref_t profiler)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the recorded frames count
+    return impl->size;
+}
+gb_profiler_frame_ref_t gb_profiler_frame(gb_profiler_ref_t profiler, tb_size_t index)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return_val(impl && impl->frames && index < impl->size, tb_null);
+
+    // the frame
+    return &impl->frames[(impl->head + index) % impl->maxn];
+}
+tb_void_t gb_profiler_stage_add(gb_profiler_ref_t profiler, tb_size_t stage, tb_hong_t time)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return(impl && stage < GB_PROFILER_STAGE_MAXN);
+
+    // add the spent time
+    impl->frame.stages[stage] += time;
+}
+tb_void_t gb_profiler_count_add(gb_profiler_ref_t profiler, tb_size_t count, tb_size_t value)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return(impl && count < GB_PROFILER_COUNT_MAXN);
+
+    // add the count
+    impl->frame.counts[count] += value;
+}
+tb_bool_t gb_profiler_dump(gb_profiler_ref_t profiler, tb_stream_ref_t stream)
+{
+    // check
+    gb_profiler_impl_t* impl = (gb_profiler_impl_t*)profiler;
+    tb_assert_and_check_return_val(impl && stream, tb_false);
+
+    // begin events
+    if (tb_stream_printf(stream, "{\"traceEvents\":[\n") < 0) return tb_false;
+
+    // done
+    tb_size_t i = 0;
+    tb_size_t j = 0;
+    for (i = 0; i < impl->size; i++)
+    {
+        // the frame
+        gb_profiler_frame_ref_t frame = gb_profiler_frame(profiler, i);
+        tb_assert_and_check_return_val(frame, tb_false);
+
+        // the frame event
+        if (tb_stream_printf(stream, "%s{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%lld,\"dur\":%lld,\"args\":{\"index\":%lu}}\n"
+                ,   i? "," : ""
+                ,   frame->time
+                ,   frame->duration
+                ,   frame->index) < 0) return tb_false;
+
+        // the stages event
+        if (tb_stream_printf(stream, ",{\"name\":\"stages\",\"ph\":\"C\",\"pid\":1,\"ts\":%lld,\"args\":{", frame->time) < 0) return tb_false;
+        for (j = 0; j < GB_PROFILER_STAGE_MAXN; j++)
+        {
+            if (tb_stream_printf(stream, "%s\"%s\":%lld", j? "," : "", g_stage_names[j], frame->stages[j]) < 0) return tb_false;
+        }
+        if (tb_stream_printf(stream, "}}\n") < 0) return tb_false;
+
+        // the counts event
+        if (tb_stream_printf(stream, ",{\"name\":\"counts\",\"ph\":\"C\",\"pid\":1,\"ts\":%lld,\"args\":{", frame->time) < 0) return tb_false;
+        for (j = 0; j < GB_PROFILER_COUNT_MAXN; j++)
+        {
+            if (tb_stream_printf(stream, "%s\"%s\":%lu", j? "," : "", g_count_names[j], frame->counts[j]) < 0) return tb_false;
+        }
+        if (tb_stream_printf(stream, "}}\n") < 0) return tb_false;
+    }
+
+    // end events
+    if (tb_stream_printf(stream, "],\"displayTimeUnit\":\"ms\"}\n") < 0) return tb_false;
+
+    // ok
+    return tb_true;
+}
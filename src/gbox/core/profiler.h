@@ -0,0 +1,202 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        profiler.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_PROFILER_H
+#define GB_CORE_PROFILER_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the default frames count of the profiler
+#define GB_PROFILER_FRAMES_DEFAULT      (120)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/// the profiler stage enum
+typedef enum __gb_profiler_stage_e
+{
+    GB_PROFILER_STAGE_FLATTEN       = 0 //!< flatten the path to the polygon
+,   GB_PROFILER_STAGE_STROKE        = 1 //!< stroke the path, lines, points or polygon
+,   GB_PROFILER_STAGE_TESSELLATE    = 2 //!< tessellate the polygon
+,   GB_PROFILER_STAGE_RASTER        = 3 //!< scan the polygon, lines or points and fill the spans
+,   GB_PROFILER_STAGE_BLIT          = 4 //!< clear the target or fill the rects
+,   GB_PROFILER_STAGE_MAXN          = 5
+
+}gb_profiler_stage_e;
+
+/// the profiler count enum
+typedef enum __gb_profiler_count_e
+{
+    GB_PROFILER_COUNT_PATHS         = 0 //!< the drawn paths count
+,   GB_PROFILER_COUNT_SPANS         = 1 //!< the emitted spans count
+,   GB_PROFILER_COUNT_PIXELS        = 2 //!< the touched pixels count
+,   GB_PROFILER_COUNT_DRAWS         = 3 //!< the draw calls count
+,   GB_PROFILER_COUNT_MAXN          = 4
+
+}gb_profiler_count_e;
+
+/// the profiler frame type
+typedef struct __gb_profiler_frame_t
+{
+    /// the frame index
+    tb_size_t                       index;
+
+    /// the start time, us
+    tb_hong_t                       time;
+
+    /// the frame duration, us
+    tb_hong_t                       duration;
+
+    /// the spent time of all stages, us
+    tb_hong_t                       stages[GB_PROFILER_STAGE_MAXN];
+
+    /// the counts
+    tb_size_t                       counts[GB_PROFILER_COUNT_MAXN];
+
+}gb_profiler_frame_t, *gb_profiler_frame_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/*! init profiler
+ *
+ * the profiler records the frames into a ring buffer, and the oldest frame will be dropped if it is full.
+ *
+ * the frame time is always recorded, but the stage times and counts are only recorded 
+ * in the profile mode, e.g. xmake f -m profile, because the hot paths are not instrumented in other modes.
+ *
+ * we can attach it to a context for recording all canvases of this context, e.g.
+ *
+ * @code
+ *
+    // init profiler
+    gb_profiler_ref_t profiler = gb_profiler_init(0);
+
+    // attach it to the context of the canvas 
+    gb_context_profiler_set(gb_device_context(gb_canvas_device(canvas)), profiler);
+
+    // draw frames, the window will begin and end the frame automatically
+    gb_profiler_frame_begin(profiler);
+    // ...
+    gb_profiler_frame_end(profiler);
+
+    // dump the chrome trace events
+    gb_profiler_dump(profiler, stream);
+ * @endcode
+ *
+ * @note the profiler is not thread-safe, so do not attach it to the contexts of different threads
+ *
+ * @param maxn      the maximum frames count, uses the default count if be zero
+ *
+ * @return          the profiler
+ */
+gb_profiler_ref_t   gb_profiler_init(tb_size_t maxn);
+
+/*! exit profiler
+ *
+ * @param profiler  the profiler
+ */
+tb_void_t           gb_profiler_exit(gb_profiler_ref_t profiler);
+
+/*! clear all recorded frames
+ *
+ * @param profiler  the profiler
+ */
+tb_void_t           gb_profiler_clear(gb_profiler_ref_t profiler);
+
+/*! begin a frame
+ *
+ * @param profiler  the profiler
+ */
+tb_void_t           gb_profiler_frame_begin(gb_profiler_ref_t profiler);
+
+/*! end the current frame and record it
+ *
+ * @param profiler  the profiler
+ */
+tb_void_t           gb_profiler_frame_end(gb_profiler_ref_t profiler);
+
+/*! the recorded frames count
+ *
+ * @param profiler  the profiler
+ *
+ * @return          the frames count
+ */
+tb_size_t           gb_profiler_size(gb_profiler_ref_t profiler);
+
+/*! the recorded frame
+ *
+ * @param profiler  the profiler
+ * @param index     the frame index, the oldest frame is zero
+ *
+ * @return          the frame
+ */
+gb_profiler_frame_ref_t gb_profiler_frame(gb_profiler_ref_t profiler, tb_size_t index);
+
+/*! add the spent time to the stage of the current frame
+ *
+ * @param profiler  the profiler
+ * @param stage     the stage
+ * @param time      the spent time, us
+ */
+tb_void_t           gb_profiler_stage_add(gb_profiler_ref_t profiler, tb_size_t stage, tb_hong_t time);
+
+/*! add the count of the current frame
+ *
+ * @param profiler  the profiler
+ * @param count     the count type
+ * @param value     the added value
+ */
+tb_void_t           gb_profiler_count_add(gb_profiler_ref_t profiler, tb_size_t count, tb_size_t value);
+
+/*! dump the recorded frames as the chrome trace events
+ *
+ * we can load the json file in chrome://tracing, 
+ * each frame is a complete event and the stages and counts are counter events.
+ *
+ * @param profiler  the profiler
+ * @param stream    the output stream
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_profiler_dump(gb_profiler_ref_t profiler, tb_stream_ref_t stream);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+#endif
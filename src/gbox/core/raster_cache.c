@@ -0,0 +1,478 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        raster_cache.c
+ * @ingroup     core
+ *
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "raster_cache"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "raster_cache.h"
+#include "paint.h"
+#include "bitmap.h"
+#include "pixmap.h"
+#include "canvas.h"
+#include "device.h"
+#include "clipper.h"
+#include "impl/bounds.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the entries grow
+#ifdef __gb_small__
+#   define GB_RASTER_CACHE_ENTRIES_GROW     (16)
+#else
+#   define GB_RASTER_CACHE_ENTRIES_GROW     (64)
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the raster cache entry type
+typedef struct __gb_raster_cache_entry_t
+{
+    // the list entry, the least recently used entry is the head
+    tb_list_entry_t         entry;
+
+    // the group key
+    tb_cpointer_t           key;
+
+    // the content version
+    tb_size_t               version;
+
+    // the linear part of the matrix
+    gb_float_t              sx, kx, ky, sy;
+
+    // the translation of the matrix when rasterizing it
+    gb_float_t              tx, ty;
+
+    // the origin of the raster in the device coordinates
+    tb_long_t               x, y;
+
+    // the used memory size
+    tb_size_t               size;
+
+    // the argb8888 raster, tb_null if the group has been drawn only once
+    gb_bitmap_ref_t         bitmap;
+
+}gb_raster_cache_entry_t, *gb_raster_cache_entry_ref_t;
+
+// the raster cache impl type
+typedef struct __gb_raster_cache_impl_t
+{
+    // the entries pool
+    tb_fixed_pool_ref_t     pool;
+
+    // the entries list
+    tb_list_entry_head_t    list;
+
+    // the entries hash, key => entry
+    tb_hash_map_ref_t       hash;
+
+    // the pooled bitmap for rendering the groups
+    gb_bitmap_ref_t         bitmap;
+
+    // the canvas of the pooled bitmap
+    gb_canvas_ref_t         canvas;
+
+    // the context of the canvas, it is referenced from the drawing device
+    gb_context_ref_t        context;
+
+    // the stats
+    gb_raster_cache_stats_t stats;
+
+}gb_raster_cache_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_raster_cache_entry_exit(tb_pointer_t data, tb_cpointer_t priv)
+{
+    // check
+    gb_raster_cache_entry_ref_t entry = (gb_raster_cache_entry_ref_t)data;
+    tb_assert_and_check_return(entry);
+
+    // exit the raster
+    if (entry->bitmap) gb_bitmap_exit(entry->bitmap);
+    entry->bitmap = tb_null;
+}
+static tb_bool_t gb_raster_cache_entry_same(gb_raster_cache_entry_ref_t entry, tb_size_t version, gb_matrix_ref_t matrix)
+{
+    // the same version and scale?
+    return (    entry->version == version
+            &&  entry->sx == matrix->sx && entry->kx == matrix->kx
+            &&  entry->ky == matrix->ky && entry->sy == matrix->sy)? tb_true : tb_false;
+}
+static tb_void_t gb_raster_cache_entry_remove(gb_raster_cache_impl_t* impl, gb_raster_cache_entry_ref_t entry)
+{
+    // update the used size
+    tb_assert(impl->stats.size >= entry->size);
+    impl->stats.size -= entry->size;
+
+    // remove it from the hash
+    tb_hash_map_remove(impl->hash, entry->key);
+
+    // remove it from the list
+    tb_list_entry_remove(&impl->list, &entry->entry);
+
+    // exit it
+    tb_fixed_pool_free(impl->pool, entry);
+}
+static gb_bitmap_ref_t gb_raster_cache_render(gb_raster_cache_impl_t* impl, gb_canvas_ref_t canvas, tb_long_t x, tb_long_t y, tb_size_t width, tb_size_t height, gb_raster_cache_func_t func, tb_cpointer_t priv)
+{
+    // the context of the drawing device, the canvas of other context will be remade
+    gb_context_ref_t context = gb_device_context(gb_canvas_device(canvas));
+    if (impl->canvas && impl->context != context)
+    {
+        gb_canvas_exit(impl->canvas);
+        impl->canvas = tb_null;
+    }
+
+    // init the pooled bitmap
+    if (!impl->bitmap) impl->bitmap = gb_bitmap_init(tb_null, GB_PIXFMT_XRGB8888, width, height, 0, tb_false);
+    tb_assert_and_check_return_val(impl->bitmap, tb_null);
+
+    // init the canvas, it shares the context with the drawing device on the same thread
+    if (!impl->canvas)
+    {
+        impl->canvas    = gb_canvas_init_from_bitmap_with_context(impl->bitmap, context);
+        impl->context   = context;
+    }
+    tb_assert_and_check_return_val(impl->canvas, tb_null);
+
+    // resize the pooled bitmap for this group
+    gb_device_resize(gb_canvas_device(impl->canvas), width, height);
+    tb_assert_and_check_return_val(gb_bitmap_width(impl->bitmap) == width && gb_bitmap_height(impl->bitmap) == height, tb_null);
+
+    // init the raster
+    gb_bitmap_ref_t raster = gb_bitmap_init(tb_null, GB_PIXFMT_ARGB8888, width, height, 0, tb_true);
+    tb_assert_and_check_return_val(raster, tb_null);
+
+    // the pixmaps
+    gb_pixmap_ref_t source = gb_pixmap(GB_PIXFMT_XRGB8888, 0xff);
+    gb_pixmap_ref_t target = gb_pixmap(GB_PIXFMT_ARGB8888, 0xff);
+    tb_assert_and_check_return_val(source && source->color_get && target && target->pixel, raster);
+
+    // the group matrix is moved to the origin of the raster
+    gb_matrix_t matrix = *gb_canvas_matrix(canvas);
+    matrix.tx -= gb_long_to_float(x);
+    matrix.ty -= gb_long_to_float(y);
+
+    /* render the group over the black and white backdrops
+     *
+     * the pixels are blended by the same alpha for all channels, so the drawn pixels are linear for the backdrop:
+     *
+     * black = color
+     * white = color + 0xff * (1 - alpha)
+     *
+     * so the raster can be restored: alpha = 0xff - (white - black), color = black / alpha
+     */
+    tb_size_t pass;
+    for (pass = 0; pass < 2; pass++)
+    {
+        // reset the canvas state to the drawing canvas
+        gb_canvas_clear_clipper(impl->canvas);
+        *gb_canvas_matrix(impl->canvas) = matrix;
+        gb_paint_copy(gb_canvas_paint(impl->canvas), gb_canvas_paint(canvas));
+
+        // draw the group over the backdrop
+        gb_canvas_draw_clear(impl->canvas, pass? GB_COLOR_WHITE : GB_COLOR_BLACK);
+        func(impl->canvas, priv);
+
+        // the first pass? copy the colors, the layout of xrgb8888 is same as argb8888
+        if (!pass)
+        {
+            tb_memcpy(gb_bitmap_data(raster), gb_bitmap_data(impl->bitmap), gb_bitmap_row_bytes(raster) * height);
+            continue;
+        }
+
+        // restore the alpha from the white pass
+        tb_size_t           i;
+        tb_size_t           n = width * height;
+        tb_byte_t*          d = (tb_byte_t*)gb_bitmap_data(raster);
+        tb_byte_t const*    s = (tb_byte_t const*)gb_bitmap_data(impl->bitmap);
+        for (i = 0; i < n; i++, d += 4, s += 4)
+        {
+            // the colors over the black and white backdrops
+            gb_color_t black = source->color_get(d);
+            gb_color_t white = source->color_get(s);
+
+            // the alpha is the inverse transmittance of the backdrop
+            tb_long_t t = tb_max((tb_long_t)white.r - black.r, (tb_long_t)white.g - black.g);
+            t = tb_max(t, (tb_long_t)white.b - black.b);
+            tb_size_t a = (tb_size_t)(0xff - tb_max(t, 0));
+
+            // unpremultiply the color, the transparent pixel is cleared
+            gb_color_t color = gb_color_make((tb_byte_t)a, 0, 0, 0);
+            if (a)
+            {
+                color.r = (tb_byte_t)tb_min((black.r * 0xff + (a >> 1)) / a, 0xff);
+                color.g = (tb_byte_t)tb_min((black.g * 0xff + (a >> 1)) / a, 0xff);
+                color.b = (tb_byte_t)tb_min((black.b * 0xff + (a >> 1)) / a, 0xff);
+            }
+
+            // save it, the color_set of the pixmap may blend it by the alpha
+            tb_bits_set_u32_le(d, target->pixel(color));
+        }
+    }
+
+    // ok
+    return raster;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_raster_cache_ref_t gb_raster_cache_init(tb_size_t maxn)
+{
+    // done
+    tb_bool_t               ok = tb_false;
+    gb_raster_cache_impl_t* impl = tb_null;
+    do
+    {
+        // make cache
+        impl = tb_malloc0_type(gb_raster_cache_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init budget
+        impl->stats.maxn = maxn? maxn : GB_RASTER_CACHE_MAXN;
+
+        // init pool
+        impl->pool = tb_fixed_pool_init(tb_null, GB_RASTER_CACHE_ENTRIES_GROW, sizeof(gb_raster_cache_entry_t), tb_null, gb_raster_cache_entry_exit, (tb_cpointer_t)impl);
+        tb_assert_and_check_break(impl->pool);
+
+        // init list
+        tb_list_entry_init(&impl->list, gb_raster_cache_entry_t, entry, tb_null);
+
+        // init hash
+        impl->hash = tb_hash_map_init(TB_HASH_MAP_BUCKET_SIZE_MICRO, tb_element_ptr(tb_null, tb_null), tb_element_ptr(tb_null, tb_null));
+        tb_assert_and_check_break(impl->hash);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_raster_cache_exit((gb_raster_cache_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_raster_cache_ref_t)impl;
+}
+tb_void_t gb_raster_cache_exit(gb_raster_cache_ref_t cache)
+{
+    // check
+    gb_raster_cache_impl_t* impl = (gb_raster_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl);
+
+    // exit canvas
+    if (impl->canvas) gb_canvas_exit(impl->canvas);
+    impl->canvas = tb_null;
+
+    // exit bitmap
+    if (impl->bitmap) gb_bitmap_exit(impl->bitmap);
+    impl->bitmap = tb_null;
+
+    // exit hash
+    if (impl->hash) tb_hash_map_exit(impl->hash);
+    impl->hash = tb_null;
+
+    // exit list
+    tb_list_entry_exit(&impl->list);
+
+    // exit pool
+    if (impl->pool) tb_fixed_pool_exit(impl->pool);
+    impl->pool = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+tb_void_t gb_raster_cache_clear(gb_raster_cache_ref_t cache)
+{
+    // check
+    gb_raster_cache_impl_t* impl = (gb_raster_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl);
+
+    // clear hash
+    if (impl->hash) tb_hash_map_clear(impl->hash);
+
+    // clear list
+    tb_list_entry_clear(&impl->list);
+
+    // clear pool
+    if (impl->pool) tb_fixed_pool_clear(impl->pool);
+
+    // clear size
+    impl->stats.size = 0;
+}
+tb_void_t gb_raster_cache_remove(gb_raster_cache_ref_t cache, tb_cpointer_t key)
+{
+    // check
+    gb_raster_cache_impl_t* impl = (gb_raster_cache_impl_t*)cache;
+    tb_assert_and_check_return(impl && impl->hash);
+
+    // remove the entry if exists
+    gb_raster_cache_entry_ref_t entry = (gb_raster_cache_entry_ref_t)tb_hash_map_get(impl->hash, key);
+    if (entry) gb_raster_cache_entry_remove(impl, entry);
+}
+tb_bool_t gb_raster_cache_draw(gb_raster_cache_ref_t cache, gb_canvas_ref_t canvas, tb_cpointer_t key, tb_size_t version, gb_rect_ref_t bounds, gb_raster_cache_func_t func, tb_cpointer_t priv)
+{
+    // check
+    gb_raster_cache_impl_t* impl = (gb_raster_cache_impl_t*)cache;
+    tb_assert_and_check_return_val(impl && impl->hash && canvas && func, tb_false);
+
+    // done
+    tb_bool_t                   ok = tb_false;
+    gb_raster_cache_entry_ref_t entry = tb_null;
+    do
+    {
+        // only the bitmap device can composite the raster, and the clipped group is drawn directly
+        gb_device_ref_t device = gb_canvas_device(canvas);
+        tb_check_break(device && gb_device_type(device) == GB_DEVICE_TYPE_BITMAP && bounds && bounds->w > 0 && bounds->h > 0);
+        tb_check_break(!gb_clipper_size(gb_canvas_clipper(canvas)));
+
+        // map the corners of the bounds to the device
+        gb_matrix_ref_t matrix = gb_canvas_matrix(canvas);
+        gb_point_t      points[4];
+        gb_point_make(&points[0], bounds->x, bounds->y);
+        gb_point_make(&points[1], bounds->x + bounds->w, bounds->y);
+        gb_point_make(&points[2], bounds->x + bounds->w, bounds->y + bounds->h);
+        gb_point_make(&points[3], bounds->x, bounds->y + bounds->h);
+        gb_matrix_apply_points(matrix, points, tb_arrayn(points));
+
+        // the pixel bounds of the raster, inflate one pixel for the antialiasing edges
+        gb_rect_t device_bounds;
+        gb_bounds_make(&device_bounds, points, tb_arrayn(points));
+        tb_long_t x0 = gb_floor(device_bounds.x) - 1;
+        tb_long_t y0 = gb_floor(device_bounds.y) - 1;
+        tb_long_t x1 = gb_ceil(device_bounds.x + device_bounds.w) + 1;
+        tb_long_t y1 = gb_ceil(device_bounds.y + device_bounds.h) + 1;
+        tb_check_break(x1 - x0 <= GB_WIDTH_MAXN && y1 - y0 <= GB_HEIGHT_MAXN);
+
+        // too large for the budget?
+        tb_size_t size = sizeof(gb_raster_cache_entry_t) + (tb_size_t)(x1 - x0) * (tb_size_t)(y1 - y0) * 4;
+        tb_check_break(size <= (impl->stats.maxn >> 2));
+
+        // get entry
+        entry = (gb_raster_cache_entry_ref_t)tb_hash_map_get(impl->hash, key);
+
+        // the first drawing for this group or the version or scale has been changed? 
+        if (!entry || !gb_raster_cache_entry_same(entry, version, matrix))
+        {
+            // remove the previous entry
+            if (entry) gb_raster_cache_entry_remove(impl, entry);
+
+            // make entry
+            entry = (gb_raster_cache_entry_ref_t)tb_fixed_pool_malloc0(impl->pool);
+            tb_assert_and_check_break(entry);
+
+            // init entry, only mark it and not render the raster
+            entry->key      = key;
+            entry->version  = version;
+            entry->sx       = matrix->sx;
+            entry->kx       = matrix->kx;
+            entry->ky       = matrix->ky;
+            entry->sy       = matrix->sy;
+            entry->size     = sizeof(gb_raster_cache_entry_t);
+
+            // add entry
+            tb_hash_map_insert(impl->hash, key, entry);
+            tb_list_entry_insert_tail(&impl->list, &entry->entry);
+            impl->stats.size += entry->size;
+            break;
+        }
+
+        // drawn again and not cached? render it at the current translation
+        if (!entry->bitmap)
+        {
+            // render the raster
+            entry->bitmap = gb_raster_cache_render(impl, canvas, x0, y0, x1 - x0, y1 - y0, func, priv);
+            tb_check_break(entry->bitmap);
+
+            // save the translation and origin
+            entry->tx   = matrix->tx;
+            entry->ty   = matrix->ty;
+            entry->x    = x0;
+            entry->y    = y0;
+
+            // update the used size
+            impl->stats.size += size - entry->size;
+            entry->size = size;
+            impl->stats.renders++;
+        }
+        else impl->stats.hits++;
+
+        // composite the raster with the translated offset, it is rounded to the pixel
+        gb_device_draw_bitmap(device, entry->bitmap, entry->x + gb_round(matrix->tx - entry->tx), entry->y + gb_round(matrix->ty - entry->ty));
+
+        // move it to the tail as the most recently used entry
+        tb_list_entry_moveto_tail(&impl->list, &entry->entry);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // remove the least recently used entries if be out of the budget
+    while (impl->stats.size > impl->stats.maxn && tb_list_entry_size(&impl->list) > 1)
+    {
+        // the head entry
+        gb_raster_cache_entry_ref_t head = (gb_raster_cache_entry_ref_t)tb_list_entry(&impl->list, tb_list_entry_head(&impl->list));
+        tb_assert_and_check_break(head && head != entry);
+
+        // remove it
+        gb_raster_cache_entry_remove(impl, head);
+        impl->stats.evictions++;
+    }
+
+    // not cached? draw it directly
+    if (!ok)
+    {
+        func(canvas, priv);
+        impl->stats.misses++;
+    }
+
+    // ok?
+    return ok;
+}
+gb_raster_cache_stats_ref_t gb_raster_cache_stats(gb_raster_cache_ref_t cache)
+{
+    // check
+    gb_raster_cache_impl_t* impl = (gb_raster_cache_impl_t*)cache;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the stats
+    return &impl->stats;
+}
@@ -0,0 +1,168 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        raster_cache.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_RASTER_CACHE_H
+#define GB_CORE_RASTER_CACHE_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the default memory budget of the raster cache
+#ifdef __gb_small__
+#   define GB_RASTER_CACHE_MAXN         (4 << 20)
+#else
+#   define GB_RASTER_CACHE_MAXN         (16 << 20)
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/*! the group drawing func type
+ *
+ * @param canvas    the canvas, it may be the canvas of the cached raster
+ * @param priv      the private data
+ */
+typedef tb_void_t   (*gb_raster_cache_func_t)(gb_canvas_ref_t canvas, tb_cpointer_t priv);
+
+/// the raster cache stats type
+typedef struct __gb_raster_cache_stats_t
+{
+    /// the count of the groups drawn from the cached rasters
+    tb_size_t               hits;
+
+    /// the count of the groups drawn directly
+    tb_size_t               misses;
+
+    /// the count of the rasterized groups
+    tb_size_t               renders;
+
+    /// the count of the evicted rasters
+    tb_size_t               evictions;
+
+    /// the used memory size
+    tb_size_t               size;
+
+    /// the memory budget
+    tb_size_t               maxn;
+
+}gb_raster_cache_stats_t, *gb_raster_cache_stats_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/*! init raster cache
+ *
+ * the raster cache renders the static group into the bitmap once at the current scale,
+ * and composites it with the translated offset for the next frames until its version or scale is changed,
+ * so panning the group will not rasterize all paths again, e.g.
+ *
+ * @code
+ *
+    // the group drawing func
+    static tb_void_t draw_map(gb_canvas_ref_t canvas, tb_cpointer_t priv)
+    {
+        gb_scene_draw((gb_scene_ref_t)priv, canvas);
+    }
+
+    // draw the map from the cached raster, the version must be changed after the map is modified
+    gb_raster_cache_draw(cache, canvas, scene, version, gb_scene_bounds(scene), draw_map, scene);
+ * @endcode
+ *
+ * the group is rasterized only if it has been drawn with the same version and scale before,
+ * so the groups which are modified for every frame will not be cached.
+ * the cache is only used for the bitmap device and the least recently used rasters are evicted if be out of the budget.
+ * the groups are rendered with the context of the drawing device, so the cache must be exited before exiting the context.
+ *
+ * @param maxn      the memory budget, uses the default budget if be zero
+ *
+ * @return          the raster cache
+ */
+gb_raster_cache_ref_t   gb_raster_cache_init(tb_size_t maxn);
+
+/*! exit raster cache
+ *
+ * @param cache     the raster cache
+ */
+tb_void_t               gb_raster_cache_exit(gb_raster_cache_ref_t cache);
+
+/*! clear all cached rasters
+ *
+ * @param cache     the raster cache
+ */
+tb_void_t               gb_raster_cache_clear(gb_raster_cache_ref_t cache);
+
+/*! remove the cached raster of the group
+ *
+ * @param cache     the raster cache
+ * @param key       the group key
+ */
+tb_void_t               gb_raster_cache_remove(gb_raster_cache_ref_t cache, tb_cpointer_t key);
+
+/*! draw the group from the cached raster
+ *
+ * the raster covers the whole bounds of the group at the current scale, skew and rotation,
+ * and the changed translation is rounded to the pixel offset when compositing it.
+ * the group is drawn directly if the canvas is clipped or the raster is too large for the budget.
+ *
+ * the group is drawn with the paint of the canvas, and the matrix, path and clipper
+ * of the cached raster canvas are not same as the given canvas.
+ *
+ * @param cache     the raster cache
+ * @param canvas    the canvas
+ * @param key       the group key
+ * @param version   the content version of the group, the raster will be remade after it is changed
+ * @param bounds    the bounds of the group in the canvas coordinates, includes the stroke width
+ * @param func      the group drawing func
+ * @param priv      the private data of the func
+ *
+ * @return          tb_true if the group is drawn from the cached raster
+ */
+tb_bool_t               gb_raster_cache_draw(gb_raster_cache_ref_t cache, gb_canvas_ref_t canvas, tb_cpointer_t key, tb_size_t version, gb_rect_ref_t bounds, gb_raster_cache_func_t func, tb_cpointer_t priv);
+
+/*! the stats of the raster cache
+ *
+ * @param cache     the raster cache
+ *
+ * @return          the stats
+ */
+gb_raster_cache_stats_ref_t gb_raster_cache_stats(gb_raster_cache_ref_t cache);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
@@ -0,0 +1,783 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        scene.c
+ * @ingroup     core
+ *
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "scene"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "scene.h"
+#include "path.h"
+#include "paint.h"
+#include "canvas.h"
+#include "impl/bounds.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum children count of the node
+#define GB_SCENE_NODE_MAXN              (16)
+
+// the maximum depth of the node stack for querying, enough for 2^32 items
+#define GB_SCENE_STACK_MAXN             (8 * GB_SCENE_NODE_MAXN)
+
+// the items grow
+#ifdef __gb_small__
+#   define GB_SCENE_ITEMS_GROW          (64)
+#else
+#   define GB_SCENE_ITEMS_GROW          (256)
+#endif
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the scene box type, x0 > x1 and y0 > y1 if be empty
+typedef struct __gb_scene_box_t
+{
+    // the minimum point
+    gb_float_t                  x0;
+    gb_float_t                  y0;
+
+    // the maximum point
+    gb_float_t                  x1;
+    gb_float_t                  y1;
+
+}gb_scene_box_t, *gb_scene_box_ref_t;
+
+// the scene item type
+typedef struct __gb_scene_item_t
+{
+    // the path
+    gb_path_ref_t               path;
+
+    // the paint
+    gb_paint_ref_t              paint;
+
+    // the bounds of the drawn pixels
+    gb_scene_box_t              box;
+
+    // the leaf node
+    tb_uint32_t                 leaf;
+
+}gb_scene_item_t, *gb_scene_item_ref_t;
+
+// the scene node type
+typedef struct __gb_scene_node_t
+{
+    // the bounds of all children
+    gb_scene_box_t              box;
+
+    // the first child node, or the first entry if be leaf
+    tb_uint32_t                 first;
+
+    // the parent node, the root is the parent of itself
+    tb_uint32_t                 parent;
+
+    // the children count
+    tb_uint16_t                 count;
+
+    // is leaf?
+    tb_uint16_t                 leaf;
+
+}gb_scene_node_t, *gb_scene_node_ref_t;
+
+// the scene entry type for sorting the items by the centers
+typedef struct __gb_scene_entry_t
+{
+    // the center
+    gb_float_t                  x;
+    gb_float_t                  y;
+
+    // the item index
+    tb_uint32_t                 index;
+
+}gb_scene_entry_t, *gb_scene_entry_ref_t;
+
+// the scene impl type
+typedef struct __gb_scene_impl_t
+{
+    // the items
+    gb_scene_item_ref_t         items;
+
+    // the items count
+    tb_size_t                   items_count;
+
+    // the items maxn
+    tb_size_t                   items_maxn;
+
+    /* the nodes of the packed r-tree
+     *
+     * the leaves are made by the sort-tile-recursive packing and stored at first,
+     * the parent levels are stored after them and the root is the last node.
+     */
+    gb_scene_node_ref_t         nodes;
+
+    // the nodes count
+    tb_size_t                   nodes_count;
+
+    // the nodes maxn
+    tb_size_t                   nodes_maxn;
+
+    // the item indices of the leaves
+    tb_uint32_t*                entries;
+
+    // the entries maxn
+    tb_size_t                   entries_maxn;
+
+    // the query results
+    tb_size_t*                  results;
+
+    // the results count
+    tb_size_t                   results_count;
+
+    // the results maxn
+    tb_size_t                   results_maxn;
+
+    // the bit marks of the hit items, they are collected in the drawing order and cleared after searching
+    tb_uint32_t*                marks;
+
+    // the marks maxn in words
+    tb_size_t                   marks_maxn;
+
+    // the bounds
+    gb_rect_t                   bounds;
+
+    // the index need be rebuilt?
+    tb_bool_t                   dirty;
+
+}gb_scene_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static __tb_inline__ tb_void_t gb_scene_box_clear(gb_scene_box_ref_t box)
+{
+    // the empty box will not intersect any boxes and will be ignored when merging it
+    box->x0 = GB_MAF;
+    box->y0 = GB_MAF;
+    box->x1 = GB_MIF;
+    box->y1 = GB_MIF;
+}
+static __tb_inline__ tb_void_t gb_scene_box_merge(gb_scene_box_ref_t box, gb_scene_box_ref_t merged)
+{
+    if (merged->x0 < box->x0) box->x0 = merged->x0;
+    if (merged->y0 < box->y0) box->y0 = merged->y0;
+    if (merged->x1 > box->x1) box->x1 = merged->x1;
+    if (merged->y1 > box->y1) box->y1 = merged->y1;
+}
+static __tb_inline__ tb_bool_t gb_scene_box_intersect(gb_scene_box_ref_t box, gb_scene_box_ref_t other)
+{
+    return box->x0 <= other->x1 && box->x1 >= other->x0 && box->y0 <= other->y1 && box->y1 >= other->y0;
+}
+static tb_void_t gb_scene_item_bounds(gb_scene_item_ref_t item)
+{
+    // check
+    tb_assert(item && item->path && item->paint);
+
+    // the bounds of the path, the null path will be not drawn
+    gb_rect_ref_t bounds = gb_path_bounds(item->path);
+    if (!bounds || gb_paint_mode(item->paint) == GB_PAINT_MODE_NONE)
+    {
+        gb_scene_box_clear(&item->box);
+        return ;
+    }
+
+    // make box
+    item->box.x0 = bounds->x;
+    item->box.y0 = bounds->y;
+    item->box.x1 = bounds->x + bounds->w;
+    item->box.y1 = bounds->y + bounds->h;
+
+    // stroke? inflate it by the outline
+    if (gb_paint_mode(item->paint) & GB_PAINT_MODE_STROKE)
+    {
+        /* the outline is at most half width * miter limit from the path for the miter join,
+         * and half width * sqrt(2) for the square cap, the hairline is inflated by one pixel
+         */
+        gb_float_t width = gb_paint_stroke_width(item->paint);
+        gb_float_t scale = GB_SQRT2;
+        if (gb_paint_stroke_join(item->paint) == GB_PAINT_STROKE_JOIN_MITER && gb_paint_stroke_miter(item->paint) > scale)
+            scale = gb_paint_stroke_miter(item->paint);
+        gb_float_t delta = width > 0? gb_mul(gb_half(width), scale) : GB_ONE;
+
+        // inflate it
+        item->box.x0 -= delta;
+        item->box.y0 -= delta;
+        item->box.x1 += delta;
+        item->box.y1 += delta;
+    }
+}
+static __tb_inline__ gb_float_t gb_scene_entry_key(gb_scene_entry_ref_t entry, tb_bool_t y)
+{
+    return y? entry->y : entry->x;
+}
+static tb_void_t gb_scene_entry_sort(gb_scene_entry_ref_t entries, tb_size_t count, tb_bool_t y)
+{
+    /* sort the entries by the x or y-coordinate of the centers
+     *
+     * we use the specialized quick sort instead of tb_sort,
+     * because the generic iterator is too slow for sorting millions of items
+     */
+    gb_scene_entry_t pivot;
+    gb_scene_entry_t temp;
+    while (count > 16)
+    {
+        // the median of three
+        tb_size_t   l = 0;
+        tb_size_t   r = count - 1;
+        tb_size_t   m = count >> 1;
+        if (gb_scene_entry_key(&entries[m], y) < gb_scene_entry_key(&entries[l], y)) { temp = entries[m]; entries[m] = entries[l]; entries[l] = temp; }
+        if (gb_scene_entry_key(&entries[r], y) < gb_scene_entry_key(&entries[l], y)) { temp = entries[r]; entries[r] = entries[l]; entries[l] = temp; }
+        if (gb_scene_entry_key(&entries[r], y) < gb_scene_entry_key(&entries[m], y)) { temp = entries[r]; entries[r] = entries[m]; entries[m] = temp; }
+        pivot = entries[m];
+
+        // partition
+        gb_float_t key = gb_scene_entry_key(&pivot, y);
+        while (l <= r)
+        {
+            while (gb_scene_entry_key(&entries[l], y) < key) l++;
+            while (gb_scene_entry_key(&entries[r], y) > key) r--;
+            if (l <= r)
+            {
+                temp = entries[l]; entries[l] = entries[r]; entries[r] = temp;
+                l++;
+                if (!r) break;
+                r--;
+            }
+        }
+
+        // sort the smaller part by recursion and the larger part by loop, the stack depth is at most log2(count)
+        if (r + 1 < count - l)
+        {
+            gb_scene_entry_sort(entries, r + 1, y);
+            entries += l;
+            count   -= l;
+        }
+        else
+        {
+            gb_scene_entry_sort(entries + l, count - l, y);
+            count = r + 1;
+        }
+    }
+
+    // insertion sort for the small part
+    tb_size_t i;
+    tb_size_t j;
+    for (i = 1; i < count; i++)
+    {
+        temp = entries[i];
+        for (j = i; j && gb_scene_entry_key(&entries[j - 1], y) > gb_scene_entry_key(&temp, y); j--)
+            entries[j] = entries[j - 1];
+        entries[j] = temp;
+    }
+}
+static gb_scene_node_ref_t gb_scene_node_make(gb_scene_impl_t* impl)
+{
+    // grow nodes
+    if (impl->nodes_count >= impl->nodes_maxn)
+    {
+        tb_size_t maxn = impl->nodes_maxn + (impl->nodes_maxn >> 1) + GB_SCENE_NODE_MAXN;
+        gb_scene_node_ref_t nodes = tb_ralloc_type(impl->nodes, maxn, gb_scene_node_t);
+        tb_assert_and_check_return_val(nodes, tb_null);
+
+        // save nodes
+        impl->nodes         = nodes;
+        impl->nodes_maxn    = maxn;
+    }
+
+    // make node
+    gb_scene_node_ref_t node = &impl->nodes[impl->nodes_count++];
+    gb_scene_box_clear(&node->box);
+    node->first     = 0;
+    node->parent    = 0;
+    node->count     = 0;
+    node->leaf      = 0;
+    return node;
+}
+static tb_bool_t gb_scene_build(gb_scene_impl_t* impl)
+{
+    // check
+    tb_assert(impl);
+
+    // clear nodes
+    impl->nodes_count = 0;
+    tb_check_return_val(impl->items_count, tb_true);
+
+    // grow entries
+    tb_size_t count = impl->items_count;
+    if (count > impl->entries_maxn)
+    {
+        tb_uint32_t* entries = tb_ralloc_type(impl->entries, impl->items_maxn, tb_uint32_t);
+        tb_assert_and_check_return_val(entries, tb_false);
+
+        // save entries
+        impl->entries       = entries;
+        impl->entries_maxn  = impl->items_maxn;
+    }
+
+    // make the centers of the items for sorting
+    tb_size_t           i = 0;
+    gb_scene_entry_ref_t sorted = tb_nalloc_type(count, gb_scene_entry_t);
+    tb_assert_and_check_return_val(sorted, tb_false);
+    for (i = 0; i < count; i++)
+    {
+        gb_scene_box_ref_t box = &impl->items[i].box;
+        sorted[i].x     = box->x0 <= box->x1? gb_avg(box->x0, box->x1) : 0;
+        sorted[i].y     = box->y0 <= box->y1? gb_avg(box->y0, box->y1) : 0;
+        sorted[i].index = (tb_uint32_t)i;
+    }
+
+    /* sort-tile-recursive packing
+     *
+     * sort the items by x into the vertical slices of sqrt(leaves) leaves,
+     * and sort the items of each slice by y, so the neighbour items are packed into the same leaf.
+     */
+    gb_scene_entry_sort(sorted, count, tb_false);
+    tb_size_t leaves    = (count + GB_SCENE_NODE_MAXN - 1) / GB_SCENE_NODE_MAXN;
+    tb_size_t slices    = tb_isqrti((tb_uint32_t)leaves);
+    if (slices * slices < leaves) slices++;
+    tb_size_t slice     = slices * GB_SCENE_NODE_MAXN;
+    for (i = 0; i < count; i += slice)
+        gb_scene_entry_sort(sorted + i, tb_min(slice, count - i), tb_true);
+
+    // make leaves
+    tb_bool_t ok = tb_true;
+    for (i = 0; i < count && ok; i += GB_SCENE_NODE_MAXN)
+    {
+        // make leaf
+        gb_scene_node_ref_t leaf = gb_scene_node_make(impl);
+        tb_assert_and_check_break_state(leaf, ok, tb_false);
+        leaf->first = (tb_uint32_t)i;
+        leaf->count = (tb_uint16_t)tb_min(count - i, GB_SCENE_NODE_MAXN);
+        leaf->leaf  = 1;
+
+        // add the items to this leaf
+        tb_size_t j;
+        for (j = i; j < i + leaf->count; j++)
+        {
+            gb_scene_item_ref_t item = &impl->items[sorted[j].index];
+            impl->entries[j] = sorted[j].index;
+            item->leaf = (tb_uint32_t)(impl->nodes_count - 1);
+            gb_scene_box_merge(&leaf->box, &item->box);
+        }
+    }
+
+    // exit the sorted entries
+    tb_free(sorted);
+    tb_check_return_val(ok, tb_false);
+
+    // make the parent levels until only the root is left
+    tb_size_t head = 0;
+    tb_size_t tail = impl->nodes_count;
+    while (tail - head > 1 && ok)
+    {
+        for (i = head; i < tail && ok; i += GB_SCENE_NODE_MAXN)
+        {
+            // make parent
+            gb_scene_node_ref_t parent = gb_scene_node_make(impl);
+            tb_assert_and_check_break_state(parent, ok, tb_false);
+            parent->first = (tb_uint32_t)i;
+            parent->count = (tb_uint16_t)tb_min(tail - i, GB_SCENE_NODE_MAXN);
+
+            // add the children to this parent, the nodes may be moved after making parent
+            tb_size_t j;
+            for (j = i; j < i + parent->count; j++)
+            {
+                impl->nodes[j].parent = (tb_uint32_t)(impl->nodes_count - 1);
+                gb_scene_box_merge(&parent->box, &impl->nodes[j].box);
+            }
+        }
+
+        // the next level
+        head = tail;
+        tail = impl->nodes_count;
+    }
+    tb_check_return_val(ok, tb_false);
+
+    // the root is the parent of itself
+    impl->nodes[impl->nodes_count - 1].parent = (tb_uint32_t)(impl->nodes_count - 1);
+
+    // ok
+    impl->dirty = tb_false;
+    return tb_true;
+}
+static tb_size_t gb_scene_search(gb_scene_impl_t* impl, gb_scene_box_ref_t box)
+{
+    // check
+    tb_assert(impl && box);
+
+    // clear results
+    impl->results_count = 0;
+
+    // rebuild the index if the items have been added
+    if (impl->dirty && !gb_scene_build(impl)) return 0;
+    tb_check_return_val(impl->nodes_count, 0);
+
+    // grow marks, all bits are cleared
+    tb_size_t words = (impl->items_count + 31) >> 5;
+    if (words > impl->marks_maxn)
+    {
+        tb_size_t size = (impl->items_maxn + 31) >> 5;
+        if (impl->marks) tb_free(impl->marks);
+        impl->marks         = tb_nalloc0_type(size, tb_uint32_t);
+        impl->marks_maxn    = impl->marks? size : 0;
+        tb_assert_and_check_return_val(impl->marks, 0);
+    }
+
+    // search the nodes intersecting the box from the root and mark the hit items
+    tb_bool_t   ok = tb_true;
+    tb_size_t   hits = 0;
+    tb_size_t   minn = impl->items_count;
+    tb_size_t   maxn = 0;
+    tb_uint32_t stack[GB_SCENE_STACK_MAXN];
+    tb_size_t   top = 0;
+    stack[top++] = (tb_uint32_t)(impl->nodes_count - 1);
+    while (top)
+    {
+        // the node
+        gb_scene_node_ref_t node = &impl->nodes[stack[--top]];
+        tb_check_continue(gb_scene_box_intersect(&node->box, box));
+
+        // leaf? mark the items intersecting the box
+        tb_size_t i;
+        if (node->leaf)
+        {
+            for (i = node->first; i < node->first + node->count; i++)
+            {
+                tb_uint32_t index = impl->entries[i];
+                if (gb_scene_box_intersect(&impl->items[index].box, box))
+                {
+                    impl->marks[index >> 5] |= (tb_uint32_t)1 << (index & 31);
+                    if (index < minn) minn = index;
+                    if (index > maxn) maxn = index;
+                    hits++;
+                }
+            }
+        }
+        else
+        {
+            tb_assert_and_check_break_state(top + node->count <= GB_SCENE_STACK_MAXN, ok, tb_false);
+            for (i = node->first; i < node->first + node->count; i++)
+                stack[top++] = (tb_uint32_t)i;
+        }
+    }
+    tb_check_return_val(hits, 0);
+
+    // grow results
+    if (ok && hits > impl->results_maxn)
+    {
+        tb_size_t size = hits + (hits >> 1) + GB_SCENE_ITEMS_GROW;
+        tb_size_t* results = tb_ralloc_type(impl->results, size, tb_size_t);
+        if (results)
+        {
+            // save results
+            impl->results       = results;
+            impl->results_maxn  = size;
+        }
+        else ok = tb_false;
+    }
+
+    // collect the marked items in the drawing order and clear the marks
+    tb_size_t word = minn >> 5;
+    tb_size_t tail = (maxn >> 5) + 1;
+    for (; word < tail; word++)
+    {
+        // the marks of this word
+        tb_uint32_t bits = impl->marks[word];
+        tb_check_continue(bits);
+        impl->marks[word] = 0;
+
+        // add the items from the lowest bit
+        while (bits && ok)
+        {
+            impl->results[impl->results_count++] = (word << 5) + tb_bits_fb1_u32_le(bits);
+            bits &= bits - 1;
+        }
+    }
+
+    // failed?
+    if (!ok) impl->results_count = 0;
+
+    // ok
+    return impl->results_count;
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_scene_ref_t gb_scene_init()
+{
+    // make scene
+    gb_scene_impl_t* impl = tb_malloc0_type(gb_scene_impl_t);
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // ok
+    return (gb_scene_ref_t)impl;
+}
+tb_void_t gb_scene_exit(gb_scene_ref_t scene)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return(impl);
+
+    // exit items, nodes, entries, results and marks
+    if (impl->items) tb_free(impl->items);
+    if (impl->nodes) tb_free(impl->nodes);
+    if (impl->entries) tb_free(impl->entries);
+    if (impl->results) tb_free(impl->results);
+    if (impl->marks) tb_free(impl->marks);
+
+    // exit it
+    tb_free(impl);
+}
+tb_void_t gb_scene_clear(gb_scene_ref_t scene)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return(impl);
+
+    // clear it, the buffers will be reused
+    impl->items_count   = 0;
+    impl->nodes_count   = 0;
+    impl->results_count = 0;
+    impl->dirty         = tb_false;
+}
+tb_size_t gb_scene_size(gb_scene_ref_t scene)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl, 0);
+
+    // the items count
+    return impl->items_count;
+}
+gb_rect_ref_t gb_scene_bounds(gb_scene_ref_t scene)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // rebuild the index if the items have been added
+    if (impl->dirty && !gb_scene_build(impl)) return tb_null;
+    tb_check_return_val(impl->nodes_count, tb_null);
+
+    // the bounds of the root, the empty root has no visible items
+    gb_scene_box_ref_t box = &impl->nodes[impl->nodes_count - 1].box;
+    tb_check_return_val(box->x0 <= box->x1 && box->y0 <= box->y1, tb_null);
+
+    // make bounds
+    gb_rect_make(&impl->bounds, box->x0, box->y0, box->x1 - box->x0, box->y1 - box->y0);
+    return &impl->bounds;
+}
+tb_bool_t gb_scene_add(gb_scene_ref_t scene, gb_path_ref_t path, gb_paint_ref_t paint)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl && path && paint, tb_false);
+
+    // too many items?
+    tb_assert_and_check_return_val(impl->items_count < TB_MAXU32, tb_false);
+
+    // grow items
+    if (impl->items_count >= impl->items_maxn)
+    {
+        tb_size_t maxn = impl->items_maxn + (impl->items_maxn >> 1) + GB_SCENE_ITEMS_GROW;
+        gb_scene_item_ref_t items = tb_ralloc_type(impl->items, maxn, gb_scene_item_t);
+        tb_assert_and_check_return_val(items, tb_false);
+
+        // save items
+        impl->items         = items;
+        impl->items_maxn    = maxn;
+    }
+
+    // add item
+    gb_scene_item_ref_t item = &impl->items[impl->items_count++];
+    item->path  = path;
+    item->paint = paint;
+    item->leaf  = 0;
+    gb_scene_item_bounds(item);
+
+    // the index need be rebuilt
+    impl->dirty = tb_true;
+
+    // ok
+    return tb_true;
+}
+tb_void_t gb_scene_update(gb_scene_ref_t scene, tb_size_t index)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return(impl && index < impl->items_count);
+
+    // update the bounds of the item
+    gb_scene_item_ref_t item = &impl->items[index];
+    gb_scene_item_bounds(item);
+
+    // the index will be rebuilt?
+    tb_check_return(!impl->dirty && item->leaf < impl->nodes_count);
+
+    /* refit the ancestors of the item
+     *
+     * the boxes are only enlarged, so the index is still conservative after the item is moved or shrunk
+     * and the empty space will be dropped after it is rebuilt
+     */
+    tb_uint32_t node = item->leaf;
+    while (1)
+    {
+        gb_scene_box_merge(&impl->nodes[node].box, &item->box);
+        if (impl->nodes[node].parent == node) break;
+        node = impl->nodes[node].parent;
+    }
+}
+gb_path_ref_t gb_scene_path(gb_scene_ref_t scene, tb_size_t index)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl && index < impl->items_count, tb_null);
+
+    // the path
+    return impl->items[index].path;
+}
+gb_paint_ref_t gb_scene_paint(gb_scene_ref_t scene, tb_size_t index)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl && index < impl->items_count, tb_null);
+
+    // the paint
+    return impl->items[index].paint;
+}
+tb_size_t gb_scene_query(gb_scene_ref_t scene, gb_rect_ref_t rect, tb_size_t const** items)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl && rect && items, 0);
+
+    // make box
+    gb_scene_box_t box;
+    box.x0 = rect->x;
+    box.y0 = rect->y;
+    box.x1 = rect->x + rect->w;
+    box.y1 = rect->y + rect->h;
+
+    // search the items
+    tb_size_t count = gb_scene_search(impl, &box);
+
+    // ok
+    *items = impl->results;
+    return count;
+}
+tb_long_t gb_scene_hit(gb_scene_ref_t scene, gb_point_ref_t point)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl && point, -1);
+
+    // make box
+    gb_scene_box_t box;
+    box.x0 = point->x;
+    box.y0 = point->y;
+    box.x1 = point->x;
+    box.y1 = point->y;
+
+    // search the items whose bounds contain the point
+    tb_size_t count = gb_scene_search(impl, &box);
+
+    // hit the shapes from the topmost item, the last one is the topmost item
+    while (count--)
+    {
+        // the item
+        tb_size_t           index = impl->results[count];
+        gb_scene_item_ref_t item = &impl->items[index];
+        tb_size_t           mode = gb_paint_mode(item->paint);
+
+        // hit the filled shape?
+        if ((mode & GB_PAINT_MODE_FILL) && gb_path_contains_point(item->path, point, gb_paint_fill_rule(item->paint)))
+            return (tb_long_t)index;
+
+        // hit the outline? the hairline is hit as one pixel width
+        gb_float_t width = gb_paint_stroke_width(item->paint);
+        if ((mode & GB_PAINT_MODE_STROKE) && gb_path_contains_stroke_point(item->path, point, width > 0? width : GB_ONE, 0))
+            return (tb_long_t)index;
+    }
+
+    // not found
+    return -1;
+}
+tb_size_t gb_scene_draw(gb_scene_ref_t scene, gb_canvas_ref_t canvas)
+{
+    // check
+    gb_scene_impl_t* impl = (gb_scene_impl_t*)scene;
+    tb_assert_and_check_return_val(impl && canvas, 0);
+
+    // the inverse canvas matrix, nothing will be drawn if it is not invertible
+    gb_matrix_t inverse = *gb_canvas_matrix(canvas);
+    tb_check_return_val(gb_matrix_invert(&inverse), 0);
+
+    // map the corners of the canvas to the scene
+    gb_point_t points[4];
+    gb_point_imake(&points[0], 0, 0);
+    gb_point_imake(&points[1], gb_canvas_width(canvas), 0);
+    gb_point_imake(&points[2], gb_canvas_width(canvas), gb_canvas_height(canvas));
+    gb_point_imake(&points[3], 0, gb_canvas_height(canvas));
+    gb_matrix_apply_points(&inverse, points, tb_arrayn(points));
+
+    // make the viewport
+    gb_rect_t viewport;
+    gb_bounds_make(&viewport, points, tb_arrayn(points));
+
+    // search the visible items
+    gb_scene_box_t box;
+    box.x0 = viewport.x;
+    box.y0 = viewport.y;
+    box.x1 = viewport.x + viewport.w;
+    box.y1 = viewport.y + viewport.h;
+    tb_size_t count = gb_scene_search(impl, &box);
+    tb_check_return_val(count, 0);
+
+    // save paint
+    gb_paint_ref_t paint = gb_canvas_save_paint(canvas);
+    tb_assert_and_check_return_val(paint, 0);
+
+    // draw the visible items in the added order
+    tb_size_t i;
+    for (i = 0; i < count; i++)
+    {
+        gb_scene_item_ref_t item = &impl->items[impl->results[i]];
+        gb_paint_copy(paint, item->paint);
+        gb_canvas_draw_path(canvas, item->path);
+    }
+
+    // load paint
+    gb_canvas_load_paint(canvas);
+
+    // ok
+    return count;
+}
@@ -0,0 +1,171 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        scene.h
+ * @ingroup     core
+ *
+ */
+#ifndef GB_CORE_SCENE_H
+#define GB_CORE_SCENE_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/*! init scene
+ *
+ * the scene retains the paths with their paints and indexes their bounds by the r-tree,
+ * so only the items intersecting the viewport will be drawn and the items can be picked quickly, e.g.
+ *
+ * @code
+ *
+    // add the paths of the map
+    gb_scene_add(scene, path, paint);
+    ...
+
+    // draw the visible items only
+    gb_scene_draw(scene, canvas);
+
+    // pick the topmost item at the cursor
+    tb_long_t index = gb_scene_hit(scene, &cursor);
+ * @endcode
+ *
+ * the items are drawn in the added order, and the index is rebuilt at the next drawing or query after adding items.
+ *
+ * @return          the scene
+ */
+gb_scene_ref_t      gb_scene_init(tb_noarg_t);
+
+/*! exit scene
+ *
+ * @param scene     the scene
+ */
+tb_void_t           gb_scene_exit(gb_scene_ref_t scene);
+
+/*! clear all items
+ *
+ * @param scene     the scene
+ */
+tb_void_t           gb_scene_clear(gb_scene_ref_t scene);
+
+/*! the items count
+ *
+ * @param scene     the scene
+ *
+ * @return          the items count
+ */
+tb_size_t           gb_scene_size(gb_scene_ref_t scene);
+
+/*! the bounds of all items
+ *
+ * @param scene     the scene
+ *
+ * @return          the bounds, return tb_null if there are no visible items
+ */
+gb_rect_ref_t       gb_scene_bounds(gb_scene_ref_t scene);
+
+/*! add the item
+ *
+ * the path and paint are referenced and not copied, they must be valid until the scene is cleared or exited,
+ * and the index of this item is the items count before adding it.
+ *
+ * @param scene     the scene
+ * @param path      the path
+ * @param paint     the paint
+ *
+ * @return          tb_true or tb_false
+ */
+tb_bool_t           gb_scene_add(gb_scene_ref_t scene, gb_path_ref_t path, gb_paint_ref_t paint);
+
+/*! update the bounds of the item after its path or paint has been modified
+ *
+ * @param scene     the scene
+ * @param index     the item index
+ */
+tb_void_t           gb_scene_update(gb_scene_ref_t scene, tb_size_t index);
+
+/*! the path of the item
+ *
+ * @param scene     the scene
+ * @param index     the item index
+ *
+ * @return          the path
+ */
+gb_path_ref_t       gb_scene_path(gb_scene_ref_t scene, tb_size_t index);
+
+/*! the paint of the item
+ *
+ * @param scene     the scene
+ * @param index     the item index
+ *
+ * @return          the paint
+ */
+gb_paint_ref_t      gb_scene_paint(gb_scene_ref_t scene, tb_size_t index);
+
+/*! query the items intersecting the rect
+ *
+ * @param scene     the scene
+ * @param rect      the rect
+ * @param items     the indices of the found items in the drawing order,
+ *                  they are valid until the next drawing or query
+ *
+ * @return          the found items count
+ */
+tb_size_t           gb_scene_query(gb_scene_ref_t scene, gb_rect_ref_t rect, tb_size_t const** items);
+
+/*! hit the topmost item whose shape contains the point
+ *
+ * the candidates are found by the bounds, and then the filled shape is tested by the fill rule of the paint
+ * and the outline is tested by the stroke width of the paint, see gb_path_contains_point and gb_path_contains_stroke_point.
+ *
+ * @param scene     the scene
+ * @param point     the point
+ *
+ * @return          the item index, return -1 if not found
+ */
+tb_long_t           gb_scene_hit(gb_scene_ref_t scene, gb_point_ref_t point);
+
+/*! draw the items intersecting the viewport of the canvas
+ *
+ * the viewport is the canvas bounds mapped to the scene by the inverse canvas matrix,
+ * and the paint of the canvas will be restored after drawing.
+ *
+ * @param scene     the scene
+ * @param canvas    the canvas
+ *
+ * @return          the drawn items count
+ */
+tb_size_t           gb_scene_draw(gb_scene_ref_t scene, gb_canvas_ref_t canvas);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
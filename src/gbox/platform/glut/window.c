@@ -54,11 +54,11 @@ typedef struct __gb_window_glut_impl_t
     // the canvas
     gb_canvas_ref_t         canvas;
 
-    // the delay for framerate
-    tb_size_t               delay;
+    // the fired time of the armed timer, 0: not armed
+    tb_hong_t               when;
 
-    // the spak time
-    tb_hong_t               time;
+    // the serial of the armed timer
+    tb_size_t               serial;
 
     // the button
     tb_size_t               button;
@@ -71,12 +71,19 @@ typedef struct __gb_window_glut_impl_t
 
 }gb_window_glut_impl_t;
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the window id bits in the timer value, the serial of the timer is in the high bits
+#define GB_WINDOW_GLUT_ID_BITS          (4)
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * globals
  */
 
 // the windows
-static gb_window_glut_impl_t*   g_windows[16] = {tb_null};
+static gb_window_glut_impl_t*   g_windows[1 << GB_WINDOW_GLUT_ID_BITS] = {tb_null};
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
@@ -86,6 +93,48 @@ static __tb_inline__ gb_window_glut_impl_t* gb_window_glut_get()
     tb_int_t id = glutGetWindow();
     return (id < tb_arrayn(g_windows))? g_windows[id] : tb_null;
 }
+static tb_void_t gb_window_glut_timer(tb_int_t value);
+static tb_void_t gb_window_glut_schedule(gb_window_glut_impl_t* impl)
+{
+    // check
+    tb_assert(impl);
+
+    // the wait time for the next frame
+    tb_long_t wait = gb_window_impl_wait((gb_window_ref_t)impl);
+
+    // nothing to draw? wait for the next invalidation
+    tb_check_return(wait >= 0);
+
+    // draw it now
+    if (!wait) 
+    {
+        glutPostWindowRedisplay(impl->id);
+        return ;
+    }
+
+    // the fired time
+    tb_hong_t when = tb_cache_time_mclock() + wait;
+
+    // the armed timer will be fired in time?
+    tb_check_return(!impl->when || impl->when > when);
+
+    /* arm a new timer
+     *
+     * the glut timer cannot be cancelled, so the old timer will be ignored by the serial when it is fired
+     */
+    impl->when      = when;
+    impl->serial    = (impl->serial + 1) & 0xffff;
+    glutTimerFunc((tb_uint_t)wait, gb_window_glut_timer, (tb_int_t)((impl->serial << GB_WINDOW_GLUT_ID_BITS) | impl->id));
+}
+static tb_void_t gb_window_glut_wakeup(gb_window_ref_t window)
+{
+    // check
+    gb_window_glut_impl_t* impl = (gb_window_glut_impl_t*)window;
+    tb_assert_and_check_return(impl && impl->id);
+
+    // schedule the next frame
+    gb_window_glut_schedule(impl);
+}
 static tb_void_t gb_window_glut_display()
 {
     // check
@@ -93,7 +142,7 @@ static tb_void_t gb_window_glut_display()
     tb_assert_and_check_return(impl && impl->canvas);
 
     // spak
-    impl->time = gb_window_impl_spak((gb_window_ref_t)impl);
+    gb_window_impl_spak((gb_window_ref_t)impl);
 
     // draw
     gb_window_impl_draw((gb_window_ref_t)impl, impl->canvas);
@@ -101,8 +150,8 @@ static tb_void_t gb_window_glut_display()
 	// flush
 	glutSwapBuffers();
 
-    // compute the spak time
-    impl->time = tb_cache_time_spak() - impl->time;
+    // schedule the next frame after drawing
+    gb_window_glut_schedule(impl);
 }
 static tb_void_t gb_window_glut_reshape(tb_int_t width, tb_int_t height)
 {
@@ -127,6 +176,9 @@ static tb_void_t gb_window_glut_reshape(tb_int_t width, tb_int_t height)
 
     // done resize
     if (impl->base.info.resize) impl->base.info.resize((gb_window_ref_t)impl, impl->canvas, impl->base.info.priv);
+
+    // redraw the whole window
+    gb_window_invalidate((gb_window_ref_t)impl, tb_null);
 }
 static tb_void_t gb_window_glut_keyboard(tb_byte_t key, tb_int_t x, tb_int_t y)
 { 
@@ -329,21 +381,21 @@ static tb_void_t gb_window_glut_motion(tb_int_t x, tb_int_t y)
 }
 static tb_void_t gb_window_glut_timer(tb_int_t value)
 {
-    // check
-    gb_window_glut_impl_t* impl = g_windows[value];
-    tb_assert_and_check_return(impl);
+    // check, the window may have been exited
+    gb_window_glut_impl_t* impl = g_windows[value & ((1 << GB_WINDOW_GLUT_ID_BITS) - 1)];
+    tb_check_return(impl);
 
     // trace
 //    tb_trace_d("timer: %d", value);
 
-    // post to draw it
-    glutPostRedisplay();
+    // it has been replaced by the newer timer? ignore it
+    tb_check_return((tb_size_t)(value >> GB_WINDOW_GLUT_ID_BITS) == impl->serial);
 
-    // compute the delay for framerate
-    if (!impl->delay) impl->delay = 1000 / (impl->base.info.framerate? impl->base.info.framerate : GB_WINDOW_DEFAULT_FRAMERATE);
+    // the timer has been fired
+    impl->when = 0;
 
-    // next timer
-    glutTimerFunc(impl->delay > (tb_size_t)impl->time? impl->delay - (tb_size_t)impl->time : 0, gb_window_glut_timer, value);
+    // spak the timer tasks and draw or schedule the next frame
+    gb_window_glut_schedule(impl);
 }
 static tb_void_t gb_window_glut_visibility(tb_int_t state)
 {
@@ -361,6 +413,9 @@ static tb_void_t gb_window_glut_visibility(tb_int_t state)
 
     // done event
     gb_window_impl_event((gb_window_ref_t)impl, &event);
+
+    // redraw the whole window if it is visible again
+    if (state == GLUT_VISIBLE) gb_window_invalidate((gb_window_ref_t)impl, tb_null);
 }
 #ifdef TB_CONFIG_OS_MACOSX
 static tb_void_t gb_window_glut_close()
@@ -435,6 +490,9 @@ static tb_void_t gb_window_glut_loop(gb_window_ref_t window)
     // done init
     if (impl->base.info.init && !impl->base.info.init((gb_window_ref_t)impl, impl->canvas, impl->base.info.priv)) return ;
 
+    // schedule the first frame
+    gb_window_glut_schedule(impl);
+
     // loop
 #ifdef TB_CONFIG_OS_MACOSX
     while (!tb_atomic_get(&impl->stop))
@@ -512,6 +570,7 @@ gb_window_ref_t gb_window_init_glut(gb_window_info_ref_t info)
         impl->base.loop         = gb_window_glut_loop;
         impl->base.exit         = gb_window_glut_exit;
         impl->base.fullscreen   = gb_window_glut_fullscreen;
+        impl->base.wakeup       = gb_window_glut_wakeup;
         impl->base.info         = *info;
 
         // init normal width and height
@@ -557,7 +616,6 @@ gb_window_ref_t gb_window_init_glut(gb_window_info_ref_t info)
         glutMouseFunc(gb_window_glut_mouse);
         glutMotionFunc(gb_window_glut_motion);
         glutPassiveMotionFunc(gb_window_glut_motion);
-        glutTimerFunc(1000 / impl->base.info.framerate, gb_window_glut_timer, impl->id);
         glutVisibilityFunc(gb_window_glut_visibility);
 #ifdef TB_CONFIG_OS_MACOSX
         glutWMCloseFunc(gb_window_glut_close);
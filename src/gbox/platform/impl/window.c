@@ -33,6 +33,24 @@
 #include "prefix.h"
 #include "window.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static __tb_inline__ tb_hong_t gb_window_impl_next(gb_window_impl_t* impl, tb_size_t* period)
+{
+    // the framerate
+    tb_size_t framerate = impl->info.framerate? impl->info.framerate : GB_WINDOW_DEFAULT_FRAMERATE;
+
+    // the frame period
+    if (period) *period = 1000 / framerate;
+
+    /* the start time of the next frame
+     *
+     * computes it from the base time instead of accumulating the rounded periods, so it will not drift
+     */
+    return impl->pace_time + ((tb_hong_t)impl->pace_count * 1000) / framerate;
+}
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
@@ -67,20 +85,96 @@ tb_hong_t gb_window_impl_spak(gb_window_ref_t window)
 		impl->fps_time = time;
     }
 
+    // the start time of this frame
+    tb_size_t period = 0;
+    tb_hong_t next = gb_window_impl_next(impl, &period);
+
+    /* restart the pacing from this frame if it is the first frame or it is late for a whole period,
+     * .e.g the on-demand window has been idle or the drawing is too slow,
+     * otherwise the next frame will be started from the scheduled time of this frame
+     */
+    if (!impl->pace_time || time >= next + period)
+    {
+        impl->pace_time     = time;
+        impl->pace_count    = 1;
+    }
+    else impl->pace_count++;
+
     // spak timer
     if (impl->timer) tb_timer_spak(impl->timer);
 
     // the spak time
     return time;
 }
+tb_long_t gb_window_impl_wait(gb_window_ref_t window)
+{
+    // check
+    gb_window_impl_t* impl = (gb_window_impl_t*)window;
+    tb_assert(impl);
+
+    // spak the cache time
+    tb_hong_t time = tb_cache_time_spak();
+
+    // spak timer, the timer tasks may invalidate the window
+    if (impl->timer) tb_timer_spak(impl->timer);
+
+    // need draw the next frame? the first frame is always drawn
+    tb_long_t wait = -1;
+    if (    !(impl->flag & GB_WINDOW_FLAG_ON_DEMAND)
+        ||  impl->animating
+        ||  !impl->pace_time
+        ||  (impl->dirty.w > 0 && impl->dirty.h > 0))
+    {
+        // the start time of the next frame
+        tb_hong_t next = gb_window_impl_next(impl, tb_null);
+
+        // the wait time
+        wait = next > time? (tb_long_t)(next - time) : 0;
+    }
+
+    // wait for the next timer task
+    if (wait && impl->timer)
+    {
+        // the timer delay
+        tb_size_t delay = tb_timer_delay(impl->timer);
+        if (delay != (tb_size_t)-1)
+        {
+            // the task is due now? spak it in the next waiting instead of drawing the frame
+            if (!delay) delay = 1;
+
+            // update the wait time
+            if (wait < 0 || (tb_size_t)wait > delay) wait = (tb_long_t)delay;
+        }
+    }
+
+    // the wait time
+    return wait;
+}
 tb_void_t gb_window_impl_draw(gb_window_ref_t window, gb_canvas_ref_t canvas)
 {
     // check
     gb_window_impl_t* impl = (gb_window_impl_t*)window;
     tb_assert(impl && impl->info.draw && canvas);
 
+    // the profiler of the canvas context
+    gb_profiler_ref_t profiler = gb_context_profiler(gb_device_context(gb_canvas_device(canvas)));
+
+    // begin frame
+    if (profiler) gb_profiler_frame_begin(profiler);
+
+    // the dirty bounds of this frame, redraws the whole window if not invalidated, .e.g the continuous or exposed window
+    if ((impl->flag & GB_WINDOW_FLAG_ON_DEMAND) && !impl->animating && impl->dirty.w > 0 && impl->dirty.h > 0)
+        impl->drawing = impl->dirty;
+    else gb_rect_imake(&impl->drawing, 0, 0, impl->width, impl->height);
+
+    // clear the dirty bounds first, so the invalidations in the draw func will schedule the next frame
+    tb_memset(&impl->dirty, 0, sizeof(gb_rect_t));
+
     // done draw
     impl->info.draw((gb_window_ref_t)impl, canvas, impl->info.priv);
+
+    // end frame
+    if (profiler) gb_profiler_frame_end(profiler);
 }
 tb_void_t gb_window_impl_event(gb_window_ref_t window, gb_event_ref_t event)
 {
@@ -29,6 +29,7 @@
 #include "../prefix.h"
 #include "../window.h"
 #include "../../core/device.h"
+#include "../../core/context.h"
 #include "../../core/canvas.h"
 #include "../../core/pixmap.h"
 #include "../../core/bitmap.h"
@@ -88,6 +89,21 @@ typedef struct __gb_window_impl_t
     // the frame count for fps
     tb_size_t               fps_count;
 
+    // the base time for pacing the frames
+    tb_hong_t               pace_time;
+
+    // the frame count after the pacing base time
+    tb_size_t               pace_count;
+
+    // the dirty bounds for the next frame, empty if not invalidated
+    gb_rect_t               dirty;
+
+    // the dirty bounds of the drawing frame
+    gb_rect_t               drawing;
+
+    // is animating?
+    tb_bool_t               animating;
+
     /* loop window
      *
      * @param window        the window
@@ -128,13 +144,19 @@ typedef struct __gb_window_impl_t
      */
     tb_void_t               (*show)(gb_window_ref_t window, tb_bool_t show);
 
+    /*! wake up the loop for drawing the invalidated frame, optional
+     *
+     * @param window        the window
+     */
+    tb_void_t               (*wakeup)(gb_window_ref_t window);
+
 }gb_window_impl_t;
 
 /* //////////////////////////////////////////////////////////////////////////////////////
  * interface
  */
 
-/* spak window
+/* spak window before drawing the frame
  *
  * @param window            the window
  *
@@ -142,6 +164,17 @@ typedef struct __gb_window_impl_t
  */
 tb_hong_t                   gb_window_impl_spak(gb_window_ref_t window);
 
+/* spak the timer and compute the wait time for the next frame
+ *
+ * the frames are paced from the start time of the previous frames without drift,
+ * so the drawing time has been accounted.
+ *
+ * @param window            the window
+ *
+ * @return                  0: draw it now, > 0: the wait time (ms), -1: wait for the events
+ */
+tb_long_t                   gb_window_impl_wait(gb_window_ref_t window);
+
 /* draw window
  *
  * @param window            the window
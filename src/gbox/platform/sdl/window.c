@@ -35,6 +35,13 @@
 #include "../impl/window.h"
 #include "sdl/sdl.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum slice (ms) for waiting the next frame, the events will be polled after it
+#define GB_WINDOW_SDL_WAIT_MAXN         (10)
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * types
  */
@@ -89,6 +96,175 @@ static tb_void_t gb_window_sdl_exit(gb_window_ref_t window)
     // exit sdl
     SDL_Quit();
 }
+static tb_bool_t gb_window_sdl_event(gb_window_sdl_impl_t* impl, SDL_Event const* evet)
+{
+    // check
+    tb_assert(impl && evet);
+
+    // done
+    tb_bool_t ok = tb_true;
+    switch (evet->type)
+    {
+    case SDL_MOUSEMOTION:
+        {
+            // init event
+            gb_event_t              event = {0};
+            event.type              = GB_EVENT_TYPE_MOUSE;
+            event.u.mouse.code      = GB_MOUSE_MOVE;
+            event.u.mouse.button    = impl->button;
+            gb_point_imake(&event.u.mouse.cursor, evet->motion.x, evet->motion.y);
+
+            // done event
+            gb_window_impl_event((gb_window_ref_t)impl, &event);
+        }
+        break;
+    case SDL_MOUSEBUTTONUP:
+    case SDL_MOUSEBUTTONDOWN:
+        {
+            // init event
+            gb_event_t              event = {0};
+            event.type              = GB_EVENT_TYPE_MOUSE;
+            event.u.mouse.code      = evet->type == SDL_MOUSEBUTTONDOWN? GB_MOUSE_DOWN : GB_MOUSE_UP;
+            gb_point_imake(&event.u.mouse.cursor, evet->button.x, evet->button.y);
+
+            // init button
+            switch (evet->button.button)
+            {
+            case SDL_BUTTON_LEFT:   event.u.mouse.button = GB_MOUSE_BUTTON_LEFT;    break;
+            case SDL_BUTTON_RIGHT:  event.u.mouse.button = GB_MOUSE_BUTTON_RIGHT;   break;
+            case SDL_BUTTON_MIDDLE: event.u.mouse.button = GB_MOUSE_BUTTON_MIDDLE;  break;
+            default:                event.u.mouse.button = GB_MOUSE_BUTTON_NONE;    break;
+            }
+
+            // save button
+            impl->button = evet->type == SDL_MOUSEBUTTONDOWN? event.u.mouse.button : GB_MOUSE_BUTTON_NONE;
+
+            // done event
+            gb_window_impl_event((gb_window_ref_t)impl, &event);
+        }
+        break;
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+        {
+            // init event
+            gb_event_t                  event = {0};
+            event.type                  = GB_EVENT_TYPE_KEYBOARD;
+            event.u.keyboard.pressed    = evet->type == SDL_KEYDOWN? tb_true : tb_false;
+
+            // init code
+            switch ((tb_size_t)evet->key.keysym.sym)
+            {
+            case SDLK_F1:           event.u.keyboard.code = GB_KEY_F1;          break;
+            case SDLK_F2:           event.u.keyboard.code = GB_KEY_F2;          break;
+            case SDLK_F3:           event.u.keyboard.code = GB_KEY_F3;          break;
+            case SDLK_F4:           event.u.keyboard.code = GB_KEY_F4;          break;
+            case SDLK_F5:           event.u.keyboard.code = GB_KEY_F5;          break;
+            case SDLK_F6:           event.u.keyboard.code = GB_KEY_F6;          break;
+            case SDLK_F7:           event.u.keyboard.code = GB_KEY_F7;          break;
+            case SDLK_F8:           event.u.keyboard.code = GB_KEY_F8;          break;
+            case SDLK_F9:           event.u.keyboard.code = GB_KEY_F9;          break;
+            case SDLK_F10:          event.u.keyboard.code = GB_KEY_F10;         break;
+            case SDLK_F11:          event.u.keyboard.code = GB_KEY_F11;         break;
+            case SDLK_F12:          event.u.keyboard.code = GB_KEY_F12;         break;
+
+            case SDLK_LEFT:         event.u.keyboard.code = GB_KEY_LEFT;        break;
+            case SDLK_UP:           event.u.keyboard.code = GB_KEY_UP;          break;
+            case SDLK_RIGHT:        event.u.keyboard.code = GB_KEY_RIGHT;       break;
+            case SDLK_DOWN:         event.u.keyboard.code = GB_KEY_DOWN;        break;
+
+            case SDLK_HOME:         event.u.keyboard.code = GB_KEY_HOME;        break;
+            case SDLK_END:          event.u.keyboard.code = GB_KEY_END;         break;
+            case SDLK_INSERT:       event.u.keyboard.code = GB_KEY_INSERT;      break;
+            case SDLK_PAGEUP:       event.u.keyboard.code = GB_KEY_PAGEUP;      break;
+            case SDLK_PAGEDOWN:     event.u.keyboard.code = GB_KEY_PAGEDOWN;    break;
+
+            case SDLK_HELP:         event.u.keyboard.code = GB_KEY_HELP;        break;
+            case SDLK_PRINT:        event.u.keyboard.code = GB_KEY_PRINT;       break;
+            case SDLK_SYSREQ:       event.u.keyboard.code = GB_KEY_SYSREQ;      break;
+            case SDLK_BREAK:        event.u.keyboard.code = GB_KEY_BREAK;       break;
+            case SDLK_MENU:         event.u.keyboard.code = GB_KEY_MENU;        break;
+            case SDLK_POWER:        event.u.keyboard.code = GB_KEY_POWER;       break;
+            case SDLK_EURO:         event.u.keyboard.code = GB_KEY_EURO;        break;
+            case SDLK_UNDO:         event.u.keyboard.code = GB_KEY_UNDO;        break;
+
+            case SDLK_NUMLOCK:      event.u.keyboard.code = GB_KEY_NUMLOCK;     break;
+            case SDLK_CAPSLOCK:     event.u.keyboard.code = GB_KEY_CAPSLOCK;    break;
+            case SDLK_SCROLLOCK:    event.u.keyboard.code = GB_KEY_SCROLLLOCK;  break;
+            case SDLK_RSHIFT:       event.u.keyboard.code = GB_KEY_RSHIFT;      break;
+            case SDLK_LSHIFT:       event.u.keyboard.code = GB_KEY_LSHIFT;      break;
+            case SDLK_RCTRL:        event.u.keyboard.code = GB_KEY_RCTRL;       break;
+            case SDLK_LCTRL:        event.u.keyboard.code = GB_KEY_LCTRL;       break;
+            case SDLK_RALT:         event.u.keyboard.code = GB_KEY_RALT;        break;
+            case SDLK_LALT:         event.u.keyboard.code = GB_KEY_LALT;        break;
+            case 0x136:             event.u.keyboard.code = GB_KEY_RCMD;        break;
+            case 0x135:             event.u.keyboard.code = GB_KEY_LCMD;        break;
+
+            case SDLK_PAUSE:        event.u.keyboard.code = GB_KEY_PAUSE;       break;
+
+            default :
+                if (evet->key.keysym.sym < 256)
+                {
+                    // the char code
+                    event.u.keyboard.code = evet->key.keysym.sym;
+                }
+                break;
+            }
+
+            // done event
+            if (event.u.keyboard.code) gb_window_impl_event((gb_window_ref_t)impl, &event);
+        }
+        break;
+    case SDL_VIDEORESIZE:
+        {
+            // trace
+            tb_trace_d("resize: type: %d, %dx%d", evet->resize.type, evet->resize.w, evet->resize.h);
+
+            // TODO
+            // ...
+        }
+        break;
+    case SDL_VIDEOEXPOSE:
+        {
+            // redraw the whole window
+            gb_window_invalidate((gb_window_ref_t)impl, tb_null);
+        }
+        break;
+    case SDL_ACTIVEEVENT:
+        {
+            // trace
+            tb_trace_d("active: type: %d, gain: %d, state: %d", evet->active.type, evet->active.gain, evet->active.state);
+
+            // active?
+            if (evet->active.state == SDL_APPACTIVE)
+            {
+                // init event
+                gb_event_t              event = {0};
+                event.type              = GB_EVENT_TYPE_ACTIVE;
+                event.u.active.code     = evet->active.gain? GB_ACTIVE_FOREGROUND : GB_ACTIVE_BACKGROUND;
+
+                // done event
+                gb_window_impl_event((gb_window_ref_t)impl, &event);
+
+                // redraw the whole window if it is in the foreground again
+                if (evet->active.gain) gb_window_invalidate((gb_window_ref_t)impl, tb_null);
+            }
+        }
+        break;
+    case SDL_QUIT:
+        {
+            // stop it
+            ok = tb_false;
+        }
+        break;
+    default:
+        // trace
+        tb_trace_e("unknown event: %x", evet->type);
+        break;
+    }
+
+    // ok?
+    return ok;
+}
 static tb_void_t gb_window_sdl_loop(gb_window_ref_t window)
 {
     // check
@@ -104,186 +280,48 @@ static tb_void_t gb_window_sdl_loop(gb_window_ref_t window)
 
     // loop
     SDL_Event evet;
-    tb_hong_t time;
+    tb_long_t wait;
     tb_bool_t stop = tb_false;
-    tb_size_t delay = 1000 / (impl->base.info.framerate? impl->base.info.framerate : GB_WINDOW_DEFAULT_FRAMERATE);
     while (!stop)
     {
-        // spak
-        time = gb_window_impl_spak((gb_window_ref_t)impl);
+        // the wait time for the next frame
+        wait = gb_window_impl_wait((gb_window_ref_t)impl);
 
-        // lock the surface
-        SDL_LockSurface(impl->surface);
+        // draw it now?
+        if (!wait)
+        {
+            // spak
+            gb_window_impl_spak((gb_window_ref_t)impl);
 
-        // draw
-        gb_window_impl_draw((gb_window_ref_t)impl, impl->canvas);
+            // lock the surface
+            SDL_LockSurface(impl->surface);
 
-        // unlock the surface
-        SDL_UnlockSurface(impl->surface);
+            // draw
+            gb_window_impl_draw((gb_window_ref_t)impl, impl->canvas);
 
-        // flip 
-        if (SDL_Flip(impl->surface) < 0) stop = tb_true;
+            // unlock the surface
+            SDL_UnlockSurface(impl->surface);
 
-        // poll
-        while (SDL_PollEvent(&evet))
+            // flip 
+            if (SDL_Flip(impl->surface) < 0) stop = tb_true;
+        }
+        // nothing to draw? block until the next event
+        else if (wait < 0)
         {
-            // done
-            switch (evet.type)
-            {
-            case SDL_MOUSEMOTION:
-                {
-                    // init event
-                    gb_event_t              event = {0};
-                    event.type              = GB_EVENT_TYPE_MOUSE;
-                    event.u.mouse.code      = GB_MOUSE_MOVE;
-                    event.u.mouse.button    = impl->button;
-                    gb_point_imake(&event.u.mouse.cursor, evet.motion.x, evet.motion.y);
-
-                    // done event
-                    gb_window_impl_event((gb_window_ref_t)impl, &event);
-                }
-                break;
-            case SDL_MOUSEBUTTONUP:
-            case SDL_MOUSEBUTTONDOWN:
-                {
-                    // init event
-                    gb_event_t              event = {0};
-                    event.type              = GB_EVENT_TYPE_MOUSE;
-                    event.u.mouse.code      = evet.type == SDL_MOUSEBUTTONDOWN? GB_MOUSE_DOWN : GB_MOUSE_UP;
-                    gb_point_imake(&event.u.mouse.cursor, evet.button.x, evet.button.y);
-
-                    // init button
-                    switch (evet.button.button)
-                    {
-                    case SDL_BUTTON_LEFT:   event.u.mouse.button = GB_MOUSE_BUTTON_LEFT;    break;
-                    case SDL_BUTTON_RIGHT:  event.u.mouse.button = GB_MOUSE_BUTTON_RIGHT;   break;
-                    case SDL_BUTTON_MIDDLE: event.u.mouse.button = GB_MOUSE_BUTTON_MIDDLE;  break;
-                    default:                event.u.mouse.button = GB_MOUSE_BUTTON_NONE;    break;
-                    }
-
-                    // save button
-                    impl->button = evet.type == SDL_MOUSEBUTTONDOWN? event.u.mouse.button : GB_MOUSE_BUTTON_NONE;
-
-                    // done event
-                    gb_window_impl_event((gb_window_ref_t)impl, &event);
-                }
-                break;
-            case SDL_KEYDOWN:
-            case SDL_KEYUP:
-                {
-                    // init event
-                    gb_event_t                  event = {0};
-                    event.type                  = GB_EVENT_TYPE_KEYBOARD;
-                    event.u.keyboard.pressed    = evet.type == SDL_KEYDOWN? tb_true : tb_false;
-
-                    // init code
-                    switch ((tb_size_t)evet.key.keysym.sym)
-                    {
-                    case SDLK_F1:           event.u.keyboard.code = GB_KEY_F1;          break;
-                    case SDLK_F2:           event.u.keyboard.code = GB_KEY_F2;          break;
-                    case SDLK_F3:           event.u.keyboard.code = GB_KEY_F3;          break;
-                    case SDLK_F4:           event.u.keyboard.code = GB_KEY_F4;          break;
-                    case SDLK_F5:           event.u.keyboard.code = GB_KEY_F5;          break;
-                    case SDLK_F6:           event.u.keyboard.code = GB_KEY_F6;          break;
-                    case SDLK_F7:           event.u.keyboard.code = GB_KEY_F7;          break;
-                    case SDLK_F8:           event.u.keyboard.code = GB_KEY_F8;          break;
-                    case SDLK_F9:           event.u.keyboard.code = GB_KEY_F9;          break;
-                    case SDLK_F10:          event.u.keyboard.code = GB_KEY_F10;         break;
-                    case SDLK_F11:          event.u.keyboard.code = GB_KEY_F11;         break;
-                    case SDLK_F12:          event.u.keyboard.code = GB_KEY_F12;         break;
-
-                    case SDLK_LEFT:         event.u.keyboard.code = GB_KEY_LEFT;        break;
-                    case SDLK_UP:           event.u.keyboard.code = GB_KEY_UP;          break;
-                    case SDLK_RIGHT:        event.u.keyboard.code = GB_KEY_RIGHT;       break;
-                    case SDLK_DOWN:         event.u.keyboard.code = GB_KEY_DOWN;        break;
-
-                    case SDLK_HOME:         event.u.keyboard.code = GB_KEY_HOME;        break;
-                    case SDLK_END:          event.u.keyboard.code = GB_KEY_END;         break;
-                    case SDLK_INSERT:       event.u.keyboard.code = GB_KEY_INSERT;      break;
-                    case SDLK_PAGEUP:       event.u.keyboard.code = GB_KEY_PAGEUP;      break;
-                    case SDLK_PAGEDOWN:     event.u.keyboard.code = GB_KEY_PAGEDOWN;    break;
-
-                    case SDLK_HELP:         event.u.keyboard.code = GB_KEY_HELP;        break;
-                    case SDLK_PRINT:        event.u.keyboard.code = GB_KEY_PRINT;       break;
-                    case SDLK_SYSREQ:       event.u.keyboard.code = GB_KEY_SYSREQ;      break;
-                    case SDLK_BREAK:        event.u.keyboard.code = GB_KEY_BREAK;       break;
-                    case SDLK_MENU:         event.u.keyboard.code = GB_KEY_MENU;        break;
-                    case SDLK_POWER:        event.u.keyboard.code = GB_KEY_POWER;       break;
-                    case SDLK_EURO:         event.u.keyboard.code = GB_KEY_EURO;        break;
-                    case SDLK_UNDO:         event.u.keyboard.code = GB_KEY_UNDO;        break;
-
-                    case SDLK_NUMLOCK:      event.u.keyboard.code = GB_KEY_NUMLOCK;     break;
-                    case SDLK_CAPSLOCK:     event.u.keyboard.code = GB_KEY_CAPSLOCK;    break;
-                    case SDLK_SCROLLOCK:    event.u.keyboard.code = GB_KEY_SCROLLLOCK;  break;
-                    case SDLK_RSHIFT:       event.u.keyboard.code = GB_KEY_RSHIFT;      break;
-                    case SDLK_LSHIFT:       event.u.keyboard.code = GB_KEY_LSHIFT;      break;
-                    case SDLK_RCTRL:        event.u.keyboard.code = GB_KEY_RCTRL;       break;
-                    case SDLK_LCTRL:        event.u.keyboard.code = GB_KEY_LCTRL;       break;
-                    case SDLK_RALT:         event.u.keyboard.code = GB_KEY_RALT;        break;
-                    case SDLK_LALT:         event.u.keyboard.code = GB_KEY_LALT;        break;
-                    case 0x136:             event.u.keyboard.code = GB_KEY_RCMD;        break;
-                    case 0x135:             event.u.keyboard.code = GB_KEY_LCMD;        break;
-
-                    case SDLK_PAUSE:        event.u.keyboard.code = GB_KEY_PAUSE;       break;
-
-                    default :
-                        if (evet.key.keysym.sym < 256)
-                        {
-                            // the char code
-                            event.u.keyboard.code = evet.key.keysym.sym;
-                        }
-                        break;
-                    }
-
-                    // done event
-                    if (event.u.keyboard.code) gb_window_impl_event((gb_window_ref_t)impl, &event);
-                }
-                break;
-            case SDL_VIDEORESIZE:
-                {
-                    // trace
-                    tb_trace_d("resize: type: %d, %dx%d", evet.resize.type, evet.resize.w, evet.resize.h);
-
-                    // TODO
-                    // ...
-                }
-                break;
-            case SDL_ACTIVEEVENT:
-                {
-                    // trace
-                    tb_trace_d("active: type: %d, gain: %d, state: %d", evet.active.type, evet.active.gain, evet.active.state);
-
-                    // active?
-                    if (evet.active.state == SDL_APPACTIVE)
-                    {
-                        // init event
-                        gb_event_t              event = {0};
-                        event.type              = GB_EVENT_TYPE_ACTIVE;
-                        event.u.active.code     = evet.active.gain? GB_ACTIVE_FOREGROUND : GB_ACTIVE_BACKGROUND;
-
-                        // done event
-                        gb_window_impl_event((gb_window_ref_t)impl, &event);
-                    }
-                }
-                break;
-            case SDL_QUIT:
-                {
-                    // stop it
-                    stop = tb_true;
-                }
-                break;
-            default:
-                // trace
-                tb_trace_e("unknown event: %x", evet.type);
-                break;
-            }
+            if (SDL_WaitEvent(&evet) && !gb_window_sdl_event(impl, &evet)) stop = tb_true;
         }
+        /* wait for the next frame or timer task
+         *
+         * sdl has not the waiting with timeout, so we sleep for a short slice only and poll the events again
+         */
+        else SDL_Delay((Uint32)tb_min(wait, GB_WINDOW_SDL_WAIT_MAXN));
 
-        // compute the delta time
-        time = tb_cache_time_spak() - time;
-
-        // wait 
-        if (delay > (tb_size_t)time) SDL_Delay(delay - (tb_size_t)time);
+        // poll
+        while (!stop && SDL_PollEvent(&evet))
+        {
+            // done event
+            if (!gb_window_sdl_event(impl, &evet)) stop = tb_true;
+        }
     }
  
     // done exit
@@ -380,6 +418,9 @@ static tb_void_t gb_window_sdl_fullscreen(gb_window_ref_t window, tb_bool_t full
 
         // done resize
         if (impl->base.info.resize) impl->base.info.resize((gb_window_ref_t)impl, impl->canvas, impl->base.info.priv);
+
+        // redraw the whole window
+        gb_window_invalidate((gb_window_ref_t)impl, tb_null);
     }
 }
 
@@ -422,6 +463,8 @@ gb_window_ref_t gb_window_init_sdl(gb_window_info_ref_t info)
          * - xrgb8888_le
          * - xrgb8888_be
          * - rgb565_le
+         * - xbgr8888_le
+         * - bgr565_le
          */
 #ifdef TB_CONFIG_OS_MACOSX
         impl->base.pixfmt       = gb_quality() < GB_QUALITY_TOP? GB_PIXFMT_RGB565 : (GB_PIXFMT_XRGB8888 | GB_PIXFMT_BENDIAN);
@@ -468,6 +511,12 @@ gb_window_ref_t gb_window_init_sdl(gb_window_info_ref_t info)
         // init title
         if (impl->base.info.title) SDL_WM_SetCaption(impl->base.info.title, tb_null);
 
+#ifndef TB_CONFIG_OS_MACOSX
+        // the surface is bgr? draw to it directly with the bgr pixmap instead of converting the whole frame
+        if (impl->surface->format && impl->surface->format->Rmask < impl->surface->format->Bmask)
+            impl->base.pixfmt   = gb_quality() < GB_QUALITY_TOP? GB_PIXFMT_BGR565 : GB_PIXFMT_XBGR8888;
+#endif
+
         // init bitmap
         impl->base.bitmap = gb_bitmap_init(impl->surface->pixels, impl->base.pixfmt, impl->base.width, impl->base.height, impl->surface->pitch, tb_false);
         tb_assert_and_check_break(impl->base.bitmap);
@@ -221,3 +221,61 @@ tb_timer_ref_t gb_window_timer(gb_window_ref_t window)
     // the timer
     return impl->timer;
 }
+tb_void_t gb_window_invalidate(gb_window_ref_t window, gb_rect_ref_t rect)
+{
+    // check
+    gb_window_impl_t* impl = (gb_window_impl_t*)window;
+    tb_assert_and_check_return(impl);
+
+    // the window bounds
+    gb_float_t x0 = 0;
+    gb_float_t y0 = 0;
+    gb_float_t x1 = gb_long_to_float(impl->width);
+    gb_float_t y1 = gb_long_to_float(impl->height);
+
+    // clip the invalidated bounds to the window
+    if (rect)
+    {
+        if (rect->x > x0) x0 = rect->x;
+        if (rect->y > y0) y0 = rect->y;
+        if (rect->x + rect->w < x1) x1 = rect->x + rect->w;
+        if (rect->y + rect->h < y1) y1 = rect->y + rect->h;
+    }
+
+    // empty?
+    tb_check_return(x1 > x0 && y1 > y0);
+
+    // merge it to the dirty bounds
+    if (impl->dirty.w > 0 && impl->dirty.h > 0)
+    {
+        if (impl->dirty.x < x0) x0 = impl->dirty.x;
+        if (impl->dirty.y < y0) y0 = impl->dirty.y;
+        if (impl->dirty.x + impl->dirty.w > x1) x1 = impl->dirty.x + impl->dirty.w;
+        if (impl->dirty.y + impl->dirty.h > y1) y1 = impl->dirty.y + impl->dirty.h;
+    }
+    gb_rect_make(&impl->dirty, x0, y0, x1 - x0, y1 - y0);
+
+    // wake up the loop
+    if (impl->wakeup) impl->wakeup(window);
+}
+tb_void_t gb_window_animate(gb_window_ref_t window, tb_bool_t animating)
+{
+    // check
+    gb_window_impl_t* impl = (gb_window_impl_t*)window;
+    tb_assert_and_check_return(impl);
+
+    // update the animating state
+    impl->animating = animating;
+
+    // wake up the loop
+    if (animating && impl->wakeup) impl->wakeup(window);
+}
+gb_rect_ref_t gb_window_dirty(gb_window_ref_t window)
+{
+    // check
+    gb_window_impl_t* impl = (gb_window_impl_t*)window;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the dirty bounds of the drawing frame
+    return &impl->drawing;
+}
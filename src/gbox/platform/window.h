@@ -69,6 +69,7 @@ typedef enum __gb_window_flag_e
 ,   GB_WINDOW_FLAG_HIHE_TITLEBAR    = 2
 ,   GB_WINDOW_FLAG_HIHE_CURSOR      = 4
 ,   GB_WINDOW_FLAG_NOT_REISZE       = 8
+,   GB_WINDOW_FLAG_ON_DEMAND        = 16    //!< only draw the invalidated or animating frames, see gb_window_invalidate
 
 }gb_window_flag_e;
 
@@ -304,6 +305,40 @@ tb_void_t               gb_window_fullscreen(gb_window_ref_t window, tb_bool_t f
  */
 tb_timer_ref_t          gb_window_timer(gb_window_ref_t window);
 
+/*! invalidate the window bounds and schedule to redraw it
+ *
+ * the invalidated bounds will be merged to the dirty bounds of the next frame,
+ * it will be drawn on the next frame time, so the frequent invalidations are coalesced.
+ *
+ * @note it only can be called in the loop thread, .e.g in the event func, draw func or timer tasks
+ *
+ * @param window        the window
+ * @param rect          the bounds, invalidates the whole window if be null
+ */
+tb_void_t               gb_window_invalidate(gb_window_ref_t window, gb_rect_ref_t rect);
+
+/*! start or stop the animation for the on-demand window
+ *
+ * the window will be redrawn at the framerate like the continuous window while animating.
+ *
+ * @note it only can be called in the loop thread
+ *
+ * @param window        the window
+ * @param animating     is animating?
+ */
+tb_void_t               gb_window_animate(gb_window_ref_t window, tb_bool_t animating);
+
+/*! the dirty bounds of the drawing frame
+ *
+ * @note it is only valid in the draw func and 
+ * it is the whole window for the continuous or animating window
+ *
+ * @param window        the window
+ *
+ * @return              the dirty bounds
+ */
+gb_rect_ref_t           gb_window_dirty(gb_window_ref_t window);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * extern
  */
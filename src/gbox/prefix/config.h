@@ -49,6 +49,14 @@
 #   define __gb_debug__
 #endif
 
+/*! @def __gb_profile__
+ *
+ * profile mode, the hot paths will be instrumented for the profiler
+ */
+#ifdef GB_CONFIG_PROFILE
+#   define __gb_profile__
+#endif
+
 #endif
 
 
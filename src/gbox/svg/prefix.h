@@ -26,6 +26,7 @@
  * includes
  */
 #include "../prefix.h"
+#include "../core/core.h"
 
 #endif
 
@@ -0,0 +1,1083 @@
+/*!The Graphic Box Library
+ *
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox;
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ *
+ * Copyright (C) 2014 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        svg.c
+ * @ingroup     svg
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "svg"
+#define TB_TRACE_MODULE_DEBUG           (0)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "svg.h"
+#include "../core/impl/float.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the entries grow count
+#ifdef __gb_small__
+#   define GB_SVG_ENTRIES_GROW          (32)
+#else
+#   define GB_SVG_ENTRIES_GROW          (128)
+#endif
+
+// the styles grow count
+#define GB_SVG_STYLES_GROW              (16)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+// the svg paint type enum
+typedef enum __gb_svg_paint_type_e
+{
+    GB_SVG_PAINT_TYPE_NONE          = 0
+,   GB_SVG_PAINT_TYPE_COLOR         = 1
+,   GB_SVG_PAINT_TYPE_CURRENT       = 2 //!< currentColor
+
+}gb_svg_paint_type_e;
+
+// the svg style type, the inherited state of the current element
+typedef struct __gb_svg_style_t
+{
+    // the matrix
+    gb_matrix_t             matrix;
+
+    // the fill color
+    gb_color_t              fill;
+
+    // the stroke color
+    gb_color_t              stroke;
+
+    // the current color
+    gb_color_t              color;
+
+    // the stroke width
+    gb_float_t              stroke_width;
+
+    // the fill type
+    tb_uint8_t              fill_type;
+
+    // the stroke type
+    tb_uint8_t              stroke_type;
+
+    // the stroke cap
+    tb_uint8_t              cap;
+
+    // the stroke join
+    tb_uint8_t              join;
+
+    // the fill rule
+    tb_uint8_t              rule;
+
+    // the group opacity, multiplied by all parents
+    tb_uint8_t              opacity;
+
+    // the fill opacity
+    tb_uint8_t              fill_opacity;
+
+    // the stroke opacity
+    tb_uint8_t              stroke_opacity;
+
+    // is hidden by the visibility? the children can show themselves again
+    tb_uint8_t              hidden;
+
+    // is not displayed? the children will never be rendered
+    tb_uint8_t              display_none;
+
+}gb_svg_style_t, *gb_svg_style_ref_t;
+
+// the svg entry type, the retained shape
+typedef struct __gb_svg_entry_t
+{
+    // the path
+    gb_path_ref_t           path;
+
+    // the matrix
+    gb_matrix_t             matrix;
+
+    // the fill color
+    gb_color_t              fill;
+
+    // the stroke color
+    gb_color_t              stroke;
+
+    // the stroke width
+    gb_float_t              stroke_width;
+
+    // the paint mode
+    tb_uint8_t              mode;
+
+    // the stroke cap
+    tb_uint8_t              cap;
+
+    // the stroke join
+    tb_uint8_t              join;
+
+    // the fill rule
+    tb_uint8_t              rule;
+
+}gb_svg_entry_t, *gb_svg_entry_ref_t;
+
+// the svg impl type
+typedef struct __gb_svg_impl_t
+{
+    // the entries
+    tb_vector_ref_t         entries;
+
+    // the styles for parsing
+    tb_stack_ref_t          styles;
+
+    // the viewport bounds
+    gb_rect_t               bounds;
+
+    // have the viewport bounds?
+    tb_bool_t               has_bounds;
+
+}gb_svg_impl_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * private implementation
+ */
+static tb_void_t gb_svg_entry_free(tb_element_ref_t element, tb_pointer_t buff)
+{
+    // check
+    gb_svg_entry_ref_t entry = (gb_svg_entry_ref_t)buff;
+    tb_assert_and_check_return(entry);
+
+    // exit path
+    if (entry->path) gb_path_exit(entry->path);
+    entry->path = tb_null;
+}
+static tb_char_t const* gb_svg_skip_separator(tb_char_t const* p)
+{
+    // skip spaces and the comma
+    while (tb_isspace(*p)) p++;
+    if (*p == ',') p++;
+    while (tb_isspace(*p)) p++;
+
+    // ok
+    return p;
+}
+static tb_char_t const* gb_svg_parse_float(tb_char_t const* p, gb_float_t* value)
+{
+    // check
+    tb_assert(p && value);
+
+    // skip separator and scan it
+    return gb_float_scan(gb_svg_skip_separator(p), value);
+}
+static tb_char_t const* gb_svg_parse_floats(tb_char_t const* p, gb_float_t* values, tb_size_t count)
+{
+    // done
+    tb_size_t i = 0;
+    for (i = 0; i < count && p; i++) p = gb_svg_parse_float(p, &values[i]);
+
+    // ok?
+    return p;
+}
+static gb_float_t gb_svg_parse_length(tb_char_t const* data, gb_float_t defval)
+{
+    // the length, the unit will be ignored
+    gb_float_t value = defval;
+    return (data && gb_svg_parse_float(data, &value))? value : defval;
+}
+static tb_byte_t gb_svg_parse_opacity(tb_char_t const* data)
+{
+    // parse it
+    gb_float_t value = GB_ONE;
+    if (!gb_svg_parse_float(data, &value)) return 0xff;
+
+    // clamp it
+    if (value < 0) value = 0;
+    if (value > GB_ONE) value = GB_ONE;
+
+    // ok
+    return (tb_byte_t)gb_float_to_long(gb_imul(value, 0xff) + gb_half(GB_ONE));
+}
+static tb_size_t gb_svg_parse_hex(tb_char_t const* p, tb_size_t n, tb_uint32_t* value)
+{
+    // done
+    tb_size_t   i = 0;
+    tb_uint32_t v = 0;
+    for (i = 0; i < n && tb_isdigit16(p[i]); i++)
+    {
+        tb_char_t ch = p[i];
+        v = (v << 4) | (tb_isdigit10(ch)? (ch - '0') : ((ch | 0x20) - 'a' + 10));
+    }
+
+    // save value
+    *value = v;
+
+    // the digit count
+    return i;
+}
+static tb_bool_t gb_svg_parse_color(tb_char_t const* data, gb_color_ref_t color)
+{
+    // check
+    tb_assert(data && color);
+
+    // skip spaces
+    tb_char_t const* p = data;
+    while (tb_isspace(*p)) p++;
+
+    // #rgb or #rrggbb?
+    if (*p == '#')
+    {
+        // parse hex
+        tb_uint32_t value = 0;
+        tb_size_t   count = gb_svg_parse_hex(p + 1, 6, &value);
+        if (count == 6) *color = gb_color_make(0xff, (tb_byte_t)(value >> 16), (tb_byte_t)(value >> 8), (tb_byte_t)value);
+        else if (count == 3)
+        {
+            // expand it, e.g. #123 => #112233
+            tb_byte_t r = (tb_byte_t)((value >> 8) & 0xf);
+            tb_byte_t g = (tb_byte_t)((value >> 4) & 0xf);
+            tb_byte_t b = (tb_byte_t)(value & 0xf);
+            *color = gb_color_make(0xff, (r << 4) | r, (g << 4) | g, (b << 4) | b);
+        }
+        else return tb_false;
+    }
+    // rgb(r, g, b) or rgb(r%, g%, b%)?
+    else if (!tb_strnicmp(p, "rgb(", 4))
+    {
+        // parse components
+        tb_size_t   i = 0;
+        tb_byte_t   rgb[3];
+        p += 4;
+        for (i = 0; i < 3; i++)
+        {
+            // parse it
+            gb_float_t value = 0;
+            p = gb_svg_parse_float(p, &value);
+            tb_check_return_val(p, tb_false);
+
+            // percent?
+            if (*p == '%')
+            {
+                value = gb_idiv(gb_imul(value, 0xff), 100);
+                p++;
+            }
+
+            // clamp it
+            tb_long_t v = gb_float_to_long(value);
+            rgb[i] = (tb_byte_t)tb_max(0, tb_min(v, 0xff));
+        }
+
+        // make color
+        *color = gb_color_make(0xff, rgb[0], rgb[1], rgb[2]);
+    }
+    // the named color
+    else if (tb_isalpha(*p)) *color = gb_color_from_name(p);
+    else return tb_false;
+
+    // ok
+    return tb_true;
+}
+static tb_size_t gb_svg_parse_paint(tb_char_t const* data, gb_color_ref_t color)
+{
+    // check
+    tb_assert(data && color);
+
+    // skip spaces
+    while (tb_isspace(*data)) data++;
+
+    // none?
+    if (!tb_strnicmp(data, "none", 4) || !tb_strnicmp(data, "transparent", 11)) return GB_SVG_PAINT_TYPE_NONE;
+
+    // currentColor?
+    if (!tb_strnicmp(data, "currentColor", 12)) return GB_SVG_PAINT_TYPE_CURRENT;
+
+    /* the paint server, e.g. url(#gradient) [fallback]
+     *
+     * the gradient and pattern are not supported now, only use the fallback color
+     */
+    if (!tb_strnicmp(data, "url(", 4))
+    {
+        // seek to the fallback
+        data = tb_strchr(data, ')');
+        tb_check_return_val(data, GB_SVG_PAINT_TYPE_NONE);
+
+        // no fallback? tb_isspace() will evaluate the argument more than once
+        data++;
+        while (tb_isspace(*data)) data++;
+        tb_check_return_val(*data, GB_SVG_PAINT_TYPE_NONE);
+
+        // parse the fallback
+        return gb_svg_parse_paint(data, color);
+    }
+
+    // the color
+    return gb_svg_parse_color(data, color)? GB_SVG_PAINT_TYPE_COLOR : GB_SVG_PAINT_TYPE_NONE;
+}
+static tb_void_t gb_svg_parse_transform(tb_char_t const* data, gb_matrix_ref_t matrix)
+{
+    // check
+    tb_assert(data && matrix);
+
+    // done
+    tb_char_t const* p = data;
+    while (*p)
+    {
+        // skip spaces and separators
+        while (tb_isspace(*p) || *p == ',') p++;
+        tb_check_break(*p);
+
+        // the transform name
+        tb_char_t const* name = p;
+        while (tb_isalpha(*p)) p++;
+        tb_size_t size = p - name;
+
+        // seek to the arguments
+        while (tb_isspace(*p)) p++;
+        tb_check_break(*p == '(');
+        p++;
+
+        // parse arguments
+        tb_size_t   count = 0;
+        gb_float_t  values[6];
+        while (count < 6)
+        {
+            tb_char_t const* next = gb_svg_parse_float(p, &values[count]);
+            tb_check_break(next);
+            p = next;
+            count++;
+        }
+
+        // seek to the end
+        while (*p && *p != ')') p++;
+        if (*p) p++;
+
+        // done transform
+        if (size == 6 && !tb_strncmp(name, "matrix", 6) && count == 6)
+        {
+            // x' = a * x + c * y + e, y' = b * x + d * y + f
+            gb_matrix_t factor;
+            gb_matrix_init(&factor, values[0], values[2], values[1], values[3], values[4], values[5]);
+            gb_matrix_multiply(matrix, &factor);
+        }
+        else if (size == 9 && !tb_strncmp(name, "translate", 9) && count)
+            gb_matrix_translate(matrix, values[0], count > 1? values[1] : 0);
+        else if (size == 5 && !tb_strncmp(name, "scale", 5) && count)
+            gb_matrix_scale(matrix, values[0], count > 1? values[1] : values[0]);
+        else if (size == 6 && !tb_strncmp(name, "rotate", 6) && count)
+        {
+            if (count >= 3) gb_matrix_rotatep(matrix, values[0], values[1], values[2]);
+            else gb_matrix_rotate(matrix, values[0]);
+        }
+        else if (size == 5 && !tb_strncmp(name, "skewX", 5) && count)
+            gb_matrix_skew(matrix, gb_tan(gb_degree_to_radian(values[0])), 0);
+        else if (size == 5 && !tb_strncmp(name, "skewY", 5) && count)
+            gb_matrix_skew(matrix, 0, gb_tan(gb_degree_to_radian(values[0])));
+        else
+        {
+            // trace
+            tb_trace_d("unknown transform: %s", name);
+        }
+    }
+}
+static tb_void_t gb_svg_style_set(gb_svg_style_ref_t style, tb_char_t const* name, tb_size_t size, tb_char_t const* value)
+{
+    // check
+    tb_assert(style && name && value);
+
+    // done
+    switch (*name)
+    {
+    case 'f':
+        {
+            if (size == 4 && !tb_strncmp(name, "fill", 4))
+                style->fill_type = (tb_uint8_t)gb_svg_parse_paint(value, &style->fill);
+            else if (size == 9 && !tb_strncmp(name, "fill-rule", 9))
+                style->rule = !tb_strnicmp(value, "evenodd", 7)? GB_PAINT_FILL_RULE_ODD : GB_PAINT_FILL_RULE_NONZERO;
+            else if (size == 12 && !tb_strncmp(name, "fill-opacity", 12))
+                style->fill_opacity = gb_svg_parse_opacity(value);
+        }
+        break;
+    case 's':
+        {
+            if (size == 6 && !tb_strncmp(name, "stroke", 6))
+                style->stroke_type = (tb_uint8_t)gb_svg_parse_paint(value, &style->stroke);
+            else if (size == 12 && !tb_strncmp(name, "stroke-width", 12))
+                style->stroke_width = gb_abs(gb_svg_parse_length(value, GB_ONE));
+            else if (size == 14 && !tb_strncmp(name, "stroke-linecap", 14))
+            {
+                if (!tb_strnicmp(value, "round", 5)) style->cap = GB_PAINT_STROKE_CAP_ROUND;
+                else if (!tb_strnicmp(value, "square", 6)) style->cap = GB_PAINT_STROKE_CAP_SQUARE;
+                else style->cap = GB_PAINT_STROKE_CAP_BUTT;
+            }
+            else if (size == 15 && !tb_strncmp(name, "stroke-linejoin", 15))
+            {
+                if (!tb_strnicmp(value, "round", 5)) style->join = GB_PAINT_STROKE_JOIN_ROUND;
+                else if (!tb_strnicmp(value, "bevel", 5)) style->join = GB_PAINT_STROKE_JOIN_BEVEL;
+                else style->join = GB_PAINT_STROKE_JOIN_MITER;
+            }
+            else if (size == 14 && !tb_strncmp(name, "stroke-opacity", 14))
+                style->stroke_opacity = gb_svg_parse_opacity(value);
+        }
+        break;
+    case 'o':
+        {
+            // the group opacity will be multiplied to the children because the layer is not supported now
+            if (size == 7 && !tb_strncmp(name, "opacity", 7))
+                style->opacity = (tb_uint8_t)((style->opacity * gb_svg_parse_opacity(value) + 0x7f) / 0xff);
+        }
+        break;
+    case 'c':
+        {
+            if (size == 5 && !tb_strncmp(name, "color", 5)) gb_svg_parse_color(value, &style->color);
+        }
+        break;
+    case 'd':
+        {
+            if (size == 7 && !tb_strncmp(name, "display", 7) && !tb_strnicmp(value, "none", 4)) style->display_none = 1;
+        }
+        break;
+    case 'v':
+        {
+            if (size == 10 && !tb_strncmp(name, "visibility", 10))
+                style->hidden = (!tb_strnicmp(value, "hidden", 6) || !tb_strnicmp(value, "collapse", 8))? 1 : 0;
+        }
+        break;
+    default:
+        break;
+    }
+}
+static tb_void_t gb_svg_style_set_css(gb_svg_style_ref_t style, tb_char_t const* data)
+{
+    // check
+    tb_assert(style && data);
+
+    // done, e.g. "fill:#fff; stroke:none"
+    tb_char_t const*    p = data;
+    tb_char_t           value[256];
+    while (*p)
+    {
+        // skip spaces and separators
+        while (tb_isspace(*p) || *p == ';') p++;
+        tb_check_break(*p);
+
+        // the name
+        tb_char_t const* name = p;
+        while (*p && *p != ':' && *p != ';' && !tb_isspace(*p)) p++;
+        tb_size_t size = p - name;
+
+        // seek to the value
+        while (tb_isspace(*p)) p++;
+        if (*p != ':') continue;
+        p++;
+        while (tb_isspace(*p)) p++;
+
+        // copy the value
+        tb_size_t n = 0;
+        while (*p && *p != ';')
+        {
+            if (n < sizeof(value) - 1) value[n++] = *p;
+            p++;
+        }
+        value[n] = '\0';
+
+        // set style
+        if (size) gb_svg_style_set(style, name, size, value);
+    }
+}
+static tb_char_t const* gb_svg_attribute(tb_xml_node_ref_t attributes, tb_char_t const* name)
+{
+    // find it
+    tb_xml_node_ref_t attr = attributes;
+    for (; attr; attr = attr->next)
+    {
+        if (!tb_strcmp(tb_string_cstr(&attr->name), name)) return tb_string_cstr(&attr->data);
+    }
+
+    // no this attribute
+    return tb_null;
+}
+static gb_float_t gb_svg_attribute_length(tb_xml_node_ref_t attributes, tb_char_t const* name, gb_float_t defval)
+{
+    return gb_svg_parse_length(gb_svg_attribute(attributes, name), defval);
+}
+static tb_void_t gb_svg_style_init(gb_svg_style_ref_t style, gb_svg_style_ref_t parent, tb_xml_node_ref_t attributes)
+{
+    // check
+    tb_assert(style && parent);
+
+    // inherit the parent style
+    *style = *parent;
+
+    // the presentation attributes
+    tb_xml_node_ref_t   attr = attributes;
+    tb_char_t const*    css = tb_null;
+    for (; attr; attr = attr->next)
+    {
+        // the name and value
+        tb_char_t const* name = tb_string_cstr(&attr->name);
+        tb_char_t const* value = tb_string_cstr(&attr->data);
+        tb_check_continue(name && value);
+
+        // the style attribute will override the presentation attributes
+        if (!tb_strcmp(name, "style")) css = value;
+        else if (!tb_strcmp(name, "transform")) gb_svg_parse_transform(value, &style->matrix);
+        else gb_svg_style_set(style, name, tb_strlen(name), value);
+    }
+
+    // the style attribute
+    if (css) gb_svg_style_set_css(style, css);
+}
+static gb_path_ref_t gb_svg_make_shape(tb_char_t const* name, tb_xml_node_ref_t attributes, tb_bool_t* fillable)
+{
+    // check
+    tb_assert(name && fillable);
+
+    // the path data? make path from it directly
+    *fillable = tb_true;
+    if (!tb_strcmp(name, "path"))
+    {
+        tb_char_t const* data = gb_svg_attribute(attributes, "d");
+        return data? gb_path_init_from_svg_data(data) : tb_null;
+    }
+
+    // init path
+    gb_path_ref_t path = gb_path_init();
+    tb_assert_and_check_return_val(path, tb_null);
+
+    // done
+    tb_bool_t ok = tb_false;
+    if (!tb_strcmp(name, "rect"))
+    {
+        // the bounds
+        gb_rect_t bounds;
+        bounds.x = gb_svg_attribute_length(attributes, "x", 0);
+        bounds.y = gb_svg_attribute_length(attributes, "y", 0);
+        bounds.w = gb_svg_attribute_length(attributes, "width", 0);
+        bounds.h = gb_svg_attribute_length(attributes, "height", 0);
+        if (bounds.w > 0 && bounds.h > 0)
+        {
+            // the radius, uses the other one if only one is specified
+            gb_float_t rx = gb_abs(gb_svg_attribute_length(attributes, "rx", -GB_ONE));
+            gb_float_t ry = gb_abs(gb_svg_attribute_length(attributes, "ry", -GB_ONE));
+            if (!gb_svg_attribute(attributes, "rx")) rx = gb_svg_attribute(attributes, "ry")? ry : 0;
+            if (!gb_svg_attribute(attributes, "ry")) ry = rx;
+            rx = tb_min(rx, gb_half(bounds.w));
+            ry = tb_min(ry, gb_half(bounds.h));
+
+            // add rect
+            if (rx > 0 && ry > 0) gb_path_add_round_rect2(path, &bounds, rx, ry, GB_ROTATE_DIRECTION_CW);
+            else gb_path_add_rect(path, &bounds, GB_ROTATE_DIRECTION_CW);
+            ok = tb_true;
+        }
+    }
+    else if (!tb_strcmp(name, "circle"))
+    {
+        // add circle
+        gb_float_t r = gb_svg_attribute_length(attributes, "r", 0);
+        if (r > 0)
+        {
+            gb_path_add_circle2(path, gb_svg_attribute_length(attributes, "cx", 0), gb_svg_attribute_length(attributes, "cy", 0), r, GB_ROTATE_DIRECTION_CW);
+            ok = tb_true;
+        }
+    }
+    else if (!tb_strcmp(name, "ellipse"))
+    {
+        // add ellipse
+        gb_float_t rx = gb_svg_attribute_length(attributes, "rx", 0);
+        gb_float_t ry = gb_svg_attribute_length(attributes, "ry", 0);
+        if (rx > 0 && ry > 0)
+        {
+            gb_path_add_ellipse2(path, gb_svg_attribute_length(attributes, "cx", 0), gb_svg_attribute_length(attributes, "cy", 0), rx, ry, GB_ROTATE_DIRECTION_CW);
+            ok = tb_true;
+        }
+    }
+    else if (!tb_strcmp(name, "line"))
+    {
+        // add line
+        gb_path_add_line2(path   ,   gb_svg_attribute_length(attributes, "x1", 0)
+                                ,   gb_svg_attribute_length(attributes, "y1", 0)
+                                ,   gb_svg_attribute_length(attributes, "x2", 0)
+                                ,   gb_svg_attribute_length(attributes, "y2", 0));
+
+        // the line cannot be filled
+        *fillable = tb_false;
+        ok = tb_true;
+    }
+    else if (!tb_strcmp(name, "polyline") || !tb_strcmp(name, "polygon"))
+    {
+        // the points
+        tb_char_t const* data = gb_svg_attribute(attributes, "points");
+        if (data)
+        {
+            // add points
+            tb_size_t           count = 0;
+            gb_float_t          values[2];
+            tb_char_t const*    p = data;
+            while ((p = gb_svg_parse_floats(p, values, 2)))
+            {
+                if (!count++) gb_path_move2_to(path, values[0], values[1]);
+                else gb_path_line2_to(path, values[0], values[1]);
+            }
+
+            // close it if be polygon
+            if (count > 1 && !tb_strcmp(name, "polygon")) gb_path_clos(path);
+            ok = count > 1;
+        }
+    }
+
+    // failed? exit path
+    if (!ok)
+    {
+        gb_path_exit(path);
+        path = tb_null;
+    }
+
+    // ok?
+    return path;
+}
+static tb_void_t gb_svg_done_shape(gb_svg_impl_t* impl, gb_svg_style_ref_t style, tb_char_t const* name, tb_xml_node_ref_t attributes)
+{
+    // check
+    tb_assert(impl && impl->entries && style && name);
+
+    // hidden?
+    tb_check_return(!style->hidden && !style->display_none);
+
+    // init entry
+    gb_svg_entry_t entry;
+    tb_memset(&entry, 0, sizeof(gb_svg_entry_t));
+
+    // done
+    tb_bool_t ok = tb_false;
+    do
+    {
+        // make shape
+        tb_bool_t fillable = tb_true;
+        entry.path = gb_svg_make_shape(name, attributes, &fillable);
+        tb_check_break(entry.path);
+
+        // the fill paint
+        if (fillable && style->fill_type != GB_SVG_PAINT_TYPE_NONE)
+        {
+            entry.fill = style->fill_type == GB_SVG_PAINT_TYPE_CURRENT? style->color : style->fill;
+            entry.fill.a = (tb_byte_t)((((entry.fill.a * style->fill_opacity + 0x7f) / 0xff) * style->opacity + 0x7f) / 0xff);
+            if (entry.fill.a) entry.mode |= GB_PAINT_MODE_FILL;
+        }
+
+        // the stroke paint
+        if (style->stroke_type != GB_SVG_PAINT_TYPE_NONE && style->stroke_width > 0)
+        {
+            entry.stroke = style->stroke_type == GB_SVG_PAINT_TYPE_CURRENT? style->color : style->stroke;
+            entry.stroke.a = (tb_byte_t)((((entry.stroke.a * style->stroke_opacity + 0x7f) / 0xff) * style->opacity + 0x7f) / 0xff);
+            if (entry.stroke.a) entry.mode |= GB_PAINT_MODE_STROKE;
+        }
+
+        // invisible?
+        tb_check_break(entry.mode);
+
+        // init the other paint info
+        entry.matrix        = style->matrix;
+        entry.stroke_width  = style->stroke_width;
+        entry.cap           = style->cap;
+        entry.join          = style->join;
+        entry.rule          = style->rule;
+
+        // save entry, the path will be owned by the entries
+        tb_vector_insert_tail(impl->entries, &entry);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // failed? exit path
+    if (!ok && entry.path) gb_path_exit(entry.path);
+}
+static tb_void_t gb_svg_done_root(gb_svg_impl_t* impl, gb_svg_style_ref_t style, tb_xml_node_ref_t attributes)
+{
+    // check
+    tb_assert(impl && style);
+
+    // the viewBox
+    tb_char_t const* viewbox = gb_svg_attribute(attributes, "viewBox");
+    if (viewbox)
+    {
+        gb_float_t values[4];
+        if (gb_svg_parse_floats(viewbox, values, 4) && values[2] > 0 && values[3] > 0)
+        {
+            gb_rect_make(&impl->bounds, values[0], values[1], values[2], values[3]);
+            impl->has_bounds = tb_true;
+        }
+    }
+
+    // the width and height, the percent size will be ignored
+    if (!impl->has_bounds)
+    {
+        tb_char_t const* width = gb_svg_attribute(attributes, "width");
+        tb_char_t const* height = gb_svg_attribute(attributes, "height");
+        if (width && height && !tb_strchr(width, '%') && !tb_strchr(height, '%'))
+        {
+            gb_float_t w = gb_svg_parse_length(width, 0);
+            gb_float_t h = gb_svg_parse_length(height, 0);
+            if (w > 0 && h > 0)
+            {
+                gb_rect_make(&impl->bounds, 0, 0, w, h);
+                impl->has_bounds = tb_true;
+            }
+        }
+    }
+}
+static tb_void_t gb_svg_done_element(gb_svg_impl_t* impl, gb_svg_style_ref_t style, tb_char_t const* name, tb_xml_node_ref_t attributes, tb_size_t level)
+{
+    // check
+    tb_assert(impl && style && name);
+
+    // skip the namespace prefix, e.g. svg:path
+    tb_char_t const* p = tb_strchr(name, ':');
+    if (p) name = p + 1;
+
+    // done
+    if (!tb_strcmp(name, "svg"))
+    {
+        // the root element?
+        if (level <= 1 && !impl->has_bounds) gb_svg_done_root(impl, style, attributes);
+        // the nested element
+        else gb_matrix_translate(&style->matrix, gb_svg_attribute_length(attributes, "x", 0), gb_svg_attribute_length(attributes, "y", 0));
+    }
+    // the container elements and the non-rendering elements will be hidden
+    else if (   !tb_strcmp(name, "defs")
+            ||  !tb_strcmp(name, "symbol")
+            ||  !tb_strcmp(name, "clipPath")
+            ||  !tb_strcmp(name, "mask")
+            ||  !tb_strcmp(name, "pattern")
+            ||  !tb_strcmp(name, "marker")
+            ||  !tb_strcmp(name, "linearGradient")
+            ||  !tb_strcmp(name, "radialGradient")
+            ||  !tb_strcmp(name, "metadata")
+            ||  !tb_strcmp(name, "title")
+            ||  !tb_strcmp(name, "desc")
+            ||  !tb_strcmp(name, "style")
+            ||  !tb_strcmp(name, "text"))
+    {
+        style->display_none = 1;
+    }
+    // the group element? only update the style
+    else if (!tb_strcmp(name, "g") || !tb_strcmp(name, "a")) ;
+    // the shape element
+    else gb_svg_done_shape(impl, style, name, attributes);
+}
+static tb_bool_t gb_svg_done(gb_svg_impl_t* impl, tb_stream_ref_t stream)
+{
+    // check
+    tb_assert(impl && impl->styles && stream);
+
+    // init the root style
+    gb_svg_style_t root;
+    tb_memset(&root, 0, sizeof(gb_svg_style_t));
+    gb_matrix_clear(&root.matrix);
+    root.fill           = GB_COLOR_BLACK;
+    root.color          = GB_COLOR_BLACK;
+    root.fill_type      = GB_SVG_PAINT_TYPE_COLOR;
+    root.stroke_type    = GB_SVG_PAINT_TYPE_NONE;
+    root.stroke_width   = GB_ONE;
+    root.cap            = GB_PAINT_STROKE_CAP_BUTT;
+    root.join           = GB_PAINT_STROKE_JOIN_MITER;
+    root.rule           = GB_PAINT_FILL_RULE_NONZERO;
+    root.opacity        = 0xff;
+    root.fill_opacity   = 0xff;
+    root.stroke_opacity = 0xff;
+    tb_stack_put(impl->styles, &root);
+
+    // init reader
+    tb_xml_reader_ref_t reader = tb_xml_reader_init();
+    tb_assert_and_check_return_val(reader, tb_false);
+
+    // done
+    tb_bool_t ok = tb_false;
+    if (tb_xml_reader_open(reader, stream, tb_false))
+    {
+        // walk events
+        gb_svg_style_t  style;
+        tb_size_t       event = TB_XML_READER_EVENT_NONE;
+        while ((event = tb_xml_reader_next(reader)))
+        {
+            switch (event)
+            {
+            case TB_XML_READER_EVENT_ELEMENT_BEG:
+            case TB_XML_READER_EVENT_ELEMENT_EMPTY:
+                {
+                    // the element name and attributes
+                    tb_char_t const*    name = tb_xml_reader_element(reader);
+                    tb_xml_node_ref_t   attributes = tb_xml_reader_attributes(reader);
+
+                    // the parent style
+                    gb_svg_style_ref_t parent = (gb_svg_style_ref_t)tb_stack_top(impl->styles);
+                    tb_assert_and_check_break(parent);
+
+                    // no name? skip it but save the parent style, so its end element will pop the matched style
+                    if (!name)
+                    {
+                        style = *parent;
+                        if (event == TB_XML_READER_EVENT_ELEMENT_BEG) tb_stack_put(impl->styles, &style);
+                        break;
+                    }
+
+                    // init style
+                    gb_svg_style_init(&style, parent, attributes);
+
+                    // done element
+                    gb_svg_done_element(impl, &style, name, attributes, tb_xml_reader_level(reader));
+
+                    // save style for the children
+                    if (event == TB_XML_READER_EVENT_ELEMENT_BEG) tb_stack_put(impl->styles, &style);
+
+                    // ok
+                    ok = tb_true;
+                }
+                break;
+            case TB_XML_READER_EVENT_ELEMENT_END:
+                {
+                    // restore style, keep the root style
+                    if (tb_stack_size(impl->styles) > 1) tb_stack_pop(impl->styles);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    // exit reader
+    tb_xml_reader_exit(reader);
+
+    // clear styles
+    tb_stack_clear(impl->styles);
+
+    // ok?
+    return ok;
+}
+static tb_void_t gb_svg_make_bounds(gb_svg_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->entries);
+
+    // make the bounds from all shapes
+    tb_bool_t   first = tb_true;
+    gb_float_t  x0 = 0;
+    gb_float_t  y0 = 0;
+    gb_float_t  x1 = 0;
+    gb_float_t  y1 = 0;
+    tb_for_all_if (gb_svg_entry_ref_t, entry, impl->entries, entry)
+    {
+        // the path bounds
+        gb_rect_ref_t bounds = gb_path_bounds(entry->path);
+        tb_check_continue(bounds);
+
+        // apply matrix to the corners
+        gb_point_t points[4];
+        gb_point_make(&points[0], bounds->x, bounds->y);
+        gb_point_make(&points[1], bounds->x + bounds->w, bounds->y);
+        gb_point_make(&points[2], bounds->x + bounds->w, bounds->y + bounds->h);
+        gb_point_make(&points[3], bounds->x, bounds->y + bounds->h);
+        gb_matrix_apply_points(&entry->matrix, points, 4);
+
+        // merge them
+        tb_size_t i = 0;
+        for (i = 0; i < 4; i++)
+        {
+            if (first)
+            {
+                x0 = x1 = points[i].x;
+                y0 = y1 = points[i].y;
+                first = tb_false;
+            }
+            if (points[i].x < x0) x0 = points[i].x;
+            if (points[i].y < y0) y0 = points[i].y;
+            if (points[i].x > x1) x1 = points[i].x;
+            if (points[i].y > y1) y1 = points[i].y;
+        }
+    }
+
+    // save bounds
+    gb_rect_make(&impl->bounds, x0, y0, x1 - x0, y1 - y0);
+}
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+gb_svg_ref_t gb_svg_init_from_url(tb_char_t const* url)
+{
+    // check
+    tb_assert_and_check_return_val(url, tb_null);
+
+    // init stream
+    tb_stream_ref_t stream = tb_stream_init_from_url(url);
+    tb_assert_and_check_return_val(stream, tb_null);
+
+    // init svg from stream
+    gb_svg_ref_t svg = tb_null;
+    if (tb_stream_open(stream)) svg = gb_svg_init_from_stream(stream);
+
+    // exit stream
+    tb_stream_exit(stream);
+
+    // ok?
+    return svg;
+}
+gb_svg_ref_t gb_svg_init_from_stream(tb_stream_ref_t stream)
+{
+    // check
+    tb_assert_and_check_return_val(stream, tb_null);
+
+    // done
+    tb_bool_t       ok = tb_false;
+    gb_svg_impl_t*  impl = tb_null;
+    do
+    {
+        // make svg
+        impl = tb_malloc0_type(gb_svg_impl_t);
+        tb_assert_and_check_break(impl);
+
+        // init entries
+        impl->entries = tb_vector_init(GB_SVG_ENTRIES_GROW, tb_element_mem(sizeof(gb_svg_entry_t), gb_svg_entry_free, tb_null));
+        tb_assert_and_check_break(impl->entries);
+
+        // init styles
+        impl->styles = tb_stack_init(GB_SVG_STYLES_GROW, tb_element_mem(sizeof(gb_svg_style_t), tb_null, tb_null));
+        tb_assert_and_check_break(impl->styles);
+
+        // parse it
+        if (!gb_svg_done(impl, stream)) break;
+
+        // no viewport? make it from all shapes
+        if (!impl->has_bounds) gb_svg_make_bounds(impl);
+
+        // trace
+        tb_trace_d("load: %lu shapes, bounds: %{rect}", tb_vector_size(impl->entries), &impl->bounds);
+
+        // ok
+        ok = tb_true;
+
+    } while (0);
+
+    // exit styles, only used for parsing
+    if (impl && impl->styles) tb_stack_exit(impl->styles);
+    if (impl) impl->styles = tb_null;
+
+    // failed?
+    if (!ok)
+    {
+        // exit it
+        if (impl) gb_svg_exit((gb_svg_ref_t)impl);
+        impl = tb_null;
+    }
+
+    // ok?
+    return (gb_svg_ref_t)impl;
+}
+tb_void_t gb_svg_exit(gb_svg_ref_t svg)
+{
+    // check
+    gb_svg_impl_t* impl = (gb_svg_impl_t*)svg;
+    tb_assert_and_check_return(impl);
+
+    // exit entries
+    if (impl->entries) tb_vector_exit(impl->entries);
+    impl->entries = tb_null;
+
+    // exit styles
+    if (impl->styles) tb_stack_exit(impl->styles);
+    impl->styles = tb_null;
+
+    // exit it
+    tb_free(impl);
+}
+gb_rect_ref_t gb_svg_bounds(gb_svg_ref_t svg)
+{
+    // check
+    gb_svg_impl_t* impl = (gb_svg_impl_t*)svg;
+    tb_assert_and_check_return_val(impl, tb_null);
+
+    // the bounds
+    return &impl->bounds;
+}
+tb_size_t gb_svg_size(gb_svg_ref_t svg)
+{
+    // check
+    gb_svg_impl_t* impl = (gb_svg_impl_t*)svg;
+    tb_assert_and_check_return_val(impl && impl->entries, 0);
+
+    // the size
+    return tb_vector_size(impl->entries);
+}
+tb_void_t gb_svg_draw(gb_svg_ref_t svg, gb_canvas_ref_t canvas)
+{
+    // check
+    gb_svg_impl_t* impl = (gb_svg_impl_t*)svg;
+    tb_assert_and_check_return(impl && impl->entries && canvas);
+
+    // save paint and matrix
+    if (!gb_canvas_save_paint(canvas)) return ;
+    gb_matrix_ref_t matrix = gb_canvas_save_matrix(canvas);
+    if (!matrix)
+    {
+        // load the saved paint for keeping the paint stack balanced
+        gb_canvas_load_paint(canvas);
+        return ;
+    }
+
+    // the base matrix
+    gb_matrix_t base = *matrix;
+
+    // draw all shapes
+    tb_for_all_if (gb_svg_entry_ref_t, entry, impl->entries, entry)
+    {
+        // apply matrix
+        *matrix = base;
+        gb_canvas_multiply(canvas, &entry->matrix);
+
+        // fill it
+        if (entry->mode & GB_PAINT_MODE_FILL)
+        {
+            gb_canvas_mode_set(canvas, GB_PAINT_MODE_FILL);
+            gb_canvas_color_set(canvas, entry->fill);
+            gb_canvas_fill_rule_set(canvas, entry->rule);
+            gb_canvas_draw_path(canvas, entry->path);
+        }
+
+        // stroke it
+        if (entry->mode & GB_PAINT_MODE_STROKE)
+        {
+            gb_canvas_mode_set(canvas, GB_PAINT_MODE_STROKE);
+            gb_canvas_color_set(canvas, entry->stroke);
+            gb_canvas_stroke_width_set(canvas, entry->stroke_width);
+            gb_canvas_stroke_cap_set(canvas, entry->cap);
+            gb_canvas_stroke_join_set(canvas, entry->join);
+            gb_canvas_draw_path(canvas, entry->path);
+        }
+    }
+
+    // load matrix and paint
+    gb_canvas_load_matrix(canvas);
+    gb_canvas_load_paint(canvas);
+}
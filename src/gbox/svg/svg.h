@@ -17,7 +17,7 @@
  * Copyright (C) 2014 - 2015, ruki All rights reserved.
  *
  * @author      ruki
- * @file        prefix.h
+ * @file        svg.h
  * @defgroup    svg
  */
 #ifndef GB_SVG_H
@@ -28,6 +28,81 @@
  */
 #include "prefix.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/*! the svg ref type
+ *
+ * the svg document is parsed only once by the streaming xml reader and all shapes 
+ * are converted to the retained paths with the flattened paint and matrix,
+ * so it can be drawn repeatedly without parsing it again.
+ */
+typedef struct{}*       gb_svg_ref_t;
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/*! init svg from the given url
+ *
+ * @param url           the url
+ *
+ * @return              the svg
+ */
+gb_svg_ref_t            gb_svg_init_from_url(tb_char_t const* url);
+
+/*! init svg from the given stream
+ *
+ * @param stream        the stream, must be opened
+ *
+ * @return              the svg
+ */
+gb_svg_ref_t            gb_svg_init_from_stream(tb_stream_ref_t stream);
+
+/*! exit svg
+ *
+ * @param svg           the svg
+ */
+tb_void_t               gb_svg_exit(gb_svg_ref_t svg);
+
+/*! the svg viewport 
+ *
+ * from the viewBox or the width and height attributes of the root element
+ *
+ * @param svg           the svg
+ *
+ * @return              the viewport bounds
+ */
+gb_rect_ref_t           gb_svg_bounds(gb_svg_ref_t svg);
+
+/*! the retained shape count
+ *
+ * @param svg           the svg
+ *
+ * @return              the shape count
+ */
+tb_size_t               gb_svg_size(gb_svg_ref_t svg);
+
+/*! draw svg to the canvas
+ *
+ * the canvas matrix and paint will be restored after drawing
+ *
+ * @param svg           the svg
+ * @param canvas        the canvas
+ */
+tb_void_t               gb_svg_draw(gb_svg_ref_t svg, gb_canvas_ref_t canvas);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
 #endif
 
 
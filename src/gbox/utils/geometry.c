@@ -32,9 +32,98 @@
  */
 #include "geometry.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+#ifndef GB_CONFIG_FLOAT_FIXED
+// the machine epsilon of the double: 2^-53
+#   define GB_GEOMETRY_EPSILON                  (1.1102230246251565e-16)
+
+/* the relative error bound of the filtered orientation
+ *
+ * see Shewchuk: Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates
+ */
+#   define GB_GEOMETRY_ORIENTATION_ERRBOUND     ((3.0 + 16.0 * GB_GEOMETRY_EPSILON) * GB_GEOMETRY_EPSILON)
+#endif
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
+#ifdef GB_CONFIG_FLOAT_FIXED
+static tb_long_t gb_points_orientation_exact(tb_hong_t dx1, tb_hong_t dy1, tb_hong_t dx2, tb_hong_t dy2)
+{
+    /* the products may overflow tb_hong_t if the coordinates are very far away,
+     * so we compare the signs first and then compare the unsigned products
+     *
+     * orientation = sign(dx1 * dy2 - dy1 * dx2)
+     */
+    tb_long_t sl = (dx1 > 0? 1 : (dx1 < 0? -1 : 0)) * (dy2 > 0? 1 : (dy2 < 0? -1 : 0));
+    tb_long_t sr = (dy1 > 0? 1 : (dy1 < 0? -1 : 0)) * (dx2 > 0? 1 : (dx2 < 0? -1 : 0));
+    if (sl != sr) return sl > sr? 1 : -1;
+    tb_check_return_val(sl, 0);
+
+    // compare the absolute products
+    tb_hize_t left  = (tb_hize_t)tb_abs(dx1) * (tb_hize_t)tb_abs(dy2);
+    tb_hize_t right = (tb_hize_t)tb_abs(dy1) * (tb_hize_t)tb_abs(dx2);
+    if (left == right) return 0;
+    return ((left > right) == (sl > 0))? 1 : -1;
+}
+#else
+static __tb_inline__ tb_void_t gb_geometry_two_sum(tb_double_t a, tb_double_t b, tb_double_t* x, tb_double_t* y)
+{
+    // x + y == a + b exactly, the volatile avoids the extended precision of x87
+    tb_double_t volatile sum = a + b;
+    tb_double_t volatile bv = sum - a;
+    tb_double_t volatile av = sum - bv;
+    *x = sum;
+    *y = (a - av) + (b - bv);
+}
+static tb_long_t gb_points_orientation_exact(gb_point_ref_t a, gb_point_ref_t b, gb_point_ref_t c)
+{
+    // the products of two floats are exact in double: 24 + 24 bits <= 53 bits
+    tb_assert_static(sizeof(gb_float_t) == sizeof(tb_float_t));
+
+    /* orientation = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)
+     *             = a.x * b.y - a.y * b.x + b.x * c.y - b.y * c.x + c.x * a.y - c.y * a.x
+     */
+    tb_double_t const terms[6] = 
+    {
+        (tb_double_t)a->x * b->y
+    ,   -(tb_double_t)a->y * b->x
+    ,   (tb_double_t)b->x * c->y
+    ,   -(tb_double_t)b->y * c->x
+    ,   (tb_double_t)c->x * a->y
+    ,   -(tb_double_t)c->y * a->x
+    };
+
+    /* sum them to the nonoverlapping expansion with the increasing magnitude
+     *
+     * the sign of the expansion is the sign of its largest component
+     */
+    tb_size_t   i = 0;
+    tb_size_t   j = 0;
+    tb_size_t   n = 0;
+    tb_double_t expansion[6];
+    for (i = 0; i < 6; i++)
+    {
+        // grow the expansion with this term and eliminate the zero components
+        tb_double_t q = terms[i];
+        tb_size_t   m = 0;
+        for (j = 0; j < n; j++)
+        {
+            tb_double_t h;
+            gb_geometry_two_sum(q, expansion[j], &q, &h);
+            if (h != 0) expansion[m++] = h;
+        }
+        if (q != 0 || !m) expansion[m++] = q;
+        n = m;
+    }
+
+    // the sign of the largest component
+    return expansion[n - 1] > 0? 1 : (expansion[n - 1] < 0? -1 : 0);
+}
+#endif
 static gb_double_t gb_point_to_segment_distance_h_cheap(gb_point_ref_t center, gb_point_ref_t upper, gb_point_ref_t lower)
 {
     // check
@@ -432,27 +521,69 @@ static tb_bool_t gb_segment_near_parallel(gb_point_ref_t org1, gb_point_ref_t ds
 /* //////////////////////////////////////////////////////////////////////////////////////
  * implementation
  */
+tb_long_t gb_points_orientation(gb_point_ref_t p0, gb_point_ref_t p1, gb_point_ref_t p2)
+{
+    // check
+    tb_assert(p0 && p1 && p2);
+
+#ifdef GB_CONFIG_FLOAT_FIXED
+    // the deltas, not overflow for tb_hong_t
+    tb_hong_t dx1 = (tb_hong_t)p1->x - p0->x;
+    tb_hong_t dy1 = (tb_hong_t)p1->y - p0->y;
+    tb_hong_t dx2 = (tb_hong_t)p2->x - p0->x;
+    tb_hong_t dy2 = (tb_hong_t)p2->y - p0->y;
+
+    // the products will not overflow? compute it directly
+    if (    tb_abs(dx1) < 0x80000000LL && tb_abs(dy1) < 0x80000000LL
+        &&  tb_abs(dx2) < 0x80000000LL && tb_abs(dy2) < 0x80000000LL)
+    {
+        tb_hong_t det = dx1 * dy2 - dy1 * dx2;
+        return det > 0? 1 : (det < 0? -1 : 0);
+    }
+
+    // compute it exactly
+    return gb_points_orientation_exact(dx1, dy1, dx2, dy2);
+#else
+    /* compute the determinant quickly
+     *
+     * det = (p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x)
+     */
+    tb_double_t detl = ((tb_double_t)p1->x - p0->x) * ((tb_double_t)p2->y - p0->y);
+    tb_double_t detr = ((tb_double_t)p1->y - p0->y) * ((tb_double_t)p2->x - p0->x);
+    tb_double_t det = detl - detr;
+
+    // the sum of the absolute products, the result is exact if the signs are different
+    tb_double_t sum = 0;
+    if (detl > 0)
+    {
+        if (detr <= 0) return det > 0? 1 : (det < 0? -1 : 0);
+        sum = detl + detr;
+    }
+    else if (detl < 0)
+    {
+        if (detr >= 0) return det > 0? 1 : (det < 0? -1 : 0);
+        sum = -detl - detr;
+    }
+    else return detr < 0? 1 : (detr > 0? -1 : 0);
+
+    // the result is reliable if the determinant is out of the error bound
+    tb_double_t bound = GB_GEOMETRY_ORIENTATION_ERRBOUND * sum;
+    if (det >= bound || -det >= bound) return det > 0? 1 : -1;
+
+    // compute it exactly for the almost-degenerate situations
+    return gb_points_orientation_exact(p0, p1, p2);
+#endif
+}
 tb_long_t gb_points_is_ccw(gb_point_ref_t p0, gb_point_ref_t p1, gb_point_ref_t p2)
 {
     // check
     tb_assert(p0 && p1 && p2);
 
-    // the coordinates
-    tb_fixed_t x0 = gb_float_to_fixed(p0->x);
-    tb_fixed_t y0 = gb_float_to_fixed(p0->y);
-    tb_fixed_t x1 = gb_float_to_fixed(p1->x);
-    tb_fixed_t y1 = gb_float_to_fixed(p1->y);
-    tb_fixed_t x2 = gb_float_to_fixed(p2->x);
-    tb_fixed_t y2 = gb_float_to_fixed(p2->y);
-  
-    /* compute the cross value of the vectors (p1, p0) and (p1, p2)
+    /* the cross value of the vectors (p1, p0) and (p1, p2)
      *
      * cross[(p1, p0), (p1, p2)] > 0
-     *
-     *
-     * the result is not reliable for almost-degenerate situations
      */
-    return ((tb_hong_t)(x0 - x1) * (y2 - y1) - (tb_hong_t)(y0 - y1) * (x2 - x1)) > 0;
+    return gb_points_orientation(p1, p0, p2) > 0;
 }
 gb_float_t gb_point_to_segment_distance_h(gb_point_ref_t center, gb_point_ref_t upper, gb_point_ref_t lower)
 {
@@ -637,22 +768,33 @@ tb_long_t gb_point_to_segment_position_h(gb_point_ref_t center, gb_point_ref_t u
     // check
     tb_assert(center && upper && lower);
 
-    // compute the cheap distance quickly
-    gb_double_t distance = gb_point_to_segment_distance_h_cheap(center, upper, lower);
+    // must be upper <= center <= lower
+    tb_assertf_abort(gb_point_in_top_or_horizontal(upper, center), "%{point} <=? %{point}", upper, center);
+    tb_assertf_abort(gb_point_in_top_or_horizontal(center, lower), "%{point} <=? %{point}", center, lower);
 
-    // get the sign of the distance
-    return distance < 0? -1 : distance > 0;
+    /* get the sign of the distance
+     *
+     * distance * (yu + yl) = (center.x - lower.x) * yu + (center.x - upper.x) * yl
+     *                      = (center.x - upper.x) * (lower.y - upper.y) - (center.y - upper.y) * (lower.x - upper.x)
+     *                      = orientation(upper, center, lower)
+     */
+    return gb_points_orientation(upper, center, lower);
 }
 tb_long_t gb_point_to_segment_position_v(gb_point_ref_t center, gb_point_ref_t left, gb_point_ref_t right)
 {
     // check
     tb_assert(center && left && right);
 
-    // compute the cheap distance quickly
-    gb_double_t distance = gb_point_to_segment_distance_v_cheap(center, left, right);
+    // must be left <= center <= right
+    tb_assertf_abort(gb_point_in_left_or_vertical(left, center), "%{point} <=? %{point}", left, center);
+    tb_assertf_abort(gb_point_in_left_or_vertical(center, right), "%{point} <=? %{point}", center, right);
 
-    // get the sign of the distance
-    return distance < 0? -1 : distance > 0;
+    /* get the sign of the distance
+     *
+     * distance * (xl + xr) = (center.y - right.y) * xl + (center.y - left.y) * xr
+     *                      = orientation(left, right, center)
+     */
+    return gb_points_orientation(left, right, center);
 }
 tb_long_t gb_segment_intersection(gb_point_ref_t org1, gb_point_ref_t dst1, gb_point_ref_t org2, gb_point_ref_t dst2, gb_point_ref_t result)
 {
@@ -181,6 +181,21 @@ __tb_extern_c_enter__
  * interfaces
  */
 
+/*! compute the orientation of the three points
+ *
+ * the result is exact even if the points are almost collinear,
+ * it only computes the exact arithmetic for the rare almost-degenerate situations
+ *
+ * orientation = sign((p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x))
+ *
+ * @param p0            the first point
+ * @param p1            the second point
+ * @param p2            the last point
+ *
+ * @return              the orientation: > 0, < 0 or collinear: 0
+ */
+tb_long_t               gb_points_orientation(gb_point_ref_t p0, gb_point_ref_t p1, gb_point_ref_t p2);
+
 /*! the three points are counter-clockwise?
  *
  *                   p1
@@ -251,7 +266,7 @@ gb_float_t              gb_point_to_segment_distance_v(gb_point_ref_t center, gb
 
 /*! compute the point-to-segment horizontal position
  *
- * only evaluate the sign of the distance, faster than distance()
+ * only evaluate the sign of the distance exactly, faster than distance()
  *
  *     upper            upper'
  *       .               .
@@ -275,7 +290,7 @@ tb_long_t               gb_point_to_segment_position_h(gb_point_ref_t center, gb
 
 /*! compute the point-to-segment vertical position
  *
- * only evaluate the sign of the distance, faster than distance()
+ * only evaluate the sign of the distance exactly, faster than distance()
  *
  *                             . right
  *                        .
@@ -66,6 +66,18 @@ typedef struct __gb_mesh_edge_list_impl_t
     // the pool
     tb_fixed_pool_ref_t             pool;
 
+    /* the recycled edges for the next making, linked by edge->next
+     *
+     * the cleared edges are moved to here at once and reused without returning to the pool
+     */
+    gb_mesh_edge_ref_t              cache;
+
+    // the edges count
+    tb_size_t                       size;
+
+    // the element need not free the user data?
+    tb_bool_t                       trivial;
+
     // the head edge
     gb_mesh_edge_t                  head[2];
 
@@ -88,20 +100,39 @@ typedef struct __gb_mesh_edge_list_impl_t
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
-static tb_void_t gb_mesh_edge_exit(tb_pointer_t data, tb_cpointer_t priv)
+static __tb_inline__ tb_void_t gb_mesh_edge_exit(gb_mesh_edge_list_impl_t* impl, gb_mesh_edge_ref_t edge)
 {
     // check
-    gb_mesh_edge_list_impl_t* impl = (gb_mesh_edge_list_impl_t*)priv;
-    tb_assert_and_check_return(impl && data);
+    tb_assert(impl && edge);
 
     // exit the user data
-    impl->element.free(&impl->element, (tb_pointer_t)((gb_mesh_edge_ref_t)data + 1));
-    impl->element.free(&impl->element, (tb_pointer_t)((gb_mesh_edge_ref_t)((tb_byte_t*)data + impl->edge_size) + 1));
+    if (!impl->trivial)
+    {
+        impl->element.free(&impl->element, (tb_pointer_t)gb_mesh_edge_user(edge));
+        impl->element.free(&impl->element, (tb_pointer_t)gb_mesh_edge_user(edge->sym));
+    }
 }
+static __tb_inline__ gb_mesh_edge_ref_t gb_mesh_edge_malloc0(gb_mesh_edge_list_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->pool);
 
-/* //////////////////////////////////////////////////////////////////////////////////////
- * private implementation
- */
+    // make it from the pool if no recycled edges
+    gb_mesh_edge_ref_t edge = impl->cache;
+    if (!edge) edge = (gb_mesh_edge_ref_t)tb_fixed_pool_malloc0(impl->pool);
+    else
+    {
+        // reuse the recycled edge
+        impl->cache = edge->next;
+        tb_memset(edge, 0, impl->edge_size << 1);
+    }
+
+    // update the edges count
+    if (edge) impl->size++;
+
+    // ok?
+    return edge;
+}
 static __tb_inline__ tb_void_t gb_mesh_edge_init(gb_mesh_edge_ref_t edge)
 {
     // check
@@ -281,8 +312,14 @@ gb_mesh_edge_list_ref_t gb_mesh_edge_list_init(tb_element_t element)
         impl->itor.next = gb_mesh_edge_itor_next;
         impl->itor.item = gb_mesh_edge_itor_item;
 
-        // init pool, item = (edge + data) + (edge->sym + data)
-        impl->pool = tb_fixed_pool_init(tb_null, GB_MESH_EDGE_LIST_GROW, impl->edge_size << 1, tb_null, gb_mesh_edge_exit, (tb_cpointer_t)impl);
+        // the element need not free the user data?
+        impl->trivial = gb_mesh_element_is_trivial(&element);
+
+        /* init pool, item = (edge + data) + (edge->sym + data)
+         *
+         * the user data are freed by the list self, so the pool need not walk the items
+         */
+        impl->pool = tb_fixed_pool_init(tb_null, GB_MESH_EDGE_LIST_GROW, impl->edge_size << 1, tb_null, tb_null, tb_null);
         tb_assert_and_check_break(impl->pool);
 
         // init head edge
@@ -320,6 +357,7 @@ tb_void_t gb_mesh_edge_list_exit(gb_mesh_edge_list_ref_t list)
     // exit pool
     if (impl->pool) tb_fixed_pool_exit(impl->pool);
     impl->pool = tb_null;
+    impl->cache = tb_null;
 
     // exit it
     tb_free(impl);
@@ -330,8 +368,27 @@ tb_void_t gb_mesh_edge_list_clear(gb_mesh_edge_list_ref_t list)
     gb_mesh_edge_list_impl_t* impl = (gb_mesh_edge_list_impl_t*)list;
     tb_assert_and_check_return(impl);
    
-    // clear pool
-    if (impl->pool) tb_fixed_pool_clear(impl->pool);
+    // non-empty?
+    gb_mesh_edge_ref_t head = impl->head;
+    if (head->next != head)
+    {
+        // exit the user data of all edges
+        gb_mesh_edge_ref_t edge = head->next;
+        if (!impl->trivial)
+        {
+            for (; edge != head; edge = edge->next)
+                gb_mesh_edge_exit(impl, edge);
+            edge = head->next;
+        }
+
+        // move all edges to the recycled edges at once
+        gb_mesh_edge_ref_t last = head->sym->next->sym;
+        last->next = impl->cache;
+        impl->cache = edge;
+    }
+
+    // clear size
+    impl->size = 0;
 
     // clear list
     gb_mesh_edge_init(impl->head);
@@ -350,10 +407,10 @@ tb_size_t gb_mesh_edge_list_size(gb_mesh_edge_list_ref_t list)
 {
     // check
     gb_mesh_edge_list_impl_t* impl = (gb_mesh_edge_list_impl_t*)list;
-    tb_assert_and_check_return_val(impl && impl->pool, 0);
+    tb_assert_and_check_return_val(impl, 0);
 
     // the size
-    return tb_fixed_pool_size(impl->pool);
+    return impl->size;
 }
 tb_size_t gb_mesh_edge_list_maxn(gb_mesh_edge_list_ref_t list)
 {
@@ -367,7 +424,7 @@ gb_mesh_edge_ref_t gb_mesh_edge_list_make(gb_mesh_edge_list_ref_t list)
     tb_assert_and_check_return_val(impl && impl->pool, tb_null);
 
     // make it
-    gb_mesh_edge_ref_t edge = (gb_mesh_edge_ref_t)tb_fixed_pool_malloc0(impl->pool);
+    gb_mesh_edge_ref_t edge = gb_mesh_edge_malloc0(impl);
     tb_assert_and_check_return_val(edge, tb_null);
 
     // the sym edge
@@ -415,7 +472,7 @@ gb_mesh_edge_ref_t gb_mesh_edge_list_make_loop(gb_mesh_edge_list_ref_t list, tb_
     tb_assert_and_check_return_val(impl && impl->pool, tb_null);
 
     // make it
-    gb_mesh_edge_ref_t edge = (gb_mesh_edge_ref_t)tb_fixed_pool_malloc0(impl->pool);
+    gb_mesh_edge_ref_t edge = gb_mesh_edge_malloc0(impl);
     tb_assert_and_check_return_val(edge, tb_null);
 
     // the sym edge
@@ -498,8 +555,13 @@ tb_void_t gb_mesh_edge_list_kill(gb_mesh_edge_list_ref_t list, gb_mesh_edge_ref_
     // remove it from the list
     gb_mesh_edge_remove_done(edge);
 
-    // exit it
-    tb_fixed_pool_free(impl->pool, edge);
+    // exit the user data
+    gb_mesh_edge_exit(impl, edge);
+
+    // recycle it
+    edge->next = impl->cache;
+    impl->cache = edge;
+    impl->size--;
 }
 tb_cpointer_t gb_mesh_edge_list_data(gb_mesh_edge_list_ref_t list, gb_mesh_edge_ref_t edge)
 {
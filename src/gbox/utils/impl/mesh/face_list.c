@@ -63,6 +63,12 @@ typedef struct __gb_mesh_face_list_impl_t
     // the pool
     tb_fixed_pool_ref_t         pool;
 
+    // the recycled faces, linked by face->entry.next
+    tb_list_entry_ref_t         cache;
+
+    // the element need not free the user data?
+    tb_bool_t                   trivial;
+
     // the head
     tb_list_entry_head_t        head;
 
@@ -82,14 +88,13 @@ typedef struct __gb_mesh_face_list_impl_t
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
-static tb_void_t gb_mesh_face_exit(tb_pointer_t data, tb_cpointer_t priv)
+static __tb_inline__ tb_void_t gb_mesh_face_exit(gb_mesh_face_list_impl_t* impl, gb_mesh_face_ref_t face)
 {
     // check
-    gb_mesh_face_list_impl_t* impl = (gb_mesh_face_list_impl_t*)priv;
-    tb_assert_and_check_return(impl && data);
+    tb_assert(impl && face);
 
     // exit the user data
-    impl->element.free(&impl->element, (tb_pointer_t)((gb_mesh_face_ref_t)data + 1));
+    if (!impl->trivial) impl->element.free(&impl->element, (tb_pointer_t)gb_mesh_face_user(face));
 }
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -112,8 +117,11 @@ gb_mesh_face_list_ref_t gb_mesh_face_list_init(tb_element_t element)
         // init element
         impl->element = element;
 
-        // init pool, item = face + data
-        impl->pool = tb_fixed_pool_init(tb_null, GB_MESH_FACE_LIST_GROW, sizeof(gb_mesh_face_t) + element.size, tb_null, gb_mesh_face_exit, (tb_cpointer_t)impl);
+        // the element need not free the user data?
+        impl->trivial = gb_mesh_element_is_trivial(&element);
+
+        // init pool, item = face + data, the user data are freed by the list self
+        impl->pool = tb_fixed_pool_init(tb_null, GB_MESH_FACE_LIST_GROW, sizeof(gb_mesh_face_t) + element.size, tb_null, tb_null, tb_null);
         tb_assert_and_check_break(impl->pool);
 
         // init head
@@ -150,6 +158,7 @@ tb_void_t gb_mesh_face_list_exit(gb_mesh_face_list_ref_t list)
     // exit pool
     if (impl->pool) tb_fixed_pool_exit(impl->pool);
     impl->pool = tb_null;
+    impl->cache = tb_null;
 
     // exit it
     tb_free(impl);
@@ -160,8 +169,23 @@ tb_void_t gb_mesh_face_list_clear(gb_mesh_face_list_ref_t list)
     gb_mesh_face_list_impl_t* impl = (gb_mesh_face_list_impl_t*)list;
     tb_assert_and_check_return(impl);
    
-    // clear pool
-    if (impl->pool) tb_fixed_pool_clear(impl->pool);
+    // non-empty?
+    if (tb_list_entry_size(&impl->head))
+    {
+        // exit the user data of all faces
+        tb_list_entry_ref_t head = (tb_list_entry_ref_t)&impl->head;
+        tb_list_entry_ref_t entry = head->next;
+        if (!impl->trivial)
+        {
+            for (; entry != head; entry = entry->next)
+                gb_mesh_face_exit(impl, (gb_mesh_face_ref_t)tb_list_entry(&impl->head, entry));
+            entry = head->next;
+        }
+
+        // move all faces to the recycled faces at once
+        head->prev->next = impl->cache;
+        impl->cache = entry;
+    }
 
     // clear head
     tb_list_entry_clear(&impl->head);
@@ -184,8 +208,7 @@ tb_size_t gb_mesh_face_list_size(gb_mesh_face_list_ref_t list)
 {
     // check
     gb_mesh_face_list_impl_t* impl = (gb_mesh_face_list_impl_t*)list;
-    tb_assert_and_check_return_val(impl && impl->pool, 0);
-    tb_assert(tb_list_entry_size(&impl->head) == tb_fixed_pool_size(impl->pool));
+    tb_assert_and_check_return_val(impl, 0);
 
     // the size
     return tb_list_entry_size(&impl->head);
@@ -202,7 +225,15 @@ gb_mesh_face_ref_t gb_mesh_face_list_make(gb_mesh_face_list_ref_t list)
     tb_assert_and_check_return_val(impl && impl->pool, tb_null);
 
     // make it
-    gb_mesh_face_ref_t face = (gb_mesh_face_ref_t)tb_fixed_pool_malloc0(impl->pool);
+    gb_mesh_face_ref_t face = tb_null;
+    if (impl->cache)
+    {
+        // reuse the recycled face
+        face = (gb_mesh_face_ref_t)tb_list_entry(&impl->head, impl->cache);
+        impl->cache = impl->cache->next;
+        tb_memset(face, 0, sizeof(gb_mesh_face_t) + impl->element.size);
+    }
+    else face = (gb_mesh_face_ref_t)tb_fixed_pool_malloc0(impl->pool);
     tb_assert_and_check_return_val(face, tb_null);
 
 #ifdef __gb_debug__
@@ -258,8 +289,12 @@ tb_void_t gb_mesh_face_list_kill(gb_mesh_face_list_ref_t list, gb_mesh_face_ref_
     // remove from the face list
     tb_list_entry_remove(&impl->head, &face->entry);
 
-    // exit it
-    tb_fixed_pool_free(impl->pool, face);
+    // exit the user data
+    gb_mesh_face_exit(impl, face);
+
+    // recycle it
+    face->entry.next = impl->cache;
+    impl->cache = &face->entry;
 }
 tb_cpointer_t gb_mesh_face_list_data(gb_mesh_face_list_ref_t list, gb_mesh_face_ref_t face)
 {
@@ -29,6 +29,37 @@
 #include "../prefix.h"
 #include "../../mesh.h"
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * inlines
+ */
+
+/* the element need not free the user data?
+ *
+ * the memory and pointer elements without the user free function only release nothing,
+ * so the mesh lists can recycle all items at once without walking them
+ *
+ * @param element   the element
+ *
+ * @return          tb_true or tb_false
+ */
+static __tb_inline__ tb_bool_t gb_mesh_element_is_trivial(tb_element_t const* element)
+{
+    // check
+    tb_assert(element);
+
+    // no free function?
+    tb_check_return_val(element->free, tb_true);
+
+    // the default free function of the memory element?
+    if (element->type == TB_ELEMENT_TYPE_MEM) return element->free == tb_element_mem(element->size, tb_null, tb_null).free;
+
+    // the default free function of the pointer element?
+    if (element->type == TB_ELEMENT_TYPE_PTR) return element->free == tb_element_ptr(tb_null, tb_null).free;
+
+    // the other elements may free the user data
+    return tb_false;
+}
+
 #endif
 
 
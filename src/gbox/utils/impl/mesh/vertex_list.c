@@ -63,6 +63,12 @@ typedef struct __gb_mesh_vertex_list_impl_t
     // the pool
     tb_fixed_pool_ref_t         pool;
 
+    // the recycled vertices, linked by vertex->entry.next
+    tb_list_entry_ref_t         cache;
+
+    // the element need not free the user data?
+    tb_bool_t                   trivial;
+
     // the head
     tb_list_entry_head_t        head;
 
@@ -82,14 +88,13 @@ typedef struct __gb_mesh_vertex_list_impl_t
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
-static tb_void_t gb_mesh_vertex_exit(tb_pointer_t data, tb_cpointer_t priv)
+static __tb_inline__ tb_void_t gb_mesh_vertex_exit(gb_mesh_vertex_list_impl_t* impl, gb_mesh_vertex_ref_t vertex)
 {
     // check
-    gb_mesh_vertex_list_impl_t* impl = (gb_mesh_vertex_list_impl_t*)priv;
-    tb_assert_and_check_return(impl && data);
+    tb_assert(impl && vertex);
 
     // exit the user data
-    impl->element.free(&impl->element, (tb_pointer_t)((gb_mesh_vertex_ref_t)data + 1));
+    if (!impl->trivial) impl->element.free(&impl->element, (tb_pointer_t)gb_mesh_vertex_user(vertex));
 }
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -112,8 +117,11 @@ gb_mesh_vertex_list_ref_t gb_mesh_vertex_list_init(tb_element_t element)
         // init element
         impl->element = element;
 
-        // init pool, item = vertex + data
-        impl->pool = tb_fixed_pool_init(tb_null, GB_MESH_VERTEX_LIST_GROW, sizeof(gb_mesh_vertex_t) + element.size, tb_null, gb_mesh_vertex_exit, (tb_cpointer_t)impl);
+        // the element need not free the user data?
+        impl->trivial = gb_mesh_element_is_trivial(&element);
+
+        // init pool, item = vertex + data, the user data are freed by the list self
+        impl->pool = tb_fixed_pool_init(tb_null, GB_MESH_VERTEX_LIST_GROW, sizeof(gb_mesh_vertex_t) + element.size, tb_null, tb_null, tb_null);
         tb_assert_and_check_break(impl->pool);
 
         // init head
@@ -150,6 +158,7 @@ tb_void_t gb_mesh_vertex_list_exit(gb_mesh_vertex_list_ref_t list)
     // exit pool
     if (impl->pool) tb_fixed_pool_exit(impl->pool);
     impl->pool = tb_null;
+    impl->cache = tb_null;
 
     // exit it
     tb_free(impl);
@@ -160,8 +169,23 @@ tb_void_t gb_mesh_vertex_list_clear(gb_mesh_vertex_list_ref_t list)
     gb_mesh_vertex_list_impl_t* impl = (gb_mesh_vertex_list_impl_t*)list;
     tb_assert_and_check_return(impl);
    
-    // clear pool
-    if (impl->pool) tb_fixed_pool_clear(impl->pool);
+    // non-empty?
+    if (tb_list_entry_size(&impl->head))
+    {
+        // exit the user data of all vertices
+        tb_list_entry_ref_t head = (tb_list_entry_ref_t)&impl->head;
+        tb_list_entry_ref_t entry = head->next;
+        if (!impl->trivial)
+        {
+            for (; entry != head; entry = entry->next)
+                gb_mesh_vertex_exit(impl, (gb_mesh_vertex_ref_t)tb_list_entry(&impl->head, entry));
+            entry = head->next;
+        }
+
+        // move all vertices to the recycled vertices at once
+        head->prev->next = impl->cache;
+        impl->cache = entry;
+    }
 
     // clear head
     tb_list_entry_clear(&impl->head);
@@ -184,8 +208,7 @@ tb_size_t gb_mesh_vertex_list_size(gb_mesh_vertex_list_ref_t list)
 {
     // check
     gb_mesh_vertex_list_impl_t* impl = (gb_mesh_vertex_list_impl_t*)list;
-    tb_assert_and_check_return_val(impl && impl->pool, 0);
-    tb_assert(tb_list_entry_size(&impl->head) == tb_fixed_pool_size(impl->pool));
+    tb_assert_and_check_return_val(impl, 0);
 
     // the size
     return tb_list_entry_size(&impl->head);
@@ -202,7 +225,15 @@ gb_mesh_vertex_ref_t gb_mesh_vertex_list_make(gb_mesh_vertex_list_ref_t list)
     tb_assert_and_check_return_val(impl && impl->pool, tb_null);
 
     // make it
-    gb_mesh_vertex_ref_t vertex = (gb_mesh_vertex_ref_t)tb_fixed_pool_malloc0(impl->pool);
+    gb_mesh_vertex_ref_t vertex = tb_null;
+    if (impl->cache)
+    {
+        // reuse the recycled vertex
+        vertex = (gb_mesh_vertex_ref_t)tb_list_entry(&impl->head, impl->cache);
+        impl->cache = impl->cache->next;
+        tb_memset(vertex, 0, sizeof(gb_mesh_vertex_t) + impl->element.size);
+    }
+    else vertex = (gb_mesh_vertex_ref_t)tb_fixed_pool_malloc0(impl->pool);
     tb_assert_and_check_return_val(vertex, tb_null);
 
 #ifdef __gb_debug__
@@ -258,8 +289,12 @@ tb_void_t gb_mesh_vertex_list_kill(gb_mesh_vertex_list_ref_t list, gb_mesh_verte
     // remove from the vertex list
     tb_list_entry_remove(&impl->head, &vertex->entry);
 
-    // exit it
-    tb_fixed_pool_free(impl->pool, vertex);
+    // exit the user data
+    gb_mesh_vertex_exit(impl, vertex);
+
+    // recycle it
+    vertex->entry.next = impl->cache;
+    impl->cache = &vertex->entry;
 }
 tb_cpointer_t gb_mesh_vertex_list_data(gb_mesh_vertex_list_ref_t list, gb_mesh_vertex_ref_t vertex)
 {
@@ -316,6 +316,7 @@ static tb_void_t gb_tessellator_active_regions_insert_bounds(gb_tessellator_impl
     region.edge     = edge;
     region.winding  = 0;
     region.inside   = 0;
+    region.dirty    = 0;
     region.fixedge  = 0;
     region.bounds   = 1;
 
@@ -349,6 +350,8 @@ static tb_void_t gb_tessellator_active_regions_test_insert(gb_tessellator_impl_t
     region.edge     = edge;
     region.winding  = 0;
     region.inside   = 0;
+    region.dirty    = 0;
+    region.fixedge  = 0;
     region.bounds   = 1;
 
     // insert region
@@ -419,14 +422,11 @@ tb_bool_t gb_tessellator_active_regions_make(gb_tessellator_impl_t* impl, gb_rec
         element.cstr = gb_tessellator_active_region_cstr;
 
         // register printf("%{tess_region}", region);
-        static tb_bool_t s_is_registered = tb_false;
-        if (!s_is_registered)
+        static tb_atomic_t s_is_registered = 0;
+        if (!tb_atomic_fetch_and_set(&s_is_registered, 1))
         {
             // register it
             tb_printf_object_register("tess_region", gb_tessellator_active_region_printf);
-
-            // ok
-            s_is_registered = tb_true;
         }
 #endif
 
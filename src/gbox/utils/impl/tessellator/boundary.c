@@ -0,0 +1,57 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2009 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        boundary.c
+ * @ingroup     utils
+ */
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * trace
+ */
+#define TB_TRACE_MODULE_NAME            "boundary"
+#define TB_TRACE_MODULE_DEBUG           (1)
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "boundary.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+tb_void_t gb_tessellator_boundary_make(gb_tessellator_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->mesh);
+
+    // done
+    tb_for_all_if (gb_mesh_edge_ref_t, edge, gb_mesh_edge_itor(impl->mesh), edge)
+    {
+        // the inside of the left and right face
+        tb_bool_t lface_inside = gb_tessellator_face_inside(gb_mesh_edge_lface(edge));
+        tb_bool_t rface_inside = gb_tessellator_face_inside(gb_mesh_edge_rface(edge));
+
+        /* mark the edge and its sym edge
+         *
+         * only the edge with the inside region on its left is marked
+         */
+        gb_tessellator_edge_winding_set(edge, lface_inside && !rface_inside);
+        gb_tessellator_edge_winding_set(gb_mesh_edge_sym(edge), rface_inside && !lface_inside);
+    }
+}
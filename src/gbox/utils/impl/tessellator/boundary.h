@@ -0,0 +1,56 @@
+/*!The Graphic Box Library
+ * 
+ * GBox is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ * 
+ * GBox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with GBox; 
+ * If not, see <a href="http://www.gnu.org/licenses/"> http://www.gnu.org/licenses/</a>
+ * 
+ * Copyright (C) 2009 - 2015, ruki All rights reserved.
+ *
+ * @author      ruki
+ * @file        boundary.h
+ * @ingroup     utils
+ */
+#ifndef GB_UTILS_IMPL_TESSELLATOR_BOUNDARY_H
+#define GB_UTILS_IMPL_TESSELLATOR_BOUNDARY_H
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+#include "prefix.h"
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_enter__
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * interfaces
+ */
+
+/* mark the boundary edges for mesh after making monotone regions
+ *
+ * the winding of the edge is set to 1 if its left face is inside and its right face is outside, 
+ * otherwise it is set to 0, so the boundary contours can be traced from the marked edges without merging faces.
+ *   
+ * @param impl      the tessellator impl
+ */
+tb_void_t           gb_tessellator_boundary_make(gb_tessellator_impl_t* impl);
+
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * extern
+ */
+__tb_extern_c_leave__
+
+#endif
+
+
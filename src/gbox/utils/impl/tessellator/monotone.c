@@ -64,9 +64,12 @@ static __tb_inline__ tb_uint8_t gb_tessellator_winding_is_inside(gb_tessellator_
     // done
     switch (impl->rule)
     {
-        case GB_TESSELLATOR_RULE_ODD:       return (winding & 1);
-        case GB_TESSELLATOR_RULE_NONZERO:   return (winding != 0);
-        default:                            break;
+        case GB_TESSELLATOR_RULE_ODD:           return (winding & 1);
+        case GB_TESSELLATOR_RULE_NONZERO:       return (winding != 0);
+        case GB_TESSELLATOR_RULE_POSITIVE:      return (winding > 0);
+        case GB_TESSELLATOR_RULE_NEGATIVE:      return (winding < 0);
+        case GB_TESSELLATOR_RULE_ABS_GEQ_TWO:   return (winding >= 2 || winding <= -2);
+        default:                                break;
     }
 
     // error
@@ -2085,6 +2088,9 @@ static tb_bool_t gb_tessellator_fix_region_intersection(gb_tessellator_impl_t* i
         gb_tessellator_profiler_add_inter(gb_mesh_edge_org(edge_right));
 #endif
 
+        // update the intersections count of the stats
+        impl->stats.intersections++;
+
         // insert the new intersection vertex to the event queue
         gb_tessellator_event_queue_insert(impl, gb_mesh_edge_org(edge_right));
 
@@ -2582,6 +2588,7 @@ static gb_tessellator_active_region_ref_t gb_tessellator_insert_region_at_right(
     region.edge     = edge_new;
     region.winding  = 0;
     region.inside   = 0;
+    region.dirty    = 0;
     region.bounds   = 0;
     region.fixedge  = 0;
 
@@ -4380,8 +4387,12 @@ tb_void_t gb_tessellator_monotone_make(gb_tessellator_impl_t* impl, gb_rect_ref_
     tb_assert(event_queue);
 
     // done
-    while (tb_priority_queue_size(event_queue))
+    tb_size_t size = 0;
+    while ((size = tb_priority_queue_size(event_queue)))
     {
+        // update the maximum size of the event queue for the stats
+        if (size > impl->stats.events) impl->stats.events = size;
+
         // get the minimum vertex event
         gb_mesh_vertex_ref_t event = (gb_mesh_vertex_ref_t)tb_priority_queue_get(event_queue);
         tb_assert(event);
@@ -4425,6 +4436,10 @@ tb_void_t gb_tessellator_monotone_make(gb_tessellator_impl_t* impl, gb_rect_ref_
 
         // sweep this event
         gb_tessellator_sweep_event(impl, event);
+
+        // update the maximum count of the active regions for the stats
+        size = tb_list_size(impl->active_regions);
+        if (size > impl->stats.regions) impl->stats.regions = size;
     }
 
     // remove degenerate faces
@@ -152,6 +152,12 @@ typedef struct __gb_tessellator_vertex_t
     // the point
     gb_point_t                          point;
 
+    // the output index for the indexed mode
+    tb_uint16_t                         index;
+
+    // the output batch of the index, the index is invalid if it is not the current batch
+    tb_uint16_t                         batch;
+
 } gb_tessellator_vertex_t, *gb_tessellator_vertex_ref_t;
 
 // the tessellator impl type
@@ -169,6 +175,12 @@ typedef struct __gb_tessellator_impl_t
     // the user private data
     tb_cpointer_t                       priv;
 
+    // the indexed func
+    gb_tessellator_indexed_func_t       indexed_func;
+
+    // the indexed private data
+    tb_cpointer_t                       indexed_priv;
+
     // the mesh
     gb_mesh_ref_t                       mesh;
 
@@ -178,12 +190,27 @@ typedef struct __gb_tessellator_impl_t
     // the output points
     tb_vector_ref_t                     outputs;
 
+    // the output indices for the indexed mode
+    tb_vector_ref_t                     indices;
+
+    // the current output batch for the indexed mode
+    tb_uint16_t                         batch;
+
     // the event queue for vertex
     tb_priority_queue_ref_t             event_queue;
 
     // the active regions
     tb_list_ref_t                       active_regions;
 
+    // the stats func
+    gb_tessellator_stats_func_t         stats_func;
+
+    // the stats private data
+    tb_cpointer_t                       stats_priv;
+
+    // the stats of the current polygon
+    gb_tessellator_stats_t              stats;
+
 }gb_tessellator_impl_t;
 
 #endif
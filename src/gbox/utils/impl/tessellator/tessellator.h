@@ -28,6 +28,7 @@
  */
 #include "mesh.h"
 #include "convex.h"
+#include "boundary.h"
 #include "geometry.h"
 #include "monotone.h"
 #include "triangulation.h"
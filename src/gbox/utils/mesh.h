@@ -377,7 +377,13 @@ gb_mesh_ref_t                   gb_mesh_init(tb_element_t edge_element, tb_eleme
  */
 tb_void_t                       gb_mesh_exit(gb_mesh_ref_t mesh);
 
-/*! clear the mesh 
+/*! clear the mesh
+ *
+ * the edges, faces and vertices are kept for the next making and are not returned to the pools,
+ * the user data is freed only if the elements have the user free function.
+ *
+ * the edges, faces and vertices are still the pointer-based half-edge items,
+ * so clearing it will not compact them.
  *
  * @param mesh                  the mesh
  */
@@ -47,6 +47,17 @@
 /* //////////////////////////////////////////////////////////////////////////////////////
  * private implementation
  */
+static __tb_inline__ tb_void_t gb_tessellator_stats_phase(gb_tessellator_impl_t* impl, tb_hong_t* phase, tb_hong_t* time)
+{
+    // stats is enabled?
+    if (impl->stats_func)
+    {
+        // add the spent time to this phase and start the next phase
+        tb_hong_t now = tb_uclock();
+        *phase += now - *time;
+        *time = now;
+    }
+}
 static tb_void_t gb_tessellator_done_output(gb_tessellator_impl_t* impl)
 {
     // check
@@ -101,23 +112,262 @@ static tb_void_t gb_tessellator_done_output(gb_tessellator_impl_t* impl)
 
                 // done it
                 impl->func((gb_point_ref_t)tb_vector_data(outputs), (tb_uint16_t)tb_vector_size(outputs), impl->priv);
+
+                // update the outputs count
+                impl->stats.outputs++;
+            }
+        }
+    }
+}
+static tb_void_t gb_tessellator_done_boundary_output(gb_tessellator_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->mesh && impl->func);
+
+    // init outputs first
+    if (!impl->outputs) impl->outputs = tb_vector_init(GB_TESSELLATOR_OUTPUTS_GROW, tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
+
+    // check outputs
+    tb_vector_ref_t outputs = impl->outputs;
+    tb_assert(outputs);
+
+    // done
+    tb_for_all_if (gb_mesh_edge_ref_t, edge_start, gb_mesh_edge_itor(impl->mesh), edge_start)
+    {
+        // trace the contours from the marked edge and its sym edge
+        tb_size_t i = 0;
+        for (i = 0; i < 2; i++)
+        {
+            // the head edge is marked?
+            gb_mesh_edge_ref_t head = i? gb_mesh_edge_sym(edge_start) : edge_start;
+            tb_check_continue(gb_tessellator_edge_winding(head));
+
+            // clear outputs
+            tb_vector_clear(outputs);
+
+            // make contour
+            gb_mesh_edge_ref_t edge = head;
+            do
+            {
+                // append point and unmark this edge
+                tb_vector_insert_tail(outputs, gb_tessellator_vertex_point(gb_mesh_edge_org(edge)));
+                gb_tessellator_edge_winding_set(edge, 0);
+
+                /* the next boundary edge leaving the destination
+                 *
+                 * rotate around the destination through the inside faces until the right face is outside
+                 *
+                 *           inside
+                 *  edge  .          
+                 * ----> dst ----> lnext 
+                 *        .   .    (the right face is inside? skip it)
+                 *        .      .
+                 *       next      
+                 *
+                 */
+                edge = gb_mesh_edge_lnext(edge);
+                while (!gb_tessellator_edge_winding(edge) && edge != head && gb_tessellator_face_inside(gb_mesh_edge_rface(edge)))
+                    edge = gb_mesh_edge_lnext(gb_mesh_edge_sym(edge));
+
+            } while (edge != head && gb_tessellator_edge_winding(edge));
+
+            // exists valid contour?
+            if (tb_vector_size(outputs) > 2)
+            {
+                // append the first point for closing the contour
+                tb_vector_insert_tail(outputs, gb_tessellator_vertex_point(gb_mesh_edge_org(head)));
+
+                // done it
+                impl->func((gb_point_ref_t)tb_vector_data(outputs), (tb_uint16_t)tb_vector_size(outputs), impl->priv);
+
+                // update the outputs count
+                impl->stats.outputs++;
             }
         }
     }
 }
+static tb_void_t gb_tessellator_done_indexed_flush(gb_tessellator_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->indexed_func && impl->outputs && impl->indices);
+
+    // exists triangles?
+    tb_size_t indices_count = tb_vector_size(impl->indices);
+    if (indices_count)
+    {
+        // done it
+        impl->indexed_func((gb_point_ref_t)tb_vector_data(impl->outputs), tb_vector_size(impl->outputs), (tb_uint16_t const*)tb_vector_data(impl->indices), indices_count, impl->indexed_priv);
+
+        // update the outputs count
+        impl->stats.outputs += indices_count / 3;
+    }
+
+    // clear outputs and indices 
+    tb_vector_clear(impl->outputs);
+    tb_vector_clear(impl->indices);
+
+    // start the next batch and all indices of the mesh vertices will be invalid
+    impl->batch++;
+}
+static tb_bool_t gb_tessellator_done_indexed_init(gb_tessellator_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->indexed_func);
+
+    // init outputs and indices first
+    if (!impl->outputs) impl->outputs = tb_vector_init(GB_TESSELLATOR_OUTPUTS_GROW, tb_element_mem(sizeof(gb_point_t), tb_null, tb_null));
+    if (!impl->indices) impl->indices = tb_vector_init(GB_TESSELLATOR_OUTPUTS_GROW, tb_element_mem(sizeof(tb_uint16_t), tb_null, tb_null));
+    tb_assert_and_check_return_val(impl->outputs && impl->indices, tb_false);
+
+    // clear outputs and indices
+    tb_vector_clear(impl->outputs);
+    tb_vector_clear(impl->indices);
+
+    /* start the first batch
+     *
+     * the mesh vertices are cleared for each polygon and their batch is zero,
+     * so the index of the mesh vertex is invalid before it is appended into the current batch
+     */
+    impl->batch = 1;
+
+    // ok
+    return tb_true;
+}
+static tb_void_t gb_tessellator_done_indexed_fan(gb_tessellator_impl_t* impl, tb_uint16_t first, tb_size_t count)
+{
+    // check
+    tb_assert(impl && impl->indices && count > 2);
+
+    // make triangles from the fan: (first, first + i, first + i + 1)
+    tb_size_t       i = 1;
+    tb_uint16_t     triangle[3];
+    tb_vector_ref_t indices = impl->indices;
+    for (i = 1; i + 1 < count; i++)
+    {
+        triangle[0] = first;
+        triangle[1] = (tb_uint16_t)(first + i);
+        triangle[2] = (tb_uint16_t)(first + i + 1);
+        tb_vector_insert_tail(indices, &triangle[0]);
+        tb_vector_insert_tail(indices, &triangle[1]);
+        tb_vector_insert_tail(indices, &triangle[2]);
+    }
+}
+static tb_void_t gb_tessellator_done_indexed_contour(gb_tessellator_impl_t* impl, gb_point_ref_t points, tb_size_t count)
+{
+    // check
+    tb_assert(impl && impl->outputs && points);
+
+    // ignore the last point for closing the contour
+    if (count > 1 && gb_point_eq(points, points + count - 1)) count--;
+    tb_check_return(count > 2);
+
+    // flush the current batch if the indices will overflow
+    if (tb_vector_size(impl->outputs) + count > GB_TESSELLATOR_INDEXED_MAXN) gb_tessellator_done_indexed_flush(impl);
+
+    // append points
+    tb_size_t       i = 0;
+    tb_uint16_t     first = (tb_uint16_t)tb_vector_size(impl->outputs);
+    for (i = 0; i < count; i++) tb_vector_insert_tail(impl->outputs, points + i);
+
+    // make triangles
+    gb_tessellator_done_indexed_fan(impl, first, count);
+}
+static tb_void_t gb_tessellator_done_indexed_output(gb_tessellator_impl_t* impl)
+{
+    // check
+    tb_assert(impl && impl->mesh && impl->outputs && impl->indices);
+
+    // done
+    tb_vector_ref_t outputs = impl->outputs;
+    tb_vector_ref_t indices = impl->indices;
+    tb_for_all_if (gb_mesh_face_ref_t, face, gb_mesh_face_itor(impl->mesh), face)
+    {
+        // the face is not inside? skip it
+        tb_check_continue(gb_tessellator_face_inside(face));
+
+        // the points count of this face, only three points for the triangulated face
+        gb_mesh_edge_ref_t  head    = gb_mesh_face_edge(face);
+        gb_mesh_edge_ref_t  edge    = head;
+        tb_size_t           count   = 0;
+        do
+        {
+            count++;
+            edge = gb_mesh_edge_lnext(edge);
+
+        } while (edge != head);
+        tb_check_continue(count > 2);
+
+        /* flush the current batch if the indices will overflow
+         *
+         * the shared vertices will be appended into the next batch again
+         */
+        if (tb_vector_size(outputs) + count > GB_TESSELLATOR_INDEXED_MAXN) gb_tessellator_done_indexed_flush(impl);
+
+        // make the triangles from the fan of this face
+        tb_size_t   i = 0;
+        tb_uint16_t first = 0;
+        tb_uint16_t index[2] = {0, 0};
+        do
+        {
+            // the vertex
+            gb_tessellator_vertex_ref_t vertex = gb_tessellator_vertex(gb_mesh_edge_org(edge));
+            tb_assert(vertex);
+
+            // append the point if it has not been appended into the current batch
+            if (vertex->batch != impl->batch)
+            {
+                vertex->index = (tb_uint16_t)tb_vector_size(outputs);
+                vertex->batch = impl->batch;
+                tb_vector_insert_tail(outputs, &vertex->point);
+            }
+
+            // append the triangle: (first, prev, current)
+            if (!i) first = vertex->index;
+            else if (i > 1)
+            {
+                index[1] = vertex->index;
+                tb_vector_insert_tail(indices, &first);
+                tb_vector_insert_tail(indices, &index[0]);
+                tb_vector_insert_tail(indices, &index[1]);
+            }
+            index[0] = vertex->index;
+
+            // the next edge
+            edge = gb_mesh_edge_lnext(edge);
+            i++;
+
+        } while (edge != head);
+    }
+}
 static tb_void_t gb_tessellator_done_convex(gb_tessellator_impl_t* impl, gb_polygon_ref_t polygon, gb_rect_ref_t bounds)
 {
     // check
-    tb_assert(impl && impl->func && polygon && bounds);
+    tb_assert(impl && polygon && bounds);
 
     // only one convex contour
     tb_assert(polygon->convex && polygon->counts && !polygon->counts[1]);
 
+    // the start time
+    tb_hong_t time = impl->stats_func? tb_uclock() : 0;
+
     // make convex or monotone? done it directly
     if (impl->mode == GB_TESSELLATOR_MODE_CONVEX || impl->mode == GB_TESSELLATOR_MODE_MONOTONE)
     {
         // done it
         impl->func(polygon->points, polygon->counts[0], impl->priv);
+        impl->stats.outputs++;
+        gb_tessellator_stats_phase(impl, &impl->stats.output, &time);
+
+        // ok
+        return ;
+    }
+
+    // make the indexed triangles? append the fan of this contour directly
+    if (impl->mode == GB_TESSELLATOR_MODE_INDEXED)
+    {
+        // done it
+        gb_tessellator_done_indexed_contour(impl, polygon->points, polygon->counts[0]);
+        gb_tessellator_stats_phase(impl, &impl->stats.output, &time);
 
         // ok
         return ;
@@ -128,6 +378,7 @@ static tb_void_t gb_tessellator_done_convex(gb_tessellator_impl_t* impl, gb_poly
 
     // make mesh
     if (!gb_tessellator_mesh_make(impl, polygon)) return ;
+    gb_tessellator_stats_phase(impl, &impl->stats.mesh, &time);
 
     // only two faces
     gb_mesh_ref_t mesh = impl->mesh;
@@ -138,37 +389,56 @@ static tb_void_t gb_tessellator_done_convex(gb_tessellator_impl_t* impl, gb_poly
 
     // make triangulation region
     gb_tessellator_triangulation_make(impl);
+    gb_tessellator_stats_phase(impl, &impl->stats.triangulation, &time);
 
     // done output
     gb_tessellator_done_output(impl);
+    gb_tessellator_stats_phase(impl, &impl->stats.output, &time);
 }
 static tb_void_t gb_tessellator_done_concave(gb_tessellator_impl_t* impl, gb_polygon_ref_t polygon, gb_rect_ref_t bounds)
 { 
     // check
-    tb_assert(impl && polygon && !polygon->convex && bounds);
+    tb_assert(impl && polygon && (!polygon->convex || impl->mode == GB_TESSELLATOR_MODE_BOUNDARY) && bounds);
+
+    // the start time
+    tb_hong_t time = impl->stats_func? tb_uclock() : 0;
 
     // make mesh
     if (!gb_tessellator_mesh_make(impl, polygon)) return ;
+    gb_tessellator_stats_phase(impl, &impl->stats.mesh, &time);
 
     // make horizontal monotone region
     gb_tessellator_monotone_make(impl, bounds);
+    gb_tessellator_stats_phase(impl, &impl->stats.monotone, &time);
+
+    // make boundary? mark the boundary edges
+    if (impl->mode == GB_TESSELLATOR_MODE_BOUNDARY)
+    {
+        gb_tessellator_boundary_make(impl);
+        gb_tessellator_stats_phase(impl, &impl->stats.convex_merge, &time);
+    }
 
     // need make convex or triangulation polygon?
-    if (impl->mode == GB_TESSELLATOR_MODE_CONVEX || impl->mode == GB_TESSELLATOR_MODE_TRIANGULATION)
+    if (impl->mode == GB_TESSELLATOR_MODE_CONVEX || impl->mode == GB_TESSELLATOR_MODE_TRIANGULATION || impl->mode == GB_TESSELLATOR_MODE_INDEXED)
     {
         // make triangulation region for each horizontal monotone region
         gb_tessellator_triangulation_make(impl);
+        gb_tessellator_stats_phase(impl, &impl->stats.triangulation, &time);
 
         // make convex? 
         if (impl->mode == GB_TESSELLATOR_MODE_CONVEX)
         {
             // merge triangles to the convex polygon
             gb_tessellator_convex_make(impl);
+            gb_tessellator_stats_phase(impl, &impl->stats.convex_merge, &time);
         }
     }
 
     // done output
-    gb_tessellator_done_output(impl);
+    if (impl->mode == GB_TESSELLATOR_MODE_INDEXED) gb_tessellator_done_indexed_output(impl);
+    else if (impl->mode == GB_TESSELLATOR_MODE_BOUNDARY) gb_tessellator_done_boundary_output(impl);
+    else gb_tessellator_done_output(impl);
+    gb_tessellator_stats_phase(impl, &impl->stats.output, &time);
 }
 
 /* //////////////////////////////////////////////////////////////////////////////////////
@@ -193,6 +463,10 @@ tb_void_t gb_tessellator_exit(gb_tessellator_ref_t tessellator)
     if (impl->outputs) tb_vector_exit(impl->outputs);
     impl->outputs = tb_null;
 
+    // exit indices
+    if (impl->indices) tb_vector_exit(impl->indices);
+    impl->indices = tb_null;
+
     // exit event queue
     if (impl->event_queue) tb_priority_queue_exit(impl->event_queue);
     impl->event_queue = tb_null;
@@ -232,14 +506,90 @@ tb_void_t gb_tessellator_func_set(gb_tessellator_ref_t tessellator, gb_tessellat
     impl->func = func;
     impl->priv = priv;
 }
+tb_void_t gb_tessellator_indexed_func_set(gb_tessellator_ref_t tessellator, gb_tessellator_indexed_func_t func, tb_cpointer_t priv)
+{
+    // check
+    gb_tessellator_impl_t* impl = (gb_tessellator_impl_t*)tessellator;
+    tb_assert_and_check_return(impl);
+
+    // set indexed func
+    impl->indexed_func = func;
+    impl->indexed_priv = priv;
+}
+tb_void_t gb_tessellator_stats_func_set(gb_tessellator_ref_t tessellator, gb_tessellator_stats_func_t func, tb_cpointer_t priv)
+{
+    // check
+    gb_tessellator_impl_t* impl = (gb_tessellator_impl_t*)tessellator;
+    tb_assert_and_check_return(impl);
+
+    // set stats func
+    impl->stats_func = func;
+    impl->stats_priv = priv;
+}
+tb_bool_t gb_tessellator_stats_dump(gb_tessellator_stats_ref_t stats, tb_stream_ref_t stream)
+{
+    // check
+    tb_assert_and_check_return_val(stats && stream, tb_false);
+
+    // dump it
+    return tb_stream_printf(stream
+            ,   "{\"bounds\":[%f,%f,%f,%f],\"contours\":%lu,\"points\":%lu,\"convex\":%s"
+                ",\"total\":%lld,\"mesh\":%lld,\"monotone\":%lld,\"triangulation\":%lld,\"convex_merge\":%lld,\"output\":%lld"
+                ",\"events\":%lu,\"regions\":%lu,\"intersections\":%lu,\"outputs\":%lu}\n"
+            ,   gb_float_to_tb(stats->bounds.x)
+            ,   gb_float_to_tb(stats->bounds.y)
+            ,   gb_float_to_tb(stats->bounds.w)
+            ,   gb_float_to_tb(stats->bounds.h)
+            ,   stats->contours
+            ,   stats->points
+            ,   stats->convex? "true" : "false"
+            ,   stats->total
+            ,   stats->mesh
+            ,   stats->monotone
+            ,   stats->triangulation
+            ,   stats->convex_merge
+            ,   stats->output
+            ,   stats->events
+            ,   stats->regions
+            ,   stats->intersections
+            ,   stats->outputs) > 0;
+}
 tb_void_t gb_tessellator_done(gb_tessellator_ref_t tessellator, gb_polygon_ref_t polygon, gb_rect_ref_t bounds)
 {
     // check
     gb_tessellator_impl_t* impl = (gb_tessellator_impl_t*)tessellator;
-    tb_assert_abort_and_check_return(impl && impl->func && polygon && polygon->points && polygon->counts && bounds);
+    tb_assert_abort_and_check_return(impl && polygon && polygon->points && polygon->counts && bounds);
+
+    // the indexed mode need the indexed func and the other modes need the func
+    tb_assert_abort_and_check_return(impl->mode == GB_TESSELLATOR_MODE_INDEXED? impl->indexed_func != tb_null : impl->func != tb_null);
+
+    // init the indexed outputs
+    if (impl->mode == GB_TESSELLATOR_MODE_INDEXED && !gb_tessellator_done_indexed_init(impl)) return ;
+
+    // init stats
+    tb_hong_t time = 0;
+    tb_memset(&impl->stats, 0, sizeof(gb_tessellator_stats_t));
+    if (impl->stats_func)
+    {
+        // the polygon info
+        tb_uint16_t* counts = polygon->counts;
+        while (*counts) 
+        {
+            impl->stats.points += *counts++;
+            impl->stats.contours++;
+        }
+        impl->stats.bounds = *bounds;
+        impl->stats.convex = polygon->convex;
+
+        // the start time
+        time = tb_uclock();
+    }
 
-    // is convex polygon for each contour?
-    if (polygon->convex)
+    /* is convex polygon for each contour?
+     *
+     * the boundary contours need be oriented by the sweep, so the convex polygon is not done directly
+     */
+    if (polygon->convex && impl->mode != GB_TESSELLATOR_MODE_BOUNDARY)
     {
         // done
         tb_size_t       index               = 0;
@@ -264,4 +614,22 @@ tb_void_t gb_tessellator_done(gb_tessellator_ref_t tessellator, gb_polygon_ref_t
         // done tessellator for the concave polygon
         gb_tessellator_done_concave(impl, polygon, bounds);
     }
+
+    // done the indexed triangles of the whole polygon at once
+    if (impl->mode == GB_TESSELLATOR_MODE_INDEXED)
+    {
+        // the start time
+        tb_hong_t flush = impl->stats_func? tb_uclock() : 0;
+
+        // flush the last batch
+        gb_tessellator_done_indexed_flush(impl);
+        gb_tessellator_stats_phase(impl, &impl->stats.output, &flush);
+    }
+
+    // report stats
+    if (impl->stats_func)
+    {
+        impl->stats.total = tb_uclock() - time;
+        impl->stats_func(&impl->stats, impl->stats_priv);
+    }
 }
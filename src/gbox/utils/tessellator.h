@@ -89,6 +89,13 @@ __tb_extern_c_enter__
  *     7. get the monotone regions with the left face marked "inside"
  */
 
+/* //////////////////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+// the maximum points count of the indexed batch
+#define GB_TESSELLATOR_INDEXED_MAXN             (TB_MAXU16)
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * types
  */
@@ -96,20 +103,35 @@ __tb_extern_c_enter__
 /*! the polygon tessellator mode enum
  *
  * monotone > convex > triangulation
+ *
+ * the indexed mode makes triangles too, but all triangles of the polygon share one vertex array 
+ * and will be passed to the indexed func with the triangle indices at once.
+ *
+ * the boundary mode makes the merged outline and hole contours of the inside region,
+ * the outline contours are counter-clockwise and the hole contours are clockwise in the screen coordinate,
+ * so the contours are not overlapped and each inside point has the winding -1 if they are tessellated again.
  */
 typedef enum __gb_tessellator_mode_e
 {
     GB_TESSELLATOR_MODE_CONVEX          = 0     //!< make convex polygon
 ,   GB_TESSELLATOR_MODE_MONOTONE        = 1     //!< make monotone polygon
 ,   GB_TESSELLATOR_MODE_TRIANGULATION   = 2     //!< make triangle 
+,   GB_TESSELLATOR_MODE_INDEXED         = 3     //!< make the indexed triangles
+,   GB_TESSELLATOR_MODE_BOUNDARY        = 4     //!< make the boundary contours
 
 }gb_tessellator_mode_e;
 
-/// the polygon tessellator rule enum
+/*! the polygon tessellator rule enum
+ *
+ * the positive, negative and abs-geq-two rules are used to combine the boundary contours, e.g. for the path operations.
+ */
 typedef enum __gb_tessellator_rule_e
 {
     GB_TESSELLATOR_RULE_ODD             = GB_PAINT_FILL_RULE_ODD     //!< the odd rule 
 ,   GB_TESSELLATOR_RULE_NONZERO         = GB_PAINT_FILL_RULE_NONZERO //!< the non-zero rule 
+,   GB_TESSELLATOR_RULE_POSITIVE        = 2                          //!< the positive rule: winding > 0
+,   GB_TESSELLATOR_RULE_NEGATIVE        = 3                          //!< the negative rule: winding < 0
+,   GB_TESSELLATOR_RULE_ABS_GEQ_TWO     = 4                          //!< the abs-geq-two rule: |winding| >= 2
 
 }gb_tessellator_rule_e;
 
@@ -124,6 +146,73 @@ typedef struct{}*       gb_tessellator_ref_t;
  */
 typedef tb_void_t       (*gb_tessellator_func_t)(gb_point_ref_t points, tb_uint16_t count, tb_cpointer_t priv);
 
+/*! the polygon tessellator indexed func type
+ *
+ * the triangles are passed by three indices for each triangle,
+ * a huge polygon will be passed in several batches if the points count exceeds GB_TESSELLATOR_INDEXED_MAXN.
+ *
+ * @param points        the shared points of the triangles
+ * @param points_count  the points count
+ * @param indices       the point indices of the triangles
+ * @param indices_count the indices count
+ * @param priv          the user private data
+ */
+typedef tb_void_t       (*gb_tessellator_indexed_func_t)(gb_point_ref_t points, tb_size_t points_count, tb_uint16_t const* indices, tb_size_t indices_count, tb_cpointer_t priv);
+
+/// the polygon tessellator stats type
+typedef struct __gb_tessellator_stats_t
+{
+    /// the polygon bounds
+    gb_rect_t           bounds;
+
+    /// the contours count of the polygon
+    tb_size_t           contours;
+
+    /// the points count of the polygon
+    tb_size_t           points;
+
+    /// is convex polygon?
+    tb_bool_t           convex;
+
+    /// the total time, us
+    tb_hong_t           total;
+
+    /// the time of making mesh, us
+    tb_hong_t           mesh;
+
+    /// the time of making monotone regions, us
+    tb_hong_t           monotone;
+
+    /// the time of triangulating the monotone regions, us
+    tb_hong_t           triangulation;
+
+    /// the time of merging triangles into the convex polygons or merging the boundary regions, us
+    tb_hong_t           convex_merge;
+
+    /// the time of making the output polygons and calling the tessellator func, us
+    tb_hong_t           output;
+
+    /// the maximum size of the event queue
+    tb_size_t           events;
+
+    /// the maximum count of the active regions
+    tb_size_t           regions;
+
+    /// the intersections count
+    tb_size_t           intersections;
+
+    /// the output polygons count, the triangles count for the indexed mode
+    tb_size_t           outputs;
+
+}gb_tessellator_stats_t, *gb_tessellator_stats_ref_t;
+
+/*! the polygon tessellator stats func type
+ *
+ * @param stats         the stats of the tessellated polygon
+ * @param priv          the user private data
+ */
+typedef tb_void_t       (*gb_tessellator_stats_func_t)(gb_tessellator_stats_ref_t stats, tb_cpointer_t priv);
+
 /* //////////////////////////////////////////////////////////////////////////////////////
  * interfaces
  */
@@ -162,6 +251,34 @@ tb_void_t               gb_tessellator_rule_set(gb_tessellator_ref_t tessellator
  */
 tb_void_t               gb_tessellator_func_set(gb_tessellator_ref_t tessellator, gb_tessellator_func_t func, tb_cpointer_t priv);
 
+/*! set the tessellator indexed func for the indexed mode
+ *
+ * @param tessellator   the tessellator
+ * @param func          the tessellator indexed func
+ * @param priv          the user private data
+ */
+tb_void_t               gb_tessellator_indexed_func_set(gb_tessellator_ref_t tessellator, gb_tessellator_indexed_func_t func, tb_cpointer_t priv);
+
+/*! set the tessellator stats func
+ *
+ * the stats will be reported for each polygon after it has been tessellated,
+ * it works in the release mode and we can find the pathological inputs from it.
+ *
+ * @param tessellator   the tessellator
+ * @param func          the stats func, disable the stats if be null
+ * @param priv          the user private data
+ */
+tb_void_t               gb_tessellator_stats_func_set(gb_tessellator_ref_t tessellator, gb_tessellator_stats_func_t func, tb_cpointer_t priv);
+
+/*! dump the tessellator stats as one line json
+ *
+ * @param stats         the stats
+ * @param stream        the output stream
+ *
+ * @return              tb_true or tb_false
+ */
+tb_bool_t               gb_tessellator_stats_dump(gb_tessellator_stats_ref_t stats, tb_stream_ref_t stream);
+
 /*! done the tessellator
  *
  * @param tessellator   the tessellator
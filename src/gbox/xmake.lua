@@ -4,7 +4,7 @@ option("fixed")
     set_enable(true)
     set_showmenu(true)
     set_category("option")
-    set_description("Enable or disable the fixed type")
+    set_description("Enable or disable the fixed type", "  the geometry, stroker and tessellator use gb_float_t, the polygon raster always steps the edges in fixed-point")
     add_defines_h_if_ok("$(prefix)_FLOAT_FIXED")
 
 -- add option: bitmap
@@ -57,7 +57,7 @@ target("gbox")
     end
 
     -- add packages
-    add_options("tbox", "opengl", "skia", "png", "jpeg", "freetype", "zlib", "base")
+    add_options("tbox", "opengl", "egl", "skia", "png", "jpeg", "freetype", "zlib", "base")
 
     -- add the common source files
     add_files("*.c")
@@ -65,6 +65,7 @@ target("gbox")
     add_files("platform/*.c")
     add_files("platform/impl/*.c")
     add_files("utils/**.c|impl/tessellator/profiler.c")
+    add_files("svg/**.c")
 
     -- add the source files for debug
     if is_mode("debug") then add_files("utils/impl/tessellator/profiler.c") end
@@ -56,6 +56,9 @@ if is_mode("release", "profile") then
         -- enable the debug symbols
         set_symbols("debug")
 
+        -- add defines to config.h for instrumenting the profiler
+        add_defines_h("$(prefix)_PROFILE")
+
     end
 
     -- smallest?